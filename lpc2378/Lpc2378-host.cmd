@@ -0,0 +1,43 @@
+/* ****************************************************************************************************** */
+/*                                       HOST LINKER SCRIPT                                               */
+/*   B.K. Linux host build (make host) additions to the default host linker script                         */
+/*                                                                                                        */
+/*   Only sections and symbols used by Wall-e SW in addition to standard ones are defined here, they are  */
+/*   inserted into the default linker script of the host (-Wl,-T used together with INSERT).              */
+/*   The same symbols are defined by Lpc2378-rom.cmd for the board.                                       */
+/*                                                                                                        */
+/*   17-Oct-2026 Initial version created                                                                  */
+/* ****************************************************************************************************** */
+
+SECTIONS
+{
+    /* .dbg_str section for tokenized trace messages - message ID is the offset from __dbg_str_start       */
+    .dbg_str :
+    {
+        __dbg_str_start = .;
+        KEEP(*(.dbg_str))
+    }
+
+    /* .dbg_site section for trace and stop call site descriptors used to compile debug filters (lib_dbg.c) */
+    .dbg_site :
+    {
+        . = ALIGN(8);
+        __dbg_site_start = .;
+        KEEP(*(.dbg_site))
+        __dbg_site_end = .;
+    }
+}
+INSERT AFTER .rodata;
+
+SECTIONS
+{
+    /* heap used by lib_memalloc.c - twice of the board heap as host pointers are 64 bit */
+    .heap (NOLOAD) :
+    {
+        . = ALIGN(16);
+        _heapstart = .;
+        . += 0x10000;
+        _heapend = .;
+    }
+}
+INSERT AFTER .bss;
@@ -0,0 +1,543 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        ctr_lcd_fb.c
+* Description: LCD frame buffer (tile cache) with dirty rectangle flush
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 - Initial version
+*********************************************************************************************************
+*/
+
+#include "type.h"
+#include "hw_lpc23xx.h"
+#include "hw_spi.h"
+#include "ctr_lcd.h"
+#include "ctr_lcd_fb.h"
+
+#if LCD_FRAMEBUFFER
+
+//IMPORTANT! full 132x132 12 bit frame buffer needs 26kB so it does not fit any free RAM area
+//           tiles are cached instead in Ethernet RAM (.eth_ram section see linker command file)
+#define ETH_RAM __attribute__ ((section(".eth_ram")))
+
+#define LCD_FB_UNKNOWN	0xFF //tile content on LCD is not known
+#define LCD_FB_SOLID	0xFE //whole tile has mColor color
+#define LCD_FB_NO_TILE	0xFF //slot is free
+#define LCD_FB_CLEAN	0xFF //mDirtyX0 value of tile without changes
+
+//LCD controller needs row address corrected by 2 to have pixel placed correctly (see LCDSetPixel)
+#define LCD_FB_ROW_OFFSET	2
+
+typedef struct
+{
+	WORD mColor;//color of the whole tile when mSlot is LCD_FB_SOLID
+	BYTE mSlot;//LCD_FB_UNKNOWN, LCD_FB_SOLID or index of slot with tile pixels
+	BYTE mDirtyX0;//changed rectangle in tile coordinates (LCD_FB_CLEAN - nothing changed)
+	BYTE mDirtyX1;
+	BYTE mDirtyY0;
+	BYTE mDirtyY1;
+} sLcdFbTile;
+
+static sLcdFbTile LcdFbTile[LCD_FB_TILES][LCD_FB_TILES] ETH_RAM;//tile map of the whole LCD
+static BYTE LcdFbSlot[LCD_FB_SLOT_NO][LCD_FB_TILE_BYTES] ETH_RAM;//pixels of tiles, 2 pixels in 3 bytes as sent to LCD
+static BYTE LcdFbSlotOwner[LCD_FB_SLOT_NO] ETH_RAM;//tile index (row*LCD_FB_TILES+column) using the slot
+static BYTE LcdFbStage[LCD_FB_STAGE_SIZE] ETH_RAM;//packed pixels collected during flush
+static BYTE LcdFbEnabled=0;
+static BYTE LcdFbClock;//next slot checked for eviction
+static BYTE LcdFbDirtyNo;//number of tiles with changes not sent to LCD
+
+/*
+*********************************************************************************************************
+* Name:                                   GetTilePixel, PutTilePixel
+*
+* Description: Read/write pixel in slot packed the same way like LCD data (RRRRGGGG BBBBRRRR GGGGBBBB)
+*
+*
+* Arguments:   pSlot - slot, InX, InY - tile coordinates, InColor - 12 bit color
+*
+* Returns:     color of the pixel (GetTilePixel)
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+static WORD GetTilePixel(const BYTE *pSlot, BYTE InX, BYTE InY)
+{
+	pSlot+=InX*((LCD_FB_TILE_SIZE*3)/2)+(InY>>1)*3;
+	if(InY&0x01)
+		return ((pSlot[1]&0x0F)<<8)|pSlot[2];
+	return (pSlot[0]<<4)|(pSlot[1]>>4);
+}//GetTilePixel
+
+static void PutTilePixel(BYTE *pSlot, BYTE InX, BYTE InY, WORD InColor)
+{
+	pSlot+=InX*((LCD_FB_TILE_SIZE*3)/2)+(InY>>1)*3;
+	if(InY&0x01)
+	{
+		pSlot[1]=(pSlot[1]&0xF0)|((InColor>>8)&0x0F);
+		pSlot[2]=InColor&0xFF;
+	}
+	else
+	{
+		pSlot[0]=(InColor>>4)&0xFF;
+		pSlot[1]=(pSlot[1]&0x0F)|((InColor&0x0F)<<4);
+	}
+}//PutTilePixel
+
+/*
+*********************************************************************************************************
+* Name:                                   MarkDirty
+*
+* Description: Extends changed rectangle of the tile
+*
+*
+* Arguments:   pTile - tile, InX0, InY0, InX1, InY1 - changed rectangle in tile coordinates
+*
+* Returns:     none
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+static void MarkDirty(sLcdFbTile *pTile, BYTE InX0, BYTE InY0, BYTE InX1, BYTE InY1)
+{
+	if(pTile->mDirtyX0==LCD_FB_CLEAN)
+	{
+		pTile->mDirtyX0=InX0;
+		pTile->mDirtyX1=InX1;
+		pTile->mDirtyY0=InY0;
+		pTile->mDirtyY1=InY1;
+		LcdFbDirtyNo++;
+		return;
+	}
+	if(InX0<pTile->mDirtyX0)pTile->mDirtyX0=InX0;
+	if(InX1>pTile->mDirtyX1)pTile->mDirtyX1=InX1;
+	if(InY0<pTile->mDirtyY0)pTile->mDirtyY0=InY0;
+	if(InY1>pTile->mDirtyY1)pTile->mDirtyY1=InY1;
+}//MarkDirty
+
+/*
+*********************************************************************************************************
+* Name:                                   ReleaseSlot
+*
+* Description: Frees slot of the tile (if any) and sets new tile state
+*
+*
+* Arguments:   pTile - tile, InState - LCD_FB_UNKNOWN or LCD_FB_SOLID
+*
+* Returns:     none
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+static void ReleaseSlot(sLcdFbTile *pTile, BYTE InState)
+{
+	if(pTile->mSlot<LCD_FB_SLOT_NO)
+		LcdFbSlotOwner[pTile->mSlot]=LCD_FB_NO_TILE;
+	pTile->mSlot=InState;
+}//ReleaseSlot
+
+/*
+*********************************************************************************************************
+* Name:                                   AllocateSlot
+*
+* Description: Assigns slot to the tile of one color and fills the slot with this color
+*
+*
+* Arguments:   InTileX, InTileY - tile position in tile map
+*
+* Returns:     none
+*
+* Note(s):
+* 		When there is no free slot clean tile is evicted (becomes unknown), when all tiles are changed
+* 		frame buffer is flushed first. Slots are checked in round robin order so the just allocated slot
+* 		is evicted as the last one.
+* *********************************************************************************************************
+*/
+static void AllocateSlot(BYTE InTileX, BYTE InTileY)
+{
+	sLcdFbTile *pTile=&LcdFbTile[InTileX][InTileY];
+	sLcdFbTile *pOwner;
+	BYTE Slot;
+	BYTE Pattern[3];
+	WORD i;
+	BYTE Pass;
+
+	for(Pass=0;;Pass++)
+	{
+		for(i=0;i<LCD_FB_SLOT_NO;i++)
+		{
+			Slot=LcdFbClock;
+			if(++LcdFbClock>=LCD_FB_SLOT_NO)LcdFbClock=0;
+			if(LcdFbSlotOwner[Slot]==LCD_FB_NO_TILE)
+				break;
+			pOwner=&LcdFbTile[LcdFbSlotOwner[Slot]/LCD_FB_TILES][LcdFbSlotOwner[Slot]%LCD_FB_TILES];
+			if(pOwner->mDirtyX0==LCD_FB_CLEAN)
+			{//evict clean tile - its pixels are already on LCD
+				ReleaseSlot(pOwner,LCD_FB_UNKNOWN);
+				break;
+			}
+		}
+		if(i<LCD_FB_SLOT_NO)break;
+		LCDFbFlush();//all slots keep changes - send them to LCD so tiles can be evicted
+	}
+
+	Pattern[0]=(pTile->mColor>>4)&0xFF;
+	Pattern[1]=((pTile->mColor&0x0F)<<4)|((pTile->mColor>>8)&0x0F);
+	Pattern[2]=pTile->mColor&0xFF;
+	for(i=0;i<LCD_FB_TILE_BYTES;i++)
+		LcdFbSlot[Slot][i]=Pattern[i%3];
+	LcdFbSlotOwner[Slot]=InTileX*LCD_FB_TILES+InTileY;
+	pTile->mSlot=Slot;
+}//AllocateSlot
+
+/*
+*********************************************************************************************************
+* Name:                                   SetLcdWindow
+*
+* Description: Sets LCD drawing window and starts memory write
+*
+*
+* Arguments:   InX0, InY0, InX1, InY1 - window corners
+*
+* Returns:     none
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+static void SetLcdWindow(BYTE InX0, BYTE InY0, BYTE InX1, BYTE InY1)
+{
+	WriteSpiCommand(PASET);
+	WriteSpiData(InX0+LCD_FB_ROW_OFFSET);
+	WriteSpiData(InX1+LCD_FB_ROW_OFFSET);
+	WriteSpiCommand(CASET);
+	WriteSpiData(InY0);
+	WriteSpiData(InY1);
+	WriteSpiCommand(RAMWR);
+}//SetLcdWindow
+
+/*
+*********************************************************************************************************
+* Name:                                   FillLcdWindow
+*
+* Description: Writes rectangle of one color directly to LCD
+*
+*
+* Arguments:   InX0, InY0, InX1, InY1 - rectangle corners, InColor - 12 bit color
+*
+* Returns:     none
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+static void FillLcdWindow(BYTE InX0, BYTE InY0, BYTE InX1, BYTE InY1, WORD InColor)
+{
+	BYTE Pattern[3];
+
+	SetLcdWindow(InX0,InY0,InX1,InY1);
+	Pattern[0]=(InColor>>4)&0xFF;
+	Pattern[1]=((InColor&0x0F)<<4)|((InColor>>8)&0x0F);
+	Pattern[2]=InColor&0xFF;
+	FillSpiData(Pattern,3,((((DWORD)(InX1-InX0+1)*(InY1-InY0+1))+1)/2)*3);
+}//FillLcdWindow
+
+/*
+*********************************************************************************************************
+* Name:                                   FlushRect
+*
+* Description: Sends rectangle of frame buffer to LCD in one window
+*
+*
+* Arguments:   InX0, InY0, InX1, InY1 - rectangle corners
+*
+* Returns:     none
+*
+* Note(s):
+* 		Rectangle covered only by tiles of one the same color is sent as repeated pattern
+* *********************************************************************************************************
+*/
+static void FlushRect(BYTE InX0, BYTE InY0, BYTE InX1, BYTE InY1)
+{
+	sLcdFbTile *pTile;
+	BYTE x,y,TileX,TileY,YEnd;
+	WORD Color;
+	WORD FirstColor=0;//color of the first pixel in the window
+	WORD Stage=0;//bytes in LcdFbStage
+	BYTE Odd=0;//first pixel of the pair is in LcdFbStage
+	BYTE Solid=1;
+
+	//check if all tiles are of one color
+	pTile=&LcdFbTile[InX0/LCD_FB_TILE_SIZE][InY0/LCD_FB_TILE_SIZE];
+	Color=pTile->mColor;
+	for(TileX=InX0/LCD_FB_TILE_SIZE;TileX<=InX1/LCD_FB_TILE_SIZE && Solid;TileX++)
+		for(TileY=InY0/LCD_FB_TILE_SIZE;TileY<=InY1/LCD_FB_TILE_SIZE;TileY++)
+		{
+			pTile=&LcdFbTile[TileX][TileY];
+			if(pTile->mSlot!=LCD_FB_SOLID || pTile->mColor!=Color)
+			{
+				Solid=0;
+				break;
+			}
+		}
+	if(Solid)
+	{
+		FillLcdWindow(InX0,InY0,InX1,InY1,Color);
+		return;
+	}
+
+	SetLcdWindow(InX0,InY0,InX1,InY1);
+	for(x=InX0;x<=InX1;x++)
+	{
+		TileX=x/LCD_FB_TILE_SIZE;
+		for(y=InY0;y<=InY1;)
+		{//walk through the row tile by tile
+			TileY=y/LCD_FB_TILE_SIZE;
+			pTile=&LcdFbTile[TileX][TileY];
+			YEnd=(TileY+1)*LCD_FB_TILE_SIZE-1;
+			if(YEnd>InY1)YEnd=InY1;
+			for(;y<=YEnd;y++)
+			{
+				if(pTile->mSlot<LCD_FB_SLOT_NO)
+					Color=GetTilePixel(LcdFbSlot[pTile->mSlot],x%LCD_FB_TILE_SIZE,y%LCD_FB_TILE_SIZE);
+				else
+					Color=pTile->mColor;
+				if(x==InX0 && y==InY0)
+					FirstColor=Color;
+				if(!Odd)
+				{
+					LcdFbStage[Stage]=(Color>>4)&0xFF;
+					LcdFbStage[Stage+1]=(Color&0x0F)<<4;
+					Odd=1;
+				}
+				else
+				{
+					LcdFbStage[Stage+1]|=(Color>>8)&0x0F;
+					LcdFbStage[Stage+2]=Color&0xFF;
+					Odd=0;
+					Stage+=3;
+					if(Stage>=LCD_FB_STAGE_SIZE)
+					{
+						WriteSpiDataBlock(LcdFbStage,Stage);
+						Stage=0;
+					}
+				}
+			}
+		}
+	}
+	if(Odd)
+	{//second pixel of the last pair wraps to the window begin so it repeats the first pixel
+		LcdFbStage[Stage+1]|=(FirstColor>>8)&0x0F;
+		LcdFbStage[Stage+2]=FirstColor&0xFF;
+		Stage+=3;
+	}
+	if(Stage)WriteSpiDataBlock(LcdFbStage,Stage);
+}//FlushRect
+
+/*
+*********************************************************************************************************
+* Name:                                   ClipRect
+*
+* Description: Limits rectangle to frame buffer area
+*
+*
+* Arguments:   pX0, pY0, pX1, pY1 - rectangle corners
+*
+* Returns:     1 - rectangle was fully inside frame buffer, 0 - rectangle was clipped
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+static BYTE ClipRect(int *pX0, int *pY0, int *pX1, int *pY1)
+{
+	BYTE Inside=1;
+
+	if(*pX0<0){*pX0=0;Inside=0;}
+	if(*pY0<0){*pY0=0;Inside=0;}
+	if(*pX1>=LCD_FB_SIZE){*pX1=LCD_FB_SIZE-1;Inside=0;}
+	if(*pY1>=LCD_FB_SIZE){*pY1=LCD_FB_SIZE-1;Inside=0;}
+	return Inside;
+}//ClipRect
+
+void LCDFbEnable(void)
+{
+	BYTE i,j;
+
+	PCONP|=BIT30;//Ethernet block must be powered to access Ethernet RAM where tiles are kept
+	for(i=0;i<LCD_FB_TILES;i++)
+		for(j=0;j<LCD_FB_TILES;j++)
+		{
+			LcdFbTile[i][j].mSlot=LCD_FB_UNKNOWN;
+			LcdFbTile[i][j].mColor=0;
+			LcdFbTile[i][j].mDirtyX0=LCD_FB_CLEAN;
+		}
+	for(i=0;i<LCD_FB_SLOT_NO;i++)
+		LcdFbSlotOwner[i]=LCD_FB_NO_TILE;
+	LcdFbClock=0;
+	LcdFbDirtyNo=0;
+	LcdFbEnabled=1;
+}//LCDFbEnable
+
+void LCDFbDisable(void)
+{
+	if(!LcdFbEnabled)return;
+	LCDFbFlush();
+	LcdFbEnabled=0;
+}//LCDFbDisable
+
+void LCDFbFlush(void)
+{
+	sLcdFbTile *pTile;
+	BYTE TileX,TileY;
+	BYTE X0,X1,Y0,Y1;//rectangle being built from the tiles in a row
+	BYTE PendX0=0,PendX1=0,PendY0=0,PendY1=0;//rectangle waiting to be merged with rectangles from next tile rows
+	BYTE Pending=0;
+
+	if(!LcdFbEnabled || !LcdFbDirtyNo)return;
+	for(TileX=0;TileX<LCD_FB_TILES;TileX++)
+	{
+		for(TileY=0;TileY<LCD_FB_TILES;)
+		{
+			pTile=&LcdFbTile[TileX][TileY];
+			if(pTile->mDirtyX0==LCD_FB_CLEAN)
+			{
+				TileY++;
+				continue;
+			}
+			X0=TileX*LCD_FB_TILE_SIZE+pTile->mDirtyX0;
+			X1=TileX*LCD_FB_TILE_SIZE+pTile->mDirtyX1;
+			Y0=TileY*LCD_FB_TILE_SIZE+pTile->mDirtyY0;
+			Y1=TileY*LCD_FB_TILE_SIZE+pTile->mDirtyY1;
+			pTile->mDirtyX0=LCD_FB_CLEAN;
+			//merge changes of next tiles in the row when they continue the rectangle
+			for(TileY++;TileY<LCD_FB_TILES;TileY++)
+			{
+				pTile=&LcdFbTile[TileX][TileY];
+				if(pTile->mDirtyX0==LCD_FB_CLEAN || Y1!=TileY*LCD_FB_TILE_SIZE-1 || pTile->mDirtyY0
+					|| X0!=TileX*LCD_FB_TILE_SIZE+pTile->mDirtyX0 || X1!=TileX*LCD_FB_TILE_SIZE+pTile->mDirtyX1)
+					break;
+				Y1=TileY*LCD_FB_TILE_SIZE+pTile->mDirtyY1;
+				pTile->mDirtyX0=LCD_FB_CLEAN;
+			}
+			//merge with rectangle from previous tile row when it is just above
+			if(Pending && PendY0==Y0 && PendY1==Y1 && PendX1+1==X0)
+			{
+				PendX1=X1;
+				continue;
+			}
+			if(Pending)FlushRect(PendX0,PendY0,PendX1,PendY1);
+			PendX0=X0;PendX1=X1;PendY0=Y0;PendY1=Y1;
+			Pending=1;
+		}
+	}
+	if(Pending)FlushRect(PendX0,PendY0,PendX1,PendY1);
+	LcdFbDirtyNo=0;
+}//LCDFbFlush
+
+BYTE LCDFbSetPixel(int x, int y, int color)
+{
+	sLcdFbTile *pTile;
+	BYTE TileX,TileY,InX,InY;
+
+	if(!LcdFbEnabled || x<0 || y<0 || x>=LCD_FB_SIZE || y>=LCD_FB_SIZE)return 0;
+	TileX=x/LCD_FB_TILE_SIZE;
+	TileY=y/LCD_FB_TILE_SIZE;
+	InX=x%LCD_FB_TILE_SIZE;
+	InY=y%LCD_FB_TILE_SIZE;
+	pTile=&LcdFbTile[TileX][TileY];
+	color&=0x0FFF;
+	if(pTile->mSlot==LCD_FB_UNKNOWN)return 0;
+	if(pTile->mSlot==LCD_FB_SOLID)
+	{
+		if(pTile->mColor==color)return 1;//nothing changes
+		AllocateSlot(TileX,TileY);
+	}
+	else if(GetTilePixel(LcdFbSlot[pTile->mSlot],InX,InY)==color)
+		return 1;//nothing changes
+	PutTilePixel(LcdFbSlot[pTile->mSlot],InX,InY,color);
+	MarkDirty(pTile,InX,InY,InX,InY);
+	return 1;
+}//LCDFbSetPixel
+
+BYTE LCDFbFillRect(int xmin, int ymin, int xmax, int ymax, int color)
+{
+	sLcdFbTile *pTile;
+	BYTE TileX,TileY;
+	BYTE X0,X1,Y0,Y1;//part of the rectangle in the tile (tile coordinates)
+	BYTE x,y;
+
+	if(!LcdFbEnabled)return 0;
+	if(!ClipRect(&xmin,&ymin,&xmax,&ymax))
+	{//rectangle exceeds frame buffer so it is drawn directly
+		LCDFbInvalidate(xmin,ymin,xmax,ymax);
+		return 0;
+	}
+	color&=0x0FFF;
+	for(TileX=xmin/LCD_FB_TILE_SIZE;TileX<=xmax/LCD_FB_TILE_SIZE;TileX++)
+		for(TileY=ymin/LCD_FB_TILE_SIZE;TileY<=ymax/LCD_FB_TILE_SIZE;TileY++)
+		{
+			pTile=&LcdFbTile[TileX][TileY];
+			X0=(xmin>TileX*LCD_FB_TILE_SIZE) ? xmin-TileX*LCD_FB_TILE_SIZE : 0;
+			X1=(xmax<(TileX+1)*LCD_FB_TILE_SIZE-1) ? xmax-TileX*LCD_FB_TILE_SIZE : LCD_FB_TILE_SIZE-1;
+			Y0=(ymin>TileY*LCD_FB_TILE_SIZE) ? ymin-TileY*LCD_FB_TILE_SIZE : 0;
+			Y1=(ymax<(TileY+1)*LCD_FB_TILE_SIZE-1) ? ymax-TileY*LCD_FB_TILE_SIZE : LCD_FB_TILE_SIZE-1;
+			if(pTile->mSlot==LCD_FB_SOLID && pTile->mColor==color)
+				continue;//nothing changes
+			if(!X0 && !Y0 && X1==LCD_FB_TILE_SIZE-1 && Y1==LCD_FB_TILE_SIZE-1)
+			{//whole tile covered - it becomes tile of one color
+				ReleaseSlot(pTile,LCD_FB_SOLID);
+				pTile->mColor=color;
+				MarkDirty(pTile,X0,Y0,X1,Y1);
+				continue;
+			}
+			if(pTile->mSlot==LCD_FB_UNKNOWN)
+			{//rest of the tile is not known so this part goes directly to LCD
+				FillLcdWindow(TileX*LCD_FB_TILE_SIZE+X0,TileY*LCD_FB_TILE_SIZE+Y0,
+						TileX*LCD_FB_TILE_SIZE+X1,TileY*LCD_FB_TILE_SIZE+Y1,color);
+				continue;
+			}
+			if(pTile->mSlot==LCD_FB_SOLID)
+				AllocateSlot(TileX,TileY);
+			for(x=X0;x<=X1;x++)
+				for(y=Y0;y<=Y1;y++)
+					PutTilePixel(LcdFbSlot[pTile->mSlot],x,y,color);
+			MarkDirty(pTile,X0,Y0,X1,Y1);
+		}
+	return 1;
+}//LCDFbFillRect
+
+BYTE LCDFbIsCached(int xmin, int ymin, int xmax, int ymax)
+{
+	BYTE TileX,TileY;
+
+	if(!LcdFbEnabled || !ClipRect(&xmin,&ymin,&xmax,&ymax))return 0;
+	for(TileX=xmin/LCD_FB_TILE_SIZE;TileX<=xmax/LCD_FB_TILE_SIZE;TileX++)
+		for(TileY=ymin/LCD_FB_TILE_SIZE;TileY<=ymax/LCD_FB_TILE_SIZE;TileY++)
+			if(LcdFbTile[TileX][TileY].mSlot==LCD_FB_UNKNOWN)return 0;
+	return 1;
+}//LCDFbIsCached
+
+void LCDFbInvalidate(int xmin, int ymin, int xmax, int ymax)
+{
+	BYTE TileX,TileY;
+
+	if(!LcdFbEnabled)return;
+	ClipRect(&xmin,&ymin,&xmax,&ymax);
+	if(xmin>xmax || ymin>ymax)return;
+	for(TileX=xmin/LCD_FB_TILE_SIZE;TileX<=xmax/LCD_FB_TILE_SIZE;TileX++)
+		for(TileY=ymin/LCD_FB_TILE_SIZE;TileY<=ymax/LCD_FB_TILE_SIZE;TileY++)
+			if(LcdFbTile[TileX][TileY].mDirtyX0!=LCD_FB_CLEAN)
+			{//changes of the tile outside of the rectangle must be on LCD before tile becomes unknown
+				LCDFbFlush();
+				break;
+			}
+	for(TileX=xmin/LCD_FB_TILE_SIZE;TileX<=xmax/LCD_FB_TILE_SIZE;TileX++)
+		for(TileY=ymin/LCD_FB_TILE_SIZE;TileY<=ymax/LCD_FB_TILE_SIZE;TileY++)
+			ReleaseSlot(&LcdFbTile[TileX][TileY],LCD_FB_UNKNOWN);
+}//LCDFbInvalidate
+
+#endif //LCD_FRAMEBUFFER
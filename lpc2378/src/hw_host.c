@@ -0,0 +1,1051 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        hw_host.c
+* Description: Host stubs of hardware drivers and simulated Wall-e board for Linux host build (make host)
+*              Replaces hw_timer.c, hw_spi.c, hw_uart.c and hw_uart1.c which need hardware response.
+*              Other hw_* drivers work unchanged on registers mapped as memory by os_cpu_host.c.
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+*              OS tick is host timerfd connected to Timer2 VIC channel, UART0 is the host terminal
+*              (stdin/stdout), MCP3208 ADC channels and sensors return constant values of the robot
+*              standing on the floor with charged batteries. Board emulation is done on every OS tick by
+*              HostBoardTick: power off, watchdog, RTC counting and alarm, track motors and ARS turn.
+*              Track motor speed follows Timer3 motor count with HOST_TRACK_LAG_TICKS lag and motor
+*              efficiency (hw_host.h) so track speed regulator can be tuned on host (tools/sim_tracks).
+*              LCD SPI words drive emulated display memory of the LCD controller so drawing can be checked
+*              and SPI words of a frame counted on host (tools/bench_lcd).
+* History:
+*              17-Oct-2026 - Initial version created
+*              17-Oct-2026 - Track pulses generated by model of track motors and encoders
+*              17-Oct-2026 - LCD controller emulator counting SPI words and keeping display memory
+*              17-Oct-2026 - Heap calls recorded into WALLE_HEAP_TRACE file
+*********************************************************************************************************
+*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/timerfd.h>
+
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+
+#include "type.h"
+#include "hw_lpc23xx.h"
+#include "hw_lpc2378.h"
+#include "hw_timer.h"
+#include "hw_spi.h"
+#include "hw_uart.h"
+#include "hw_uart1.h"
+#include "hw_gpio.h"
+#include "hw_wdt.h"
+#include "hw_sram.h"
+#include "hw_host.h"
+#include "ctr_lcd.h"
+#include "tsk_tracks.h"
+#include "lib_error.h"
+#include "os_cpu_host.h"
+
+//simulated MCP3208 channels - robot standing with charged batteries and nothing in front of it
+#define HOST_ADC_DISTANCE_DETECTOR	330  //GP2D12 - far obstacle
+#define HOST_ADC_SERVO				3420 //servo supply
+#define HOST_ADC_MAIN_SUPPLY		3241 //uP board battery
+#define HOST_ADC_MOTOR_SUPPLY		3270 //motors battery
+#define HOST_ADC_ARS_SENSOR			2048 //angular rate sensor at rest (equal to the offset)
+#define HOST_ADC_FOTO_TRANSISTOR	2048 //room light
+#define HOST_ADC_FOTO_RESISTOR		2048 //room light
+
+#define HOST_ACCELERATION			520 //uP ADC result of accelerometer X and Z axis (robot standing)
+#define HOST_US_ECHO_US				5800 //HC-SR04 echo duration in us (1m - no obstacle)
+#define HOST_TRACK_LAG_TICKS		3 //OS ticks in which track motor speed follows 1/3 of the motor count change
+#define HOST_ARS_TURN_TICKS			100 //OS ticks of any ARS controlled turn
+#define HOST_BATTERY_RAM_ENV		"WALLE_BATTERY_RAM" //environment variable with name of file keeping battery RAM
+#define HOST_HEAP_TRACE_ENV			"WALLE_HEAP_TRACE" //environment variable with name of file recording heap calls
+#define HOST_BATTERY_RAM_SIZE		0x1000 //battery RAM (2kB) rounded up to the page size
+#define HOST_WDT_TIMEOUT_TICKS		((WDT_TIMEOUT*4ULL*OS_TICKS_PER_SEC)/Fpclk) //watchdog timeout (WDT clock is Fpclk/4)
+
+//duration of one Timer3 count in ns
+#define HOST_TIMER3_COUNT_NS		((1000000000ULL*(TIMER3_PRESCALER_VALUE+1))/Fpclk)
+//duration of one Timer3 tick (GetTimer3Ticks) and OS tick in ns
+#define HOST_TIMER3_TICK_NS			(HOST_TIMER3_COUNT_NS*(INIT_TIMER3_MR2_COUNT+1))
+#define HOST_OS_TICK_NS				(1000000000ULL/OS_TICKS_PER_SEC)
+//track pulse length in Timer3 ticks multiplied by motor count of the motor with 1000 per mille efficiency
+//right motor at MID_RIGHT_MOTOR_COUNT has MID_PULSE_LENGTH_GOAL pulses
+#define HOST_TRACK_PULSE_COUNT_TICKS	((unsigned long long)MID_PULSE_LENGTH_GOAL*MID_RIGHT_MOTOR_COUNT)
+
+static const WORD HostAdcValue[ADC_CHANNEL_NO]=
+{
+	HOST_ADC_DISTANCE_DETECTOR,HOST_ADC_SERVO,HOST_ADC_MAIN_SUPPLY,HOST_ADC_MOTOR_SUPPLY,
+	HOST_ADC_ARS_SENSOR,HOST_ADC_FOTO_TRANSISTOR,HOST_ADC_FOTO_RESISTOR,0
+};
+static const BYTE HostAdcPeriod[ADC_CHANNEL_NO]=
+{
+	ADC_CH0_SAMPLING_PERIOD,ADC_CH1_SAMPLING_PERIOD,ADC_CH2_SAMPLING_PERIOD,ADC_CH3_SAMPLING_PERIOD,
+	ADC_CH4_SAMPLING_PERIOD,ADC_CH5_SAMPLING_PERIOD,ADC_CH6_SAMPLING_PERIOD,ADC_CH7_SAMPLING_PERIOD
+};
+
+//Timer0 - HC-SR04 echo measurement
+static volatile DWORD Timer0StartCAP;
+static volatile DWORD Timer0StopCAP;
+static volatile BYTE  Timer0IsCounting;
+
+//Timer1 - ARS angle integration
+static volatile LONG ArsIntegratedAngle;
+static volatile LONG ArsOffset;
+static volatile LONG TargetArsIntegratedAngle;
+static volatile BYTE ArsIsCounting;//TRUE when turn is simulated
+
+//Timer2 - OS tick
+static int Timer2Fd = -1;//host periodic timer
+
+//Timer3 - time stamps and motors PWM
+static struct timespec Timer3Start;//host time when Timer3 was started
+static volatile BYTE Timer3IsRunning;
+static volatile BYTE Timer3MR0CurrentCount = INIT_TIMER3_MR0_COUNT;//Right Motor
+static volatile BYTE Timer3MR1CurrentCount = INIT_TIMER3_MR1_COUNT;//Left Motor
+
+//track motors and encoders (indexed by LEFT_TRACK_TSK and RIGHT_TRACK_TSK)
+typedef struct
+{
+	WORD mEfficiency;//motor efficiency in per mille
+	DWORD mSpeed;//distance covered in one OS tick in 1/HOST_TRACK_DISTANCE_UNIT of the pulse
+	volatile unsigned long long mDistance;//distance covered in 1/HOST_TRACK_DISTANCE_UNIT of the pulse
+} sHostTrack;
+static sHostTrack HostTrack[2]={{HOST_LEFT_MOTOR_EFFICIENCY,0,0},{HOST_RIGHT_MOTOR_EFFICIENCY,0,0}};
+
+//LCD SPI - emulated LCD controller (only page/column address set and memory write commands are executed)
+typedef struct
+{
+	BYTE mCommand;//the last command
+	BYTE mDataNo;//number of data bytes received after the command
+	BYTE mPage0,mPage1;//page address range set by PASET
+	BYTE mColumn0,mColumn1;//column address range set by CASET
+	BYTE mPage,mColumn;//address of the next written pixel
+	BYTE mPhase;//byte of 3 bytes which carry 2 packed 12 bit pixels
+	WORD mPixel;//bits of the pixel collected from previous byte
+} sHostLcd;
+static sHostLcd HostLcd;
+static WORD HostLcdMemory[HOST_LCD_PAGES][HOST_LCD_COLUMNS];//12 bit colors
+static volatile DWORD LcdSpiWords;
+
+//UART0 - host terminal
+static char Uart0TxBuffer[UART0_TX_BUFFER_SIZE];//output is written to stdout line by line
+static WORD Uart0TxLevel;
+static WORD Uart0TxMaxLevel;
+static volatile BYTE Uart0RxBuffer[UART0_RX_BUFFER_SIZE];
+static volatile WORD Uart0RxHead;
+static volatile WORD Uart0RxTail;
+static volatile DWORD Uart0RxOverflows;
+static OS_EVENT *Uart0RxSem;//counts characters in RX buffer
+static char TempResultBuff[12];//long value converted to string
+
+//watchdog
+static BYTE  HostWdtIsRunning;//TRUE after the first feed
+static DWORD HostWdtTicks;//OS ticks since the last feed
+
+/*
+*********************************************************************************************************
+* Name:                                    HostBoardInit
+*
+* Description: Sets registers which are inputs from the board hardware
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 			Done after registers are mapped by os_cpu_host.c and before any static constructor.
+*           Battery RAM is kept in the file named by WALLE_BATTERY_RAM environment variable so power off
+*           reason, reset reason and program to execute are preserved between runs as on the board.
+*           Without the file battery RAM is signed as preserved with default program to execute.
+* *********************************************************************************************************
+*/
+__attribute__((constructor(102))) static void HostBoardInit(void)
+{
+	char *pFileName=getenv(HOST_BATTERY_RAM_ENV);
+	int Fd=pFileName?open(pFileName,O_RDWR|O_CREAT,0644):-1;
+	time_t Now=time(NULL);
+	struct tm Time;
+
+	if((Fd>=0) && !ftruncate(Fd,HOST_BATTERY_RAM_SIZE)
+		&& (mmap((void *)BATTERY_RAM_BASE_ADDR,HOST_BATTERY_RAM_SIZE,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_FIXED,Fd,0)
+			==(void *)BATTERY_RAM_BASE_ADDR))
+		close(Fd);//new file is the battery RAM after battery change - signature is set by InitStaticRam
+	else
+	{
+		if(pFileName)
+			fprintf(stderr,"walle: cannot use %s as battery RAM\n",pFileName);
+		SetBatteryRAMSignature();
+		WALLE_PROGRAM=WALLE_PROGRAM_BATH;//the rest of battery RAM is 0 i.e. unset power off, exception and reset
+	}
+	localtime_r(&Now,&Time);//RTC kept host local time while the board was off
+	RTC_SEC=Time.tm_sec;
+	RTC_MIN=Time.tm_min;
+	RTC_HOUR=Time.tm_hour;
+	RTC_DOM=Time.tm_mday;
+	RTC_DOW=Time.tm_wday;
+	RTC_DOY=Time.tm_yday+1;
+	RTC_MONTH=Time.tm_mon+1;
+	RTC_YEAR=Time.tm_year+1900;
+
+	FIO0PIN = BIT18|BIT29;//buttons are not pressed
+	FIO1PIN = BIT18|BIT19|BIT22|BIT25|BIT27;//joystick is not moved
+	AD0GDR = BIT31|(HOST_ACCELERATION<<6);//accelerometer conversion done
+}//HostBoardInit
+
+//returns Timer3 counts since InitTimer3
+static DWORD HostTimer3Counts(void)
+{
+	struct timespec Now;
+	long long Ns;
+
+	if(!Timer3IsRunning)
+		return 0;
+	clock_gettime(CLOCK_MONOTONIC,&Now);
+	Ns=(Now.tv_sec-Timer3Start.tv_sec)*1000000000LL+(Now.tv_nsec-Timer3Start.tv_nsec);
+	return (DWORD)(Ns/HOST_TIMER3_COUNT_NS);
+}//HostTimer3Counts
+
+//moves track for one OS tick, returns InIntBit when transoptor pulse is generated
+static DWORD HostTrackTick(sHostTrack *pTrack,BYTE InCount,DWORD InIntBit)
+{
+	DWORD Target;
+	unsigned long long Pulses=pTrack->mDistance/HOST_TRACK_DISTANCE_UNIT;
+
+	if(!(IO2_INT_EN_F&InIntBit))//motor runs only when its transoptor pulses are counted
+	{
+		pTrack->mSpeed=0;//fast stop
+		return 0;
+	}
+	Target=(DWORD)((HOST_TRACK_DISTANCE_UNIT*HOST_OS_TICK_NS*InCount*pTrack->mEfficiency)
+			/(HOST_TRACK_PULSE_COUNT_TICKS*1000*HOST_TIMER3_TICK_NS));
+	pTrack->mSpeed=(DWORD)((LONG)pTrack->mSpeed+((LONG)Target-(LONG)pTrack->mSpeed)/HOST_TRACK_LAG_TICKS);
+	pTrack->mDistance+=pTrack->mSpeed;
+	return (pTrack->mDistance/HOST_TRACK_DISTANCE_UNIT!=Pulses)?InIntBit:0;
+}//HostTrackTick
+
+//RTC counts one second as LPC2378 RTC does
+static void HostRtcSecond(void)
+{
+	struct tm Time;
+	time_t Seconds;
+
+	memset(&Time,0,sizeof(Time));
+	Time.tm_sec=RTC_SEC;
+	Time.tm_min=RTC_MIN;
+	Time.tm_hour=RTC_HOUR;
+	Time.tm_mday=RTC_DOM;
+	Time.tm_mon=RTC_MONTH-1;
+	Time.tm_year=RTC_YEAR-1900;
+	Seconds=timegm(&Time)+1;
+	gmtime_r(&Seconds,&Time);
+	RTC_SEC=Time.tm_sec;
+	RTC_MIN=Time.tm_min;
+	RTC_HOUR=Time.tm_hour;
+	RTC_DOM=Time.tm_mday;
+	RTC_DOW=Time.tm_wday;
+	RTC_DOY=Time.tm_yday+1;
+	RTC_MONTH=Time.tm_mon+1;
+	RTC_YEAR=Time.tm_year+1900;
+
+	//alarm when all not masked (AMR bit 0) time counters are equal to alarm registers
+	if(((RTC_AMR&0xFF)!=0xFF)
+		&& ((RTC_AMR&BIT0) || (RTC_SEC==RTC_ALSEC))
+		&& ((RTC_AMR&BIT1) || (RTC_MIN==RTC_ALMIN))
+		&& ((RTC_AMR&BIT2) || (RTC_HOUR==RTC_ALHOUR))
+		&& ((RTC_AMR&BIT3) || (RTC_DOM==RTC_ALDOM))
+		&& ((RTC_AMR&BIT4) || (RTC_DOW==RTC_ALDOW))
+		&& ((RTC_AMR&BIT5) || (RTC_DOY==RTC_ALDOY))
+		&& ((RTC_AMR&BIT6) || (RTC_MONTH==RTC_ALMON))
+		&& ((RTC_AMR&BIT7) || (RTC_YEAR==RTC_ALYEAR)))
+	{
+		RTC_ILR|=BIT1;
+		OS_CPU_HostIrqRequest(OS_CPU_HOST_IRQ_RTC);
+	}
+}//HostRtcSecond
+
+/*
+*********************************************************************************************************
+* Name:                                    HostBoardTick
+*
+* Description: Simulates Wall-e board hardware on every OS tick
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 			Called from Timer2 ISR after OSTimeTick.
+*           Simulation exits when uP board is switched off (uPBoardOff) or watchdog resets uP.
+* *********************************************************************************************************
+*/
+static void HostBoardTick(void)
+{
+	static DWORD Ticks;
+	LONG Step;
+
+	Ticks++;
+
+	if(FIO4CLR&BIT12)//uP board power supply switched off
+	{
+		Uart0Flush();
+		fprintf(stderr,"\nwalle: power off (reason %u)\n",(unsigned)POWER_OFF_REASON);
+		exit(EXIT_SUCCESS);
+	}
+
+	if(WDMOD&BIT0)//watchdog enabled
+	{
+		if(WDFEED==WDT_FEED_2)//fed since the last tick
+		{
+			WDFEED=0;
+			HostWdtIsRunning=TRUE;
+			HostWdtTicks=0;
+		}
+		else if(HostWdtIsRunning && (++HostWdtTicks>HOST_WDT_TIMEOUT_TICKS))
+		{
+			WDMOD|=BIT2;//time-out flag
+			Uart0Flush();
+			fprintf(stderr,"\nwalle: watchdog reset\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if(!(Ticks%OS_TICKS_PER_SEC) && (RTC_CCR&BIT0))//RTC counters enabled
+		HostRtcSecond();
+
+	//transoptor pulses of tracks which motors are running (P2.6 right motor, P2.7 left motor)
+	IO2_INT_STAT_F=HostTrackTick(&HostTrack[RIGHT_TRACK_TSK],Timer3MR0CurrentCount,BIT6)
+			|HostTrackTick(&HostTrack[LEFT_TRACK_TSK],Timer3MR1CurrentCount,BIT7);
+	if(IO2_INT_STAT_F)
+		OS_CPU_HostIrqRequest(OS_CPU_HOST_IRQ_PORT2);
+
+	if(ArsIsCounting)//the robot turns until target angle is reached
+	{
+		Step=labs(TargetArsIntegratedAngle)/HOST_ARS_TURN_TICKS+1;
+		ArsIntegratedAngle+=(TargetArsIntegratedAngle<0)?-Step:Step;
+		if(labs(ArsIntegratedAngle)>=labs(TargetArsIntegratedAngle))
+		{
+			ArsIsCounting=FALSE;
+			StopTracks();
+		}
+	}
+}//HostBoardTick
+
+/*
+*********************************************************************************************************
+*                                       TIMERS (hw_timer.h)
+*
+* Note(s):     Timer2 is OS tick host timerfd. Timer3 counts host monotonic time. Timer0 HC-SR04 echo and
+*              Timer1 ARS turn are simulated.
+*********************************************************************************************************
+*/
+void InitTimer0(void)
+{
+	Timer0IsCounting=FALSE;
+}//InitTimer0
+
+void Timer0Start(void)
+{
+	Timer0StartCAP=1;
+	Timer0StopCAP=Timer0StartCAP+HOST_US_ECHO_US;//Timer0 counts 1us
+	Timer0IsCounting=FALSE;//echo is received at once
+}//Timer0Start
+
+void Timer0Stop(void)
+{
+	Timer0IsCounting=FALSE;
+}//Timer0Stop
+
+void WaitTimer0_10uS(void)
+{
+}//WaitTimer0_10uS
+
+DWORD GetTimer0StartCAP(void)
+{
+	return Timer0StartCAP;
+}//GetTimer0StartCAP
+
+DWORD GetTimer0StopCAP(void)
+{
+	return Timer0StopCAP;
+}//GetTimer0StopCAP
+
+BYTE IsTimer0Counting(void)
+{
+	return Timer0IsCounting;
+}//IsTimer0Counting
+
+void InitTimer1(void)
+{
+}//InitTimer1
+
+void SetArsOffset(void)
+{
+	ArsOffset = (LONG)CalculateAdcOffset(ADC_ARS_SENSOR,ARS_OFFSET_SAMPLE_COUNT,ARS_OFFSET_SAMPLE_TICKS);
+}//SetArsOffset
+
+LONG GetArsOffset(void)
+{
+	return ArsOffset;
+}//GetArsOffset
+
+void StartArsAngleCounting(void)
+{
+	ArsIntegratedAngle=0;
+	ArsIsCounting=TRUE;
+}//StartArsAngleCounting
+
+void StopArsAngleCounting(void)
+{
+	ArsIsCounting=FALSE;
+}//StopArsAngleCounting
+
+void SetArsTargetAngle(LONG InTargetAngle)
+{
+	TargetArsIntegratedAngle=InTargetAngle;
+}//SetArsTargetAngle
+
+LONG GetArsTargetAngle(void)
+{
+	return TargetArsIntegratedAngle;
+}//GetArsTargetAngle
+
+LONG GetArsAngleValue(void)
+{
+	return ArsIntegratedAngle;
+}//GetArsAngleValue
+
+void InitTimer2(void)
+{
+	struct itimerspec Period;
+
+	memset(&Period,0,sizeof(Period));
+	Period.it_interval.tv_nsec=1000000000L/OS_TICKS_PER_SEC;
+	Period.it_value.tv_nsec=Period.it_interval.tv_nsec;
+	Timer2Fd=timerfd_create(CLOCK_MONOTONIC,TFD_NONBLOCK);
+	if((Timer2Fd<0) || timerfd_settime(Timer2Fd,0,&Period,NULL))
+		UCOSII_RES_EXCEPTION;//there is not OS tick
+	VICVectAddr26 = (DWORD)Timer2IsrHandler;
+	VICIntEnable |= BIT26;
+	OS_CPU_HostIrqSource(OS_CPU_HOST_IRQ_TIMER2,Timer2Fd);
+}//InitTimer2
+
+void Timer2IsrHandler(void)
+{
+	unsigned long long Expirations=0;
+
+	if(read(Timer2Fd,&Expirations,sizeof(Expirations))!=sizeof(Expirations))
+		return;//already read
+	while(Expirations--)//ticks missed when host was late are not lost
+	{
+		OSTimeTick();
+		HostBoardTick();
+	}
+}//Timer2IsrHandler
+
+void InitTimer3(void)
+{
+	clock_gettime(CLOCK_MONOTONIC,&Timer3Start);
+	Timer3IsRunning=TRUE;
+}//InitTimer3
+
+unsigned long GetTimer3CounterValue(void)
+{
+	return HostTimer3Counts()%(INIT_TIMER3_MR2_COUNT+1);
+}//GetTimer3CounterValue
+
+DWORD GetTimer3Ticks(void)
+{
+	return HostTimer3Counts()/(INIT_TIMER3_MR2_COUNT+1);
+}//GetTimer3Ticks
+
+DWORD GetTimer3TimeStamp(void)
+{
+	return HostTimer3Counts();
+}//GetTimer3TimeStamp
+
+void SetTimer3MR0Count(BYTE InCount)
+{
+	if(InCount >= INIT_TIMER3_MR2_COUNT)
+	{
+		Timer3MR0CurrentCount = INIT_TIMER3_MR2_COUNT;
+	}
+	else
+	{
+		Timer3MR0CurrentCount = InCount;
+	}
+}//SetTimer3MR0Count
+
+BYTE GetTimer3MR0Count(void)
+{
+	return Timer3MR0CurrentCount;
+}//GetTimer3MR0Count
+
+void SetTimer3MR1Count(BYTE InCount)
+{
+	if(InCount >= INIT_TIMER3_MR2_COUNT)
+	{
+		Timer3MR1CurrentCount = INIT_TIMER3_MR2_COUNT;
+	}
+	else
+	{
+		Timer3MR1CurrentCount = InCount;
+	}
+}//SetTimer3MR1Count
+
+BYTE GetTimer3MR1Count(void)
+{
+	return Timer3MR1CurrentCount;
+}//GetTimer3MR1Count
+
+/*
+*********************************************************************************************************
+*                                       SPI (hw_spi.h)
+*
+* Note(s):     LCD data are counted and executed by emulated LCD controller. ADC channels return
+*              constant values, sampled channels return them since Timer3 sampling engine is started.
+*********************************************************************************************************
+*/
+void InitSpiLcd(void)
+{
+}//InitSpiLcd
+
+//writes the pixel to the emulated display memory and moves to the next one inside the page/column window
+static void HostLcdPixel(WORD InColor)
+{
+	if((HostLcd.mPage<HOST_LCD_PAGES) && (HostLcd.mColumn<HOST_LCD_COLUMNS))
+		HostLcdMemory[HostLcd.mPage][HostLcd.mColumn]=InColor;
+	if(HostLcd.mColumn<HostLcd.mColumn1)
+		HostLcd.mColumn++;
+	else
+	{
+		HostLcd.mColumn=HostLcd.mColumn0;
+		HostLcd.mPage=(HostLcd.mPage<HostLcd.mPage1)?HostLcd.mPage+1:HostLcd.mPage0;
+	}
+}//HostLcdPixel
+
+//executes data byte of the last LCD command
+static void HostLcdData(BYTE InData)
+{
+	switch(HostLcd.mCommand)
+	{
+	case PASET:
+		if(HostLcd.mDataNo==0)HostLcd.mPage0=InData;
+		else HostLcd.mPage1=InData;
+		break;
+	case CASET:
+		if(HostLcd.mDataNo==0)HostLcd.mColumn0=InData;
+		else HostLcd.mColumn1=InData;
+		break;
+	case RAMWR://3 bytes are 2 pixels rrrrgggg bbbbrrrr ggggbbbb
+		if(HostLcd.mPhase==0)
+		{
+			HostLcd.mPixel=(WORD)InData<<4;
+			HostLcd.mPhase=1;
+		}
+		else if(HostLcd.mPhase==1)
+		{
+			HostLcdPixel(HostLcd.mPixel|(InData>>4));
+			HostLcd.mPixel=(WORD)(InData&0xF)<<8;
+			HostLcd.mPhase=2;
+		}
+		else
+		{
+			HostLcdPixel(HostLcd.mPixel|InData);
+			HostLcd.mPhase=0;
+		}
+		break;
+	default://other commands do not change display memory
+		break;
+	}
+	HostLcd.mDataNo++;
+}//HostLcdData
+
+void WriteSpiCommand(volatile unsigned int command)
+{
+	HostLcd.mCommand=(BYTE)command;
+	HostLcd.mDataNo=0;
+	if(HostLcd.mCommand==RAMWR)
+	{
+		HostLcd.mPage=HostLcd.mPage0;
+		HostLcd.mColumn=HostLcd.mColumn0;
+		HostLcd.mPhase=0;
+	}
+	LcdSpiWords++;
+}//WriteSpiCommand
+
+void WriteSpiData(volatile unsigned int data)
+{
+	HostLcdData((BYTE)data);
+	LcdSpiWords++;
+}//WriteSpiData
+
+void WriteSpiDataBlock(const BYTE *pData, DWORD InByteNo)
+{
+	DWORD i;
+
+	for(i=0;i<InByteNo;i++)
+		HostLcdData(pData[i]);
+	LcdSpiWords+=InByteNo;
+}//WriteSpiDataBlock
+
+void FillSpiData(const BYTE *pPattern, BYTE InPatternLength, DWORD InByteNo)
+{
+	DWORD i;
+
+	if(!InPatternLength)return;
+	for(i=0;i<InByteNo;i++)
+		HostLcdData(pPattern[i%InPatternLength]);
+	LcdSpiWords+=InByteNo;
+}//FillSpiData
+
+void GpDmaIsrHandler(void)
+{
+}//GpDmaIsrHandler
+
+DWORD GetLcdSpiWords(void)
+{
+	return LcdSpiWords;
+}//GetLcdSpiWords
+
+#if SPI_MEASURE_EN > 0
+DWORD GetSpiTimeStamp(void)
+{
+	return HostTimer3Counts();
+}//GetSpiTimeStamp
+
+DWORD GetLcdDmaWaitTime(void)
+{
+	return 0;//simulated LCD transfers do not wait
+}//GetLcdDmaWaitTime
+
+void MeasureAdcConversions(WORD InConversionsNo, sSpiTime *pOutPolled, sSpiTime *pOutEngine)
+{
+	DWORD Start;
+	WORD i;
+
+	Start=HostTimer3Counts();
+	for(i=0;i<InConversionsNo;i++)
+		(void)GetAdcConversion(i&(ADC_CHANNEL_NO-1));
+	pOutPolled->mTime=pOutPolled->mCpuTime=HostTimer3Counts()-Start;
+	*pOutEngine=*pOutPolled;//there is no sampling engine on the host
+}//MeasureAdcConversions
+#endif //SPI_MEASURE_EN
+
+void InitSpiAdc(void)
+{
+}//InitSpiAdc
+
+WORD GetAdcConversion(BYTE InAdcChannelNo)
+{
+	return HostAdcValue[InAdcChannelNo&(ADC_CHANNEL_NO-1)];
+}//GetAdcConversion
+
+void AdcSamplingTick(void)
+{
+}//AdcSamplingTick
+
+WORD GetAdcLatest(BYTE InAdcChannelNo)
+{
+	if((InAdcChannelNo>=ADC_CHANNEL_NO) || !Timer3IsRunning)
+		return 0;//there are not samples
+	return HostAdcValue[InAdcChannelNo];
+}//GetAdcLatest
+
+WORD GetAdcAverage(BYTE InAdcChannelNo, BYTE InSamplesNo)
+{
+	if(!InSamplesNo)
+		return 0;
+	return GetAdcLatest(InAdcChannelNo);
+}//GetAdcAverage
+
+WORD GetAdcMedian(BYTE InAdcChannelNo, BYTE InSamplesNo)
+{
+	if(!InSamplesNo)
+		return 0;
+	return GetAdcLatest(InAdcChannelNo);
+}//GetAdcMedian
+
+BYTE GetAdcSamplesSince(BYTE InAdcChannelNo, DWORD InTimeStamp)
+{
+	DWORD Now=GetTimer3Ticks();
+	DWORD Period;
+
+	if((InAdcChannelNo>=ADC_CHANNEL_NO) || !Timer3IsRunning || (Now<InTimeStamp))
+		return 0;
+	Period=HostAdcPeriod[InAdcChannelNo]*ADC_SAMPLING_TIMER3_TICKS;
+	if(!Period)
+		return 0;//channel is not sampled
+	if((Now-InTimeStamp)/Period>=ADC_SAMPLE_BUFFER_SIZE)
+		return ADC_SAMPLE_BUFFER_SIZE;
+	return (BYTE)((Now-InTimeStamp)/Period);
+}//GetAdcSamplesSince
+
+WORD CalculateAdcOffset(BYTE InAdcChannelNo, WORD InSamplesNo, WORD InDelayInTicks )
+{
+	DWORD Sum=0;
+	WORD i;
+
+	if(!InSamplesNo)
+		return 0;
+	for(i=0;i<InSamplesNo;i++)//takes the same time as on the board
+	{
+		Sum+=GetAdcConversion(InAdcChannelNo);
+		OSTimeDly(InDelayInTicks);
+	}
+	return (WORD)(Sum/InSamplesNo);
+}//CalculateAdcOffset
+
+/*
+*********************************************************************************************************
+*                                       UART0 (hw_uart.h)
+*
+* Note(s):     UART0 is the host terminal. Characters are read by UART0 ISR when stdin is ready, <Enter>
+*              is received as '\r' as from terminal connected to the board. Output is written line by line.
+*********************************************************************************************************
+*/
+//writes buffered output to stdout - called with IRQs disabled
+static void Uart0TxWrite(void)
+{
+	WORD Written=0;
+	ssize_t Result;
+
+	while(Written<Uart0TxLevel)
+	{
+		Result=write(STDOUT_FILENO,Uart0TxBuffer+Written,Uart0TxLevel-Written);
+		if(Result<=0)
+			break;//output is closed - data are lost
+		Written+=(WORD)Result;
+	}
+	Uart0TxLevel=0;
+}//Uart0TxWrite
+
+void InitUart0(void)
+{
+	Uart0RxSem=OSSemCreate(0);
+	if(!Uart0RxSem)
+		UCOSII_RES_EXCEPTION;
+	VICVectAddr6 = (DWORD)Uart0IsrHandler;
+	VICIntEnable |= BIT6;
+	OS_CPU_HostIrqSource(OS_CPU_HOST_IRQ_UART0,STDIN_FILENO);
+	atexit(Uart0Flush);//last messages are not lost when simulation exits
+}//InitUart0
+
+void Uart0IsrHandler(void)
+{
+	char Received[UART0_RX_BUFFER_SIZE];
+	struct pollfd Stdin;
+	int Available=0;
+	int Length;
+	int i;
+
+	Stdin.fd=STDIN_FILENO;
+	Stdin.events=POLLIN;
+	if((poll(&Stdin,1,0)<=0) || !Stdin.revents)
+		return;//IRQ requested again before the previous one was served
+	if((ioctl(STDIN_FILENO,FIONREAD,&Available)<0) || !Available)
+	{
+		OS_CPU_HostIrqSource(OS_CPU_HOST_IRQ_UART0,-1);//end of input - terminal disconnected
+		return;
+	}
+	if(Available>(int)sizeof(Received))
+		Available=sizeof(Received);//the rest is read by the next IRQ
+	Length=read(STDIN_FILENO,Received,Available);
+	for(i=0;i<Length;i++)
+	{
+		if(((Uart0RxHead+1)%UART0_RX_BUFFER_SIZE)==Uart0RxTail)
+		{
+			Uart0RxOverflows++;//character is lost as on the board
+			continue;
+		}
+		Uart0RxBuffer[Uart0RxHead]=(Received[i]=='\n')?'\r':Received[i];
+		Uart0RxHead=(Uart0RxHead+1)%UART0_RX_BUFFER_SIZE;
+		OSSemPost(Uart0RxSem);
+	}
+}//Uart0IsrHandler
+
+//gets character from RX buffer - there must be any
+static int Uart0RxGet(void)
+{
+	int ch;
+#if OS_CRITICAL_METHOD == 3
+	OS_CPU_SR  cpu_sr;
+#endif
+
+	OS_ENTER_CRITICAL();
+	ch=Uart0RxBuffer[Uart0RxTail];
+	Uart0RxTail=(Uart0RxTail+1)%UART0_RX_BUFFER_SIZE;
+	OS_EXIT_CRITICAL();
+	return ch;
+}//Uart0RxGet
+
+int Uart0PutChar(int ch)
+{
+#if OS_CRITICAL_METHOD == 3
+	OS_CPU_SR  cpu_sr;
+#endif
+
+	if(ch=='\r')
+		return ch;//host terminal needs only '\n'
+	OS_ENTER_CRITICAL();
+	Uart0TxBuffer[Uart0TxLevel++]=(char)ch;
+	if(Uart0TxLevel>Uart0TxMaxLevel)
+		Uart0TxMaxLevel=Uart0TxLevel;
+	if((ch=='\n') || (Uart0TxLevel==UART0_TX_BUFFER_SIZE))
+		Uart0TxWrite();
+	OS_EXIT_CRITICAL();
+	return ch;
+}//Uart0PutChar
+
+void Uart0PutStr(char *pString)
+{
+	// loop until null-terminator is seen
+	while (*pString != 0x00)
+	{
+		Uart0PutChar(*pString++); //put character by character
+	}
+}//Uart0PutStr
+
+void Uart0Flush(void)
+{
+#if OS_CRITICAL_METHOD == 3
+	OS_CPU_SR  cpu_sr;
+#endif
+
+	OS_ENTER_CRITICAL();
+	Uart0TxWrite();
+	OS_EXIT_CRITICAL();
+}//Uart0Flush
+
+int Uart0GetChar(void)
+{
+	BYTE Result;
+	char ch=0;
+
+	if(!OSRunning)
+	{
+		if(read(STDIN_FILENO,&ch,1)!=1)//wait until any character received
+			return 0;
+		return (ch=='\n')?'\r':ch;
+	}
+	OSSemPend(Uart0RxSem,0x0000,&Result);//wait for UART0 ISR to receive a character
+	if(Result != OS_NO_ERR)UCOSII_RES_EXCEPTION;//Exception when ther is an error
+	return Uart0RxGet();
+}//Uart0GetChar
+
+int Uart0CheckForCharacterReceived(void)
+{
+	if(!OSRunning)
+		return 0;//terminal is read by UART0 ISR only
+	if(!OSSemAccept(Uart0RxSem))//when there is not any charcter received return 0
+		return 0;
+	return Uart0RxGet();//return received character if there is any
+}//Uart0CheckForCharacterReceived
+
+void Uart0DebugMessage(char *pMsgStr,long Value, BYTE GenExcept)
+{
+	Uart0Message(pMsgStr,Value);
+	if(GenExcept)
+	{
+		Uart0Flush();//send out buffered message before operation is stopped
+		DEBUG_EXCEPTION;//SWI to stop operation efter debug message is displayed
+	}
+}//Uart0DebugMessage
+
+void Uart0Message(char *pMsgStr,long Value)
+{
+	Uart0PutStr(pMsgStr);//transimt string to the terminal
+	snprintf(TempResultBuff,sizeof(TempResultBuff),"%ld",Value);//change to string
+	Uart0PutStr(TempResultBuff);//transmit walue
+	Uart0PutChar('\n');//move cursor on terminal to the new line
+}//Uart0Message
+
+int Uart0GetTrmlChar(void)
+{
+	int CharReceived;
+
+	while(!(CharReceived=Uart0GetChar()));//null characters are ignored
+	return CharReceived;
+}//Uart0GetTrmlChar
+
+char *Uart0GetTrmlStr(char* pMsgBuffer, int inLength)
+{
+	char c;   //character received
+	char *s;  //pinter to current position in the buffer;
+
+	s=pMsgBuffer;//s points to buffer beginning
+
+	if (inLength < 2) //sanity check of enough place to capture at least <Enter>
+		return NULL;
+
+	while (--inLength > 0 && (c = (char)Uart0GetTrmlChar()) != '\r')
+		{//read character by character until <Enter> recived
+		*s++ = c;
+		}
+	*s = 0;//terminate recived string with \0
+	if (s==pMsgBuffer)//if nothing received just '\n'
+		return NULL;
+	else
+		return pMsgBuffer;
+}//Uart0GetTrmlStr
+
+DWORD GetUart0TxOverflows(void)
+{
+	return 0;//output is never dropped
+}//GetUart0TxOverflows
+
+DWORD GetUart0RxOverflows(void)
+{
+	return Uart0RxOverflows;
+}//GetUart0RxOverflows
+
+WORD GetUart0TxMaxLevel(void)
+{
+	return Uart0TxMaxLevel;
+}//GetUart0TxMaxLevel
+
+/*
+*********************************************************************************************************
+*                                       UART1 (hw_uart1.h)
+*
+* Note(s):     Voice recognition module is not connected - nothing is ever received.
+*********************************************************************************************************
+*/
+void InitUart1(void)
+{
+}//InitUart1
+
+int Uart1PutChar(int ch)
+{
+	return ch;
+}//Uart1PutChar
+
+void Uart1PutStr(char *pString)
+{
+	(void)pString;
+}//Uart1PutStr
+
+int Uart1CheckForCharacterReceived(void)
+{
+	return 0;
+}//Uart1CheckForCharacterReceived
+
+int Uart1GetChar(void)
+{
+	int ch;
+
+	while(!(ch=Uart1CheckForCharacterReceived()))
+		OSTimeDly(UART1_DELAY_TICKS);//wait 1 tick to not block OS
+	return ch;
+}//Uart1GetChar
+
+int Uart1GetCharWithTimeout(DWORD TimeOut)
+{
+	int ch=0;//character received
+	DWORD  NoOfTimeoutTicks=(TimeOut*OS_TICKS_PER_SEC)/1000;//number of OS Ticks counted for timeout
+
+	if(NoOfTimeoutTicks==0)// when infinite wait
+	{
+		while(TRUE)//infinite loop untill anything received
+		{
+		if((ch=Uart1CheckForCharacterReceived())) break;//when any character received break
+		OSTimeDly(UART1_DELAY_TICKS);//wait 1 ticke to not block OS
+		}
+	}
+	else
+	{
+		while(NoOfTimeoutTicks>0)
+		{
+		OSTimeDly(UART1_DELAY_TICKS);
+		NoOfTimeoutTicks-=1;
+		if((ch=Uart1CheckForCharacterReceived())) break;//when any character received break
+		}
+	}
+	return ch;
+}//Uart1GetCharWithTimeout
+
+/*
+*********************************************************************************************************
+*                                       TRACK MOTORS MODEL (hw_host.h)
+*********************************************************************************************************
+*/
+void HostSetTrackMotors(WORD InLeftEfficiency,WORD InRightEfficiency)
+{
+	HostTrack[LEFT_TRACK_TSK].mEfficiency=InLeftEfficiency;
+	HostTrack[RIGHT_TRACK_TSK].mEfficiency=InRightEfficiency;
+}//HostSetTrackMotors
+
+unsigned long long HostGetTrackDistance(BYTE InTrack)
+{
+	return HostTrack[InTrack].mDistance;
+}//HostGetTrackDistance
+
+DWORD HostGetTrackPulseLength(BYTE InTrack,BYTE InCount)
+{
+	if(!InCount || !HostTrack[InTrack].mEfficiency)
+		return 0;
+	return (DWORD)((HOST_TRACK_PULSE_COUNT_TICKS*1000)/((DWORD)InCount*HostTrack[InTrack].mEfficiency));
+}//HostGetTrackPulseLength
+
+/*
+*********************************************************************************************************
+*                                       LCD EMULATOR (hw_host.h)
+*********************************************************************************************************
+*/
+WORD HostGetLcdPixel(int x, int y)
+{
+	x+=HOST_LCD_PAGE_OFFSET;
+	if((x<0) || (x>=HOST_LCD_PAGES) || (y<0) || (y>=HOST_LCD_COLUMNS))
+		return 0;
+	return HostLcdMemory[x][y];
+}//HostGetLcdPixel
+
+void HostFillLcd(WORD InColor)
+{
+	int i,j;
+
+	for(i=0;i<HOST_LCD_PAGES;i++)
+		for(j=0;j<HOST_LCD_COLUMNS;j++)
+			HostLcdMemory[i][j]=InColor;
+}//HostFillLcd
+
+/*
+*********************************************************************************************************
+*                                       HEAP TRACE (hw_host.h)
+*********************************************************************************************************
+*/
+void HostHeapTrace(void *pInBlock,unsigned int InSize)
+{
+	static FILE *pTrace;
+	static BYTE TraceChecked;//TRUE after environment variable was checked
+	char *pFileName;
+
+	if(!TraceChecked)
+	{
+		TraceChecked=TRUE;
+		pFileName=getenv(HOST_HEAP_TRACE_ENV);
+		if(pFileName && !(pTrace=fopen(pFileName,"w")))
+			fprintf(stderr,"walle: cannot record heap calls into %s\n",pFileName);
+	}
+	if(!pTrace)
+		return;
+	if(InSize)
+		fprintf(pTrace,"m %p %u\n",pInBlock,InSize);
+	else
+		fprintf(pTrace,"f %p\n",pInBlock);
+	fflush(pTrace);//walle is usually stopped by signal
+}//HostHeapTrace
@@ -1,392 +1,1064 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        hw_spi.c
-* Description: Functions to control SPI0 conected to LCD for OLIMEX LPC 2378 eval board
-* Author:      Bogdan Kowalczyk
-* Date:        5-Aug-2008
-* History:
-* 5-Aug-2008 - Initial version - extracted from original James P Lynch file and modified for OLIMEX LPC 2378
-* 13-Oct-2009 - Added MCP 3208 SPI A/D handling through SSP1 interface
-* 12-Dec-2010 - Chnged ADC CLK to almost 2MHz (to have as quick readings as possible) 
-*               and added MUTEX protection of ADC
-* 6-Jan-2011 - Changed ADC readings to 500 000Hz to avoid random wrong readings which appeared for 2MHz
-* 
-*********************************************************************************************************
-*/
-
-#include "type.h"
-#include "hw_lpc23xx.h" //Header file for NXP LPC23xx/24xx Family Microprocessors
-
-//includes to get access to uCOS-II mutex to protect ADC which is going to be a coomon resource for diffrent managers
-#include "os_cpu.h"
-#include "os_cfg.h"
-#include "os_ucos_ii.h"
-#include "lib_error.h"
-
-#include "hw_gpio.h"
-#include "hw_spi.h"
-
-//IMPORTANT! Access to the SPI ADC is protected by mutex to avoid
-//           problems when ADC is used by two different managers
-//           Mutex is only operated by ADC API functions not accessed directly.
-OS_EVENT* AdcMutex; 
-
-
-//  *********************************************************************************************
-//   						InitSpiLcd( )
-//  SSP0 is used to handling LCD connection - SSP is setup to work in SPI mode
-//	Sets up SPI channel 0 for communications to Nokia 6610 LCD Display                                                          
-//     
-//	I/O ports used:		PA2  = LCD Reset (set to low to reset)
-//						PA12 = LCD chip select (set to low to select the LCD chip)                                                              
-//						PA16 = SPI0_MISO Master In - Slave Out (not used in LCD interface)
-//						PA17 = SPI0_MOSI Master Out - Slave In pin (Serial Data to LCD slave)
-//						PA18 = SPI0_SPCK  Serial Clock (to LCD slave)					                                              
-//						PB20 = backlight control (normally PWM control, 1 = full on)	                                                                                                              
-//
-//  Author:  Olimex, James P Lynch     August 30, 2007
-//  IMPORTANT! 
-//           Need to be called after GPIO is initailzed
-//
-//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
-//  ********************************************************************************************* 
-void InitSpiLcd(void) {
-	//SSP channel 0 is used to control LCD in SPI configuration
-	//some I/O port lines are used as well
-	
-	//P1.26 - Output LCD_BL
-	FIO1DIR |= BIT26;
-	FIO1SET = BIT26; //set P1.26 HIGH should turn on LCD
-	
-	//P3.25 - Output - LCD_RESET
-	FIO3DIR |= BIT25;
-	FIO3SET = BIT25; // SetP3.25 to HIGH   (assert LCD Reset low then high to reset the controller)
-	
-	
-	//Setup uP pins for SPI P1.24 - MOSI0, P1.23 - MISO0, P1.21 - SSEL0, P1.20 - SCK0
-	PINSEL3 |= BIT17|BIT16|BIT15|BIT14|BIT11|BIT10|BIT9|BIT8;
-	
-	//setup Control Register to RESET values to assure known starup state with SSP module disbled
-	//Default values are modified only when needed to get final SPP configuration
-	SSP0CR0 = 0;
-	SSP0CR1 = 0;
-	
-	//select 9 bits transmission, SPI format, CPOL = HIGH inactive CLK state is high
-	//CPHA = LOW data captured on falling edge, SCR = 0 Serial Clock equal prescaler clock 
-	SSP0CR0 |= BIT6|BIT3;
-	
-	//set SSP prescaler clock => Fpclk/4 = 12,5 MHz/4 = 3125000Hz <-> 320ns 
-	SSP0CPSR = 0x04;
-	
-	//disable all interrupts - polling mode will be in use
-	SSP0IMSC = 0x00; 
-	
-	//disable DMA 
-	SSP0DMACR = 0;
-	
-	//enable SPP module after setup 
-	SSP0CR1 |= BIT1; 
-}//InitSpi
-
-
-//  *****************************************************************************
-//   						WriteSpiCommand.c
-// 
-//     Writes 9-bit command to LCD display via SPI interface
-//     
-//	   Inputs:	data  -  Leadis LDS176 controller/driver command
-//						                                              
-//						                                                             
-//	   Note:  clears bit 8 to indicate command transfer                                                           
-//
-//  Author:  Olimex, James P Lynch     August 30, 2007
-//  IMPORTANT! 
-//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
-//  ***************************************************************************** 
-void WriteSpiCommand(volatile unsigned int command){
-	
-	// wait for the previous transfer to complete
-	while ((SSP0SR & BIT0) != BIT0);//wait until Transmit FIFO empty
-
-	// clear bit 8 - indicates a "command" 
-	command = (command & ~0x0100);
-
-	// send the command
-	SSP0DR = command;
-}//WriteSpiCommand
-
-
-//  *****************************************************************************
-//   						WriteSpiData.c
-// 
-//     Writes 9-bit data to LCD display via SPI interface
-//     
-//	   Inputs:	data  -  Leadis LDS176 controller/driver command
-//						                                              
-//						                                                             
-//	   Note:  Sets bit 8 to indicate data transfer                                                           
-//
-//  Author:  Olimex, James P Lynch     August 30, 2007
-//  IMPORTANT! 
-//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
-//  ***************************************************************************** 
-
-void WriteSpiData(volatile unsigned int data){
-
-	// wait for the previous transfer to complete
-	while ((SSP0SR & BIT0) != BIT0);//wait until Transmit FIFO empty
-
-	// set bit 8, indicates "data" 
-	data = (data | 0x0100);
-
-	// send the data
-	SSP0DR = data;
-
-}//WriteSpiData
-
-//  *********************************************************************************************
-//   						InitSpiAdc( )
-//  SSP1 is used to handling A/D MCP 3208. SSP is setup to work in SPI mode and connected to ADC
-//  as defined below:
-//		MCP 3208 CLK <- SCK1 (P0.7) - ETX2.2
-//      MCP 3208 DIN <- MOSI1 (P0.9) - ETX2.4
-//      MCP 3208 DOUT -> MISO1 (P0.8) - ETX2.3
-//      MCP 3208 NCS <- SSEL1 (P0.6) - ETX2.1
-//     
-//  IMPORTANT!
-//           1) It was noted that SPI speed to ADC cannot be larger to 12,5Mhz/18 to get correct readings
-//           for higher speed from time to time there are wrong readings possible.
-//           2) Need to be called after GPIO is initailzed (just for the case we decide to control SSEL through GPIO output)
-//			 3) Need to be call after uCOS-II is initialized because of ADC mutex
-//           
-//  ********************************************************************************************* 
-void InitSpiAdc(void) 
-{
-	//SSP channel 1 is used to control ADC MCP3208
-	//it is assumed that SSP1 is tern on (PCONP) on uC reset
-	
-	//Setup uP pins for SPI1 out of P0 port to get below setup (PINSEL0=0 after reset):
-	//		MCP 3208 CLK <- SCK1 (P0.7) - ETX2.2
-	//      MCP 3208 DIN <- MOSI1 (P0.9) - ETX2.4
-	//      MCP 3208 DOUT -> MISO1 (P0.8) - ETX2.3
-	//      MCP 3208 NCS <- SSEL1 (P0.6) - ETX2.1	
-	PINSEL0 |= BIT19|BIT17|BIT15|BIT13;
-	
-	//setup Control Register to RESET values to assure known starup state with SSP module disbled
-	//Default values are modified only when needed to get final SPP configuration
-	SSP1CR0 = 0;
-	SSP1CR1 = 0;
-	
-	//select 8 bits transmission, SPI format, CPOL = HIGH inactive CLK state is high
-	//CPHA = HIGH data captured on rising edge, SCR = 0 Serial Clock equal prescaler clock 
-	SSP1CR0 |= BIT7|BIT6|BIT2|BIT1|BIT0;
-	
-	//I decided to increase clock to be closed to 2MHz
-	//but 2MHz did not work correctly resulting with some wrong readings so final setup
-	//is 12,5Mhz/25 = 500 000Hz -> T = 2us 
-	//set SSP prescaler clock => Fpclk/100 = 12,5 MHz/100 = 125000Hz <-> 8uS 
-	//SSP1CPSR = 0x64;// div Fpclk by 100
-	SSP1CPSR = 0x19;//experimet showed that 0x18 works while 0x17 does not finally i decided for 0x19
-	
-	//disable all interrupts - polling mode will be in use
-	SSP1IMSC = 0x00; 
-	
-	//disable DMA 
-	SSP1DMACR = 0;
-	
-	//enable SPP module after setup in master mode
-	SSP1CR1 |= BIT1; 
-	
-	//setup ADC mutex
-	AdcMutex=OSSemCreate(1);//initialize ADC mutex to avaliable state
-	if(!AdcMutex)UCOSII_RES_EXCEPTION;//Exception - when there is not uCOS-II event blocks availiable (uCOS-II resources are not availaible) 
-}//InitSpiAdc
-
-/*
-*********************************************************************************************************
-* Name:                                    GetAdcAccess 
-* 
-* Description: Call to get access to ADC
-*       
-*
-* Arguments:   none
-*
-* Returns:     none
-*
-* Note(s):     
-*             Need to be called to get exclusive access to ADC
-* *********************************************************************************************************
-*/
-void GetAdcAccess(void)
-{
-	BYTE Result;
-	OSSemPend(AdcMutex,0x0000,&Result);//for uCOS-II the value 0x0000 means wait for mutex infinite
-	if(Result != OS_NO_ERR)UCOSII_RES_EXCEPTION;//Exception when ther is an error
-}// GetADCAccess
-
-/*
-*********************************************************************************************************
-* Name:                                    ReleaseAdcAccess 
-* 
-* Description: Call to release access to ADC
-*       
-*
-* Arguments:   none
-*
-* Returns:     none
-*
-* Note(s):     
-*            
-* *********************************************************************************************************
-*/
-void ReleaseAdcAccess(void)
-{
-	OSSemPost(AdcMutex);//release ADC mutex
-}// ReleaseADCAccess
-
-//  *****************************************************************************
-//   						GetAdcConversion
-// 
-//     Initialize ADC conversion for specified channel
-//		Input:
-//				- number of channel for which we want to initialize ADC conversion
-//                0x00 - CH0
-//                ...
-//                0x07 - CH7
-//      Output
-//             - 12 bit conversion results (on D0 to D12)
-//
-//   IMPORTANT!
-//           This command sends three bytes to initialize conversion of the ADC
-//           after this command 3 bytes from SSP are read
-//
-//  ***************************************************************************** 
-WORD GetAdcConversion(BYTE InAdcChannelNo)
-{
-	BYTE TmpData1 = 0x00;
-	BYTE TmpData2 = 0x00;
-	BYTE TmpData3 = 0x00;
-	BYTE TmpInAdcChannelNo;
-	WORD Result = 0x0000;
-	
-	//setup first byte
-	TmpData1|=BIT2|BIT1;//setup start of conversion and singl-ended DAC mode
-	TmpInAdcChannelNo = InAdcChannelNo;
-	TmpData1|=(TmpInAdcChannelNo >> 2);//shift InAdcChannelNo right to get BIT2 on BIT0 position
-
-	//setup second byte
-	TmpInAdcChannelNo = InAdcChannelNo;
-	TmpData2|= (TmpInAdcChannelNo << 6);//move BIT1 and BIT0 to be MSB
-
-	//setup third byte
-	TmpData3 =0xAA;//do not care byte it can have any value
-	
-	while ((SSP1SR & BIT0) != BIT0);//wait until Transmit FIFO empty FIFO is ready to capture up to 8 frames
-	SSP1DR = TmpData1;//send first byte
-	SSP1DR = TmpData2;//send second byte
-	SSP1DR = TmpData3;//send third byte
-	
-	while ((SSP1SR & BIT4) == BIT4);//wait as long as SSP controler is busy (sending and/or receiving)
-	
-	TmpData1 = SSP1DR;//read first byte it does not contain any value
-	TmpData2 = SSP1DR;//read second byte
-	TmpData3 = SSP1DR;//read third byte 
-	Result = TmpData2;
-	Result = Result << 8;
-	Result |= TmpData3;//setup final result
-	Result &=0x0FFF;//zeros MSBs
-	return Result;
-}//	GetAdcConversion
-
-
-
-/* IMPORTANT! This is commented out version I returned finally to the original
- * implementation once it was obvious that SPI speed is the root cause of wrong ADC readings
- * not ADC handling
-WORD GetAdcConversion(BYTE InAdcChannelNo)
-{
-	BYTE TmpData1; //reset further
-	BYTE TmpData2 = 0x00;
-	BYTE TmpData3 = 0x00;
-	BYTE TmpInAdcChannelNo;
-	WORD Result = 0x0000;
-	
-	//assure there is not any received data befor we run conversion
-	while ((SSP1SR & BIT2) == BIT2)//as long as receive FIFO is not empty take all data to make it empty
-		TmpData1 = SSP1DR;//read first byte it does not contain any value
-	TmpData1 = 0x00;//reset tmp data before we strat using it
-	
-	//setu first byte
-	TmpData1|=BIT2|BIT1;//setup start of conversion and singl-ended DAC mode
-	TmpInAdcChannelNo = InAdcChannelNo;
-	TmpData1|=(TmpInAdcChannelNo >> 2);//shift InAdcChannelNo right to get BIT2 on BIT0 position
-
-	//setup second byte
-	TmpInAdcChannelNo = InAdcChannelNo;
-	TmpData2|= (TmpInAdcChannelNo << 6);//move BIT1 and BIT0 to be MSB
-
-	//setup third byte
-	TmpData3 =0xAA;//do not care byte it can have any value
-	
-	while ((SSP1SR & BIT0) != BIT0);//wait until Transmit FIFO empty FIFO is ready to capture up to 8 frames
-	SSP1DR = TmpData1;//send first byte
-	SSP1DR = TmpData2;//send second byte
-	SSP1DR = TmpData3;//send third byte
-	
-	while ((SSP1SR & BIT4) == BIT4);//wait as long as SSP controler is busy (sending and/or receiving)
-	
-	TmpData1 = SSP1DR;//read first byte it does not contain any value
-	TmpData2 = SSP1DR;//read second byte
-	TmpData3 = SSP1DR;//read third byte 
-	Result = TmpData2;
-	Result = Result << 8;
-	Result |= TmpData3;//setup final result
-	Result &=0x0FFF;//zeros MSBs
-	return Result;
-}//	GetAdcConversion
-*/
-
-/*
-*********************************************************************************************************
-* Name:                                    CalculateAdcOffset
-* 
-* Description: Calculates ADC offset for specified channel
-*       
-*
-* Arguments:   
-* 				InAdcChannelNo - number of channel for which we want to initialize ADC conversion
-*                                0x00 - CH0
-*                                ...
-*                                0x07 - CH7
-*               InSamplesNo - number of samples which are averaged needs to be >=1
-* 				InDelayInTicks - delay in OS ticks between samples
-*
-* Returns:     Calculated ofset value for ADC
-*
-* Note(s):     
-*            
-* *********************************************************************************************************
-*/
-WORD CalculateAdcOffset(BYTE InAdcChannelNo, WORD InSamplesNo, WORD InDelayInTicks )
-{
-	DWORD Offset=0;//store offset in DWORD for the case large number of samples is summed out
-	WORD i;//counts subsequent samples taken
-	
-	if(!InSamplesNo) return 0;
-	for(i=1;i <= InSamplesNo;i++)
-	{
-		Offset += (DWORD)GetAdcConversion(InAdcChannelNo);	
-		OSTimeDly(InDelayInTicks);
-	}
-	Offset=Offset/((DWORD)InSamplesNo);
-	return (WORD)Offset;//convert offset back to WORD and return
-}//CalculateAdcOffset
-
-
-	
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        hw_spi.c
+* Description: Functions to control SPI0 conected to LCD for OLIMEX LPC 2378 eval board
+* Author:      Bogdan Kowalczyk
+* Date:        5-Aug-2008
+* History:
+* 5-Aug-2008 - Initial version - extracted from original James P Lynch file and modified for OLIMEX LPC 2378
+* 13-Oct-2009 - Added MCP 3208 SPI A/D handling through SSP1 interface
+* 12-Dec-2010 - Chnged ADC CLK to almost 2MHz (to have as quick readings as possible) 
+*               and added MUTEX protection of ADC
+* 6-Jan-2011 - Changed ADC readings to 500 000Hz to avoid random wrong readings which appeared for 2MHz
+* 17-Oct-2026 - ADC sampled in background by Timer3 driven sampling engine into per channel sample buffers
+*               ADC mutex removed as readers do not access SSP1 any longer
+* 17-Oct-2026 - LCD data blocks sent to SSP0 by GPDMA, writing task waits on semaphore until transfer is done
+* 17-Oct-2026 - Added counter of words sent to LCD
+* 17-Oct-2026 - Added SPI_MEASURE_EN measurement of LCD DMA waits, sampling engine time and polled ADC conversions
+*********************************************************************************************************
+*/
+
+#include "type.h"
+#include "hw_lpc23xx.h" //Header file for NXP LPC23xx/24xx Family Microprocessors
+
+//includes to get access to uCOS-II critical sections protecting ADC sample buffers
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+#include "lib_error.h"
+
+#include "hw_gpio.h"
+#include "hw_spi.h"
+#include "hw_timer.h"
+
+//samples of the single ADC channel collected by the sampling engine
+typedef struct
+{
+	WORD mValue[ADC_SAMPLE_BUFFER_SIZE];//the latest samples
+	DWORD mTimeStamp[ADC_SAMPLE_BUFFER_SIZE];//Timer3 ticks when conversion of the sample was started
+	BYTE mHead;//place for the next sample
+	BYTE mCount;//number of valid samples in the buffer
+	WORD mPeriod;//sampling period in sampling engine ticks (0 - channel is not sampled)
+	WORD mCountdown;//number of sampling engine ticks left to the next sample
+} sAdcChannel;
+
+//IMPORTANT! SSP1 (ADC) is owned by the sampling engine run from Timer3 ISR.
+//           Sample buffers are updated by ISR so readers access them in critical sections only.
+static sAdcChannel AdcChannel[ADC_CHANNEL_NO];//sample buffers of every ADC channel
+static volatile BYTE AdcSamplingOn;//set once sampling engine is initialized
+static BYTE AdcTickDivider;//counts Timer3 ticks up to ADC_SAMPLING_TIMER3_TICKS
+static BYTE AdcNextChannel;//channel from which round robin search for the channel to sample starts
+static BYTE AdcPendingChannel;//channel which conversion is in progress or ADC_NO_CHANNEL
+static DWORD AdcPendingTimeStamp;//time stamp of conversion in progress
+
+//IMPORTANT! GPDMA can access AHB RAM only (not local RAM where variables are) so DMA buffers
+//           are placed in USB RAM section (.dma_ram) see linker command file
+#define DMA_RAM __attribute__ ((section(".dma_ram")))
+
+static WORD LcdDmaBuffer[2][LCD_DMA_BUFFER_SIZE] DMA_RAM;//double buffer of 9 bit LCD words transferred by GPDMA
+static OS_EVENT* LcdDmaSem;//posted by GPDMA ISR when LCD transfer is done
+static volatile BYTE LcdDmaBusy;//set when LCD DMA transfer is in progress
+static BYTE LcdDmaIrq;//set when LCD DMA transfer completion is signaled by interrupt (not polled)
+static DWORD LcdSpiWords;//number of 9 bit words sent to LCD so far (used to measure LCD traffic)
+
+#if SPI_MEASURE_EN > 0
+static DWORD LcdDmaWaitTime;//Timer3 counts tasks waited on LcdDmaSem
+static DWORD AdcEngineTime;//Timer3 counts spent in sampling engine
+static volatile DWORD AdcEngineConversions;//number of conversions done by sampling engine
+#endif
+
+
+//  *********************************************************************************************
+//   						InitSpiLcd( )
+//  SSP0 is used to handling LCD connection - SSP is setup to work in SPI mode
+//	Sets up SPI channel 0 for communications to Nokia 6610 LCD Display                                                          
+//     
+//	I/O ports used:		PA2  = LCD Reset (set to low to reset)
+//						PA12 = LCD chip select (set to low to select the LCD chip)                                                              
+//						PA16 = SPI0_MISO Master In - Slave Out (not used in LCD interface)
+//						PA17 = SPI0_MOSI Master Out - Slave In pin (Serial Data to LCD slave)
+//						PA18 = SPI0_SPCK  Serial Clock (to LCD slave)					                                              
+//						PB20 = backlight control (normally PWM control, 1 = full on)	                                                                                                              
+//
+//  Author:  Olimex, James P Lynch     August 30, 2007
+//  IMPORTANT! 
+//           Need to be called after GPIO is initailzed
+//
+//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
+//  ********************************************************************************************* 
+void InitSpiLcd(void) {
+	//SSP channel 0 is used to control LCD in SPI configuration
+	//some I/O port lines are used as well
+	
+	//P1.26 - Output LCD_BL
+	FIO1DIR |= BIT26;
+	FIO1SET = BIT26; //set P1.26 HIGH should turn on LCD
+	
+	//P3.25 - Output - LCD_RESET
+	FIO3DIR |= BIT25;
+	FIO3SET = BIT25; // SetP3.25 to HIGH   (assert LCD Reset low then high to reset the controller)
+	
+	
+	//Setup uP pins for SPI P1.24 - MOSI0, P1.23 - MISO0, P1.21 - SSEL0, P1.20 - SCK0
+	PINSEL3 |= BIT17|BIT16|BIT15|BIT14|BIT11|BIT10|BIT9|BIT8;
+	
+	//setup Control Register to RESET values to assure known starup state with SSP module disbled
+	//Default values are modified only when needed to get final SPP configuration
+	SSP0CR0 = 0;
+	SSP0CR1 = 0;
+	
+	//select 9 bits transmission, SPI format, CPOL = HIGH inactive CLK state is high
+	//CPHA = LOW data captured on falling edge, SCR = 0 Serial Clock equal prescaler clock 
+	SSP0CR0 |= BIT6|BIT3;
+	
+	//set SSP prescaler clock => Fpclk/4 = 12,5 MHz/4 = 3125000Hz <-> 320ns 
+	SSP0CPSR = 0x04;
+	
+	//disable all interrupts - SSP0 transfers are polled or done by GPDMA
+	SSP0IMSC = 0x00; 
+	
+	//enable DMA request for transmit FIFO (data blocks are sent by GPDMA channel 0)
+	SSP0DMACR = BIT1;
+	
+	//enable SPP module after setup 
+	SSP0CR1 |= BIT1; 
+	
+	//setup GPDMA used to send LCD data blocks
+	PCONP|=BIT31;//enable USB block to get access to USB RAM where DMA buffers are placed
+	PCONP|=BIT29;//enable GPDMA
+	GPDMA_INT_TCCLR=0xFF;//clear all DMA interrupts
+	GPDMA_INT_ERR_CLR=0xFF;
+	GPDMA_CONFIG=BIT0;//enable GPDMA in little endian mode
+	LcdDmaBusy=0;
+	LcdDmaSem=OSSemCreate(0);//create semaphore to wait for DMA transfer end
+	if(!LcdDmaSem)UCOSII_RES_EXCEPTION;//Exception - when there is not uCOS-II event blocks availiable
+	VICIntEnClr = BIT25;//disable GPDMA interrupt in VIC
+	VICVectAddr25 = (DWORD)GpDmaIsrHandler; //assign address to GPDMA IRQ Handler
+	VICIntEnable |= BIT25;//enable GPDMA interrupts in VIC
+}//InitSpi
+
+
+//  *****************************************************************************
+//   						WriteSpiCommand.c
+// 
+//     Writes 9-bit command to LCD display via SPI interface
+//     
+//	   Inputs:	data  -  Leadis LDS176 controller/driver command
+//						                                              
+//						                                                             
+//	   Note:  clears bit 8 to indicate command transfer                                                           
+//
+//  Author:  Olimex, James P Lynch     August 30, 2007
+//  IMPORTANT! 
+//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
+//  ***************************************************************************** 
+void WriteSpiCommand(volatile unsigned int command){
+	
+	// wait for place in transmit FIFO (FIFO keeps order of commands and data)
+	while ((SSP0SR & BIT1) != BIT1);//wait until Transmit FIFO not full
+	LcdSpiWords++;
+
+	// clear bit 8 - indicates a "command" 
+	command = (command & ~0x0100);
+
+	// send the command
+	SSP0DR = command;
+}//WriteSpiCommand
+
+
+//  *****************************************************************************
+//   						WriteSpiData.c
+// 
+//     Writes 9-bit data to LCD display via SPI interface
+//     
+//	   Inputs:	data  -  Leadis LDS176 controller/driver command
+//						                                              
+//						                                                             
+//	   Note:  Sets bit 8 to indicate data transfer                                                           
+//
+//  Author:  Olimex, James P Lynch     August 30, 2007
+//  IMPORTANT! 
+//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
+//  ***************************************************************************** 
+
+void WriteSpiData(volatile unsigned int data){
+
+ 	// wait for place in transmit FIFO (FIFO keeps order of commands and data)
+	while ((SSP0SR & BIT1) != BIT1);//wait until Transmit FIFO not full
+	LcdSpiWords++;
+
+	// set bit 8, indicates "data" 
+	data = (data | 0x0100);
+
+	// send the data
+	SSP0DR = data;
+
+}//WriteSpiData
+
+/*
+*********************************************************************************************************
+* Name:                                    StartLcdDma
+* 
+* Description: Starts GPDMA channel 0 transfer of 9 bit words to SSP0 transmit FIFO
+*       
+*
+* Arguments:   
+* 				pWords - words to be sent (must be in USB RAM)
+* 				InWordNo - number of words <= LCD_DMA_BUFFER_SIZE
+*
+* Returns:     none
+*
+* Note(s):     
+*            Before kernel is running transfer end is polled otherwise it is signaled by GPDMA interrupt
+* *********************************************************************************************************
+*/
+static void StartLcdDma(const WORD *pWords, WORD InWordNo)
+{
+	LcdDmaIrq=OSRunning;//wait on semaphore only when uCOS-II is running
+	LcdDmaBusy=1;
+	GPDMA_INT_TCCLR=BIT0;//clear any pending channel 0 interrupts
+	GPDMA_INT_ERR_CLR=BIT0;
+	GPDMA_CH0_SRC=(DWORD)pWords;
+	GPDMA_CH0_DEST=(DWORD)&SSP0DR;
+	GPDMA_CH0_LLI=0;//single block transfer
+	//transfer size, source and destination burst 4 (half of SSP FIFO), 16 bits width, source increment, TC interrupt
+	GPDMA_CH0_CTRL=(InWordNo&0x0FFF)|BIT12|BIT15|BIT18|BIT21|BIT26|BIT31;
+	//enable channel, destination SSP0 TX (0), memory to peripheral flow control
+	//terminal count and error interrupts are unmasked only when transfer end is signaled by interrupt
+	GPDMA_CH0_CFG=BIT0|BIT11|(LcdDmaIrq?(BIT14|BIT15):0);
+}//StartLcdDma
+
+/*
+*********************************************************************************************************
+* Name:                                    WaitLcdDma
+* 
+* Description: Waits until LCD GPDMA transfer started by StartLcdDma is done
+*       
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+*            Calling task is suspended on semaphore for the time of transfer
+* *********************************************************************************************************
+*/
+static void WaitLcdDma(void)
+{
+	BYTE Result;
+#if SPI_MEASURE_EN > 0
+	DWORD WaitStart;
+#endif
+	
+	if(!LcdDmaBusy)return;
+	if(LcdDmaIrq)
+	{
+#if SPI_MEASURE_EN > 0
+		WaitStart=GetSpiTimeStamp();
+#endif
+		OSSemPend(LcdDmaSem,0x0000,&Result);//wait for GPDMA ISR
+		if(Result != OS_NO_ERR)UCOSII_RES_EXCEPTION;//Exception when ther is an error
+#if SPI_MEASURE_EN > 0
+		LcdDmaWaitTime+=GetSpiTimeStamp()-WaitStart;
+#endif
+	}
+	else
+	{
+		while(!(GPDMA_RAW_INT_TCSTAT & BIT0) && !(GPDMA_RAW_INT_ERR_STAT & BIT0));//poll end of the transfer
+		GPDMA_INT_TCCLR=BIT0;
+		GPDMA_INT_ERR_CLR=BIT0;
+	}
+	LcdDmaBusy=0;
+}//WaitLcdDma
+
+/*
+*********************************************************************************************************
+* Name:                                    GpDmaIsrHandler
+* 
+* Description: GPDMA Interrupt Service Routine - signals end of LCD transfer
+*       
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+* 			Interrupting device is acknowledged and its sorce of interrupt is cleared on this level.
+* 			Note that VIC of the uP is cleared on the level of OS_CPU_ExceptHndlr function.
+* *********************************************************************************************************
+*/
+void GpDmaIsrHandler(void)
+{
+	if((GPDMA_INT_TCSTAT|GPDMA_INT_ERR_STAT) & BIT0)//channel 0 transfer done (or broken by an error)
+	{
+		GPDMA_INT_TCCLR=BIT0;
+		GPDMA_INT_ERR_CLR=BIT0;
+		OSSemPost(LcdDmaSem);//wake up task waiting for transfer end
+	}
+}//GpDmaIsrHandler
+
+/*
+*********************************************************************************************************
+* Name:                                    WriteSpiLcdBlock
+* 
+* Description: Writes block of LCD data bytes (bit 8 set) through SSP0 using GPDMA
+*       
+*
+* Arguments:   
+* 				pData - data bytes
+* 				InByteNo - number of data bytes
+* 				InPatternLength - 0 when pData has InByteNo bytes, otherwise number of bytes of pData
+* 								repeated until InByteNo bytes are written
+*
+* Returns:     none
+*
+* Note(s):     
+*            Data are copied into one DMA buffer when the other one is transferred
+*            Repeated pattern is copied only once and the same buffer is transferred many times
+* *********************************************************************************************************
+*/
+static void WriteSpiLcdBlock(const BYTE *pData, DWORD InByteNo, BYTE InPatternLength)
+{
+	WORD *pBuffer;
+	WORD ChunkMax;//max number of words in one transfer
+	WORD ChunkNo;//number of words in current transfer
+	WORD i;
+	BYTE BufferNo=0;
+	
+	if(InByteNo<LCD_DMA_MIN_WORDS)//not worth to use DMA for few words
+	{
+		for(i=0;i<InByteNo;i++)
+			WriteSpiData(pData[InPatternLength ? i%InPatternLength : i]);
+		return;
+	}
+	LcdSpiWords+=InByteNo;
+	
+	if(InPatternLength)//fill buffer with the pattern once
+	{
+		ChunkMax=(LCD_DMA_BUFFER_SIZE/InPatternLength)*InPatternLength;//every transfer starts from pattern begin
+		pBuffer=LcdDmaBuffer[0];
+		for(i=0;i<ChunkMax;i++)pBuffer[i]=pData[i%InPatternLength]|0x0100;// set bit 8, indicates "data"
+		while(InByteNo)
+		{
+			ChunkNo=(InByteNo>ChunkMax) ? ChunkMax : (WORD)InByteNo;
+			WaitLcdDma();
+			StartLcdDma(pBuffer,ChunkNo);
+			InByteNo-=ChunkNo;
+		}
+	}
+	else
+	{
+		while(InByteNo)
+		{
+			ChunkNo=(InByteNo>LCD_DMA_BUFFER_SIZE) ? LCD_DMA_BUFFER_SIZE : (WORD)InByteNo;
+			pBuffer=LcdDmaBuffer[BufferNo];
+			for(i=0;i<ChunkNo;i++)pBuffer[i]=pData[i]|0x0100;// set bit 8, indicates "data"
+			WaitLcdDma();//previous transfer done so the next one can be started
+			StartLcdDma(pBuffer,ChunkNo);
+			BufferNo^=1;//fill the other buffer when this one is transferred
+			pData+=ChunkNo;
+			InByteNo-=ChunkNo;
+		}
+	}
+	WaitLcdDma();//block is in SSP0 FIFO when returned
+}//WriteSpiLcdBlock
+
+/*
+*********************************************************************************************************
+* Name:                                    WriteSpiDataBlock
+* 
+* Description: Writes block of LCD data bytes through SSP0 using GPDMA
+*       
+*
+* Arguments:   
+* 				pData - data bytes
+* 				InByteNo - number of data bytes
+*
+* Returns:     none
+*
+* Note(s):     
+*            Calling task is suspended while data are shifted out so other tasks can run
+* *********************************************************************************************************
+*/
+void WriteSpiDataBlock(const BYTE *pData, DWORD InByteNo)
+{
+	WriteSpiLcdBlock(pData,InByteNo,0);
+}//WriteSpiDataBlock
+
+/*
+*********************************************************************************************************
+* Name:                                    FillSpiData
+* 
+* Description: Writes data pattern through SSP0 using GPDMA until requested number of bytes is written
+*       
+*
+* Arguments:   
+* 				pPattern - pattern bytes
+* 				InPatternLength - number of pattern bytes (1..LCD_DMA_BUFFER_SIZE)
+* 				InByteNo - total number of data bytes to be written
+*
+* Returns:     none
+*
+* Note(s):     
+*            Calling task is suspended while data are shifted out so other tasks can run
+*            Used to fill LCD area with one color (e.g. 3 bytes for two 12 bit pixels)
+* *********************************************************************************************************
+*/
+void FillSpiData(const BYTE *pPattern, BYTE InPatternLength, DWORD InByteNo)
+{
+	if(!InPatternLength)return;
+	WriteSpiLcdBlock(pPattern,InByteNo,InPatternLength);
+}//FillSpiData
+
+/*
+*********************************************************************************************************
+* Name:                                    GetLcdSpiWords
+* 
+* Description: Returns number of 9 bit words (commands and data) sent to LCD since power on
+*       
+*
+* Arguments:   none
+*
+* Returns:     number of words (wraps around)
+*
+* Note(s):     
+*            Difference of two readings gives LCD traffic of drawing done between them
+* *********************************************************************************************************
+*/
+DWORD GetLcdSpiWords(void)
+{
+	return LcdSpiWords;
+}//GetLcdSpiWords
+
+#if SPI_MEASURE_EN > 0
+/*
+*********************************************************************************************************
+* Name:                                    GetSpiTimeStamp
+* 
+* Description: Returns Timer3 fine time stamp (see GetTimer3TimeStamp) and can be called with interrupts enabled
+*       
+*
+* Arguments:   none
+*
+* Returns:     number of Timer3 counts (about 0.48us each)
+*
+* Note(s):     
+* *********************************************************************************************************
+*/
+DWORD GetSpiTimeStamp(void)
+{
+	OS_CPU_SR cpu_sr;
+	DWORD TimeStamp;
+	
+	OS_ENTER_CRITICAL();
+	TimeStamp=GetTimer3TimeStamp();
+	OS_EXIT_CRITICAL();
+	return TimeStamp;
+}//GetSpiTimeStamp
+
+/*
+*********************************************************************************************************
+* Name:                                    GetLcdDmaWaitTime
+* 
+* Description: Returns time tasks spent waiting on semaphore for the end of LCD GPDMA transfers
+*       
+*
+* Arguments:   none
+*
+* Returns:     waiting time in Timer3 counts (wraps around)
+*
+* Note(s):     
+* *********************************************************************************************************
+*/
+DWORD GetLcdDmaWaitTime(void)
+{
+	return LcdDmaWaitTime;
+}//GetLcdDmaWaitTime
+#endif //SPI_MEASURE_EN
+
+//  *********************************************************************************************
+//   						InitSpiAdc( )
+//  SSP1 is used to handling A/D MCP 3208. SSP is setup to work in SPI mode and connected to ADC
+//  as defined below:
+//		MCP 3208 CLK <- SCK1 (P0.7) - ETX2.2
+//      MCP 3208 DIN <- MOSI1 (P0.9) - ETX2.4
+//      MCP 3208 DOUT -> MISO1 (P0.8) - ETX2.3
+//      MCP 3208 NCS <- SSEL1 (P0.6) - ETX2.1
+//     
+//  IMPORTANT!
+//           1) It was noted that SPI speed to ADC cannot be larger to 12,5Mhz/18 to get correct readings
+//           for higher speed from time to time there are wrong readings possible.
+//           2) Need to be called after GPIO is initailzed (just for the case we decide to control SSEL through GPIO output)
+//			 3) Sampling engine starts to work once Timer3 is initialized (InitTimer3)
+//           
+//  ********************************************************************************************* 
+void InitSpiAdc(void) 
+{
+	static const WORD SamplingPeriod[ADC_CHANNEL_NO]={ADC_CH0_SAMPLING_PERIOD,ADC_CH1_SAMPLING_PERIOD,
+		ADC_CH2_SAMPLING_PERIOD,ADC_CH3_SAMPLING_PERIOD,ADC_CH4_SAMPLING_PERIOD,ADC_CH5_SAMPLING_PERIOD,
+		ADC_CH6_SAMPLING_PERIOD,ADC_CH7_SAMPLING_PERIOD};
+	BYTE Ch;
+	
+	//SSP channel 1 is used to control ADC MCP3208
+	//it is assumed that SSP1 is tern on (PCONP) on uC reset
+	
+	//Setup uP pins for SPI1 out of P0 port to get below setup (PINSEL0=0 after reset):
+	//		MCP 3208 CLK <- SCK1 (P0.7) - ETX2.2
+	//      MCP 3208 DIN <- MOSI1 (P0.9) - ETX2.4
+	//      MCP 3208 DOUT -> MISO1 (P0.8) - ETX2.3
+	//      MCP 3208 NCS <- SSEL1 (P0.6) - ETX2.1	
+	PINSEL0 |= BIT19|BIT17|BIT15|BIT13;
+	
+	//setup Control Register to RESET values to assure known starup state with SSP module disbled
+	//Default values are modified only when needed to get final SPP configuration
+	SSP1CR0 = 0;
+	SSP1CR1 = 0;
+	
+	//select 8 bits transmission, SPI format, CPOL = HIGH inactive CLK state is high
+	//CPHA = HIGH data captured on rising edge, SCR = 0 Serial Clock equal prescaler clock 
+	SSP1CR0 |= BIT7|BIT6|BIT2|BIT1|BIT0;
+	
+	//I decided to increase clock to be closed to 2MHz
+	//but 2MHz did not work correctly resulting with some wrong readings so final setup
+	//is 12,5Mhz/25 = 500 000Hz -> T = 2us 
+	//set SSP prescaler clock => Fpclk/100 = 12,5 MHz/100 = 125000Hz <-> 8uS 
+	//SSP1CPSR = 0x64;// div Fpclk by 100
+	SSP1CPSR = 0x19;//experimet showed that 0x18 works while 0x17 does not finally i decided for 0x19
+	
+	//disable all interrupts - polling mode will be in use
+	SSP1IMSC = 0x00; 
+	
+	//disable DMA 
+	SSP1DMACR = 0;
+	
+	//enable SPP module after setup in master mode
+	SSP1CR1 |= BIT1; 
+	
+	//setup sampling engine
+	for(Ch=0;Ch<ADC_CHANNEL_NO;Ch++)
+	{
+		AdcChannel[Ch].mHead=0;
+		AdcChannel[Ch].mCount=0;
+		AdcChannel[Ch].mPeriod=SamplingPeriod[Ch];
+		AdcChannel[Ch].mCountdown=Ch;//spread first samples of channels
+	}
+	AdcTickDivider=0;
+	AdcNextChannel=0;
+	AdcPendingChannel=ADC_NO_CHANNEL;
+	AdcSamplingOn=1;
+}//InitSpiAdc
+
+/*
+*********************************************************************************************************
+* Name:                                    StartAdcConversion
+* 
+* Description: Sends three bytes which start MCP 3208 conversion of specified channel
+*       
+*
+* Arguments:   InAdcChannelNo - number of channel 0x00 (CH0) ... 0x07 (CH7)
+*
+* Returns:     none
+*
+* Note(s):     
+*            Result is available in SSP1 receive FIFO once SSP1 is not busy (see ReadAdcConversion)
+* *********************************************************************************************************
+*/
+static void StartAdcConversion(BYTE InAdcChannelNo)
+{
+	BYTE TmpData1 = 0x00;
+	BYTE TmpData2 = 0x00;
+	BYTE TmpData3 = 0x00;
+	BYTE TmpInAdcChannelNo;
+	
+	//setup first byte
+	TmpData1|=BIT2|BIT1;//setup start of conversion and singl-ended DAC mode
+	TmpInAdcChannelNo = InAdcChannelNo;
+	TmpData1|=(TmpInAdcChannelNo >> 2);//shift InAdcChannelNo right to get BIT2 on BIT0 position
+	
+	//setup second byte
+	TmpInAdcChannelNo = InAdcChannelNo;
+	TmpData2|= (TmpInAdcChannelNo << 6);//move BIT1 and BIT0 to be MSB
+	
+	//setup third byte
+	TmpData3 =0xAA;//do not care byte it can have any value
+	
+	while ((SSP1SR & BIT0) != BIT0);//wait until Transmit FIFO empty FIFO is ready to capture up to 8 frames
+	SSP1DR = TmpData1;//send first byte
+	SSP1DR = TmpData2;//send second byte
+	SSP1DR = TmpData3;//send third byte
+}//StartAdcConversion
+
+/*
+*********************************************************************************************************
+* Name:                                    ReadAdcConversion
+* 
+* Description: Reads three bytes received from MCP 3208 and converts them to the conversion result
+*       
+*
+* Arguments:   none
+*
+* Returns:     12 bit conversion results (on D0 to D12)
+*
+* Note(s):     
+*            Call only when SSP1 is not busy after StartAdcConversion
+* *********************************************************************************************************
+*/
+static WORD ReadAdcConversion(void)
+{
+	BYTE TmpData2;
+	BYTE TmpData3;
+	WORD Result;
+	
+	Result = SSP1DR;//read first byte it does not contain any value
+	TmpData2 = SSP1DR;//read second byte
+	TmpData3 = SSP1DR;//read third byte 
+	Result = TmpData2;
+	Result = Result << 8;
+	Result |= TmpData3;//setup final result
+	Result &=0x0FFF;//zeros MSBs
+	return Result;
+}//ReadAdcConversion
+
+//  *****************************************************************************
+//   						GetAdcConversion
+// 
+//     Initialize ADC conversion for specified channel
+//		Input:
+//				- number of channel for which we want to initialize ADC conversion
+//                0x00 - CH0
+//                ...
+//                0x07 - CH7
+//      Output
+//             - 12 bit conversion results (on D0 to D12)
+//
+//   IMPORTANT!
+//           This command sends three bytes to initialize conversion of the ADC
+//           after this command 3 bytes from SSP are read
+//           When sampling engine is running SSP1 is owned by it so the latest sample is returned
+//
+//  ***************************************************************************** 
+WORD GetAdcConversion(BYTE InAdcChannelNo)
+{
+	if(AdcSamplingOn)return GetAdcLatest(InAdcChannelNo);//SSP1 is owned by sampling engine
+	
+	StartAdcConversion(InAdcChannelNo);
+	while ((SSP1SR & BIT4) == BIT4);//wait as long as SSP controler is busy (sending and/or receiving)
+	return ReadAdcConversion();
+}//	GetAdcConversion
+
+/*
+*********************************************************************************************************
+* Name:                                    AdcSamplingStep
+* 
+* Description: Single sampling engine tick - stores result of the previous conversion and starts the next one
+*       
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+* *********************************************************************************************************
+*/
+static void AdcSamplingStep(void)
+{
+	sAdcChannel *pChannel;
+	BYTE Ch;
+	BYTE i;
+	
+	if(AdcPendingChannel!=ADC_NO_CHANNEL)//store result of conversion started on previous engine tick
+	{
+		if(SSP1SR & BIT4)return;//conversion still in progress (should not happen) so try on next tick
+		pChannel=&AdcChannel[AdcPendingChannel];
+		pChannel->mValue[pChannel->mHead]=ReadAdcConversion();
+		pChannel->mTimeStamp[pChannel->mHead]=AdcPendingTimeStamp;
+		pChannel->mHead=(pChannel->mHead+1)&(ADC_SAMPLE_BUFFER_SIZE-1);
+		if(pChannel->mCount<ADC_SAMPLE_BUFFER_SIZE)pChannel->mCount++;
+		AdcPendingChannel=ADC_NO_CHANNEL;
+#if SPI_MEASURE_EN > 0
+		AdcEngineConversions++;
+#endif
+	}
+	
+	for(Ch=0;Ch<ADC_CHANNEL_NO;Ch++)//count down time to the next sample of every channel
+		if(AdcChannel[Ch].mCountdown)AdcChannel[Ch].mCountdown--;
+	
+	for(i=0;i<ADC_CHANNEL_NO;i++)//find the next channel which needs to be sampled
+	{
+		Ch=(AdcNextChannel+i)&(ADC_CHANNEL_NO-1);
+		if(AdcChannel[Ch].mPeriod && !AdcChannel[Ch].mCountdown)
+		{
+			AdcChannel[Ch].mCountdown=AdcChannel[Ch].mPeriod;
+			AdcNextChannel=(Ch+1)&(ADC_CHANNEL_NO-1);
+			AdcPendingChannel=Ch;
+			AdcPendingTimeStamp=GetTimer3Ticks();
+			StartAdcConversion(Ch);
+			break;
+		}
+	}
+}//AdcSamplingStep
+
+/*
+*********************************************************************************************************
+* Name:                                    AdcSamplingTick
+* 
+* Description: Sampling engine step called from Timer3 ISR on every Timer3 tick
+*       
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+*            Every ADC_SAMPLING_TIMER3_TICKS result of the previous conversion is stored in the channel
+*            sample buffer and conversion of the next channel which sampling period elapsed is started
+*            (channels are searched round robin). There is no waiting for SSP1 inside.
+* *********************************************************************************************************
+*/
+void AdcSamplingTick(void)
+{
+#if SPI_MEASURE_EN > 0
+	DWORD Start;
+#endif
+	
+	if(!AdcSamplingOn)return;
+	if(++AdcTickDivider<ADC_SAMPLING_TIMER3_TICKS)return;
+	AdcTickDivider=0;
+	
+#if SPI_MEASURE_EN > 0
+	Start=GetTimer3TimeStamp();//called from Timer3 ISR so interrupts are disabled
+	AdcSamplingStep();
+	AdcEngineTime+=GetTimer3TimeStamp()-Start;
+#else
+	AdcSamplingStep();
+#endif
+}//AdcSamplingTick
+
+/*
+*********************************************************************************************************
+* Name:                                    CopyAdcSamples
+* 
+* Description: Copies the latest samples of the channel
+*       
+*
+* Arguments:   
+* 				InAdcChannelNo - number of channel 0x00 (CH0) ... 0x07 (CH7)
+*               InSamplesNo - number of the latest samples to copy
+*               pSamples - storage for at least InSamplesNo samples (the latest sample is the first one)
+*
+* Returns:     Number of samples copied (less than InSamplesNo when there are not enough samples)
+*
+* Note(s):     
+* *********************************************************************************************************
+*/
+static BYTE CopyAdcSamples(BYTE InAdcChannelNo, BYTE InSamplesNo, WORD *pSamples)
+{
+	sAdcChannel *pChannel;
+	BYTE Index;
+	BYTE i;
+	OS_CPU_SR cpu_sr;
+	
+	if(InAdcChannelNo>=ADC_CHANNEL_NO)return 0;
+	pChannel=&AdcChannel[InAdcChannelNo];
+	
+	OS_ENTER_CRITICAL();
+	if(InSamplesNo>pChannel->mCount)InSamplesNo=pChannel->mCount;
+	Index=pChannel->mHead;
+	for(i=0;i<InSamplesNo;i++)
+	{
+		Index=(Index-1)&(ADC_SAMPLE_BUFFER_SIZE-1);
+		pSamples[i]=pChannel->mValue[Index];
+	}
+	OS_EXIT_CRITICAL();
+	return InSamplesNo;
+}//CopyAdcSamples
+
+/*
+*********************************************************************************************************
+* Name:                                    GetAdcLatest
+* 
+* Description: Returns the latest sample of the channel
+*       
+*
+* Arguments:   InAdcChannelNo - number of channel 0x00 (CH0) ... 0x07 (CH7)
+*
+* Returns:     The latest 12 bit sample or 0 when there is none
+*
+* Note(s):     
+*            Does not block, can be called from ISR
+* *********************************************************************************************************
+*/
+WORD GetAdcLatest(BYTE InAdcChannelNo)
+{
+	WORD Sample;
+	
+	if(!CopyAdcSamples(InAdcChannelNo,1,&Sample))return 0;
+	return Sample;
+}//GetAdcLatest
+
+/*
+*********************************************************************************************************
+* Name:                                    GetAdcAverage
+* 
+* Description: Returns average of the latest samples of the channel
+*       
+*
+* Arguments:   
+* 				InAdcChannelNo - number of channel 0x00 (CH0) ... 0x07 (CH7)
+*               InSamplesNo - number of the latest samples averaged (up to ADC_SAMPLE_BUFFER_SIZE)
+*
+* Returns:     Average of the samples or 0 when there is none
+*
+* Note(s):     
+*            Does not block
+* *********************************************************************************************************
+*/
+WORD GetAdcAverage(BYTE InAdcChannelNo, BYTE InSamplesNo)
+{
+	WORD Samples[ADC_SAMPLE_BUFFER_SIZE];
+	DWORD Sum=0;
+	BYTE Count;
+	BYTE i;
+	
+	if(InSamplesNo>ADC_SAMPLE_BUFFER_SIZE)InSamplesNo=ADC_SAMPLE_BUFFER_SIZE;
+	Count=CopyAdcSamples(InAdcChannelNo,InSamplesNo,Samples);
+	if(!Count)return 0;
+	for(i=0;i<Count;i++)Sum+=Samples[i];
+	return (WORD)(Sum/Count);
+}//GetAdcAverage
+
+/*
+*********************************************************************************************************
+* Name:                                    GetAdcMedian
+* 
+* Description: Returns median of the latest samples of the channel
+*       
+*
+* Arguments:   
+* 				InAdcChannelNo - number of channel 0x00 (CH0) ... 0x07 (CH7)
+*               InSamplesNo - number of the latest samples taken into account (up to ADC_SAMPLE_BUFFER_SIZE)
+*
+* Returns:     Median of the samples or 0 when there is none
+*
+* Note(s):     
+*            Does not block, use it when single wrong readings need to be filtered out
+* *********************************************************************************************************
+*/
+WORD GetAdcMedian(BYTE InAdcChannelNo, BYTE InSamplesNo)
+{
+	WORD Samples[ADC_SAMPLE_BUFFER_SIZE];
+	WORD Sample;
+	BYTE Count;
+	BYTE i;
+	BYTE j;
+	
+	if(InSamplesNo>ADC_SAMPLE_BUFFER_SIZE)InSamplesNo=ADC_SAMPLE_BUFFER_SIZE;
+	Count=CopyAdcSamples(InAdcChannelNo,InSamplesNo,Samples);
+	if(!Count)return 0;
+	for(i=1;i<Count;i++)//insertion sort of few samples
+	{
+		Sample=Samples[i];
+		for(j=i;j>0 && Samples[j-1]>Sample;j--)Samples[j]=Samples[j-1];
+		Samples[j]=Sample;
+	}
+	return Samples[Count/2];
+}//GetAdcMedian
+
+/*
+*********************************************************************************************************
+* Name:                                    GetAdcSamplesSince
+* 
+* Description: Returns number of samples of the channel taken since specified time stamp
+*       
+*
+* Arguments:   
+* 				InAdcChannelNo - number of channel 0x00 (CH0) ... 0x07 (CH7)
+*               InTimeStamp - Timer3 ticks (see GetTimer3Ticks)
+*
+* Returns:     Number of samples in the channel buffer taken not earlier than InTimeStamp
+*
+* Note(s):     
+*            Used to wait for samples taken after some event e.g. sensor power up
+* *********************************************************************************************************
+*/
+BYTE GetAdcSamplesSince(BYTE InAdcChannelNo, DWORD InTimeStamp)
+{
+	sAdcChannel *pChannel;
+	BYTE Index;
+	BYTE Count=0;
+	OS_CPU_SR cpu_sr;
+	
+	if(InAdcChannelNo>=ADC_CHANNEL_NO)return 0;
+	pChannel=&AdcChannel[InAdcChannelNo];
+	
+	OS_ENTER_CRITICAL();
+	Index=pChannel->mHead;
+	while(Count<pChannel->mCount)
+	{
+		Index=(Index-1)&(ADC_SAMPLE_BUFFER_SIZE-1);
+		if((LONG)(pChannel->mTimeStamp[Index]-InTimeStamp)<0)break;//older samples are not counted
+		Count++;
+	}
+	OS_EXIT_CRITICAL();
+	return Count;
+}//GetAdcSamplesSince
+
+
+
+/* IMPORTANT! This is commented out version I returned finally to the original
+ * implementation once it was obvious that SPI speed is the root cause of wrong ADC readings
+ * not ADC handling
+WORD GetAdcConversion(BYTE InAdcChannelNo)
+{
+	BYTE TmpData1; //reset further
+	BYTE TmpData2 = 0x00;
+	BYTE TmpData3 = 0x00;
+	BYTE TmpInAdcChannelNo;
+	WORD Result = 0x0000;
+	
+	//assure there is not any received data befor we run conversion
+	while ((SSP1SR & BIT2) == BIT2)//as long as receive FIFO is not empty take all data to make it empty
+		TmpData1 = SSP1DR;//read first byte it does not contain any value
+	TmpData1 = 0x00;//reset tmp data before we strat using it
+	
+	//setu first byte
+	TmpData1|=BIT2|BIT1;//setup start of conversion and singl-ended DAC mode
+	TmpInAdcChannelNo = InAdcChannelNo;
+	TmpData1|=(TmpInAdcChannelNo >> 2);//shift InAdcChannelNo right to get BIT2 on BIT0 position
+
+	//setup second byte
+	TmpInAdcChannelNo = InAdcChannelNo;
+	TmpData2|= (TmpInAdcChannelNo << 6);//move BIT1 and BIT0 to be MSB
+
+	//setup third byte
+	TmpData3 =0xAA;//do not care byte it can have any value
+	
+	while ((SSP1SR & BIT0) != BIT0);//wait until Transmit FIFO empty FIFO is ready to capture up to 8 frames
+	SSP1DR = TmpData1;//send first byte
+	SSP1DR = TmpData2;//send second byte
+	SSP1DR = TmpData3;//send third byte
+	
+	while ((SSP1SR & BIT4) == BIT4);//wait as long as SSP controler is busy (sending and/or receiving)
+	
+	TmpData1 = SSP1DR;//read first byte it does not contain any value
+	TmpData2 = SSP1DR;//read second byte
+	TmpData3 = SSP1DR;//read third byte 
+	Result = TmpData2;
+	Result = Result << 8;
+	Result |= TmpData3;//setup final result
+	Result &=0x0FFF;//zeros MSBs
+	return Result;
+}//	GetAdcConversion
+*/
+
+/*
+*********************************************************************************************************
+* Name:                                    CalculateAdcOffset
+* 
+* Description: Calculates ADC offset for specified channel
+*       
+*
+* Arguments:   
+* 				InAdcChannelNo - number of channel for which we want to initialize ADC conversion
+*                                0x00 - CH0
+*                                ...
+*                                0x07 - CH7
+*               InSamplesNo - number of samples which are averaged needs to be >=1
+* 				InDelayInTicks - delay in OS ticks between samples
+*
+* Returns:     Calculated ofset value for ADC
+*
+* Note(s):     
+*            InDelayInTicks must be longer than sampling period of the channel to average different samples
+* *********************************************************************************************************
+*/
+WORD CalculateAdcOffset(BYTE InAdcChannelNo, WORD InSamplesNo, WORD InDelayInTicks )
+{
+	DWORD Offset=0;//store offset in DWORD for the case large number of samples is summed out
+	WORD i;//counts subsequent samples taken
+	
+	if(!InSamplesNo) return 0;
+	for(i=1;i <= InSamplesNo;i++)
+	{
+		Offset += (DWORD)GetAdcConversion(InAdcChannelNo);	
+		OSTimeDly(InDelayInTicks);
+	}
+	Offset=Offset/((DWORD)InSamplesNo);
+	return (WORD)Offset;//convert offset back to WORD and return
+}//CalculateAdcOffset
+
+
+	
+
+#if SPI_MEASURE_EN > 0
+/*
+*********************************************************************************************************
+* Name:                                    MeasureAdcConversions
+* 
+* Description: Measures time of ADC conversions done by CPU polling SSP1 and by the sampling engine
+*       
+*
+* Arguments:   
+* 				InConversionsNo - number of measured conversions
+*               pOutPolled - time of conversions done one by one by CPU waiting for SSP1
+*               pOutEngine - time of conversions done by sampling engine (CPU time is sampling engine ISR time)
+*
+* Returns:     none
+*
+* Note(s):     
+*            Polled conversions are done the way GetAdcConversion did before sampling engine was added.
+*            Sampling engine runs more conversions than requested while the task waits so its times are
+*            scaled down to InConversionsNo conversions.
+* *********************************************************************************************************
+*/
+void MeasureAdcConversions(WORD InConversionsNo, sSpiTime *pOutPolled, sSpiTime *pOutEngine)
+{
+	OS_CPU_SR cpu_sr;
+	DWORD Start;
+	DWORD EngineTime;
+	DWORD Conversions;
+	WORD i;
+	
+	//take SSP1 from the sampling engine and drop result of the conversion it started
+	OS_ENTER_CRITICAL();
+	AdcSamplingOn=0;
+	OS_EXIT_CRITICAL();
+	while ((SSP1SR & BIT4) == BIT4);//wait as long as SSP controler is busy (sending and/or receiving)
+	if(AdcPendingChannel!=ADC_NO_CHANNEL)
+	{
+		ReadAdcConversion();
+		AdcPendingChannel=ADC_NO_CHANNEL;
+	}
+	
+	Start=GetSpiTimeStamp();
+	for(i=0;i<InConversionsNo;i++)
+	{
+		StartAdcConversion(i&(ADC_CHANNEL_NO-1));
+		while ((SSP1SR & BIT4) == BIT4);//CPU waits for the conversion result
+		ReadAdcConversion();
+	}
+	pOutPolled->mTime=GetSpiTimeStamp()-Start;
+	pOutPolled->mCpuTime=pOutPolled->mTime;//CPU was busy all the time
+	
+	//give SSP1 back to the sampling engine and wait until it does InConversionsNo conversions
+	OS_ENTER_CRITICAL();
+	AdcSamplingOn=1;
+	Conversions=AdcEngineConversions;
+	EngineTime=AdcEngineTime;
+	Start=GetTimer3TimeStamp();
+	OS_EXIT_CRITICAL();
+	while((AdcEngineConversions-Conversions)<InConversionsNo)
+		OSTimeDly(1);
+	OS_ENTER_CRITICAL();
+	Conversions=AdcEngineConversions-Conversions;
+	pOutEngine->mTime=((GetTimer3TimeStamp()-Start)/Conversions)*InConversionsNo;
+	pOutEngine->mCpuTime=((AdcEngineTime-EngineTime)*InConversionsNo)/Conversions;
+	OS_EXIT_CRITICAL();
+}//MeasureAdcConversions
+#endif //SPI_MEASURE_EN
@@ -1,269 +1,522 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2016, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        hw_uart.c
-* Description: Functions to control UART0 for OLIMEX LPC 2378 eval board
-* Author:      Bogdan Kowalczyk
-* Date:        16-Apr-2016
-* History:
-* 16-Apr-2016 - Initial version polling type UART control for very first trials
-* 
-*********************************************************************************************************
-*/
-
-#include "os_cpu.h"
-#include "os_cfg.h"
-#include "os_ucos_ii.h"
-
-#include "type.h"
-#include "hw_lpc23xx.h" //Header file for NXP LPC23xx/24xx Family Microprocessors
-#include "hw_uart.h"
-#include "lib_error.h"
-#include "lib_std.h"
-
-/*
-*********************************************************************************************************
-* Name:                                    InitUart0  
-* 
-* Description: Setup UART0 for serial transmission according to the
-*              transmission parameters
-*
-* Arguments:   none
-*
-* Returns:     none
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-void InitUart0(void)
-{
-	//PCONP|=BIT3;//enable UART0 - by default on uP rest it is on so this line is commented out
-	//Fpclk is 12,5MHz
-	
-	//Setup uP pins for UART0 so TxD is on P0.2 and RxD is on P03.3 out of P0 port to get below setup 
-	PINSEL0 |= BIT4|BIT6;
-	U0LCR=BIT7|BIT1|BIT0; //enable Divisior latches, setup 8 bit, no parity, 1 stop bit transmission
-	//setup divider for 9600 bits/second transmission
-	//divisior = Fpclk/(16xBaudRate)
-	//divisior = 12500000/(16x9600)=81,3 = 0x51 Hex - for 9600 baud rate
-	//divisior = 12500000/(16x115200)= 7 = 0x07 Hex - for 115 200 vaud rate
-	U0DLL=0x07;
-	U0DLM=0;
-	U0LCR&=(~BIT7); //disable access to divisir latches	
-}//InitUart
-
-/*
-*********************************************************************************************************
-* Name:                                    Uart0PutChar 
-* 
-* Description: Sends character out of the UART
-*
-* Arguments:   ch - character to be written to the serial port
-*
-* Returns:     character written to the serial port
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-int Uart0PutChar(int ch)
-{
-	if (ch=='\n') //when new line put carraige return firs
-	{
-		while(!(U0LSR & 0x20)); // wait until THR empty
-		U0THR=0x0D; // put carriage return
-	}
-	while(!(U0LSR & 0x20));// wait until THR empty
-	return (U0THR=ch);
-}//Uart0PutChar
-
-/*
-*********************************************************************************************************
-* Name:                                    Uart0GetChar 
-* 
-* Description: Gets character from the uart.
-* IMPORTANT! That is blocking function its keep waitin on Uart until character is received.
-* 		Tasks are not switched because there is not any OSTimeDly used in the while.
-* 		For non blocking version use Uart0CheckForChar function which returns when there is not character received.
-*
-* Arguments:   none
-*
-* Returns:     character read from the serial port
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-int Uart0GetChar(void)
-{
-	while(!(U0LSR & 0x01)); //keep in loop untill any character received
-	return U0RBR;
-}//Uart0GetChar
-
-
-/*
-*********************************************************************************************************
-* Name:                                    Uart0CheckForCharacterReceived 
-* 
-* Description: Check if there is character received and if there is any returns it
-* 		That is non-blocking version of Uart0GetChar
-*
-* Arguments:   none
-*
-* Returns:     0 - none character received or character read from the serial port if there is any
-* 
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-int Uart0CheckForCharacterReceived(void)
-{
-	if(!(U0LSR & 0x01)) //ehen there is not any charcter received return 0
-		return 0;
-	else
-		return U0RBR;//return received character if there is any
-}//Uart0CheckForCharacterReceived
-
-//send string via serial port
-//pString - pointer to string to be send
-void Uart0PutStr(char *pString) 
-{
-	// loop until null-terminator is seen
-	while (*pString != 0x00) 
-	{
-		Uart0PutChar(*pString++); //put character by character
-	}
-}//Uart0PutStr
-
-static char TempResultBuff[32];//temporary buffer place for ltoa convertion 
-
-/*
-*********************************************************************************************************
-* Name:                                  Uart0DebugMessage
-* 
-* Description: 
-* 	Displays DEBUG message plus Value on the terminal output and next comes to the new line
-*   when GenExcept requested (<>0) generates SWI to stop system operation
-*  
-*
-* Arguments:   
-*				pMsgStr - message to display
-* 				Value - value to display
-* 				GenExcept <>0 - generate exception
-* Returns:     none
-*
-* 			
-* Note(s):     
-* 			After texy displayed CR/LF is automaticly generated moving cursor on terminal to a new line
-* *********************************************************************************************************
-*/
-void Uart0DebugMessage(char *pMsgStr,long Value, BYTE GenExcept)
-{
-	Uart0PutStr(pMsgStr);//transimt string to the terminal 
-	ltoa(Value,TempResultBuff,10);//change to string
-	Uart0PutStr(TempResultBuff);//transmit walue
-	Uart0PutChar('\n');//move cursor on terminal to the new line
-	if(GenExcept)
-		DEBUG_EXCEPTION;//SWI to stop operation efter debug message is displayed
-}//Uart0DebugMessage
-
-
-/*
-*********************************************************************************************************
-* Name:                                  Uart0Message
-* 
-* Description: 
-* 	Displays DEBUG message plus Value on the terminal output and next comes to the new line
-*  
-*
-* Arguments:   
-*				pMsgStr - message to display
-* 				Value - value to display
-* Returns:     none
-*
-* 			
-* Note(s):     
-* 			After texy displayed CR/LF is automaticly generated moving cursor on terminal to a new line
-* *********************************************************************************************************
-*/
-void Uart0Message(char *pMsgStr,long Value)
-{
-	Uart0PutStr(pMsgStr);//transimt string to the terminal 
-	ltoa(Value,TempResultBuff,10);//change to string
-	Uart0PutStr(TempResultBuff);//transmit walue
-	Uart0PutChar('\n');//move cursor on terminal to the new line
-}//Uart0Message
-
-/*
-*********************************************************************************************************
-* Name:                                    Uart0GetTrmlChar 
-* 
-* Description: Waits and gets character from the Uart0 but in sach a way that tasks switching is not blcoked
-* 		because during waiting OSTimeDly is used
-*
-* Arguments:   none
-*
-* Returns:     0 - none character received or character read from the serial port if there is any
-* 
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-int Uart0GetTrmlChar(void)
-{
-	int CharReceived;
-	
-	while(!(CharReceived=Uart0CheckForCharacterReceived()))//if there is not character received
-		OSTimeDly(WAIT_FOR_UART_CHAR);
-	return CharReceived;
-	
-}//Uart0GetTrmlChar
-
-/*
-*********************************************************************************************************
-* Name:                                    Uart0GetTrmlStr 
-* 
-* Description: Waits and gets characters from the Uart0 until <Enter>. 
-*              Task switching is not blocked because Uart0GetTrmlChar() is used to get single character
-* 			   (see above)
-*
-* Arguments:   pMsgBuffer - pointer to the storage area buffer of the received line
-* 			   inLength - length of the buffer used for the storage 
-*
-* Returns:     pointer to first character or NULL if none characters are received
-* 
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-char *Uart0GetTrmlStr(char* pMsgBuffer, int inLength)
-{
-	char c;   //character received
-	char *s;  //pinter to current position in the buffer;
-	
-	s=pMsgBuffer;//s points to buffer beginning
-	
-	if (inLength < 2) //sanity check of enough place to capture at least <Enter>
-		return NULL;
-	
-	while (--inLength > 0 && (c = (char)Uart0GetTrmlChar()) != '\r')
-		{//read character by character until <Enter> recived
-		*s++ = c;
-		}
-	*s = 0;//terminate recived string with \0
-	if (s==pMsgBuffer)//if nothing received just '\n'
-		return NULL;
-	else
-		return pMsgBuffer; 
-	
-}//Uart0GetTrmlStr
-
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2016, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        hw_uart.c
+* Description: Functions to control UART0 for OLIMEX LPC 2378 eval board
+* Author:      Bogdan Kowalczyk
+* Date:        16-Apr-2016
+* History:
+* 16-Apr-2016 - Initial version polling type UART control for very first trials
+* 17-Oct-2026 - Interrupt driven UART0 with TX and RX ring buffers, TX overflow policy and counters
+* 
+*********************************************************************************************************
+*/
+
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+
+#include "type.h"
+#include "hw_lpc23xx.h" //Header file for NXP LPC23xx/24xx Family Microprocessors
+#include "hw_uart.h"
+#include "lib_error.h"
+#include "lib_std.h"
+
+#define UART0_TX_MASK	(UART0_TX_BUFFER_SIZE-1)
+#define UART0_RX_MASK	(UART0_RX_BUFFER_SIZE-1)
+#define CPSR_IRQ_DISABLED	BIT7 //I bit of CPSR returned by OS_CPU_SR_Save
+
+//TX ring buffer - tasks put characters at Uart0TxHead, ISR sends characters from Uart0TxTail
+//IMPORTANT! Indexes are changed with interrupts disabled only, one place is always left empty
+static char Uart0TxBuffer[UART0_TX_BUFFER_SIZE];
+static volatile WORD Uart0TxHead;
+static volatile WORD Uart0TxTail;
+static volatile BYTE Uart0TxRunning;//set when THRE interrupt is expected to send the next characters
+//RX ring buffer - ISR puts characters at Uart0RxHead, tasks read them from Uart0RxTail
+static unsigned char Uart0RxBuffer[UART0_RX_BUFFER_SIZE];
+static volatile BYTE Uart0RxHead;
+static volatile BYTE Uart0RxTail;
+static OS_EVENT* Uart0RxSem;//counts characters in RX buffer
+
+static DWORD Uart0TxOverflows;//characters which found TX buffer full (dropped or waited depending on policy)
+static DWORD Uart0RxOverflows;//received characters dropped because RX buffer was full
+static WORD Uart0TxMaxLevel;//the highest number of characters waiting in TX buffer so far
+
+/*
+*********************************************************************************************************
+* Name:                                    InitUart0  
+* 
+* Description: Setup UART0 for serial transmission according to the
+*              transmission parameters
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+void InitUart0(void)
+{
+	//PCONP|=BIT3;//enable UART0 - by default on uP rest it is on so this line is commented out
+	//Fpclk is 12,5MHz
+	
+	//Setup uP pins for UART0 so TxD is on P0.2 and RxD is on P03.3 out of P0 port to get below setup 
+	PINSEL0 |= BIT4|BIT6;
+	U0LCR=BIT7|BIT1|BIT0; //enable Divisior latches, setup 8 bit, no parity, 1 stop bit transmission
+	//setup divider for 9600 bits/second transmission
+	//divisior = Fpclk/(16xBaudRate)
+	//divisior = 12500000/(16x9600)=81,3 = 0x51 Hex - for 9600 baud rate
+	//divisior = 12500000/(16x115200)= 7 = 0x07 Hex - for 115 200 vaud rate
+	U0DLL=0x07;
+	U0DLM=0;
+	U0LCR&=(~BIT7); //disable access to divisir latches	
+	
+	Uart0RxSem=OSSemCreate(0);//create semaphore counting received characters
+	if(!Uart0RxSem)UCOSII_RES_EXCEPTION;//Exception - when there is not uCOS-II event blocks availiable
+	U0FCR=BIT0|BIT1|BIT2;//enable and reset FIFOs, RX trigger level is 1 character
+	VICIntEnClr = BIT6;//disable UART0 interrupt in VIC
+	VICVectAddr6 = (DWORD)Uart0IsrHandler; //assign address to UART0 IRQ Handler
+	U0IER=BIT0|BIT1|BIT2;//enable RX data available, THR empty and RX line status interrupts
+	VICIntEnable |= BIT6;//enable UART0 interrupts in VIC
+}//InitUart
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0TxFill 
+* 
+* Description: Moves characters from TX buffer into empty TX FIFO
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+*              Called from ISR or with interrupts disabled
+*              When THR is not empty THRE interrupt calls it again once FIFO is sent out
+* *********************************************************************************************************
+*/
+static void Uart0TxFill(void)
+{
+	BYTE n;
+	
+	if(Uart0TxHead==Uart0TxTail)
+	{
+		Uart0TxRunning=0;//nothing to send, next character starts transmission again
+		return;
+	}
+	Uart0TxRunning=1;
+	if(!(U0LSR & BIT5))//THR and FIFO not empty so wait for THRE interrupt
+		return;
+	for(n=0;(n<UART0_TX_FIFO_SIZE) && (Uart0TxTail!=Uart0TxHead);n++)
+	{
+		U0THR=Uart0TxBuffer[Uart0TxTail];
+		Uart0TxTail=(Uart0TxTail+1)&UART0_TX_MASK;
+	}
+}//Uart0TxFill
+
+//sends character by polling THR empty flag
+static void Uart0PollChar(char ch)
+{
+	while(!(U0LSR & BIT5));// wait until THR empty
+	U0THR=ch;
+}//Uart0PollChar
+
+//sends out all characters from TX buffer by polling, must be called with interrupts disabled
+static void Uart0TxDrain(void)
+{
+	while(Uart0TxTail!=Uart0TxHead)
+	{
+		Uart0PollChar(Uart0TxBuffer[Uart0TxTail]);
+		Uart0TxTail=(Uart0TxTail+1)&UART0_TX_MASK;
+	}
+}//Uart0TxDrain
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0TxPut 
+* 
+* Description: Puts character into TX buffer and starts transmission if it is not in progress
+*
+* Arguments:   ch - character to be sent
+*
+* Returns:     none
+*
+* Note(s):     
+*              Character is sent by polling when interrupts cannot be used (see hw_uart.h)
+* *********************************************************************************************************
+*/
+static void Uart0TxPut(char ch)
+{
+	OS_CPU_SR  cpu_sr;
+	WORD Level;
+	
+	OS_ENTER_CRITICAL();
+	if(!OSRunning || OSIntNesting || (cpu_sr & CPSR_IRQ_DISABLED))
+	{//THRE interrupt cannot be served so keep characters order sending buffer first
+		Uart0TxDrain();
+		Uart0PollChar(ch);
+		OS_EXIT_CRITICAL();
+		return;
+	}
+	if(((Uart0TxHead+1)&UART0_TX_MASK)==Uart0TxTail)//TX buffer full
+	{
+		Uart0TxOverflows++;
+#if UART0_TX_OVERFLOW_POLICY == UART0_TX_BLOCK
+		do
+		{
+			OS_EXIT_CRITICAL();
+			OSTimeDly(UART0_TX_BLOCK_DELAY);//let ISR send characters out
+			OS_ENTER_CRITICAL();
+		}while(((Uart0TxHead+1)&UART0_TX_MASK)==Uart0TxTail);
+#elif UART0_TX_OVERFLOW_POLICY == UART0_TX_DROP_OLDEST
+		Uart0TxTail=(Uart0TxTail+1)&UART0_TX_MASK;//drop the oldest character
+#else
+		OS_EXIT_CRITICAL();
+		return;//drop the new character
+#endif
+	}
+	Uart0TxBuffer[Uart0TxHead]=ch;
+	Uart0TxHead=(Uart0TxHead+1)&UART0_TX_MASK;
+	Level=(Uart0TxHead-Uart0TxTail)&UART0_TX_MASK;
+	if(Level>Uart0TxMaxLevel)
+		Uart0TxMaxLevel=Level;
+	if(!Uart0TxRunning)
+		Uart0TxFill();//start transmission
+	OS_EXIT_CRITICAL();
+}//Uart0TxPut
+
+//gets character from RX buffer, there must be a character in the buffer (RX semaphore acquired)
+static int Uart0RxGet(void)
+{
+	OS_CPU_SR  cpu_sr;
+	int ch;
+	
+	OS_ENTER_CRITICAL();
+	ch=Uart0RxBuffer[Uart0RxTail];
+	Uart0RxTail=(Uart0RxTail+1)&UART0_RX_MASK;
+	OS_EXIT_CRITICAL();
+	return ch;
+}//Uart0RxGet
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0IsrHandler 
+* 
+* Description: UART0 Interrupt Service Routine - moves characters between ring buffers and UART0 FIFOs
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+* 			Interrupting device is acknowledged and its sorce of interrupt is cleared on this level.
+* 			Note that VIC of the uP is cleared on the level of OS_CPU_ExceptHndlr function.
+* *********************************************************************************************************
+*/
+void Uart0IsrHandler(void)
+{
+	DWORD IntId;
+	BYTE Next;
+	unsigned char ch;
+	
+	while(!((IntId=U0IIR) & BIT0))//as long as there is any UART0 interrupt pending (reading IIR clears THRE)
+	{
+		switch(IntId & (BIT1|BIT2|BIT3))
+		{
+		case BIT1|BIT2://RX line status - cleared by LSR read
+			IntId=U0LSR;
+			break;
+		case BIT2://RX data available
+		case BIT2|BIT3://RX character time-out
+			while(U0LSR & BIT0)
+			{
+				ch=U0RBR;
+				Next=(Uart0RxHead+1)&UART0_RX_MASK;
+				if(Next==Uart0RxTail)
+				{
+					Uart0RxOverflows++;//RX buffer full - character is dropped
+					continue;
+				}
+				Uart0RxBuffer[Uart0RxHead]=ch;
+				Uart0RxHead=Next;
+				OSSemPost(Uart0RxSem);//wake up task waiting for a character
+			}
+			break;
+		case BIT1://THR empty
+			Uart0TxFill();
+			break;
+		default:
+			break;
+		}
+	}
+}//Uart0IsrHandler
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0PutChar 
+* 
+* Description: Puts character into UART0 TX buffer which is sent out by UART0 interrupt
+*
+* Arguments:   ch - character to be written to the serial port
+*
+* Returns:     character written to the serial port
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+int Uart0PutChar(int ch)
+{
+	if (ch=='\n') //when new line put carraige return firs
+	{
+		Uart0TxPut(0x0D); // put carriage return
+	}
+	Uart0TxPut(ch);
+	return ch;
+}//Uart0PutChar
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0GetChar 
+* 
+* Description: Gets character from the uart.
+* IMPORTANT! That is blocking function its keep waitin on Uart until character is received.
+* 		When uCOS-II is running calling task waits on RX semaphore otherwise UART is polled.
+* 		For non blocking version use Uart0CheckForChar function which returns when there is not character received.
+*
+* Arguments:   none
+*
+* Returns:     character read from the serial port
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+int Uart0GetChar(void)
+{
+	BYTE Result;
+	
+	if(!OSRunning)
+	{
+		while(!(U0LSR & 0x01)); //keep in loop untill any character received
+		return U0RBR;
+	}
+	OSSemPend(Uart0RxSem,0x0000,&Result);//wait for UART0 ISR to receive a character
+	if(Result != OS_NO_ERR)UCOSII_RES_EXCEPTION;//Exception when ther is an error
+	return Uart0RxGet();
+}//Uart0GetChar
+
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0CheckForCharacterReceived 
+* 
+* Description: Check if there is character received and if there is any returns it
+* 		That is non-blocking version of Uart0GetChar
+*
+* Arguments:   none
+*
+* Returns:     0 - none character received or character read from the serial port if there is any
+* 
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+int Uart0CheckForCharacterReceived(void)
+{
+	if(!OSRunning)
+	{
+		if(!(U0LSR & 0x01)) //ehen there is not any charcter received return 0
+			return 0;
+		else
+			return U0RBR;//return received character if there is any
+	}
+	if(!OSSemAccept(Uart0RxSem))//when there is not any charcter received return 0
+		return 0;
+	return Uart0RxGet();//return received character if there is any
+}//Uart0CheckForCharacterReceived
+
+//send string via serial port
+//pString - pointer to string to be send
+void Uart0PutStr(char *pString) 
+{
+	// loop until null-terminator is seen
+	while (*pString != 0x00) 
+	{
+		Uart0PutChar(*pString++); //put character by character
+	}
+}//Uart0PutStr
+
+static char TempResultBuff[32];//temporary buffer place for ltoa convertion 
+
+/*
+*********************************************************************************************************
+* Name:                                  Uart0DebugMessage
+* 
+* Description: 
+* 	Displays DEBUG message plus Value on the terminal output and next comes to the new line
+*   when GenExcept requested (<>0) generates SWI to stop system operation
+*  
+*
+* Arguments:   
+*				pMsgStr - message to display
+* 				Value - value to display
+* 				GenExcept <>0 - generate exception
+* Returns:     none
+*
+* 			
+* Note(s):     
+* 			After texy displayed CR/LF is automaticly generated moving cursor on terminal to a new line
+* *********************************************************************************************************
+*/
+void Uart0DebugMessage(char *pMsgStr,long Value, BYTE GenExcept)
+{
+	Uart0PutStr(pMsgStr);//transimt string to the terminal 
+	ltoa(Value,TempResultBuff,10);//change to string
+	Uart0PutStr(TempResultBuff);//transmit walue
+	Uart0PutChar('\n');//move cursor on terminal to the new line
+	if(GenExcept)
+	{
+		Uart0Flush();//send out buffered message before operation is stopped
+		DEBUG_EXCEPTION;//SWI to stop operation efter debug message is displayed
+	}
+}//Uart0DebugMessage
+
+
+/*
+*********************************************************************************************************
+* Name:                                  Uart0Message
+* 
+* Description: 
+* 	Displays DEBUG message plus Value on the terminal output and next comes to the new line
+*  
+*
+* Arguments:   
+*				pMsgStr - message to display
+* 				Value - value to display
+* Returns:     none
+*
+* 			
+* Note(s):     
+* 			After texy displayed CR/LF is automaticly generated moving cursor on terminal to a new line
+* *********************************************************************************************************
+*/
+void Uart0Message(char *pMsgStr,long Value)
+{
+	Uart0PutStr(pMsgStr);//transimt string to the terminal 
+	ltoa(Value,TempResultBuff,10);//change to string
+	Uart0PutStr(TempResultBuff);//transmit walue
+	Uart0PutChar('\n');//move cursor on terminal to the new line
+}//Uart0Message
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0GetTrmlChar 
+* 
+* Description: Waits and gets character from the Uart0 but in sach a way that tasks switching is not blcoked
+* 		because calling task waits on RX semaphore
+*
+* Arguments:   none
+*
+* Returns:     0 - none character received or character read from the serial port if there is any
+* 
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+int Uart0GetTrmlChar(void)
+{
+	int CharReceived;
+	
+	while(!(CharReceived=Uart0GetChar()));//null characters are ignored
+	return CharReceived;
+	
+}//Uart0GetTrmlChar
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0GetTrmlStr 
+* 
+* Description: Waits and gets characters from the Uart0 until <Enter>. 
+*              Task switching is not blocked because Uart0GetTrmlChar() is used to get single character
+* 			   (see above)
+*
+* Arguments:   pMsgBuffer - pointer to the storage area buffer of the received line
+* 			   inLength - length of the buffer used for the storage 
+*
+* Returns:     pointer to first character or NULL if none characters are received
+* 
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+char *Uart0GetTrmlStr(char* pMsgBuffer, int inLength)
+{
+	char c;   //character received
+	char *s;  //pinter to current position in the buffer;
+	
+	s=pMsgBuffer;//s points to buffer beginning
+	
+	if (inLength < 2) //sanity check of enough place to capture at least <Enter>
+		return NULL;
+	
+	while (--inLength > 0 && (c = (char)Uart0GetTrmlChar()) != '\r')
+		{//read character by character until <Enter> recived
+		*s++ = c;
+		}
+	*s = 0;//terminate recived string with \0
+	if (s==pMsgBuffer)//if nothing received just '\n'
+		return NULL;
+	else
+		return pMsgBuffer; 
+	
+}//Uart0GetTrmlStr
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0Flush 
+* 
+* Description: Sends out all characters from TX buffer by polling UART0 with interrupts disabled
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+*              Used before an exception is generated so the last messages are not lost
+* *********************************************************************************************************
+*/
+void Uart0Flush(void)
+{
+	OS_CPU_SR  cpu_sr;
+	
+	OS_ENTER_CRITICAL();
+	Uart0TxDrain();
+	OS_EXIT_CRITICAL();
+}//Uart0Flush
+
+//UART0 buffers statistics
+DWORD GetUart0TxOverflows(void)
+{
+	return Uart0TxOverflows;
+}//GetUart0TxOverflows
+
+DWORD GetUart0RxOverflows(void)
+{
+	return Uart0RxOverflows;
+}//GetUart0RxOverflows
+
+WORD GetUart0TxMaxLevel(void)
+{
+	return Uart0TxMaxLevel;
+}//GetUart0TxMaxLevel
@@ -1,182 +1,225 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*           
-*              (c) Copyright 2013, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        res_list.h: 
-* Description: List of tasks and other critical resources in the system and their priorities
-* Author:      Bogdan Kowalczyk
-* Date:        15-Dec-2013
-* Note:
-* History:
-*              15-Dec-2013 - Initial version created
-*              25-Jan-2015 - Added Brain, Context and Exe managers
-*              02-Jan-2017 - Added Rmt (Remote) manager
-*              13-Jan-2018 - Added VRM (Voice Recognition Module) manager
-*********************************************************************************************************
-*/
-
-#ifndef TSK_LIST_H_
-#define TSK_LIST_H_
-
-//IMPORTANT OS_MAX_EVENTS! 
-//In addition to the below task list, this file also includes list of OS_EVENT blocks
-//utilized by Wall-e to setup correctly OS_MAX_EVENTS limit in the os_cfg.h
-//Every queue, message box, or semaphore created in the system oocupies one OS_EVENT block
-//List of resourcies occuping OS_EVENT:
-
-// 10 x OS_EVENT blocks because of resources defined below the so named Manager Layer
-//Pwm1Mutex - access to PWM1 (servo control) is protected by mutex
-//AdcMutex - access to ADC is protected with mutex
-//MemMutex - mutex in Kernel to protect new and delete and make them thread safety
-//MemMgrMutex - mutex in Kernel which protects reference counting operation for all objects (Notifiers)
-//cDispatcher.m_PublisherMutex - protects access to publisher tables
-//cDispatcher.m_SubscriberMutex - protects access to subscriber tables
-//LeftTrackMailbox - used to communicate from track Port2Isr (track detector) to TrackControlTask
-//RightTrackMailbox - used to communicate from track Port2Isr (track detector) to TrackControlTask
-//CtxMutext - mutext in CtxMngr to protect simultanous access to the context data
-//uPAdcMutex - mutex to protect exclusive access to uP ADC (uPAdcMutex)
-
-//In addition to above every manager which derives from cMngBasePublisherSubscriber has transmit 
-//and receive queues so 13 managers gives 13*2=26 OS_EVENT blocks because of its queues
-
-// This list is only used as reference not included anywhere.
-// It works like one common place to know what are the tasks in the system because they are
-// covered under managers but also as stand alone uCOS-II tasks
-
-// typedef unsigned int   OS_STK;                   /* Each stack entry is 32-bit wide                    */
-
-// There is stand alone exception stack in uCOS-II for ARM of the bleow defined size
-// Stack Size: OS_CPU_EXCEPT_STK_SIZE    		128        /* Default exception stack size is 128 OS_STK entries */
-
-//IMPORTANT! Maximum number of subscribers and publishers is defined in wrp_kernel.hpp file as
-//           NO_OF_PUBLISHERS  					13
-//           NO_OF_SUBSCRIBERS					13
-
-
-// *************************************************************************************************************
-//Task:			
-//Priority:
-//Stack Size:
-//Send Q Size:
-//Rec Q Size:	
-
-// *************************************************************************************************************
-//Task:			cKernel::m_DispatcherThread - dispatches notifiers
-//Priority:		DISPATCHER_THREAD_PRIORITY 		3
-//Stack Size: 	DISPATCHER_THREAD_STACK_SIZE = 	OS_TASK_STACK_SIZE	= 128 x OS_STK
-
-// *************************************************************************************************************
-//Task:			mng_motion
-//Priority:		MOTION_THREAD_PRIORITY   		5
-//Stack Size:	MOTION_THREAD_STACK_SIZE		128
-//Send Q Size:	MOTION_PUBLISHER_SEND_Q_SIZE 	5
-//Rec Q Size:	MOTION_SUBSCRIBER_REC_Q_SIZE 	5
-
-// *************************************************************************************************************
-//Task:			LeftTrackControlTask
-//Priority:		LEFT_TRACK_CTRL_TASK_PRIORITY  	6
-//Stack Size: 	LEFT_TRACK_CTRL_STACK_SIZE 		OS_TASK_STACK_SIZE	= 128 x OS_STK
- 
-// *************************************************************************************************************
-//Task:			RightTrackControlTask
-//Priority:		RIGHT_TRACK_CTRL_TASK_PRIORITY  7
-//Stack Size: 	RIGHT_TRACK_CTRL_STACK_SIZE 	OS_TASK_STACK_SIZE = 128 x OS_STK
-
-// *************************************************************************************************************
-//Task:			mng_leftarm
-//Priority:		LEFT_ARM_THREAD_PRIORITY  		10
-//Stack Size:   LEFT_ARM_THREAD_STACK_SIZE		128
-//Send Q Size:	LEFT_ARM_PUBLISHER_SEND_Q_SIZE 	5
-//Rec Q Size:	LEFT_ARM_SUBSCRIBER_REC_Q_SIZE 	5
-
-// *************************************************************************************************************
-//Task:			mng_rightarm
-//Priority:		RIGHT_ARM_PUBLISHER_SEND_Q_SIZE	11
-//Stack Size:   RIGHT_ARM_THREAD_STACK_SIZE		128
-//Send Q Size:	RIGHT_ARM_PUBLISHER_SEND_Q_SIZE	5
-//Rec Q Size:	RIGHT_ARM_SUBSCRIBER_REC_Q_SIZE	5
-
-// *************************************************************************************************************
-//Task:			mng_rtc
-//Priority:		RTC_THREAD_PRIORITY   			15
-//Stack Size:	RTC_THREAD_STACK_SIZE			128
-//Send Q Size:	RTC_PUBLISHER_SEND_Q_SIZE 		5
-//Rec Q Size:	RTC_SUBSCRIBER_REC_Q_SIZE 		5
-
-// *************************************************************************************************************
-//Task:			mng_keypad
-//Priority:		KEYPAD_THREAD_PRIORITY   		20	
-//Stack Size:	KEYPAD_THREAD_STACK_SIZE		128
-//Send Q Size:	KEYPAD_PUBLISHER_SEND_Q_SIZE 	5
-//Rec Q Size:	KEYPAD_SUBSCRIBER_REC_Q_SIZE 	5
-
-// *************************************************************************************************************
-//Task:			mng_ctx	
-//Priority:		CTX_THREAD_PRIORITY   			21
-//Stack Size:	CTX_THREAD_STACK_SIZE			128
-//Send Q Size:	CTX_PUBLISHER_SEND_Q_SIZE 		5
-//Rec Q Size:	CTX_SUBSCRIBER_REC_Q_SIZE 		5
-
-// *************************************************************************************************************
-//Task:			mng_exe	
-//Priority:		EXE_THREAD_PRIORITY   			23
-//Stack Size:	EXE_THREAD_STACK_SIZE			128
-//Send Q Size:	EXE_PUBLISHER_SEND_Q_SIZE 		5
-//Rec Q Size:	EXE_SUBSCRIBER_REC_Q_SIZE 		5
-
-
-// *************************************************************************************************************
-//Task:			mng_brain	
-//Priority:		BRAIN_THREAD_PRIORITY   		24
-//Stack Size:	BRAIN_THREAD_STACK_SIZE			128
-//Send Q Size:	BRAIN_PUBLISHER_SEND_Q_SIZE 	5
-//Rec Q Size:	BRAIN_SUBSCRIBER_REC_Q_SIZE 	5
-
-// *************************************************************************************************************
-//Task:			mng_monitor	
-//Priority:		MONITOR_THREAD_PRIORITY   		26
-//Stack Size:	MONITOR_THREAD_STACK_SIZE		128
-//Send Q Size:	MONITOR_PUBLISHER_SEND_Q_SIZE 	5
-//Rec Q Size:	MONITOR_SUBSCRIBER_REC_Q_SIZE 	5
-
-// *************************************************************************************************************
-//Task:			mng_display
-//Priority:		DISPLAY_THREAD_PRIORITY   		30
-//Stack Size:	DISPLAY_THREAD_STACK_SIZE		128
-//Send Q Size:	DISPLAY_PUBLISHER_SEND_Q_SIZE 	5 
-//Rec Q Size:	DISPLAY_SUBSCRIBER_REC_Q_SIZE 	5
-
-// *************************************************************************************************************
-//Task:			mng_indicator
-//Priority:		INDICATOR_THREAD_PRIORITY   	35
-//Stack Size:	INDICATOR_THREAD_STACK_SIZE		128
-//Send Q Size:	INDICATOR_PUBLISHER_SEND_Q_SIZE 5
-//Rec Q Size:	INDICATOR_SUBSCRIBER_REC_Q_SIZE 5
-
-// *************************************************************************************************************
-//Task:			mng_rmt
-//Priority:		RMT_THREAD_PRIORITY	   			40
-//Stack Size:	RMT_THREAD_STACK_SIZE			128
-//Send Q Size:	RMT_PUBLISHER_SEND_Q_SIZE		5
-//Rec Q Size:	RMT_SUBSCRIBER_REC_Q_SIZE 		5
-
-// *************************************************************************************************************
-//Task:			mng_vrm
-//Priority:		VRM_THREAD_PRIORITY	   			42
-//Stack Size:	VRM_THREAD_STACK_SIZE			128
-//Send Q Size:	VRM_PUBLISHER_SEND_Q_SIZE		5
-//Rec Q Size:	VRM_SUBSCRIBER_REC_Q_SIZE 		5
-
-// *************************************************************************************************************
-//Task:			OSTaskIdle - run by ::OSInit()from cKernelInit::cKernelInit()
-//                           do nothing taks, counts only its execution for eventual uP utilization figures
-//Priority: 	OS_IDLE_PRIO       				63
-//Stack Size: 	OS_TASK_IDLE_STK_SIZE    		64  //64 x OS_STK
-
-
-#endif /*TSK_LIST_H_*/
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*           
+*              (c) Copyright 2013, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        res_list.h: 
+* Description: List of tasks and other critical resources in the system and their priorities
+* Author:      Bogdan Kowalczyk
+* Date:        15-Dec-2013
+* Note:
+* History:
+*              15-Dec-2013 - Initial version created
+*              25-Jan-2015 - Added Brain, Context and Exe managers
+*              02-Jan-2017 - Added Rmt (Remote) manager
+*              13-Jan-2018 - Added VRM (Voice Recognition Module) manager
+*              17-Oct-2026 - Added dispatcher event OS_EVENT block
+*              17-Oct-2026 - Removed MemMgrMutex as reference counting is protected by critical section
+*              17-Oct-2026 - Track mailboxes replaced with track pulse buffer semaphores
+*              17-Oct-2026 - Added ObstacleWatchTask and its semaphores
+*              17-Oct-2026 - Removed AdcMutex as ADC is sampled by Timer3 driven sampling engine
+*              17-Oct-2026 - Added LcdDmaSem for GPDMA driven LCD transfers
+*              17-Oct-2026 - Added Uart0RxSem for interrupt driven UART0
+*              17-Oct-2026 - Mutexes with priority inheritance (PIP priorities 0..4 and 19 reserved)
+*              17-Oct-2026 - Added uCOS-II timer task and its OSTmrSemSignal semaphore
+*              17-Oct-2026 - Added event flag groups (OS_MAX_FLAGS)
+*********************************************************************************************************
+*/
+
+#ifndef TSK_LIST_H_
+#define TSK_LIST_H_
+
+//IMPORTANT OS_MAX_EVENTS! 
+//In addition to the below task list, this file also includes list of OS_EVENT blocks
+//utilized by Wall-e to setup correctly OS_MAX_EVENTS limit in the os_cfg.h
+//Every queue, message box, or semaphore created in the system oocupies one OS_EVENT block
+//List of resourcies occuping OS_EVENT:
+
+// 14 x OS_EVENT blocks because of resources defined below the so named Manager Layer
+//Pwm1Mutex - access to PWM1 (servo control) is protected by mutex
+//MemMutex - mutex in Kernel to protect new and delete and make them thread safety
+//cDispatcher.m_PublisherMutex - protects access to publisher tables
+//cDispatcher.m_SubscriberMutex - protects access to subscriber tables
+//cDispatcher.m_DispatchEvent - signaled by publishers on every Post() to wake up dispatching thread
+//LeftTrackPulseBuffer.mSem - counts pulses put by track Port2Isr (track detector) for LeftTrackControlTask
+//RightTrackPulseBuffer.mSem - counts pulses put by track Port2Isr (track detector) for RightTrackControlTask
+//ObstacleWatchStartSem - posted by Move() to start ObstacleWatchTask sampling
+//ObstacleWatchDoneSem - posted by ObstacleWatchTask when movement is finished or stopped on an obstacle
+//CtxMutext - mutext in CtxMngr to protect simultanous access to the context data
+//uPAdcMutex - mutex to protect exclusive access to uP ADC (uPAdcMutex)
+//LcdDmaSem - posted by GpDmaIsrHandler when LCD data block is transferred to SSP0
+//Uart0RxSem - posted by Uart0IsrHandler for every character put into UART0 RX buffer
+//OSTmrSemSignal - posted by OSTimeTick() to wake up uCOS-II timer task
+
+//IMPORTANT OS_MAX_FLAGS!
+//Event flag groups do not use OS_EVENT blocks - they are limited by OS_MAX_FLAGS in the os_cfg.h
+//List of event flag groups:
+//HwEvents - HW_EVT_xxx flags set by ISRs (tracks stop and pulses) see lib_event.h
+//cCtxMngr.mCtxUpdatedFlags - CTX_xxx_UPDATED flags set after first update of the context
+
+//IMPORTANT PIP! 
+//Every mutex with priority inheritance reserves its Priority Inheritance Priority (PIP) in addition to OS_EVENT block.
+//PIP must not be used by any task and it must be higher than priority of every task which uses the mutex.
+//Owner of the mutex runs at PIP when higher priority task waits for the mutex.
+//Reserved PIP priorities:
+//MEM_MUTEX_PIP							0	MemMutex used by all tasks
+//DISPATCHER_SUBSCRIBER_MUTEX_PIP		1	cDispatcher.m_SubscriberMutex used by dispatcher and all managers
+//DISPATCHER_PUBLISHER_MUTEX_PIP		2	cDispatcher.m_PublisherMutex used by dispatcher and all managers
+//UP_ADC_MUTEX_PIP						3	uPAdcMutex used by ObstacleWatchTask and tilt check
+//PWM1_MUTEX_PIP						4	Pwm1Mutex used by mng_motion and arms managers
+//CTX_MUTEX_PIP							19	CtxMutext used by mng_ctx and mng_exe
+
+//In addition to above every manager which derives from cMngBasePublisherSubscriber has transmit 
+//and receive queues so 13 managers gives 13*2=26 OS_EVENT blocks because of its queues
+
+// This list is only used as reference not included anywhere.
+// It works like one common place to know what are the tasks in the system because they are
+// covered under managers but also as stand alone uCOS-II tasks
+
+// typedef unsigned int   OS_STK;                   /* Each stack entry is 32-bit wide                    */
+
+// There is stand alone exception stack in uCOS-II for ARM of the bleow defined size
+// Stack Size: OS_CPU_EXCEPT_STK_SIZE    		128        /* Default exception stack size is 128 OS_STK entries */
+
+//IMPORTANT! Maximum number of subscribers and publishers is defined in wrp_kernel.hpp file as
+//           NO_OF_PUBLISHERS  					13
+//           NO_OF_SUBSCRIBERS					13
+
+
+// *************************************************************************************************************
+//Task:			
+//Priority:
+//Stack Size:
+//Send Q Size:
+//Rec Q Size:	
+
+// *************************************************************************************************************
+//Task:			cKernel::m_DispatcherThread - dispatches notifiers (wakes up only when notifiers are posted)
+//Priority:		DISPATCHER_THREAD_PRIORITY 		5
+//Stack Size: 	DISPATCHER_THREAD_STACK_SIZE = 	OS_TASK_STACK_SIZE	= 128 x OS_STK
+
+// *************************************************************************************************************
+//Task:			ObstacleWatchTask - samples US, IRED and tilt during movement and stops tracks on an obstacle
+//Priority:		OBSTACLE_WATCH_TASK_PRIORITY  	6
+//Stack Size: 	OBSTACLE_WATCH_STACK_SIZE 		OS_TASK_STACK_SIZE	= 128 x OS_STK
+
+// *************************************************************************************************************
+//Task:			mng_motion
+//Priority:		MOTION_THREAD_PRIORITY   		7
+//Stack Size:	MOTION_THREAD_STACK_SIZE		128
+//Send Q Size:	MOTION_PUBLISHER_SEND_Q_SIZE 	5
+//Rec Q Size:	MOTION_SUBSCRIBER_REC_Q_SIZE 	5
+
+// *************************************************************************************************************
+//Task:			LeftTrackControlTask
+//Priority:		LEFT_TRACK_CTRL_TASK_PRIORITY  	8
+//Stack Size: 	LEFT_TRACK_CTRL_STACK_SIZE 		OS_TASK_STACK_SIZE	= 128 x OS_STK
+ 
+// *************************************************************************************************************
+//Task:			RightTrackControlTask
+//Priority:		RIGHT_TRACK_CTRL_TASK_PRIORITY  9
+//Stack Size: 	RIGHT_TRACK_CTRL_STACK_SIZE 	OS_TASK_STACK_SIZE = 128 x OS_STK
+
+// *************************************************************************************************************
+//Task:			mng_leftarm
+//Priority:		LEFT_ARM_THREAD_PRIORITY  		10
+//Stack Size:   LEFT_ARM_THREAD_STACK_SIZE		128
+//Send Q Size:	LEFT_ARM_PUBLISHER_SEND_Q_SIZE 	5
+//Rec Q Size:	LEFT_ARM_SUBSCRIBER_REC_Q_SIZE 	5
+
+// *************************************************************************************************************
+//Task:			mng_rightarm
+//Priority:		RIGHT_ARM_PUBLISHER_SEND_Q_SIZE	11
+//Stack Size:   RIGHT_ARM_THREAD_STACK_SIZE		128
+//Send Q Size:	RIGHT_ARM_PUBLISHER_SEND_Q_SIZE	5
+//Rec Q Size:	RIGHT_ARM_SUBSCRIBER_REC_Q_SIZE	5
+
+// *************************************************************************************************************
+//Task:			OSTmr_Task - uCOS-II timer task runs expired timers callbacks (cNotifierTimer delivers EVT_TIMER)
+//Priority:		OS_TASK_TMR_PRIO  				12
+//Stack Size: 	OS_TASK_TMR_STK_SIZE 			128 x OS_STK
+//Timers:		OS_TMR_CFG_MAX					16 (mng_monitor uses 6)
+
+// *************************************************************************************************************
+//Task:			mng_rtc
+//Priority:		RTC_THREAD_PRIORITY   			15
+//Stack Size:	RTC_THREAD_STACK_SIZE			128
+//Send Q Size:	RTC_PUBLISHER_SEND_Q_SIZE 		5
+//Rec Q Size:	RTC_SUBSCRIBER_REC_Q_SIZE 		5
+
+// *************************************************************************************************************
+//Task:			mng_keypad
+//Priority:		KEYPAD_THREAD_PRIORITY   		20	
+//Stack Size:	KEYPAD_THREAD_STACK_SIZE		128
+//Send Q Size:	KEYPAD_PUBLISHER_SEND_Q_SIZE 	5
+//Rec Q Size:	KEYPAD_SUBSCRIBER_REC_Q_SIZE 	5
+
+// *************************************************************************************************************
+//Task:			mng_ctx	
+//Priority:		CTX_THREAD_PRIORITY   			21
+//Stack Size:	CTX_THREAD_STACK_SIZE			128
+//Send Q Size:	CTX_PUBLISHER_SEND_Q_SIZE 		5
+//Rec Q Size:	CTX_SUBSCRIBER_REC_Q_SIZE 		5
+
+// *************************************************************************************************************
+//Task:			mng_exe	
+//Priority:		EXE_THREAD_PRIORITY   			23
+//Stack Size:	EXE_THREAD_STACK_SIZE			128
+//Send Q Size:	EXE_PUBLISHER_SEND_Q_SIZE 		5
+//Rec Q Size:	EXE_SUBSCRIBER_REC_Q_SIZE 		5
+
+
+// *************************************************************************************************************
+//Task:			mng_brain	
+//Priority:		BRAIN_THREAD_PRIORITY   		24
+//Stack Size:	BRAIN_THREAD_STACK_SIZE			128
+//Send Q Size:	BRAIN_PUBLISHER_SEND_Q_SIZE 	5
+//Rec Q Size:	BRAIN_SUBSCRIBER_REC_Q_SIZE 	5
+
+// *************************************************************************************************************
+//Task:			mng_monitor	
+//Priority:		MONITOR_THREAD_PRIORITY   		26
+//Stack Size:	MONITOR_THREAD_STACK_SIZE		128
+//Send Q Size:	MONITOR_PUBLISHER_SEND_Q_SIZE 	5
+//Rec Q Size:	MONITOR_SUBSCRIBER_REC_Q_SIZE 	8
+
+// *************************************************************************************************************
+//Task:			mng_display
+//Priority:		DISPLAY_THREAD_PRIORITY   		30
+//Stack Size:	DISPLAY_THREAD_STACK_SIZE		128
+//Send Q Size:	DISPLAY_PUBLISHER_SEND_Q_SIZE 	5 
+//Rec Q Size:	DISPLAY_SUBSCRIBER_REC_Q_SIZE 	5
+
+// *************************************************************************************************************
+//Task:			mng_indicator
+//Priority:		INDICATOR_THREAD_PRIORITY   	35
+//Stack Size:	INDICATOR_THREAD_STACK_SIZE		128
+//Send Q Size:	INDICATOR_PUBLISHER_SEND_Q_SIZE 5
+//Rec Q Size:	INDICATOR_SUBSCRIBER_REC_Q_SIZE 5
+
+// *************************************************************************************************************
+//Task:			mng_rmt
+//Priority:		RMT_THREAD_PRIORITY	   			40
+//Stack Size:	RMT_THREAD_STACK_SIZE			128
+//Send Q Size:	RMT_PUBLISHER_SEND_Q_SIZE		5
+//Rec Q Size:	RMT_SUBSCRIBER_REC_Q_SIZE 		5
+
+// *************************************************************************************************************
+//Task:			mng_vrm
+//Priority:		VRM_THREAD_PRIORITY	   			42
+//Stack Size:	VRM_THREAD_STACK_SIZE			128
+//Send Q Size:	VRM_PUBLISHER_SEND_Q_SIZE		5
+//Rec Q Size:	VRM_SUBSCRIBER_REC_Q_SIZE 		5
+
+// *************************************************************************************************************
+//Task:			OSTaskIdle - run by ::OSInit()from cKernelInit::cKernelInit()
+//                           do nothing taks, counts only its execution for eventual uP utilization figures
+//Priority: 	OS_IDLE_PRIO       				63
+//Stack Size: 	OS_TASK_IDLE_STK_SIZE    		64  //64 x OS_STK
+
+
+#endif /*TSK_LIST_H_*/
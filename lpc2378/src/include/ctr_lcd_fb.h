@@ -0,0 +1,172 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        ctr_lcd_fb.h
+* Description: LCD frame buffer (tile cache) with dirty rectangle flush
+*              LCD primitives draw into 12 bit packed tiles kept in Ethernet RAM and only changed
+*              rectangles are sent to LCD by LCDFbFlush
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#ifndef CTR_LCD_FB_H_
+#define CTR_LCD_FB_H_
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+#include "type.h"
+
+//set to 0 to have LCD primitives always writing directly to LCD (no frame buffer code compiled)
+#define LCD_FRAMEBUFFER	1
+
+//LCD area covered by frame buffer (rows x and columns y from 0 to LCD_FB_SIZE-1)
+#define LCD_FB_SIZE			132
+//frame buffer is split into square tiles which are cached independently
+#define LCD_FB_TILE_SIZE	12 //IMPORTANT! must be even and LCD_FB_SIZE must be its multiple
+#define LCD_FB_TILES		(LCD_FB_SIZE/LCD_FB_TILE_SIZE) //tiles in a row and in a column
+#define LCD_FB_TILE_BYTES	((LCD_FB_TILE_SIZE*LCD_FB_TILE_SIZE*3)/2) //12 bit packed pixels of one tile
+//number of tiles which can keep individual pixels (tiles of one color do not need a slot)
+//68 x 216 bytes plus tile table and staging buffer fits 16kB of Ethernet RAM
+#define LCD_FB_SLOT_NO		68
+//bytes of packed pixels collected before sent to LCD during flush (must be multiple of 3)
+#define LCD_FB_STAGE_SIZE	396
+
+#if LCD_FRAMEBUFFER
+/*
+*********************************************************************************************************
+* Name:                                   LCDFbEnable
+*
+* Description: Enables frame buffer - LCD primitives draw into tiles from now on
+*
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 		All tiles start as unknown (LCD content is not known) so drawing into them goes directly to LCD
+* 		until tile is fully covered by filled rectangle or cleared screen
+* *********************************************************************************************************
+*/
+extern void LCDFbEnable(void);
+
+/*
+*********************************************************************************************************
+* Name:                                   LCDFbDisable
+*
+* Description: Flushes frame buffer and disables it - LCD primitives draw directly to LCD
+*
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+extern void LCDFbDisable(void);
+
+/*
+*********************************************************************************************************
+* Name:                                   LCDFbFlush
+*
+* Description: Sends all changed rectangles to LCD
+*
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 		Changed parts of adjacent tiles are merged into one rectangle sent with one PASET, CASET, RAMWR
+* *********************************************************************************************************
+*/
+extern void LCDFbFlush(void);
+
+/*
+*********************************************************************************************************
+* Name:                                   LCDFbSetPixel
+*
+* Description: Sets pixel in frame buffer
+*
+*
+* Arguments:   x - row, y - column, color - 12 bit color
+*
+* Returns:     1 - pixel is set in frame buffer, 0 - caller must write pixel directly to LCD
+*
+* Note(s):
+* 		0 is returned when frame buffer is disabled or pixel belongs to unknown tile
+* *********************************************************************************************************
+*/
+extern BYTE LCDFbSetPixel(int x, int y, int color);
+
+/*
+*********************************************************************************************************
+* Name:                                   LCDFbFillRect
+*
+* Description: Fills rectangle in frame buffer with the color
+*
+*
+* Arguments:   xmin, ymin, xmax, ymax - rectangle corners, color - 12 bit color
+*
+* Returns:     1 - rectangle is drawn, 0 - caller must draw rectangle directly to LCD
+*
+* Note(s):
+* 		Tiles fully covered by the rectangle become tiles of one color (no slot needed)
+* 		Parts of unknown tiles are written directly to LCD
+* *********************************************************************************************************
+*/
+extern BYTE LCDFbFillRect(int xmin, int ymin, int xmax, int ymax, int color);
+
+/*
+*********************************************************************************************************
+* Name:                                   LCDFbIsCached
+*
+* Description: Checks if whole rectangle can be drawn into frame buffer
+*
+*
+* Arguments:   xmin, ymin, xmax, ymax - rectangle corners
+*
+* Returns:     1 - frame buffer is enabled and none of tiles covered by the rectangle is unknown, 0 - otherwise
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+extern BYTE LCDFbIsCached(int xmin, int ymin, int xmax, int ymax);
+
+/*
+*********************************************************************************************************
+* Name:                                   LCDFbInvalidate
+*
+* Description: Marks tiles covered by the rectangle as unknown before the rectangle is written directly to LCD
+*
+*
+* Arguments:   xmin, ymin, xmax, ymax - rectangle corners
+*
+* Returns:     none
+*
+* Note(s):
+* 		Frame buffer is flushed first when any of invalidated tiles has changes not sent to LCD
+* *********************************************************************************************************
+*/
+extern void LCDFbInvalidate(int xmin, int ymin, int xmax, int ymax);
+
+#else
+#define LCDFbEnable()
+#define LCDFbDisable()
+#define LCDFbFlush()
+#endif //LCD_FRAMEBUFFER
+
+#ifdef __cplusplus
+}
+#endif //to close extern "C" if used
+#endif /*CTR_LCD_FB_H_*/
@@ -0,0 +1,150 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        hw_host.h
+* Description: Access to the simulated Wall-e board of the Linux host build (make host)
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+*              Used only by HOST_RUN build by host simulations and benchmarks (tools directory).
+* History:
+*              17-Oct-2026 - Initial version created
+*              17-Oct-2026 - Added LCD emulator access
+*              17-Oct-2026 - Added recording of heap calls
+*********************************************************************************************************
+*/
+#ifndef HW_HOST_H_
+#define HW_HOST_H_
+
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+#include "type.h"
+
+//track distance returned by HostGetTrackDistance is in 1/HOST_TRACK_DISTANCE_UNIT of the track pulse
+#define HOST_TRACK_DISTANCE_UNIT	1000000
+
+//nominal efficiency of the track motor in per mille
+//left motor is weaker as LOW/MID/HIGH_LEFT_MOTOR_COUNT is larger than the right one
+#define HOST_LEFT_MOTOR_EFFICIENCY	976
+#define HOST_RIGHT_MOTOR_EFFICIENCY	1000
+
+//display memory of emulated LCD controller, LCD drawing adds HOST_LCD_PAGE_OFFSET to the page address
+//so row x of ctr_lcd.h functions is page x+HOST_LCD_PAGE_OFFSET (see LCDSetPixel)
+#define HOST_LCD_PAGES			134
+#define HOST_LCD_COLUMNS		132
+#define HOST_LCD_PAGE_OFFSET	2
+
+/*
+*********************************************************************************************************
+* Name:                                    HostSetTrackMotors
+*
+* Description: Setup efficiency of simulated track motors
+*
+* Arguments:   InLeftEfficiency - left motor efficiency in per mille of the nominal motor
+*              InRightEfficiency - right motor efficiency in per mille of the nominal motor
+*
+* Returns:     none
+*
+* Note(s):
+* 			Speed of the track is proportional to its Timer3 motor count and motor efficiency.
+*           Default efficiencies are HOST_LEFT_MOTOR_EFFICIENCY and HOST_RIGHT_MOTOR_EFFICIENCY.
+* *********************************************************************************************************
+*/
+extern void HostSetTrackMotors(WORD InLeftEfficiency,WORD InRightEfficiency);
+
+/*
+*********************************************************************************************************
+* Name:                                    HostGetTrackDistance
+*
+* Description: Get distance covered by simulated track since the program start
+*
+* Arguments:   InTrack - LEFT_TRACK_TSK or RIGHT_TRACK_TSK
+*
+* Returns:     distance in 1/HOST_TRACK_DISTANCE_UNIT of the track pulse
+*
+* Note(s):
+* 			Distance grows in both motor directions.
+* *********************************************************************************************************
+*/
+extern unsigned long long HostGetTrackDistance(BYTE InTrack);
+
+/*
+*********************************************************************************************************
+* Name:                                    HostGetTrackPulseLength
+*
+* Description: Get steady state pulse length of simulated track
+*
+* Arguments:   InTrack - LEFT_TRACK_TSK or RIGHT_TRACK_TSK
+*              InCount - Timer3 motor count of the track
+*
+* Returns:     length of the track pulse in Timer3 ticks (0 when track does not move)
+*
+* Note(s):
+* 			Used to get open loop speed of the track which motor count is not corrected.
+* *********************************************************************************************************
+*/
+extern DWORD HostGetTrackPulseLength(BYTE InTrack,BYTE InCount);
+
+/*
+*********************************************************************************************************
+* Name:                                    HostGetLcdPixel
+*
+* Description: Get pixel of emulated LCD
+*
+* Arguments:   x - row address as used by ctr_lcd.h functions
+*              y - column address
+*
+* Returns:     12 bit color of the pixel in emulated LCD controller memory (0 outside of the memory)
+*
+* Note(s):
+* 			Emulated LCD executes PASET, CASET and RAMWR commands, other commands are only counted
+*           by GetLcdSpiWords.
+* *********************************************************************************************************
+*/
+extern WORD HostGetLcdPixel(int x, int y);
+
+/*
+*********************************************************************************************************
+* Name:                                    HostFillLcd
+*
+* Description: Fill whole memory of emulated LCD with the color
+*
+* Arguments:   InColor - 12 bit color
+*
+* Returns:     none
+*
+* Note(s):
+* 			Used to make pixels not drawn by the tested code visible when emulated LCD is compared.
+* *********************************************************************************************************
+*/
+extern void HostFillLcd(WORD InColor);
+
+/*
+*********************************************************************************************************
+* Name:                                    HostHeapTrace
+*
+* Description: Record heap call into the file named by WALLE_HEAP_TRACE environment variable
+*
+* Arguments:   pInBlock - user area of the allocated or released block
+*              InSize - size requested by malloc() or 0 for free()
+*
+* Returns:     none
+*
+* Note(s):
+* 			Called by lib_memalloc.c when MEM_TRACE_EN is 1. Nothing is recorded without the variable.
+*           Every call is one line - "m <address> <size>" or "f <address>" replayed by tools/bench_heap.
+* *********************************************************************************************************
+*/
+extern void HostHeapTrace(void *pInBlock,unsigned int InSize);
+
+#ifdef __cplusplus
+}
+#endif //to close extern "C" if used
+#endif /*HW_HOST_H_*/
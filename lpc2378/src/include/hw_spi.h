@@ -1,191 +1,416 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        hw_spi.c
-* Description: Functions to control SPI0 conected to LCD for OLIMEX LPC 2378 eval board
-* Author:      Bogdan Kowalczyk
-* Date:        5-Aug-2008
-* History:
-* 5-Aug-2008 - Initial version - extracted from original James P Lynch file and modified for OLIMEX LPC 2378
-* 13-Oct-2009 - Added MCP 3208 SPI A/D handling through SSP1 interface
-* 12-Dec-2010 - Chnged ADC CLK to almost 2MHz (to have as quick readings as possible) 
-*               and added MUTEX protection of ADC
-* 
-*********************************************************************************************************
-*/
-#ifndef SPI_H_
-#define SPI_H_
-
-#ifdef __cplusplus
-   extern "C" {
-#endif
-#include "type.h"
-	   
-#define ADC_DISTANCE_DETECTOR 	0 //distance detector is at ADC channel 0	
-#define ADC_SERVO 				1 //servo power supply voltage is at ADC channel 1
-#define ADC_MAIN_SUPPLY			2 //battery supply for uP board is at ADC channel 2
-#define ADC_MOTOR_SUPPLY		3 //battery supply for motors is at ADC channel 3	
-#define ADC_ARS_SENSOR			4 //angular rate sensor
-#define ADC_FOTO_TRANSISTOR		5 //fototranzistor nose sensor
-#define ADC_FOTO_RESISTOR		6 //fotoresistor tail sensor
-	   
-//  *********************************************************************************************
-//   						InitSpiLcd( )
-// 
-//	Sets up SPI channel 0 for communications to Nokia 6610 LCD Display                                                          
-//     
-//	I/O ports used:		PA2  = LCD Reset (set to low to reset)
-//						PA12 = LCD chip select (set to low to select the LCD chip)                                                              
-//						PA16 = SPI0_MISO Master In - Slave Out (not used in LCD interface)
-//						PA17 = SPI0_MOSI Master Out - Slave In pin (Serial Data to LCD slave)
-//						PA18 = SPI0_SPCK  Serial Clock (to LCD slave)					                                              
-//						PB20 = backlight control (normally PWM control, 1 = full on)	                                                                                                              
-//
-//  Author:  Olimex, James P Lynch     August 30, 2007
-//  IMPORTANT! 
-//           Need to be called after GPIO is initailzed
-//
-//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
-//  ********************************************************************************************* 
-extern void InitSpiLcd(void);
-
-
-//  *****************************************************************************
-//   						WriteSpiCommand.c
-// 
-//     Writes 9-bit command to LCD display via SPI interface
-//     
-//	   Inputs:	data  -  Leadis LDS176 controller/driver command
-//						                                              
-//						                                                             
-//	   Note:  clears bit 8 to indicate command transfer                                                           
-//
-//  Author:  Olimex, James P Lynch     August 30, 2007
-//  IMPORTANT! 
-//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
-//  ***************************************************************************** 
-extern void WriteSpiCommand(volatile unsigned int command);
-
-
-//  *****************************************************************************
-//   						WriteSpiData.c
-// 
-//     Writes 9-bit data to LCD display via SPI interface
-//     
-//	   Inputs:	data  -  Leadis LDS176 controller/driver command
-//						                                              
-//						                                                             
-//	   Note:  Sets bit 8 to indicate data transfer                                                           
-//
-//  Author:  Olimex, James P Lynch     August 30, 2007
-//  IMPORTANT! 
-//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
-//  ***************************************************************************** 
-
-extern void WriteSpiData(volatile unsigned int data);
-
-
-//  *********************************************************************************************
-//   						InitSpiAdc( )
-//  SSP1 is used to handling A/D MCP 3208. SSP is setup to work in SPI mode and connected to ADC
-//  as defined below:
-//		MCP 3208 CLK <- SCK1 (P0.7) - ETX2.2
-//      MCP 3208 DIN <- MOSI1 (P0.9) - ETX2.4
-//      MCP 3208 DOUT -> MISO1 (P0.8) - ETX2.3
-//      MCP 3208 NCS <- SSEL1 (P0.6) - ETX2.1
-//     
-//  IMPORTANT! 
-//           Need to be called after GPIO is initailzed (just for the case we decide to control SSEL through GPIO output)
-//
-//  ********************************************************************************************* 
-extern void InitSpiAdc(void); 
-
-
-/*
-*********************************************************************************************************
-* Name:                                    GetAdcAccess 
-* 
-* Description: Call to get access to ADC
-*       
-*
-* Arguments:   none
-*
-* Returns:     none
-*
-* Note(s):     
-*             Need to be called to get exclusive access to ADC
-* *********************************************************************************************************
-*/
-extern void GetAdcAccess(void);
-
-
-/*
-*********************************************************************************************************
-* Name:                                    ReleaseAdcAccess 
-* 
-* Description: Call to release access to ADC
-*       
-*
-* Arguments:   none
-*
-* Returns:     none
-*
-* Note(s):     
-*            
-* *********************************************************************************************************
-*/
-extern void ReleaseAdcAccess(void);
-
-//  *****************************************************************************
-//   						GetAdcConversion
-// 
-//     Initialize ADC conversion for specified channel
-//		Input:
-//				- number of channel for which we want to initialize ADC conversion
-//                0x00 - CH0
-//                ...
-//                0x07 - CH7
-//      Output
-//             - 12 bit conversion results (on D0 to D12 bits)
-//
-//   IMPORTANT!
-//           This command sends three bytes to initialize conversion of the ADC
-//           after this command 3 bytes from SSP are read
-//
-//  ***************************************************************************** 
-extern WORD GetAdcConversion(BYTE InAdcChannelNo);
-
-
-/*
-*********************************************************************************************************
-* Name:                                    CalculateAdcOffset
-* 
-* Description: Calculates ADC offset for specified channel
-*       
-*
-* Arguments:   
-* 				InAdcChannelNo - number of channel for which we want to initialize ADC conversion
-*                                0x00 - CH0
-*                                ...
-*                                0x07 - CH7
-*               InSamplesNo - number of samples which are averaged
-* 				InDelayInTicks - delay in OS ticks between samples
-*
-* Returns:     Calculated ofset value for ADC
-*
-* Note(s):     
-*            
-* *********************************************************************************************************
-*/
-extern WORD CalculateAdcOffset(BYTE InAdcChannelNo, WORD InSamplesNo, WORD InDelayInTicks );
-
-#ifdef __cplusplus
-}
-#endif //to close extern "C" if used
- 
-#endif /*SPI_H_*/
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        hw_spi.c
+* Description: Functions to control SPI0 conected to LCD for OLIMEX LPC 2378 eval board
+* Author:      Bogdan Kowalczyk
+* Date:        5-Aug-2008
+* History:
+* 5-Aug-2008 - Initial version - extracted from original James P Lynch file and modified for OLIMEX LPC 2378
+* 13-Oct-2009 - Added MCP 3208 SPI A/D handling through SSP1 interface
+* 12-Dec-2010 - Chnged ADC CLK to almost 2MHz (to have as quick readings as possible) 
+*               and added MUTEX protection of ADC
+* 17-Oct-2026 - ADC sampled in background by Timer3 driven sampling engine, ADC mutex removed
+* 17-Oct-2026 - Added GPDMA driven LCD data block transfers
+* 17-Oct-2026 - Added GetLcdSpiWords to measure LCD traffic
+* 17-Oct-2026 - Added SPI_MEASURE_EN time measurement of LCD DMA waits and ADC conversions
+*********************************************************************************************************
+*/
+#ifndef SPI_H_
+#define SPI_H_
+
+#ifdef __cplusplus
+   extern "C" {
+#endif
+#include "type.h"
+	   
+//set to 1 to measure time of LCD transfers and ADC conversions (see MeasureAdcConversions, LCDMeasureClearScreen)
+#define SPI_MEASURE_EN	0
+#define SPI_MEASURE_ADC_CONVERSIONS	1000 //number of ADC conversions measured
+
+//time of the measured SPI operation
+typedef struct
+{
+	DWORD mTime;//time from start to the end of the operation in Timer3 counts (about 0.48us)
+	DWORD mCpuTime;//CPU time used by the operation in Timer3 counts (busy waiting included)
+} sSpiTime;
+	   
+#define ADC_DISTANCE_DETECTOR 	0 //distance detector is at ADC channel 0	
+#define ADC_SERVO 				1 //servo power supply voltage is at ADC channel 1
+#define ADC_MAIN_SUPPLY			2 //battery supply for uP board is at ADC channel 2
+#define ADC_MOTOR_SUPPLY		3 //battery supply for motors is at ADC channel 3	
+#define ADC_ARS_SENSOR			4 //angular rate sensor
+#define ADC_FOTO_TRANSISTOR		5 //fototranzistor nose sensor
+#define ADC_FOTO_RESISTOR		6 //fotoresistor tail sensor
+
+//ADC SAMPLING ENGINE
+//Timer3 ISR every ADC_SAMPLING_TIMER3_TICKS (sampling engine tick) stores result of the previous conversion
+//and starts conversion of the next channel which sampling period elapsed.
+//One conversion takes 24 SSP1 clocks = 48us so it is done before the next sampling engine tick.
+#define ADC_CHANNEL_NO				8 //number of MCP 3208 channels
+#define ADC_NO_CHANNEL				0xFF //none channel conversion is in progress
+#define ADC_SAMPLE_BUFFER_SIZE		16 //samples kept for every channel - IMPORTANT! must be power of 2
+#define ADC_SAMPLING_TIMER3_TICKS	2 //sampling engine tick = 2 x 120us = 240us
+	   
+//sampling period of every channel in sampling engine ticks (0 - channel is not sampled)
+//IMPORTANT! Sum of 1/period of all channels must be < 1 as only one conversion is done every engine tick
+#define ADC_CH0_SAMPLING_PERIOD		16 //distance detector every 3.84ms (GP2D12 output changes every ~38ms)
+#define ADC_CH1_SAMPLING_PERIOD		40 //servo supply every 9.6ms
+#define ADC_CH2_SAMPLING_PERIOD		40 //main supply every 9.6ms
+#define ADC_CH3_SAMPLING_PERIOD		40 //motor supply every 9.6ms
+#define ADC_CH4_SAMPLING_PERIOD		4  //angular rate sensor every 0.96ms to follow Timer1 ARS_SAMPLE_PER_SEC integration
+#define ADC_CH5_SAMPLING_PERIOD		40 //fototransistor every 9.6ms (averaged over ~100ms to filter out light flicker)
+#define ADC_CH6_SAMPLING_PERIOD		40 //fotoresistor every 9.6ms (averaged over ~100ms to filter out light flicker)
+#define ADC_CH7_SAMPLING_PERIOD		0  //not connected
+	   
+//  *********************************************************************************************
+//   						InitSpiLcd( )
+// 
+//	Sets up SPI channel 0 for communications to Nokia 6610 LCD Display                                                          
+//     
+//	I/O ports used:		PA2  = LCD Reset (set to low to reset)
+//						PA12 = LCD chip select (set to low to select the LCD chip)                                                              
+//						PA16 = SPI0_MISO Master In - Slave Out (not used in LCD interface)
+//						PA17 = SPI0_MOSI Master Out - Slave In pin (Serial Data to LCD slave)
+//						PA18 = SPI0_SPCK  Serial Clock (to LCD slave)					                                              
+//						PB20 = backlight control (normally PWM control, 1 = full on)	                                                                                                              
+//
+//  Author:  Olimex, James P Lynch     August 30, 2007
+//  IMPORTANT! 
+//           Need to be called after GPIO is initailzed
+//
+//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
+//  ********************************************************************************************* 
+extern void InitSpiLcd(void);
+
+
+//  *****************************************************************************
+//   						WriteSpiCommand.c
+// 
+//     Writes 9-bit command to LCD display via SPI interface
+//     
+//	   Inputs:	data  -  Leadis LDS176 controller/driver command
+//						                                              
+//						                                                             
+//	   Note:  clears bit 8 to indicate command transfer                                                           
+//
+//  Author:  Olimex, James P Lynch     August 30, 2007
+//  IMPORTANT! 
+//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
+//  ***************************************************************************** 
+extern void WriteSpiCommand(volatile unsigned int command);
+
+
+//  *****************************************************************************
+//   						WriteSpiData.c
+// 
+//     Writes 9-bit data to LCD display via SPI interface
+//     
+//	   Inputs:	data  -  Leadis LDS176 controller/driver command
+//						                                              
+//						                                                             
+//	   Note:  Sets bit 8 to indicate data transfer                                                           
+//
+//  Author:  Olimex, James P Lynch     August 30, 2007
+//  IMPORTANT! 
+//  Original James P Lynch file for SAM7-EX256 was modified to support Olimex LPC2378 STK
+//  ***************************************************************************** 
+
+extern void WriteSpiData(volatile unsigned int data);
+
+//LCD data block transfers through GPDMA channel 0
+#define LCD_DMA_BUFFER_SIZE	510 //9 bit words in one DMA buffer (multiple of 3 bytes of two 12 bit pixels, < 4096 transfer size)
+#define LCD_DMA_MIN_WORDS	16 //shorter blocks are written directly by CPU
+
+/*
+*********************************************************************************************************
+* Name:                                    WriteSpiDataBlock
+* 
+* Description: Writes block of LCD data bytes through SSP0 using GPDMA
+*       
+*
+* Arguments:   
+* 				pData - data bytes
+* 				InByteNo - number of data bytes
+*
+* Returns:     none
+*
+* Note(s):     
+*            Calling task is suspended while data are shifted out so other tasks can run
+* *********************************************************************************************************
+*/
+extern void WriteSpiDataBlock(const BYTE *pData, DWORD InByteNo);
+
+/*
+*********************************************************************************************************
+* Name:                                    FillSpiData
+* 
+* Description: Writes data pattern through SSP0 using GPDMA until requested number of bytes is written
+*       
+*
+* Arguments:   
+* 				pPattern - pattern bytes
+* 				InPatternLength - number of pattern bytes (1..LCD_DMA_BUFFER_SIZE)
+* 				InByteNo - total number of data bytes to be written
+*
+* Returns:     none
+*
+* Note(s):     
+*            Calling task is suspended while data are shifted out so other tasks can run
+* *********************************************************************************************************
+*/
+extern void FillSpiData(const BYTE *pPattern, BYTE InPatternLength, DWORD InByteNo);
+
+/*
+*********************************************************************************************************
+* Name:                                    GpDmaIsrHandler
+* 
+* Description: GPDMA Interrupt Service Routine - signals end of LCD transfer
+*       
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+* *********************************************************************************************************
+*/
+extern void GpDmaIsrHandler(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    GetLcdSpiWords
+* 
+* Description: Returns number of 9 bit words (commands and data) sent to LCD since power on
+*       
+*
+* Arguments:   none
+*
+* Returns:     number of words (wraps around)
+*
+* Note(s):     
+*            Difference of two readings gives LCD traffic of drawing done between them
+* *********************************************************************************************************
+*/
+extern DWORD GetLcdSpiWords(void);
+
+#if SPI_MEASURE_EN > 0
+/*
+*********************************************************************************************************
+* Name:                                    GetSpiTimeStamp
+* 
+* Description: Returns Timer3 fine time stamp (see GetTimer3TimeStamp) and can be called with interrupts enabled
+*       
+*
+* Arguments:   none
+*
+* Returns:     number of Timer3 counts (about 0.48us each)
+*
+* Note(s):     
+* *********************************************************************************************************
+*/
+extern DWORD GetSpiTimeStamp(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    GetLcdDmaWaitTime
+* 
+* Description: Returns time tasks spent waiting on semaphore for the end of LCD GPDMA transfers
+*       
+*
+* Arguments:   none
+*
+* Returns:     waiting time in Timer3 counts (wraps around)
+*
+* Note(s):     
+*            CPU is used by other tasks in that time. Difference of two readings gives waiting time
+*            of LCD drawing done between them.
+* *********************************************************************************************************
+*/
+extern DWORD GetLcdDmaWaitTime(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    MeasureAdcConversions
+* 
+* Description: Measures time of ADC conversions done by CPU polling SSP1 and by the sampling engine
+*       
+*
+* Arguments:   
+* 				InConversionsNo - number of measured conversions
+*               pOutPolled - time of conversions done one by one by CPU waiting for SSP1
+*               pOutEngine - time of conversions done by sampling engine (CPU time is sampling engine ISR time)
+*
+* Returns:     none
+*
+* Note(s):     
+*            Sampling engine is stopped for the time of polled conversions so the latest samples are delayed.
+*            Call from a task as it waits until sampling engine does InConversionsNo conversions.
+* *********************************************************************************************************
+*/
+extern void MeasureAdcConversions(WORD InConversionsNo, sSpiTime *pOutPolled, sSpiTime *pOutEngine);
+#endif //SPI_MEASURE_EN
+
+
+//  *********************************************************************************************
+//   						InitSpiAdc( )
+//  SSP1 is used to handling A/D MCP 3208. SSP is setup to work in SPI mode and connected to ADC
+//  as defined below:
+//		MCP 3208 CLK <- SCK1 (P0.7) - ETX2.2
+//      MCP 3208 DIN <- MOSI1 (P0.9) - ETX2.4
+//      MCP 3208 DOUT -> MISO1 (P0.8) - ETX2.3
+//      MCP 3208 NCS <- SSEL1 (P0.6) - ETX2.1
+//     
+//  IMPORTANT! 
+//           Need to be called after GPIO is initailzed (just for the case we decide to control SSEL through GPIO output)
+//
+//  ********************************************************************************************* 
+extern void InitSpiAdc(void); 
+
+
+//  *****************************************************************************
+//   						GetAdcConversion
+// 
+//     Initialize ADC conversion for specified channel
+//		Input:
+//				- number of channel for which we want to initialize ADC conversion
+//                0x00 - CH0
+//                ...
+//                0x07 - CH7
+//      Output
+//             - 12 bit conversion results (on D0 to D12 bits)
+//
+//   IMPORTANT!
+//           This command sends three bytes to initialize conversion of the ADC
+//           after this command 3 bytes from SSP are read
+//           When sampling engine is running SSP1 is owned by it so the latest sample is returned
+//
+//  ***************************************************************************** 
+extern WORD GetAdcConversion(BYTE InAdcChannelNo);
+
+/*
+*********************************************************************************************************
+* Name:                                    AdcSamplingTick
+* 
+* Description: Sampling engine step called from Timer3 ISR on every Timer3 tick
+*       
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+*            Every ADC_SAMPLING_TIMER3_TICKS result of the previous conversion is stored in the channel
+*            sample buffer and conversion of the next channel which sampling period elapsed is started
+* *********************************************************************************************************
+*/
+extern void AdcSamplingTick(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    GetAdcLatest
+* 
+* Description: Returns the latest sample of the channel
+*       
+*
+* Arguments:   InAdcChannelNo - number of channel 0x00 (CH0) ... 0x07 (CH7)
+*
+* Returns:     The latest 12 bit sample or 0 when there is none
+*
+* Note(s):     
+*            Does not block, can be called from ISR
+* *********************************************************************************************************
+*/
+extern WORD GetAdcLatest(BYTE InAdcChannelNo);
+
+/*
+*********************************************************************************************************
+* Name:                                    GetAdcAverage
+* 
+* Description: Returns average of the latest samples of the channel
+*       
+*
+* Arguments:   
+* 				InAdcChannelNo - number of channel 0x00 (CH0) ... 0x07 (CH7)
+*               InSamplesNo - number of the latest samples averaged (up to ADC_SAMPLE_BUFFER_SIZE)
+*
+* Returns:     Average of the samples or 0 when there is none
+*
+* Note(s):     
+*            Does not block
+* *********************************************************************************************************
+*/
+extern WORD GetAdcAverage(BYTE InAdcChannelNo, BYTE InSamplesNo);
+
+/*
+*********************************************************************************************************
+* Name:                                    GetAdcMedian
+* 
+* Description: Returns median of the latest samples of the channel
+*       
+*
+* Arguments:   
+* 				InAdcChannelNo - number of channel 0x00 (CH0) ... 0x07 (CH7)
+*               InSamplesNo - number of the latest samples taken into account (up to ADC_SAMPLE_BUFFER_SIZE)
+*
+* Returns:     Median of the samples or 0 when there is none
+*
+* Note(s):     
+*            Does not block, use it when single wrong readings need to be filtered out
+* *********************************************************************************************************
+*/
+extern WORD GetAdcMedian(BYTE InAdcChannelNo, BYTE InSamplesNo);
+
+/*
+*********************************************************************************************************
+* Name:                                    GetAdcSamplesSince
+* 
+* Description: Returns number of samples of the channel taken since specified time stamp
+*       
+*
+* Arguments:   
+* 				InAdcChannelNo - number of channel 0x00 (CH0) ... 0x07 (CH7)
+*               InTimeStamp - Timer3 ticks (see GetTimer3Ticks)
+*
+* Returns:     Number of samples in the channel buffer taken not earlier than InTimeStamp
+*
+* Note(s):     
+*            Used to wait for samples taken after some event e.g. sensor power up
+* *********************************************************************************************************
+*/
+extern BYTE GetAdcSamplesSince(BYTE InAdcChannelNo, DWORD InTimeStamp);
+
+
+/*
+*********************************************************************************************************
+* Name:                                    CalculateAdcOffset
+* 
+* Description: Calculates ADC offset for specified channel
+*       
+*
+* Arguments:   
+* 				InAdcChannelNo - number of channel for which we want to initialize ADC conversion
+*                                0x00 - CH0
+*                                ...
+*                                0x07 - CH7
+*               InSamplesNo - number of samples which are averaged
+* 				InDelayInTicks - delay in OS ticks between samples
+*
+* Returns:     Calculated ofset value for ADC
+*
+* Note(s):     
+*            InDelayInTicks must be longer than sampling period of the channel to average different samples
+* *********************************************************************************************************
+*/
+extern WORD CalculateAdcOffset(BYTE InAdcChannelNo, WORD InSamplesNo, WORD InDelayInTicks );
+
+#ifdef __cplusplus
+}
+#endif //to close extern "C" if used
+ 
+#endif /*SPI_H_*/
@@ -1,191 +1,262 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2016, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        hw_uart.h
-* Description: Functions to control UART0 for OLIMEX LPC 2378 eval board
-* Author:      Bogdan Kowalczyk
-* Date:        16-Apr-2016
-* History:
-* 16-Apr-2016 - Initial version polling type UART control for very first trials
-* 
-*********************************************************************************************************
-*/
-#ifndef HW_UART_H_
-#define HW_UART_H_
-#ifdef __cplusplus
-   extern "C" {
-#endif
-
-#include "type.h"	   
-	   
-#define WAIT_FOR_UART_CHAR 1 //number of OS Ticks Uart0DebugGetChar is waiting befor next check of if char is received
-
-	   /*
-*********************************************************************************************************
-* Name:                                    InitUart0  
-* 
-* Description: Setup UART0 for serial transmission according to the
-*              transmission parameters
-*
-* Arguments:   none
-*
-* Returns:     none
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-extern void InitUart0(void);
-
-
-/*
-*********************************************************************************************************
-* Name:                                    Uart0PutChar 
-* 
-* Description: Sends character out of the UART
-*
-* Arguments:   ch - character to be written to the serial port
-*
-* Returns:     character written to the serial port
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-extern int Uart0PutChar(int ch);
-
-
-//send string via serial port
-//pString - pointer to string to be send
-extern void Uart0PutStr(char *pString);
-
-
-/*
-*********************************************************************************************************
-* Name:                                    Uart0GetChar 
-* 
-* Description: Gets character from the uart.
-* IMPORTANT! That is blocking function its keep waitin on Uart until character is received.
-* 		Tasks are not switched because there is not any OSTimeDly used in the while.
-* 		For non blocking version use Uart0CheckForChar function which returns when there is not character received.
-*
-* Arguments:   none
-*
-* Returns:     character read from the serial port
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-extern int Uart0GetChar(void);
-
-
-/*
-*********************************************************************************************************
-* Name:                                    Uart0CheckForCharacter 
-* 
-* Description: Check if there is character received and if there is any returns it
-* 		That is non-blocking version of Uart0GetChar
-*
-* Arguments:   none
-*
-* Returns:     0 - none character received or character read from the serial port if there is any
-* 
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-extern int Uart0CheckForCharacterReceived(void);
-
-/*
-*********************************************************************************************************
-* Name:                                  Uart0DebugMessage
-* 
-* Description: 
-* 	Displays DEBUG message plus Value on the terminal output and next comes to the new line
-*   when GenExcept requested (<>0) generates SWI to stop system operation
-*  
-*
-* Arguments:   
-*				pMsgStr - message to display
-* 				Value - value to display
-* 				GenExcept <>0 - generate exception
-* Returns:     none
-*
-* 			
-* Note(s):     
-* 			After texy displayed CR/LF is automaticly generated moving cursor on terminal to a new line
-* *********************************************************************************************************
-*/
-extern void Uart0DebugMessage(char *pMsgStr,long Value, BYTE GenExcept);
-
-/*
-*********************************************************************************************************
-* Name:                                  Uart0Message
-* 
-* Description: 
-* 	Displays DEBUG message plus Value on the terminal output and next comes to the new line
-*  
-*
-* Arguments:   
-*				pMsgStr - message to display
-* 				Value - value to display
-* Returns:     none
-*
-* 			
-* Note(s):     
-* 			After texy displayed CR/LF is automaticly generated moving cursor on terminal to a new line
-* *********************************************************************************************************
-*/
-extern void Uart0Message(char *pMsgStr,long Value);
-
-/*
-*********************************************************************************************************
-* Name:                                    Uart0GetTrmlChar 
-* 
-* Description: Waits and gets character from the Uart0 terminal connection but in sach a way 
-*              that tasks switching is not blcoked because during waiting OSTimeDly is used
-*
-* Arguments:   none
-*
-* Returns:     0 - none character received or character read from the serial port if there is any
-* 
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-extern int Uart0GetTrmlChar(void);
-
-/*
-*********************************************************************************************************
-* Name:                                    Uart0GetTmrlStr 
-* 
-* Description: Waits and gets characters from the Uart0 Terminal connection until <Enter>
-*              Task switching is not blocked because Uart0GetTrmlChar() is used to get single character
-*
-*
-*
-* Arguments:   pMsgBuffer - pointer to the storage area buffer of the received line
-* 			   inLength - length of the buffer used for the storage 
-*
-* Returns:     pointer to first character or NULL if none characters are received
-* 
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-extern char *Uart0GetTrmlStr(char* pMsgBuffer, int inLength);
-
-#ifdef __cplusplus
-}
-#endif //to close extern "C" if used
-   
-#endif /*HW_UART_H_*/
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2016, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        hw_uart.h
+* Description: Functions to control UART0 for OLIMEX LPC 2378 eval board
+* Author:      Bogdan Kowalczyk
+* Date:        16-Apr-2016
+* History:
+* 16-Apr-2016 - Initial version polling type UART control for very first trials
+* 17-Oct-2026 - Interrupt driven UART0 with TX and RX ring buffers, TX overflow policy and counters
+* 17-Oct-2026 - UART0_TX_OVERFLOW_POLICY can be given at build time (host test of every policy)
+* 
+*********************************************************************************************************
+*/
+#ifndef HW_UART_H_
+#define HW_UART_H_
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+#include "type.h"	   
+	   
+
+//UART0 ring buffers filled/emptied by UART0 interrupt (sizes must be power of 2)
+#define UART0_TX_BUFFER_SIZE	1024 //characters queued for transmission
+#define UART0_RX_BUFFER_SIZE	64   //received characters not yet read by a task
+#define UART0_TX_FIFO_SIZE		16   //characters which can be written into TX FIFO once THR is empty
+
+//what Uart0PutChar does when TX buffer is full
+#define UART0_TX_DROP			0 //new character is dropped
+#define UART0_TX_BLOCK			1 //calling task is delayed until there is a place in the buffer
+#define UART0_TX_DROP_OLDEST	2 //the oldest not yet sent character is dropped to make a place for the new one
+#ifndef UART0_TX_OVERFLOW_POLICY
+#define UART0_TX_OVERFLOW_POLICY	UART0_TX_BLOCK
+#endif
+//number of OS Ticks task waits before next check for a place in TX buffer (UART0_TX_BLOCK policy)
+#define UART0_TX_BLOCK_DELAY	1
+
+//IMPORTANT! Before uCOS-II is running, with interrupts disabled or from ISR UART0 is used in polling mode:
+//           TX buffer is sent out first and next the character is sent by polling THR empty flag
+
+	   /*
+*********************************************************************************************************
+* Name:                                    InitUart0  
+* 
+* Description: Setup UART0 for serial transmission according to the
+*              transmission parameters
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+extern void InitUart0(void);
+
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0PutChar 
+* 
+* Description: Puts character into UART0 TX buffer which is sent out by UART0 interrupt
+*
+* Arguments:   ch - character to be written to the serial port
+*
+* Returns:     character written to the serial port
+*
+* Note(s):     
+*              '\n' is sent as "\r\n"
+*              When TX buffer is full UART0_TX_OVERFLOW_POLICY defines what is done
+* 
+* *********************************************************************************************************
+*/
+extern int Uart0PutChar(int ch);
+
+
+//send string via serial port
+//pString - pointer to string to be send
+extern void Uart0PutStr(char *pString);
+
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0GetChar 
+* 
+* Description: Gets character from the uart.
+* IMPORTANT! That is blocking function its keep waitin on Uart until character is received.
+* 		When uCOS-II is running calling task waits on RX semaphore otherwise UART is polled.
+* 		For non blocking version use Uart0CheckForChar function which returns when there is not character received.
+*
+* Arguments:   none
+*
+* Returns:     character read from the serial port
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+extern int Uart0GetChar(void);
+
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0CheckForCharacter 
+* 
+* Description: Check if there is character received and if there is any returns it
+* 		That is non-blocking version of Uart0GetChar
+*
+* Arguments:   none
+*
+* Returns:     0 - none character received or character read from the serial port if there is any
+* 
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+extern int Uart0CheckForCharacterReceived(void);
+
+/*
+*********************************************************************************************************
+* Name:                                  Uart0DebugMessage
+* 
+* Description: 
+* 	Displays DEBUG message plus Value on the terminal output and next comes to the new line
+*   when GenExcept requested (<>0) generates SWI to stop system operation
+*  
+*
+* Arguments:   
+*				pMsgStr - message to display
+* 				Value - value to display
+* 				GenExcept <>0 - generate exception
+* Returns:     none
+*
+* 			
+* Note(s):     
+* 			After texy displayed CR/LF is automaticly generated moving cursor on terminal to a new line
+* *********************************************************************************************************
+*/
+extern void Uart0DebugMessage(char *pMsgStr,long Value, BYTE GenExcept);
+
+/*
+*********************************************************************************************************
+* Name:                                  Uart0Message
+* 
+* Description: 
+* 	Displays DEBUG message plus Value on the terminal output and next comes to the new line
+*  
+*
+* Arguments:   
+*				pMsgStr - message to display
+* 				Value - value to display
+* Returns:     none
+*
+* 			
+* Note(s):     
+* 			After texy displayed CR/LF is automaticly generated moving cursor on terminal to a new line
+* *********************************************************************************************************
+*/
+extern void Uart0Message(char *pMsgStr,long Value);
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0GetTrmlChar 
+* 
+* Description: Waits and gets character from the Uart0 terminal connection but in sach a way 
+*              that tasks switching is not blcoked because during waiting OSTimeDly is used
+*
+* Arguments:   none
+*
+* Returns:     0 - none character received or character read from the serial port if there is any
+* 
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+extern int Uart0GetTrmlChar(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0GetTmrlStr 
+* 
+* Description: Waits and gets characters from the Uart0 Terminal connection until <Enter>
+*              Task switching is not blocked because Uart0GetTrmlChar() is used to get single character
+*
+*
+*
+* Arguments:   pMsgBuffer - pointer to the storage area buffer of the received line
+* 			   inLength - length of the buffer used for the storage 
+*
+* Returns:     pointer to first character or NULL if none characters are received
+* 
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+extern char *Uart0GetTrmlStr(char* pMsgBuffer, int inLength);
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0Flush 
+* 
+* Description: Sends out all characters from TX buffer by polling UART0 with interrupts disabled
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+*              Used before an exception is generated so the last messages are not lost
+* *********************************************************************************************************
+*/
+extern void Uart0Flush(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    Uart0IsrHandler 
+* 
+* Description: UART0 Interrupt Service Routine - moves characters between ring buffers and UART0 FIFOs
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+* *********************************************************************************************************
+*/
+extern void Uart0IsrHandler(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    GetUart0TxOverflows, GetUart0RxOverflows, GetUart0TxMaxLevel 
+* 
+* Description: UART0 buffers statistics
+*
+* Arguments:   none
+*
+*              GetUart0TxOverflows - number of TX characters which found TX buffer full (dropped or waited depending on policy)
+*              GetUart0RxOverflows - number of received characters dropped because of RX buffer overflow
+*              GetUart0TxMaxLevel - the highest number of characters waiting in TX buffer so far
+*
+* Note(s):     
+* *********************************************************************************************************
+*/
+extern DWORD GetUart0TxOverflows(void);
+extern DWORD GetUart0RxOverflows(void);
+extern WORD GetUart0TxMaxLevel(void);
+
+#ifdef __cplusplus
+}
+#endif //to close extern "C" if used
+   
+#endif /*HW_UART_H_*/
@@ -1,1115 +1,1115 @@
-/*************************************************************************
- *
- *	Author: Slavcho Tomov
- *
- *    (c) Copyright Olimex 2006
- *  B.K - this file was generated using Olimex BmpToArray.exe utility
- * and is used by lcd.c to write entire bit map into LCD
- **************************************************************************/
-
-const unsigned char bmp [] = {};
-
-#if 0 //disable big bitmap with Kuba face as it is not used now
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-	
-const unsigned char bmp [] = {
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xee, 0xed, 0xde, 0xde, 0xed, 0xee, 0xdd, 0xee, 0xee, 0xff, 0xff, 0xff, 0xde, 0xec, 0xde, 0xdd, 0xee, 0xee, 0xee, 0xef, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xef, 0xfc, 0xef, 0xcd, 0xeb, 0xbe, 0x9a, 0xc8, 0x8a, 0x77, 0x97, 0x79, 0x77, 0x97, 0x78, 0x88, 0x99, 0x9a, 0x89, 0xa8, 0x89, 
-				0x77, 0x87, 0x89, 0x88, 0x9a, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xde, 0xec, 0xde, 0xbc, 0xe9, 0xac, 0x78, 0xb6, 0x79, 0x45, 0x62, 0x34, 0x23, 0x42, 0x34, 0x23, 0x42, 0x34, 
-				0x34, 0x53, 0x45, 0x34, 0x53, 0x34, 0x23, 0x42, 0x34, 0x34, 0x54, 0x45, 0x77, 0x8c, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfc, 0xde, 0xbc, 0xda, 0xbc, 0x9a, 0xb7, 0x8a, 0x78, 0x95, 0x67, 0x23, 0x51, 0x24, 0x12, 0x31, 0x23, 
-				0x12, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x31, 0x23, 0x12, 0x31, 0x23, 0x11, 0x31, 0x23, 0x22, 0x32, 0x24, 0x33, 0x45, 0x56, 0x88, 0xae, 0xee, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xde, 0xeb, 0xce, 0xab, 0xd9, 0xac, 0x78, 0xa5, 0x67, 0x45, 0x62, 0x45, 0x23, 0x51, 0x24, 
-				0x12, 0x31, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x31, 0x23, 0x12, 0x31, 0x23, 0x11, 0x21, 0x22, 0x11, 0x21, 0x23, 0x22, 0x32, 0x34, 
-				0x33, 0x43, 0x35, 0x44, 0x57, 0x89, 0xbc, 0xdd, 0xde, 0xdd, 0xed, 0xde, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xea, 0xcd, 0x9a, 0xc7, 0x8a, 0x56, 0x74, 0x56, 0x34, 0x51, 0x24, 
-				0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x22, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x12, 0x21, 0x23, 0x22, 0x32, 0x23, 0x22, 0x43, 0x34, 0x34, 0x54, 0x45, 0x66, 0x77, 0x79, 0x88, 0xa8, 0x8a, 0x99, 0xbc, 0xcd, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xce, 0xea, 0xcd, 0x9a, 0xc7, 0x8a, 0x55, 0x73, 0x45, 
-				0x24, 0x52, 0x35, 0x12, 0x41, 0x24, 0x23, 0x42, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 
-				0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x22, 0x32, 0x23, 0x12, 0x32, 0x23, 0x23, 0x42, 0x34, 0x33, 0x43, 0x45, 0x34, 0x53, 0x35, 
-				0x45, 0x57, 0x78, 0xaa, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfa, 0xce, 0x8a, 0xd6, 0x8a, 
-				0x46, 0x73, 0x46, 0x23, 0x52, 0x35, 0x24, 0x52, 0x34, 0x23, 0x42, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x31, 0x23, 0x12, 0x32, 0x23, 
-				0x12, 0x31, 0x22, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x22, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x32, 0x23, 
-				0x22, 0x32, 0x24, 0x23, 0x42, 0x24, 0x22, 0x43, 0x45, 0x55, 0x6b, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfb, 0xde, 
-				0x9b, 0xd7, 0x9b, 0x57, 0x92, 0x56, 0x24, 0x52, 0x35, 0x12, 0x41, 0x24, 0x13, 0x42, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 
-				0x12, 0x21, 0x23, 0x12, 0x21, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x12, 0x21, 0x23, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x31, 0x23, 0x12, 0x32, 0x24, 0x33, 0x46, 0x67, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xfe, 0xff, 0xac, 0xd8, 0x9b, 0x66, 0x84, 0x56, 0x34, 0x52, 0x35, 0x23, 0x41, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
-				0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x21, 0x12, 
-				0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x32, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x11, 0x22, 0x23, 0x33, 0x44, 0x45, 
-				0x88, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf9, 0xce, 0x8a, 0xc5, 0x67, 0x34, 0x53, 0x45, 0x23, 0x42, 0x34, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x21, 0x12, 
-				0x12, 0x21, 0x23, 0x33, 0x43, 0x34, 0x55, 0x6a, 0xab, 0xcd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xac, 0xe7, 0x9c, 0x56, 0x83, 0x46, 0x24, 0x52, 0x34, 0x12, 0x42, 0x24, 
-				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x10, 0x11, 0x01, 0x21, 0x12, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 
-				0x12, 0x21, 0x12, 0x11, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x22, 0x23, 0x23, 0x42, 0x34, 0x33, 0x45, 0x67, 0x88, 0xa9, 0xab, 0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfa, 0xce, 0x89, 0xb5, 0x67, 0x34, 0x62, 0x45, 
-				0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x10, 0x11, 0x01, 0x21, 0x22, 
-				0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x12, 0x11, 0x21, 0x22, 0x12, 0x21, 0x12, 0x11, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x22, 0x23, 0x22, 0x32, 0x24, 0x23, 0x43, 0x35, 0x44, 0x55, 0x56, 
-				0x77, 0x8a, 0xac, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xee, 0xac, 0xe8, 0xac, 
-				0x45, 0x72, 0x45, 0x23, 0x52, 0x34, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x23, 0x12, 0x31, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
-				0x01, 0x10, 0x12, 0x01, 0x21, 0x22, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x11, 0x21, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x12, 0x11, 0x21, 0x12, 
-				0x11, 0x21, 0x22, 0x12, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x32, 0x23, 
-				0x23, 0x42, 0x24, 0x22, 0x43, 0x35, 0x34, 0x55, 0x56, 0x89, 0xac, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xce, 0xea, 0xce, 0x79, 0xb5, 0x68, 0x24, 0x51, 0x34, 0x23, 0x41, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x11, 0x20, 0x12, 0x01, 0x21, 0x12, 
-				0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x12, 0x21, 0x22, 0x12, 0x32, 0x23, 0x23, 0x42, 0x24, 0x12, 0x31, 0x23, 0x23, 0x43, 0x45, 0x45, 0x66, 0x67, 0x9a, 0xbe, 0xee, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xfc, 0xef, 0x9c, 0xe7, 0x9b, 0x45, 0x72, 0x45, 0x13, 0x51, 0x24, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x12, 0x20, 0x12, 
-				0x01, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x11, 0x20, 0x12, 0x01, 0x20, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x02, 0x21, 0x22, 
-				0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x11, 0x21, 0x22, 0x12, 0x31, 0x23, 0x22, 0x31, 0x23, 0x11, 0x31, 0x23, 0x22, 0x42, 0x34, 0x23, 0x43, 0x35, 
-				0x55, 0x68, 0x89, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf8, 0xce, 0x7a, 0xc4, 0x57, 0x13, 0x51, 0x35, 0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 
-				0x02, 0x20, 0x12, 0x12, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x12, 0x12, 0x21, 0x22, 
-				0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x11, 0x21, 0x12, 0x11, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x12, 0x20, 0x12, 0x02, 0x21, 0x22, 0x01, 0x21, 0x12, 0x12, 0x21, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x11, 0x31, 0x23, 
-				0x22, 0x42, 0x34, 0x33, 0x53, 0x35, 0x34, 0x56, 0x67, 0x89, 0xae, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x9c, 0xe6, 0xac, 0x36, 0x81, 0x35, 0x12, 0x41, 0x24, 
-				0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x02, 0x20, 0x12, 0x11, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
-				0x01, 0x21, 0x12, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x23, 0x12, 0x21, 0x22, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 
-				0x01, 0x21, 0x22, 0x12, 0x31, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x22, 0x01, 0x21, 0x12, 0x12, 0x21, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x34, 0x23, 0x53, 0x35, 0x44, 0x55, 0x56, 0x66, 0x8a, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfa, 0xce, 0x7a, 0xc3, 0x67, 
-				0x13, 0x51, 0x35, 0x02, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x02, 0x20, 0x12, 0x02, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x01, 0x21, 0x23, 
-				0x12, 0x31, 0x22, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 
-				0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x23, 0x42, 0x35, 0x34, 0x53, 0x45, 0x45, 0x66, 0x78, 
-				0xbc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xad, 0xe7, 0xad, 0x36, 0x81, 0x45, 0x13, 0x50, 0x35, 0x02, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x31, 0x22, 
-				0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 
-				0x01, 0x20, 0x22, 0x12, 0x20, 0x22, 0x02, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x42, 0x35, 
-				0x23, 0x52, 0x35, 0x23, 0x43, 0x45, 0x77, 0x8d, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xfc, 0xef, 0x8b, 0xe5, 0x7a, 0x14, 0x61, 0x35, 0x13, 0x50, 0x24, 0x02, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 
-				0x02, 0x31, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x01, 0x21, 0x22, 0x01, 0x20, 0x12, 
-				0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x01, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x22, 0x02, 0x20, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x42, 0x34, 0x23, 0x42, 0x34, 0x23, 0x42, 0x24, 0x44, 0x58, 0x89, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfa, 0xbe, 0x78, 0xb2, 0x46, 0x13, 0x51, 0x35, 0x13, 0x50, 0x24, 0x12, 0x41, 0x24, 
-				0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x02, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x22, 
-				0x12, 0x31, 0x22, 0x02, 0x20, 0x22, 0x02, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 
-				0x01, 0x21, 0x22, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x02, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x02, 0x20, 0x22, 0x12, 0x20, 0x22, 
-				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x34, 0x23, 0x42, 0x34, 0x23, 0x42, 0x24, 0x22, 0x45, 0x56, 0x9a, 0xbf, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0xe8, 0xac, 0x45, 0x71, 0x25, 0x13, 0x51, 0x35, 
-				0x13, 0x51, 0x24, 0x12, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x02, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x01, 0x21, 0x22, 
-				0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x20, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x02, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x02, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x23, 0x41, 0x34, 0x23, 0x42, 0x34, 
-				0x22, 0x43, 0x45, 0x66, 0x7c, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x8a, 0xd6, 0x79, 
-				0x13, 0x51, 0x25, 0x13, 0x51, 0x35, 0x13, 0x51, 0x24, 0x12, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x22, 0x02, 0x20, 0x22, 0x02, 0x20, 0x12, 
-				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
-				0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x22, 
-				0x02, 0x21, 0x22, 0x12, 0x21, 0x22, 0x01, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x30, 0x23, 0x02, 0x31, 0x23, 0x12, 0x31, 0x24, 
-				0x12, 0x41, 0x24, 0x22, 0x42, 0x24, 0x22, 0x42, 0x34, 0x45, 0x58, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xef, 0xfa, 0xbd, 0x78, 0xa2, 0x46, 0x12, 0x51, 0x25, 0x13, 0x51, 0x35, 0x12, 0x41, 0x34, 0x12, 0x41, 0x23, 0x12, 0x30, 0x22, 0x02, 0x20, 0x12, 
-				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 
-				0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
-				0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x02, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
-				0x02, 0x31, 0x23, 0x12, 0x31, 0x24, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 0x12, 0x42, 0x34, 0x44, 0x55, 0x56, 0xcc, 0xdf, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe8, 0xac, 0x45, 0x71, 0x35, 0x12, 0x51, 0x35, 0x13, 0x51, 0x24, 0x12, 0x41, 0x34, 0x12, 0x40, 0x23, 
-				0x02, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x23, 0x11, 0x31, 0x13, 
-				0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 
-				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x22, 
-				0x02, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x30, 0x23, 0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 0x12, 0x42, 0x24, 0x34, 0x54, 0x45, 
-				0x77, 0x8f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xee, 0x9a, 0xd5, 0x69, 0x24, 0x61, 0x25, 0x12, 0x41, 0x24, 0x12, 0x41, 0x24, 
-				0x12, 0x41, 0x24, 0x12, 0x30, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 
-				0x01, 0x31, 0x13, 0x11, 0x31, 0x23, 0x01, 0x30, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x11, 0x01, 0x20, 0x12, 
-				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 
-				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x02, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 
-				0x12, 0x42, 0x24, 0x33, 0x53, 0x45, 0x55, 0x6d, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xce, 0x78, 0xb3, 0x46, 0x23, 0x51, 0x24, 
-				0x12, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 
-				0x01, 0x20, 0x12, 0x01, 0x21, 0x12, 0x11, 0x31, 0x23, 0x12, 0x31, 0x23, 0x01, 0x30, 0x13, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x10, 0x11, 
-				0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 
-				0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
-				0x12, 0x41, 0x24, 0x22, 0x42, 0x24, 0x12, 0x41, 0x24, 0x33, 0x53, 0x35, 0x34, 0x58, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xf8, 0xad, 
-				0x45, 0x82, 0x35, 0x13, 0x51, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x01, 0x20, 0x12, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 
-				0x01, 0x10, 0x11, 0x01, 0x21, 0x12, 0x11, 0x20, 0x12, 0x11, 0x21, 0x13, 0x12, 0x31, 0x24, 0x12, 0x41, 0x24, 0x12, 0x30, 0x13, 0x01, 0x30, 0x12, 
-				0x01, 0x21, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x21, 0x12, 0x12, 0x20, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
-				0x11, 0x20, 0x12, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 0x12, 0x41, 0x24, 0x23, 0x52, 0x35, 0x33, 0x56, 0x57, 0xcc, 0xdf, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xac, 0xe6, 0x8b, 0x13, 0x62, 0x35, 0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x11, 0x21, 0x12, 0x01, 0x20, 0x11, 
-				0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x11, 0x21, 0x23, 0x12, 0x31, 0x12, 0x11, 0x31, 0x23, 0x12, 0x42, 0x24, 0x22, 0x52, 0x25, 
-				0x12, 0x41, 0x24, 0x11, 0x31, 0x23, 0x12, 0x31, 0x23, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x23, 0x11, 0x31, 0x23, 
-				0x12, 0x31, 0x23, 0x01, 0x20, 0x12, 0x12, 0x30, 0x12, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x11, 
-				0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 0x22, 0x52, 0x35, 
-				0x33, 0x54, 0x45, 0x99, 0xaf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 0x8a, 0xd3, 0x57, 0x12, 0x51, 0x35, 0x12, 0x41, 0x23, 0x12, 0x31, 0x13, 0x12, 0x31, 0x22, 
-				0x11, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x11, 0x21, 0x12, 0x11, 0x22, 0x24, 0x22, 0x31, 0x13, 0x12, 0x32, 0x24, 
-				0x22, 0x42, 0x35, 0x23, 0x52, 0x35, 0x12, 0x52, 0x25, 0x12, 0x42, 0x35, 0x23, 0x52, 0x34, 0x01, 0x30, 0x12, 0x01, 0x21, 0x12, 0x11, 0x20, 0x12, 
-				0x01, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x13, 0x12, 0x31, 0x23, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 
-				0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x02, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 
-				0x12, 0x42, 0x24, 0x22, 0x52, 0x35, 0x33, 0x53, 0x35, 0x66, 0x8f, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0x78, 0xa2, 0x35, 0x13, 0x51, 0x24, 0x12, 0x41, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x11, 0x21, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x13, 0x22, 0x42, 0x34, 
-				0x22, 0x41, 0x24, 0x22, 0x42, 0x25, 0x22, 0x53, 0x36, 0x34, 0x63, 0x36, 0x23, 0x52, 0x35, 0x22, 0x53, 0x46, 0x44, 0x62, 0x35, 0x12, 0x41, 0x13, 
-				0x11, 0x31, 0x13, 0x11, 0x30, 0x12, 0x01, 0x32, 0x24, 0x22, 0x41, 0x24, 0x12, 0x41, 0x24, 0x12, 0x41, 0x23, 0x23, 0x42, 0x34, 0x01, 0x20, 0x11, 
-				0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 0x23, 0x52, 0x35, 0x23, 0x53, 0x35, 0x45, 0x6c, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbd, 0x56, 0x81, 0x35, 
-				0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x13, 
-				0x11, 0x32, 0x24, 0x33, 0x53, 0x35, 0x23, 0x52, 0x25, 0x23, 0x53, 0x35, 0x23, 0x63, 0x47, 0x34, 0x73, 0x36, 0x34, 0x62, 0x36, 0x23, 0x65, 0x57, 
-				0x55, 0x74, 0x46, 0x22, 0x42, 0x24, 0x11, 0x42, 0x24, 0x12, 0x31, 0x13, 0x11, 0x32, 0x24, 0x23, 0x52, 0x35, 0x22, 0x51, 0x25, 0x12, 0x41, 0x24, 
-				0x33, 0x53, 0x45, 0x12, 0x30, 0x12, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 
-				0x01, 0x20, 0x12, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x12, 0x42, 0x34, 0x23, 0x52, 0x35, 0x23, 0x53, 0x35, 0x44, 0x59, 0x9a, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xef, 0xf9, 0xac, 0x35, 0x61, 0x35, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 
-				0x11, 0x21, 0x23, 0x12, 0x32, 0x23, 0x12, 0x42, 0x34, 0x33, 0x53, 0x35, 0x33, 0x52, 0x25, 0x33, 0x63, 0x36, 0x34, 0x64, 0x58, 0x45, 0x73, 0x47, 
-				0x44, 0x72, 0x36, 0x34, 0x66, 0x69, 0x66, 0x94, 0x57, 0x23, 0x52, 0x35, 0x12, 0x42, 0x35, 0x33, 0x51, 0x13, 0x12, 0x43, 0x35, 0x33, 0x52, 0x35, 
-				0x23, 0x52, 0x35, 0x12, 0x51, 0x25, 0x34, 0x64, 0x56, 0x22, 0x40, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x12, 0x01, 0x20, 0x12, 
-				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x12, 0x42, 0x34, 0x22, 0x42, 0x35, 
-				0x23, 0x53, 0x35, 0x34, 0x57, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf8, 0x9b, 0x35, 0x61, 0x35, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
-				0x12, 0x21, 0x22, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x42, 0x34, 0x22, 0x43, 0x45, 0x44, 0x63, 0x46, 0x34, 0x63, 0x36, 0x34, 0x63, 0x46, 
-				0x45, 0x75, 0x69, 0x45, 0x83, 0x47, 0x45, 0x82, 0x36, 0x34, 0x77, 0x7a, 0x67, 0xa5, 0x57, 0x34, 0x63, 0x46, 0x22, 0x53, 0x46, 0x55, 0x71, 0x24, 
-				0x22, 0x55, 0x57, 0x44, 0x63, 0x36, 0x23, 0x62, 0x35, 0x23, 0x52, 0x35, 0x45, 0x75, 0x57, 0x33, 0x50, 0x13, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
-				0x01, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 
-				0x12, 0x42, 0x34, 0x22, 0x42, 0x24, 0x23, 0x52, 0x35, 0x34, 0x56, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0x8a, 0x34, 0x61, 0x34, 0x12, 0x41, 0x23, 0x12, 0x32, 0x23, 
-				0x12, 0x21, 0x22, 0x12, 0x22, 0x22, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x42, 0x24, 0x33, 0x53, 0x35, 0x33, 0x54, 0x46, 0x44, 0x74, 0x47, 
-				0x44, 0x64, 0x46, 0x45, 0x74, 0x47, 0x55, 0x86, 0x6a, 0x55, 0x84, 0x57, 0x55, 0x83, 0x47, 0x55, 0x87, 0x8b, 0x78, 0xb5, 0x68, 0x45, 0x75, 0x57, 
-				0x23, 0x54, 0x46, 0x66, 0x92, 0x35, 0x23, 0x56, 0x68, 0x45, 0x73, 0x47, 0x34, 0x73, 0x36, 0x23, 0x63, 0x46, 0x56, 0x86, 0x69, 0x45, 0x71, 0x24, 
-				0x01, 0x30, 0x12, 0x01, 0x20, 0x12, 0x11, 0x21, 0x23, 0x12, 0x31, 0x13, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 
-				0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x42, 0x34, 0x22, 0x41, 0x24, 0x23, 0x52, 0x35, 0x34, 0x56, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xd5, 0x68, 0x23, 0x52, 0x34, 
-				0x12, 0x41, 0x23, 0x22, 0x32, 0x33, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x32, 0x24, 0x22, 0x43, 0x34, 0x33, 0x53, 0x35, 
-				0x33, 0x64, 0x47, 0x44, 0x74, 0x47, 0x44, 0x74, 0x47, 0x55, 0x94, 0x58, 0x55, 0x96, 0x6a, 0x55, 0x95, 0x59, 0x56, 0x94, 0x58, 0x66, 0xa7, 0x8c, 
-				0x78, 0xb6, 0x6a, 0x56, 0x85, 0x68, 0x44, 0x74, 0x46, 0x77, 0xa3, 0x46, 0x33, 0x66, 0x7a, 0x55, 0x84, 0x57, 0x44, 0x73, 0x47, 0x34, 0x74, 0x57, 
-				0x66, 0x96, 0x7a, 0x55, 0x72, 0x35, 0x11, 0x30, 0x13, 0x11, 0x31, 0x13, 0x12, 0x31, 0x24, 0x23, 0x41, 0x23, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
-				0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x24, 0x12, 0x41, 0x24, 0x23, 0x42, 0x34, 0x34, 0x56, 0x67, 
-				0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-				0x8a, 0xc4, 0x56, 0x23, 0x51, 0x24, 0x12, 0x41, 0x23, 0x23, 0x32, 0x34, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x23, 0x32, 0x34, 0x22, 0x32, 0x24, 
-				0x33, 0x43, 0x35, 0x33, 0x53, 0x35, 0x33, 0x65, 0x57, 0x45, 0x74, 0x58, 0x45, 0x85, 0x58, 0x56, 0x95, 0x58, 0x66, 0xa6, 0x6a, 0x55, 0x95, 0x69, 
-				0x56, 0xa5, 0x69, 0x67, 0xb7, 0x8c, 0x78, 0xc6, 0x7a, 0x66, 0x96, 0x69, 0x55, 0x84, 0x57, 0x77, 0xa4, 0x47, 0x34, 0x67, 0x7a, 0x56, 0x94, 0x58, 
-				0x45, 0x84, 0x58, 0x44, 0x75, 0x69, 0x77, 0xb6, 0x7a, 0x55, 0x83, 0x46, 0x12, 0x41, 0x13, 0x12, 0x31, 0x23, 0x12, 0x32, 0x24, 0x33, 0x52, 0x34, 
-				0x01, 0x30, 0x13, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x24, 0x12, 0x41, 0x24, 
-				0x22, 0x42, 0x34, 0x34, 0x56, 0x67, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x89, 0xb3, 0x46, 0x23, 0x41, 0x24, 0x22, 0x42, 0x34, 0x23, 0x42, 0x34, 0x23, 0x32, 0x23, 0x22, 0x32, 0x23, 
-				0x23, 0x32, 0x23, 0x22, 0x32, 0x24, 0x33, 0x53, 0x35, 0x33, 0x53, 0x36, 0x34, 0x64, 0x57, 0x55, 0x85, 0x59, 0x55, 0x85, 0x59, 0x66, 0xa6, 0x6a, 
-				0x66, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 0x66, 0xa5, 0x6a, 0x77, 0xb8, 0x8c, 0x88, 0xc7, 0x8b, 0x67, 0xa6, 0x7a, 0x56, 0x95, 0x58, 0x67, 0xa4, 0x57, 
-				0x45, 0x86, 0x7a, 0x66, 0x95, 0x69, 0x56, 0x95, 0x59, 0x55, 0x86, 0x7a, 0x78, 0xc7, 0x7b, 0x66, 0x93, 0x47, 0x12, 0x51, 0x24, 0x12, 0x41, 0x24, 
-				0x22, 0x42, 0x35, 0x34, 0x62, 0x35, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 
-				0x12, 0x31, 0x24, 0x12, 0x41, 0x24, 0x22, 0x42, 0x34, 0x33, 0x55, 0x56, 0xcc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x78, 0xa3, 0x45, 0x12, 0x41, 0x24, 0x22, 0x42, 0x34, 0x33, 0x42, 0x34, 
-				0x23, 0x32, 0x33, 0x23, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x42, 0x25, 0x33, 0x53, 0x36, 0x33, 0x63, 0x36, 0x44, 0x75, 0x58, 0x55, 0x86, 0x6a, 
-				0x55, 0x86, 0x6a, 0x66, 0xa6, 0x6a, 0x67, 0xb6, 0x7b, 0x66, 0xa6, 0x6a, 0x66, 0xa6, 0x7a, 0x78, 0xc8, 0x8c, 0x89, 0xc8, 0x8c, 0x77, 0xb6, 0x7a, 
-				0x66, 0xa6, 0x69, 0x77, 0xa5, 0x58, 0x55, 0x87, 0x7b, 0x67, 0xa6, 0x69, 0x66, 0xa6, 0x6a, 0x55, 0x97, 0x7b, 0x78, 0xc7, 0x8c, 0x67, 0xa4, 0x57, 
-				0x22, 0x51, 0x24, 0x22, 0x41, 0x24, 0x22, 0x53, 0x46, 0x45, 0x73, 0x46, 0x12, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 0x22, 0x42, 0x34, 0x34, 0x54, 0x56, 0xbb, 0xcf, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x78, 0xa2, 0x45, 0x12, 0x41, 0x24, 
-				0x22, 0x32, 0x34, 0x33, 0x42, 0x34, 0x23, 0x32, 0x33, 0x22, 0x32, 0x23, 0x22, 0x31, 0x23, 0x22, 0x43, 0x35, 0x33, 0x63, 0x36, 0x34, 0x74, 0x47, 
-				0x45, 0x85, 0x58, 0x56, 0x95, 0x69, 0x55, 0x96, 0x6a, 0x67, 0xb6, 0x6a, 0x77, 0xb7, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xa6, 0x7b, 0x78, 0xc8, 0x9d, 
-				0x89, 0xd8, 0x9c, 0x77, 0xb6, 0x7a, 0x67, 0xa7, 0x7b, 0x67, 0xa5, 0x69, 0x55, 0x87, 0x7b, 0x77, 0xb6, 0x7a, 0x66, 0xa6, 0x7a, 0x66, 0xa8, 0x8c, 
-				0x89, 0xd8, 0x8c, 0x77, 0xb4, 0x57, 0x23, 0x52, 0x35, 0x23, 0x51, 0x25, 0x23, 0x54, 0x57, 0x56, 0x83, 0x46, 0x23, 0x52, 0x35, 0x12, 0x42, 0x24, 
-				0x22, 0x42, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x42, 0x34, 0x34, 0x54, 0x45, 
-				0x99, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 
-				0x67, 0x92, 0x35, 0x12, 0x41, 0x24, 0x22, 0x42, 0x34, 0x33, 0x42, 0x33, 0x23, 0x32, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x53, 0x36, 
-				0x33, 0x63, 0x47, 0x45, 0x85, 0x58, 0x55, 0x95, 0x59, 0x56, 0xa5, 0x6a, 0x56, 0xa6, 0x7b, 0x67, 0xb7, 0x7b, 0x78, 0xc7, 0x8c, 0x78, 0xc8, 0x8c, 
-				0x78, 0xc7, 0x8c, 0x88, 0xc8, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xb7, 0x8c, 0x78, 0xb7, 0x8b, 0x77, 0xb6, 0x6a, 0x56, 0x97, 0x8c, 0x77, 0xb7, 0x8b, 
-				0x67, 0xa6, 0x7b, 0x67, 0xb8, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xb5, 0x58, 0x33, 0x62, 0x36, 0x23, 0x52, 0x35, 0x23, 0x65, 0x68, 0x56, 0x93, 0x57, 
-				0x23, 0x62, 0x35, 0x23, 0x52, 0x34, 0x23, 0x42, 0x34, 0x23, 0x42, 0x34, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 
-				0x22, 0x42, 0x34, 0x33, 0x53, 0x45, 0x88, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x56, 0x82, 0x35, 0x13, 0x41, 0x23, 0x22, 0x32, 0x33, 0x23, 0x32, 0x23, 0x22, 0x31, 0x22, 0x11, 0x21, 0x13, 
-				0x12, 0x32, 0x24, 0x33, 0x64, 0x47, 0x44, 0x74, 0x58, 0x55, 0x95, 0x6a, 0x56, 0xa5, 0x6a, 0x66, 0xa6, 0x6a, 0x66, 0xa6, 0x7c, 0x78, 0xc7, 0x8c, 
-				0x78, 0xc7, 0x8d, 0x88, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x88, 0xd8, 0x8c, 0x88, 0xc7, 0x7b, 
-				0x67, 0xa8, 0x8c, 0x88, 0xd8, 0x8c, 0x77, 0xb6, 0x7b, 0x78, 0xc8, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xb4, 0x58, 0x34, 0x72, 0x36, 0x23, 0x62, 0x36, 
-				0x34, 0x75, 0x69, 0x56, 0x93, 0x58, 0x24, 0x62, 0x46, 0x23, 0x52, 0x35, 0x23, 0x52, 0x34, 0x23, 0x42, 0x34, 0x22, 0x31, 0x23, 0x12, 0x31, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x42, 0x34, 0x33, 0x53, 0x45, 0x88, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x56, 0x82, 0x35, 0x12, 0x41, 0x23, 0x22, 0x32, 0x33, 0x23, 0x31, 0x23, 
-				0x12, 0x21, 0x22, 0x11, 0x21, 0x13, 0x11, 0x42, 0x25, 0x34, 0x74, 0x58, 0x55, 0x95, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xb5, 0x6b, 0x67, 0xb6, 0x7b, 
-				0x67, 0xb7, 0x7c, 0x78, 0xc7, 0x8c, 0x88, 0xd8, 0x8d, 0x89, 0xd8, 0x8d, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd9, 0x9d, 0x99, 0xd9, 0xad, 
-				0x99, 0xd9, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xc8, 0x9d, 0x99, 0xd8, 0x9d, 0x89, 0xd7, 0x8c, 0x78, 0xc8, 0x9d, 0x89, 0xe8, 0x9d, 0x78, 0xc4, 0x59, 
-				0x34, 0x73, 0x47, 0x34, 0x73, 0x47, 0x45, 0x85, 0x6a, 0x56, 0xa3, 0x58, 0x24, 0x72, 0x47, 0x13, 0x62, 0x35, 0x23, 0x52, 0x34, 0x23, 0x42, 0x34, 
-				0x23, 0x32, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x42, 0x34, 0x33, 0x53, 0x35, 0x88, 0x9f, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xce, 0x56, 0x81, 0x34, 0x12, 0x41, 0x23, 
-				0x23, 0x42, 0x33, 0x12, 0x31, 0x22, 0x12, 0x21, 0x12, 0x11, 0x21, 0x23, 0x12, 0x43, 0x46, 0x45, 0x85, 0x59, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6b, 
-				0x56, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x78, 0xc7, 0x8d, 0x88, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd9, 0x9d, 0x9a, 0xd9, 0xad, 
-				0x99, 0xd9, 0xad, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x99, 0xd9, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xd8, 0x9d, 
-				0x89, 0xe8, 0x9d, 0x67, 0xc5, 0x6a, 0x45, 0x84, 0x58, 0x45, 0x94, 0x59, 0x46, 0x95, 0x6a, 0x56, 0xa3, 0x59, 0x24, 0x82, 0x47, 0x13, 0x62, 0x35, 
-				0x22, 0x52, 0x24, 0x23, 0x42, 0x23, 0x23, 0x32, 0x33, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x42, 0x35, 0x33, 0x53, 0x35, 
-				0x88, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xce, 
-				0x56, 0x82, 0x34, 0x12, 0x41, 0x23, 0x22, 0x32, 0x23, 0x12, 0x21, 0x12, 0x11, 0x21, 0x12, 0x11, 0x32, 0x24, 0x33, 0x54, 0x57, 0x55, 0x85, 0x59, 
-				0x56, 0xa5, 0x6b, 0x56, 0xb6, 0x6b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x8c, 0x78, 0xc8, 0x8d, 0x88, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 
-				0x99, 0xd9, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0xae, 
-				0x8a, 0xe8, 0x9d, 0x89, 0xd8, 0x9e, 0x89, 0xe7, 0x9d, 0x67, 0xc6, 0x7b, 0x45, 0x95, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6b, 0x46, 0xb4, 0x6a, 
-				0x35, 0x93, 0x48, 0x23, 0x62, 0x36, 0x22, 0x51, 0x24, 0x12, 0x41, 0x23, 0x22, 0x32, 0x33, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 
-				0x22, 0x42, 0x34, 0x33, 0x53, 0x45, 0x88, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xf9, 0xbd, 0x56, 0x71, 0x34, 0x13, 0x41, 0x24, 0x23, 0x32, 0x23, 0x11, 0x21, 0x12, 0x11, 0x20, 0x12, 0x12, 0x32, 0x35, 
-				0x44, 0x75, 0x58, 0x55, 0x95, 0x6a, 0x56, 0xa5, 0x6b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x78, 0xc7, 0x8c, 0x78, 0xd8, 0x8d, 
-				0x89, 0xd8, 0x9d, 0x89, 0xd9, 0x9d, 0x99, 0xd9, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
-				0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x89, 0xd7, 0x9d, 0x78, 0xd6, 0x8c, 0x57, 0xb5, 0x7b, 0x57, 0xb5, 0x7b, 
-				0x56, 0xb5, 0x7c, 0x57, 0xb4, 0x6b, 0x36, 0xa3, 0x59, 0x24, 0x71, 0x36, 0x12, 0x61, 0x25, 0x12, 0x41, 0x23, 0x12, 0x32, 0x23, 0x12, 0x31, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x42, 0x34, 0x33, 0x53, 0x45, 0x88, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x9c, 0x34, 0x61, 0x34, 0x23, 0x42, 0x34, 0x23, 0x42, 0x23, 0x11, 0x21, 0x12, 
-				0x11, 0x20, 0x12, 0x12, 0x43, 0x36, 0x55, 0x85, 0x59, 0x55, 0xa5, 0x6a, 0x56, 0xb6, 0x7b, 0x56, 0xb5, 0x6b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 
-				0x78, 0xc7, 0x8c, 0x88, 0xc8, 0x8d, 0x89, 0xd8, 0x8d, 0x89, 0xd9, 0x9d, 0x99, 0xd9, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
-				0x9a, 0xea, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xd7, 0x9d, 0x78, 0xd7, 0x8d, 
-				0x68, 0xc6, 0x8c, 0x67, 0xc5, 0x7c, 0x57, 0xc5, 0x7c, 0x57, 0xc4, 0x7c, 0x46, 0xb3, 0x6a, 0x35, 0x92, 0x48, 0x13, 0x61, 0x25, 0x12, 0x41, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x42, 0x34, 0x33, 0x53, 0x45, 0x99, 0xaf, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0x8b, 0x24, 0x51, 0x34, 0x22, 0x42, 0x24, 
-				0x22, 0x32, 0x23, 0x11, 0x20, 0x12, 0x01, 0x20, 0x13, 0x22, 0x43, 0x47, 0x55, 0x95, 0x5a, 0x56, 0xa5, 0x6a, 0x56, 0xb5, 0x6b, 0x56, 0xb6, 0x6b, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x7b, 0x78, 0xc7, 0x8c, 0x88, 0xc8, 0x8c, 0x88, 0xc8, 0x8d, 0x88, 0xd8, 0x9d, 0x99, 0xd9, 0x9d, 0x9a, 0xe9, 0xae, 
-				0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xea, 0xbe, 0xab, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0xae, 0x8a, 0xe8, 0x9d, 
-				0x79, 0xd7, 0x9d, 0x79, 0xd6, 0x8d, 0x68, 0xd6, 0x8c, 0x67, 0xc6, 0x7d, 0x67, 0xd5, 0x7d, 0x57, 0xd4, 0x7c, 0x47, 0xc4, 0x6b, 0x35, 0xa3, 0x59, 
-				0x24, 0x72, 0x36, 0x12, 0x51, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x43, 0x34, 0x33, 0x43, 0x45, 
-				0x99, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xe6, 0x79, 
-				0x23, 0x51, 0x34, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x11, 0x20, 0x12, 0x01, 0x21, 0x13, 0x23, 0x54, 0x58, 0x55, 0x95, 0x6a, 0x56, 0xa5, 0x6a, 
-				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa6, 0x6a, 0x66, 0xa6, 0x7a, 0x77, 0xb7, 0x7b, 0x78, 0xb7, 0x8c, 0x78, 0xb7, 0x8b, 0x88, 0xc8, 0x8c, 
-				0x89, 0xd9, 0x9d, 0x9a, 0xd9, 0xae, 0xaa, 0xea, 0xae, 0x9a, 0xe9, 0xae, 0xaa, 0xea, 0xbe, 0xab, 0xe9, 0xbe, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9d, 
-				0x89, 0xd8, 0x9d, 0x89, 0xd7, 0x9d, 0x79, 0xd7, 0x9d, 0x79, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x7c, 0x68, 0xd5, 0x7d, 0x57, 0xd5, 0x7d, 
-				0x57, 0xc4, 0x6c, 0x46, 0xb4, 0x6a, 0x35, 0x92, 0x47, 0x12, 0x51, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
-				0x22, 0x42, 0x34, 0x33, 0x43, 0x45, 0x99, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xbc, 0xe5, 0x68, 0x23, 0x51, 0x24, 0x12, 0x41, 0x23, 0x12, 0x32, 0x23, 0x11, 0x20, 0x12, 0x01, 0x21, 0x14, 0x34, 0x65, 0x59, 
-				0x46, 0x94, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x59, 0x55, 0x95, 0x58, 0x55, 0x85, 0x58, 0x55, 0x85, 0x58, 0x55, 0x85, 0x69, 0x66, 0x96, 0x6a, 
-				0x77, 0xa6, 0x7a, 0x77, 0xa7, 0x8b, 0x88, 0xc8, 0x9d, 0x9a, 0xd9, 0xae, 0xaa, 0xea, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xea, 0xbe, 0xab, 0xe9, 0xae, 
-				0x9a, 0xe9, 0xae, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x79, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x79, 0xd7, 0x8d, 0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x7c, 
-				0x67, 0xd6, 0x8d, 0x68, 0xd5, 0x7d, 0x57, 0xd4, 0x7c, 0x46, 0xc4, 0x6b, 0x35, 0xa2, 0x47, 0x12, 0x50, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
-				0x12, 0x31, 0x23, 0x12, 0x21, 0x23, 0x22, 0x42, 0x34, 0x23, 0x43, 0x45, 0x99, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0xd5, 0x67, 0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x22, 0x32, 0x23, 0x12, 0x20, 0x12, 
-				0x01, 0x21, 0x24, 0x45, 0x75, 0x59, 0x56, 0xa5, 0x6a, 0x56, 0x94, 0x59, 0x44, 0x84, 0x48, 0x44, 0x84, 0x47, 0x34, 0x73, 0x47, 0x44, 0x74, 0x47, 
-				0x44, 0x75, 0x57, 0x55, 0x85, 0x58, 0x66, 0x96, 0x6a, 0x77, 0xa7, 0x7b, 0x77, 0xb7, 0x8b, 0x89, 0xd9, 0xad, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
-				0x9a, 0xea, 0xbe, 0xab, 0xe9, 0xae, 0x9a, 0xe8, 0x9d, 0x88, 0xd8, 0x8d, 0x78, 0xc7, 0x8c, 0x78, 0xb7, 0x8b, 0x78, 0xc7, 0x8c, 0x79, 0xd7, 0x8c, 
-				0x78, 0xc6, 0x8c, 0x68, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x68, 0xd6, 0x8d, 0x57, 0xd5, 0x7c, 0x57, 0xc4, 0x6b, 0x46, 0xa3, 0x58, 0x13, 0x60, 0x24, 
-				0x12, 0x32, 0x34, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x11, 0x21, 0x23, 0x22, 0x42, 0x34, 0x23, 0x44, 0x45, 0xaa, 0xbf, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xd4, 0x57, 0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 
-				0x12, 0x32, 0x23, 0x12, 0x20, 0x12, 0x01, 0x32, 0x35, 0x55, 0x85, 0x69, 0x56, 0xa4, 0x59, 0x34, 0x83, 0x37, 0x34, 0x74, 0x47, 0x44, 0x74, 0x58, 
-				0x45, 0x84, 0x57, 0x44, 0x74, 0x47, 0x44, 0x74, 0x57, 0x55, 0x85, 0x58, 0x66, 0x96, 0x6a, 0x77, 0xa7, 0x7b, 0x77, 0xb7, 0x7b, 0x89, 0xc9, 0x9d, 
-				0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xad, 0x9a, 0xea, 0xbe, 0x9b, 0xe9, 0xae, 0x89, 0xd8, 0x8d, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x7b, 0x67, 0xa6, 0x7a, 
-				0x66, 0xa6, 0x6a, 0x67, 0xa6, 0x7a, 0x77, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x56, 0xb5, 0x7b, 0x67, 0xc6, 0x8d, 0x67, 0xd5, 0x7d, 0x57, 0xc5, 0x7b, 
-				0x46, 0xb3, 0x59, 0x13, 0x60, 0x24, 0x12, 0x32, 0x34, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x11, 0x21, 0x23, 0x22, 0x32, 0x24, 0x23, 0x43, 0x45, 
-				0xaa, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xc4, 0x56, 
-				0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x22, 0x32, 0x23, 0x12, 0x21, 0x12, 0x12, 0x43, 0x46, 0x56, 0x95, 0x6a, 0x45, 0x93, 0x48, 0x33, 0x74, 0x47, 
-				0x55, 0x85, 0x59, 0x55, 0x95, 0x69, 0x66, 0xa6, 0x7a, 0x67, 0xa6, 0x69, 0x66, 0x95, 0x69, 0x56, 0x96, 0x69, 0x66, 0x96, 0x7a, 0x67, 0xa7, 0x7b, 
-				0x77, 0xb7, 0x8b, 0x78, 0xc8, 0x9d, 0x9a, 0xd9, 0xad, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9d, 0x78, 0xd7, 0x8c, 0x78, 0xc7, 0x8c, 
-				0x78, 0xb6, 0x7b, 0x66, 0xa5, 0x69, 0x45, 0x74, 0x47, 0x44, 0x75, 0x58, 0x56, 0x96, 0x6a, 0x56, 0x95, 0x69, 0x56, 0xa5, 0x6a, 0x56, 0xb5, 0x7c, 
-				0x68, 0xd5, 0x7d, 0x57, 0xc5, 0x7c, 0x46, 0xb4, 0x59, 0x24, 0x60, 0x24, 0x02, 0x32, 0x34, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x01, 0x21, 0x23, 
-				0x12, 0x32, 0x23, 0x23, 0x43, 0x34, 0x77, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0x9a, 0xc4, 0x56, 0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x22, 0x32, 0x23, 0x12, 0x31, 0x13, 0x22, 0x54, 0x58, 0x56, 0xa5, 0x6a, 
-				0x45, 0x93, 0x48, 0x44, 0x85, 0x59, 0x55, 0x96, 0x6a, 0x67, 0xa7, 0x7b, 0x77, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x7b, 0x67, 0xa6, 0x7a, 
-				0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x7b, 0x77, 0xb7, 0x8b, 0x78, 0xc8, 0x9d, 0x89, 0xd9, 0xad, 0x9a, 0xd9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9d, 
-				0x78, 0xd7, 0x8c, 0x78, 0xc7, 0x8c, 0x77, 0xb6, 0x7b, 0x66, 0xa5, 0x69, 0x45, 0x84, 0x47, 0x44, 0x73, 0x47, 0x34, 0x64, 0x47, 0x45, 0x84, 0x59, 
-				0x45, 0x95, 0x6a, 0x56, 0xa5, 0x6a, 0x57, 0xc5, 0x7c, 0x57, 0xc5, 0x7c, 0x56, 0xb4, 0x6a, 0x24, 0x70, 0x25, 0x02, 0x32, 0x34, 0x12, 0x31, 0x23, 
-				0x12, 0x30, 0x12, 0x01, 0x21, 0x23, 0x12, 0x32, 0x23, 0x22, 0x43, 0x34, 0x55, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xd4, 0x57, 0x12, 0x41, 0x24, 0x12, 0x42, 0x23, 0x22, 0x32, 0x23, 0x12, 0x31, 0x13, 
-				0x24, 0x55, 0x69, 0x56, 0xa5, 0x6a, 0x45, 0x94, 0x59, 0x56, 0xa6, 0x6a, 0x66, 0xa6, 0x6a, 0x67, 0xb7, 0x7b, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8b, 
-				0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x7b, 0x77, 0xb6, 0x7a, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x9c, 0x89, 0xd8, 0xad, 0x9a, 0xd9, 0xae, 
-				0x9a, 0xe9, 0xae, 0x8a, 0xe8, 0x9d, 0x78, 0xd7, 0x8c, 0x68, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7a, 0x67, 0xa6, 0x6a, 0x66, 0x95, 0x69, 
-				0x55, 0x85, 0x58, 0x45, 0x84, 0x58, 0x45, 0x95, 0x6a, 0x56, 0xa4, 0x5a, 0x56, 0xa5, 0x6b, 0x57, 0xc5, 0x7c, 0x56, 0xb4, 0x6a, 0x34, 0x70, 0x25, 
-				0x02, 0x42, 0x34, 0x12, 0x31, 0x23, 0x12, 0x30, 0x12, 0x01, 0x21, 0x23, 0x12, 0x32, 0x23, 0x22, 0x42, 0x34, 0x44, 0x5c, 0xcd, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfb, 0xce, 0x8a, 0xd4, 0x68, 0x12, 0x51, 0x24, 0x12, 0x32, 0x23, 
-				0x22, 0x32, 0x23, 0x12, 0x31, 0x24, 0x45, 0x75, 0x6a, 0x57, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x7b, 
-				0x78, 0xb7, 0x7b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x77, 0xb7, 0x7a, 0x77, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x8c, 
-				0x89, 0xd8, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x8a, 0xe7, 0x9d, 0x78, 0xd6, 0x8c, 0x68, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x7b, 
-				0x77, 0xb7, 0x8b, 0x88, 0xc8, 0x8c, 0x88, 0xc7, 0x8c, 0x67, 0xb6, 0x7a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x45, 0x94, 0x59, 0x46, 0xb5, 0x7c, 
-				0x56, 0xb4, 0x6a, 0x35, 0x80, 0x25, 0x02, 0x42, 0x34, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x22, 0x42, 0x34, 
-				0x44, 0x59, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xe8, 0x9d, 0x79, 0xc5, 0x68, 
-				0x12, 0x51, 0x24, 0x12, 0x42, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x24, 0x56, 0x85, 0x7a, 0x57, 0xb5, 0x6a, 0x56, 0xa5, 0x6a, 0x57, 0xb6, 0x7b, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7a, 0x66, 0xa6, 0x69, 0x66, 0x96, 0x69, 0x66, 0x96, 0x69, 0x66, 0x96, 0x69, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x7a, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x8c, 0x79, 0xd8, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0xae, 0x8a, 0xe7, 0x9d, 0x78, 0xd6, 0x8c, 0x68, 0xc6, 0x8c, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x88, 0xc8, 0x9c, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xd6, 0x7c, 0x67, 0xb6, 0x6b, 
-				0x56, 0xa4, 0x5a, 0x45, 0xa5, 0x6b, 0x57, 0xc5, 0x7b, 0x45, 0x91, 0x36, 0x02, 0x42, 0x34, 0x13, 0x31, 0x23, 0x12, 0x20, 0x12, 0x12, 0x21, 0x23, 
-				0x12, 0x31, 0x24, 0x22, 0x43, 0x34, 0x55, 0x68, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 
-				0x89, 0xd7, 0x8d, 0x67, 0xc5, 0x69, 0x23, 0x61, 0x24, 0x12, 0x42, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x35, 0x66, 0x96, 0x7b, 0x57, 0xb5, 0x7b, 
-				0x56, 0xb5, 0x7b, 0x57, 0xb5, 0x7b, 0x56, 0xa6, 0x6a, 0x56, 0x95, 0x58, 0x55, 0x75, 0x58, 0x66, 0x86, 0x68, 0x66, 0x86, 0x68, 0x66, 0x85, 0x58, 
-				0x56, 0x85, 0x69, 0x66, 0xa6, 0x6a, 0x66, 0xa5, 0x6a, 0x67, 0xb6, 0x7c, 0x78, 0xc8, 0x9d, 0x89, 0xe9, 0xae, 0x8a, 0xe8, 0xae, 0x89, 0xe7, 0x9d, 
-				0x68, 0xd6, 0x8c, 0x67, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x7b, 0x78, 0xb7, 0x8b, 0x78, 0xb8, 0x9c, 0x89, 0xc8, 0x9d, 0x89, 0xd8, 0x9d, 
-				0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x7c, 0x67, 0xb5, 0x6a, 0x45, 0xa5, 0x6b, 0x57, 0xc5, 0x7c, 0x56, 0xa2, 0x46, 0x02, 0x42, 0x34, 0x23, 0x41, 0x23, 
-				0x12, 0x30, 0x12, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x43, 0x35, 0x55, 0x68, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xd6, 0x7d, 0x67, 0xd6, 0x6b, 0x34, 0x71, 0x25, 0x12, 0x42, 0x24, 0x12, 0x31, 0x23, 0x12, 0x44, 0x57, 
-				0x67, 0xa6, 0x7b, 0x57, 0xb5, 0x7b, 0x57, 0xb5, 0x7b, 0x56, 0xb5, 0x6a, 0x56, 0x94, 0x58, 0x45, 0x85, 0x58, 0x55, 0x73, 0x36, 0x34, 0x53, 0x35, 
-				0x33, 0x53, 0x35, 0x44, 0x65, 0x57, 0x66, 0x85, 0x58, 0x55, 0x85, 0x69, 0x56, 0x95, 0x69, 0x56, 0xa6, 0x7b, 0x78, 0xc7, 0x9d, 0x89, 0xe9, 0xae, 
-				0x8a, 0xe8, 0x9e, 0x79, 0xd6, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x6a, 0x66, 0xa5, 0x69, 0x56, 0x96, 0x69, 0x66, 0x96, 0x7a, 
-				0x77, 0xa7, 0x8c, 0x89, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x67, 0xd6, 0x7c, 0x56, 0xb4, 0x6b, 0x57, 0xc6, 0x7c, 0x57, 0xb3, 0x58, 
-				0x02, 0x41, 0x24, 0x23, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x43, 0x35, 0x55, 0x69, 0x9b, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xd6, 0x7d, 0x66, 0xd6, 0x6c, 0x45, 0x81, 0x25, 0x12, 0x42, 0x24, 
-				0x12, 0x31, 0x23, 0x22, 0x55, 0x68, 0x67, 0xb6, 0x7c, 0x67, 0xb5, 0x7b, 0x57, 0xb5, 0x7b, 0x56, 0xa5, 0x69, 0x45, 0x84, 0x47, 0x44, 0x73, 0x35, 
-				0x21, 0x41, 0x13, 0x00, 0x21, 0x02, 0x10, 0x21, 0x13, 0x11, 0x43, 0x35, 0x55, 0x75, 0x58, 0x55, 0x85, 0x59, 0x55, 0x95, 0x59, 0x56, 0xa6, 0x7b, 
-				0x67, 0xc7, 0x8d, 0x89, 0xe8, 0xae, 0x8a, 0xe7, 0x9e, 0x78, 0xd6, 0x8d, 0x67, 0xc5, 0x7b, 0x57, 0xb5, 0x7b, 0x56, 0xa5, 0x58, 0x55, 0x85, 0x58, 
-				0x55, 0x75, 0x58, 0x66, 0x86, 0x68, 0x66, 0x96, 0x69, 0x66, 0xa6, 0x7b, 0x68, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xc5, 0x6b, 
-				0x57, 0xc6, 0x7c, 0x67, 0xc5, 0x6a, 0x12, 0x51, 0x24, 0x23, 0x41, 0x23, 0x12, 0x31, 0x23, 0x22, 0x41, 0x24, 0x12, 0x41, 0x24, 0x12, 0x42, 0x35, 
-				0x66, 0x7c, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xd6, 0x7d, 0x67, 0xd6, 0x6b, 
-				0x55, 0x91, 0x25, 0x12, 0x42, 0x34, 0x12, 0x31, 0x23, 0x23, 0x56, 0x69, 0x67, 0xb6, 0x7c, 0x67, 0xb5, 0x7b, 0x57, 0xb5, 0x6b, 0x56, 0xa4, 0x59, 
-				0x45, 0x83, 0x36, 0x22, 0x53, 0x36, 0x33, 0x51, 0x13, 0x10, 0x33, 0x35, 0x55, 0x61, 0x13, 0x22, 0x46, 0x67, 0x66, 0x85, 0x57, 0x55, 0x85, 0x58, 
-				0x55, 0x94, 0x59, 0x56, 0xa5, 0x6a, 0x67, 0xc7, 0x8d, 0x79, 0xd7, 0x9e, 0x79, 0xe7, 0x8d, 0x68, 0xd6, 0x7c, 0x57, 0xc5, 0x6b, 0x56, 0xb5, 0x6a, 
-				0x55, 0x95, 0x58, 0x55, 0x74, 0x56, 0x33, 0x52, 0x25, 0x23, 0x53, 0x35, 0x55, 0x65, 0x57, 0x55, 0x85, 0x69, 0x66, 0xa6, 0x7b, 0x67, 0xc6, 0x8d, 
-				0x68, 0xd6, 0x8d, 0x67, 0xd6, 0x7d, 0x67, 0xc6, 0x8d, 0x68, 0xd6, 0x7b, 0x23, 0x61, 0x24, 0x23, 0x42, 0x24, 0x22, 0x41, 0x23, 0x22, 0x42, 0x24, 
-				0x22, 0x41, 0x24, 0x12, 0x43, 0x46, 0x89, 0xbe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xce, 
-				0x78, 0xd7, 0x7d, 0x67, 0xd6, 0x6b, 0x56, 0xa2, 0x36, 0x12, 0x42, 0x34, 0x12, 0x31, 0x24, 0x34, 0x66, 0x7a, 0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x7b, 
-				0x57, 0xb5, 0x6a, 0x56, 0xa3, 0x58, 0x33, 0x72, 0x25, 0x44, 0x67, 0x79, 0x66, 0x71, 0x13, 0x11, 0x22, 0x34, 0x54, 0x51, 0x12, 0x22, 0x48, 0x89, 
-				0x99, 0xb6, 0x69, 0x55, 0x85, 0x59, 0x55, 0x94, 0x59, 0x55, 0xa5, 0x6a, 0x67, 0xb6, 0x7d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xd5, 0x7c, 
-				0x57, 0xb5, 0x6b, 0x57, 0xb5, 0x6a, 0x56, 0x95, 0x57, 0x55, 0x65, 0x66, 0x22, 0x41, 0x12, 0x11, 0x21, 0x12, 0x01, 0x21, 0x13, 0x23, 0x54, 0x57, 
-				0x66, 0x95, 0x69, 0x56, 0xb6, 0x7c, 0x67, 0xd6, 0x8d, 0x68, 0xd6, 0x7d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x7c, 0x34, 0x70, 0x14, 0x22, 0x42, 0x34, 
-				0x23, 0x42, 0x24, 0x22, 0x42, 0x24, 0x12, 0x41, 0x24, 0x23, 0x55, 0x58, 0x99, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xfa, 0xce, 0x78, 0xd7, 0x7d, 0x67, 0xd6, 0x6b, 0x66, 0xa3, 0x47, 0x22, 0x52, 0x34, 0x12, 0x31, 0x24, 0x34, 0x66, 0x7a, 
-				0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x7b, 0x57, 0xb5, 0x6a, 0x45, 0x92, 0x47, 0x22, 0x63, 0x36, 0x54, 0x76, 0x68, 0x66, 0x82, 0x24, 0x11, 0x21, 0x12, 
-				0x11, 0x21, 0x13, 0x33, 0x47, 0x78, 0x77, 0x96, 0x69, 0x45, 0x85, 0x69, 0x55, 0x94, 0x59, 0x45, 0xa5, 0x6a, 0x56, 0xb6, 0x7d, 0x68, 0xd6, 0x8e, 
-				0x68, 0xd6, 0x7d, 0x57, 0xd5, 0x7c, 0x57, 0xb5, 0x6b, 0x67, 0xb5, 0x6a, 0x55, 0x96, 0x68, 0x88, 0xa8, 0x8a, 0x22, 0x41, 0x12, 0x54, 0x54, 0x45, 
-				0x00, 0x20, 0x13, 0x11, 0x42, 0x25, 0x44, 0x75, 0x59, 0x56, 0xa6, 0x6b, 0x67, 0xc6, 0x7d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
-				0x45, 0x90, 0x14, 0x22, 0x42, 0x34, 0x23, 0x42, 0x34, 0x23, 0x41, 0x24, 0x12, 0x41, 0x25, 0x56, 0x97, 0x7b, 0x78, 0xcb, 0xce, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0x89, 0xd7, 0x8d, 0x77, 0xd6, 0x6b, 0x67, 0xb5, 0x69, 0x23, 0x62, 0x35, 
-				0x22, 0x41, 0x24, 0x45, 0x76, 0x7b, 0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x7c, 0x57, 0xb5, 0x6b, 0x46, 0xa3, 0x58, 0x45, 0x95, 0x59, 0x55, 0x85, 0x58, 
-				0x55, 0x73, 0x46, 0x22, 0x53, 0x35, 0x44, 0x63, 0x46, 0x55, 0x76, 0x68, 0x66, 0x85, 0x69, 0x56, 0x95, 0x69, 0x55, 0x94, 0x59, 0x45, 0xa4, 0x5a, 
-				0x56, 0xb6, 0x7d, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x7d, 0x57, 0xd5, 0x7c, 0x57, 0xc5, 0x7b, 0x67, 0xb5, 0x6a, 0x45, 0x85, 0x69, 0x78, 0xa7, 0x8a, 
-				0x22, 0x40, 0x03, 0x22, 0x42, 0x24, 0x00, 0x30, 0x13, 0x44, 0x64, 0x47, 0x12, 0x53, 0x47, 0x56, 0xa5, 0x6b, 0x67, 0xc6, 0x7d, 0x68, 0xd6, 0x8d, 
-				0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x56, 0xa0, 0x25, 0x12, 0x42, 0x34, 0x23, 0x42, 0x34, 0x23, 0x51, 0x25, 0x12, 0x55, 0x58, 0x78, 0xd7, 0x8d, 
-				0x78, 0xd8, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0x89, 0xd8, 0x8d, 0x77, 0xd6, 0x6b, 
-				0x67, 0xb6, 0x7b, 0x45, 0x72, 0x35, 0x22, 0x42, 0x24, 0x45, 0x76, 0x7b, 0x67, 0xc6, 0x8c, 0x67, 0xc6, 0x7c, 0x57, 0xc5, 0x7b, 0x57, 0xb5, 0x6b, 
-				0x56, 0xa5, 0x6a, 0x66, 0xa6, 0x6a, 0x66, 0x96, 0x69, 0x66, 0x96, 0x79, 0x77, 0xa7, 0x7a, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 
-				0x45, 0x94, 0x59, 0x45, 0xa4, 0x5a, 0x67, 0xc6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe5, 0x7d, 0x57, 0xd5, 0x7c, 0x57, 0xc5, 0x7c, 0x67, 0xc6, 0x7b, 
-				0x66, 0xa6, 0x69, 0x56, 0x85, 0x57, 0x33, 0x51, 0x24, 0x23, 0x51, 0x13, 0x01, 0x31, 0x24, 0x66, 0x85, 0x58, 0x22, 0x51, 0x25, 0x44, 0x85, 0x6a, 
-				0x67, 0xc6, 0x7d, 0x67, 0xd6, 0x8d, 0x68, 0xe6, 0x8e, 0x68, 0xe7, 0x8d, 0x56, 0xb1, 0x25, 0x12, 0x42, 0x35, 0x23, 0x52, 0x35, 0x22, 0x51, 0x25, 
-				0x44, 0x86, 0x7c, 0x67, 0xd6, 0x7d, 0x67, 0xd8, 0x8d, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 
-				0x89, 0xd8, 0x8d, 0x78, 0xd6, 0x6b, 0x67, 0xc7, 0x7b, 0x66, 0x93, 0x36, 0x23, 0x52, 0x35, 0x45, 0x76, 0x8b, 0x68, 0xc6, 0x8c, 0x67, 0xc6, 0x7c, 
-				0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x66, 0xb6, 0x6b, 0x67, 0xb6, 0x7b, 0x77, 0xb7, 0x7b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x77, 0xb6, 0x7b, 
-				0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x5a, 0x45, 0x94, 0x59, 0x45, 0xa5, 0x6c, 0x67, 0xd6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe5, 0x7e, 0x57, 0xd5, 0x7c, 
-				0x57, 0xc5, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xb6, 0x7a, 0x67, 0xa6, 0x69, 0x66, 0x96, 0x69, 0x66, 0x84, 0x56, 0x34, 0x64, 0x47, 0x55, 0x85, 0x58, 
-				0x55, 0x84, 0x47, 0x44, 0x85, 0x5a, 0x56, 0xb6, 0x7d, 0x68, 0xd6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8d, 0x67, 0xb2, 0x36, 0x12, 0x42, 0x35, 
-				0x23, 0x52, 0x35, 0x22, 0x53, 0x46, 0x67, 0xb7, 0x8d, 0x67, 0xd6, 0x6d, 0x67, 0xd7, 0x7d, 0xaa, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xde, 0xfa, 0xad, 0x89, 0xd8, 0x8d, 0x78, 0xd6, 0x6b, 0x77, 0xc7, 0x8c, 0x77, 0xb3, 0x47, 0x23, 0x52, 0x35, 0x45, 0x87, 0x8b, 
-				0x68, 0xc6, 0x8c, 0x67, 0xc6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7b, 0x67, 0xc7, 0x7b, 0x78, 0xb7, 0x7b, 
-				0x77, 0xb6, 0x7b, 0x67, 0xa6, 0x7b, 0x67, 0xa5, 0x6a, 0x56, 0xa4, 0x5a, 0x45, 0xa4, 0x5a, 0x56, 0xb5, 0x7c, 0x67, 0xd6, 0x8e, 0x68, 0xe6, 0x8e, 
-				0x68, 0xe5, 0x8e, 0x57, 0xd5, 0x7d, 0x57, 0xc5, 0x7c, 0x57, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xa6, 0x7a, 0x77, 0xb8, 0x8b, 0x78, 0xb7, 0x8b, 
-				0x77, 0xa6, 0x7a, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x56, 0xa5, 0x6b, 0x56, 0xb6, 0x7d, 0x68, 0xd6, 0x8e, 0x68, 0xe6, 0x8e, 0x78, 0xe6, 0x8e, 
-				0x67, 0xc2, 0x47, 0x12, 0x52, 0x35, 0x23, 0x52, 0x35, 0x34, 0x66, 0x7a, 0x89, 0xd7, 0x8e, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x7d, 0xaa, 0xef, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf9, 0xad, 0x88, 0xd8, 0x8d, 0x77, 0xd6, 0x6b, 0x77, 0xc7, 0x8d, 0x77, 0xb4, 0x47, 
-				0x23, 0x62, 0x35, 0x45, 0x87, 0x8b, 0x78, 0xc6, 0x8c, 0x67, 0xc6, 0x7d, 0x67, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8d, 0x68, 0xd6, 0x7c, 
-				0x67, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb5, 0x6a, 0x56, 0xa4, 0x5a, 0x45, 0xa4, 0x5b, 0x56, 0xc5, 0x7d, 
-				0x67, 0xe6, 0x8e, 0x79, 0xe6, 0x9e, 0x68, 0xe5, 0x8e, 0x58, 0xe5, 0x7d, 0x57, 0xd5, 0x7c, 0x57, 0xc6, 0x7c, 0x67, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 
-				0x67, 0xb7, 0x7b, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x77, 0xc6, 0x7c, 0x67, 0xc6, 0x7d, 0x67, 0xd6, 0x7d, 0x57, 0xd6, 0x7d, 0x68, 0xe6, 0x8e, 
-				0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x67, 0xc3, 0x47, 0x22, 0x52, 0x35, 0x23, 0x52, 0x35, 0x55, 0x88, 0xae, 0x8a, 0xe7, 0x8e, 0x67, 0xd6, 0x7d, 
-				0x77, 0xe7, 0x7d, 0x99, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xce, 0x99, 0xd8, 0x8d, 0x77, 0xd6, 0x7b, 
-				0x78, 0xd8, 0x8d, 0x77, 0xb5, 0x58, 0x23, 0x62, 0x36, 0x55, 0x87, 0x8c, 0x78, 0xc6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
-				0x68, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb5, 0x6b, 0x56, 0xa4, 0x5a, 
-				0x45, 0xb5, 0x6b, 0x56, 0xc5, 0x7d, 0x68, 0xe7, 0x9e, 0x79, 0xf7, 0x9f, 0x69, 0xf6, 0x8e, 0x68, 0xe5, 0x8e, 0x68, 0xd5, 0x7d, 0x67, 0xd6, 0x7c, 
-				0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xb7, 0x7c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 
-				0x68, 0xd6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x67, 0xc3, 0x47, 0x22, 0x53, 0x35, 0x23, 0x53, 0x46, 0x67, 0xa8, 0x9e, 
-				0x89, 0xe7, 0x8e, 0x67, 0xd6, 0x7d, 0x87, 0xe7, 0x7d, 0x99, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xab, 0xe8, 0x8d, 0x77, 0xd6, 0x7b, 0x88, 0xd8, 0x9d, 0x78, 0xc6, 0x6a, 0x34, 0x62, 0x36, 0x55, 0x87, 0x8c, 0x78, 0xc6, 0x8c, 0x68, 0xd6, 0x7d, 
-				0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 
-				0x67, 0xb5, 0x6b, 0x56, 0xa5, 0x6b, 0x56, 0xb5, 0x6b, 0x56, 0xc6, 0x8e, 0x79, 0xe7, 0x9f, 0x79, 0xf7, 0xaf, 0x69, 0xf6, 0x9e, 0x68, 0xe6, 0x8e, 
-				0x68, 0xe6, 0x8d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x8d, 0x68, 0xd6, 0x7c, 0x67, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x67, 0xd6, 0x8d, 
-				0x68, 0xd6, 0x8d, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x67, 0xc2, 0x47, 0x22, 0x52, 0x35, 
-				0x23, 0x55, 0x58, 0x78, 0xc8, 0x9e, 0x89, 0xe7, 0x8e, 0x67, 0xd7, 0x7d, 0x77, 0xe7, 0x7d, 0xaa, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf8, 0x9d, 0x77, 0xd6, 0x7b, 0x88, 0xd8, 0x9d, 0x78, 0xc7, 0x7b, 0x55, 0x82, 0x36, 0x55, 0x87, 0x8c, 
-				0x78, 0xc6, 0x8c, 0x67, 0xc6, 0x7d, 0x68, 0xd6, 0x8d, 0x68, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
-				0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x6b, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x57, 0xd6, 0x8e, 0x79, 0xe7, 0x9f, 0x69, 0xf7, 0xaf, 
-				0x69, 0xf6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x67, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 
-				0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 0x68, 0xe6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 
-				0x57, 0xb2, 0x47, 0x23, 0x52, 0x35, 0x23, 0x66, 0x6a, 0x89, 0xd8, 0xae, 0x79, 0xe7, 0x8e, 0x67, 0xd7, 0x7d, 0x77, 0xd8, 0x7d, 0xba, 0xef, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xad, 0x78, 0xd6, 0x7c, 0x78, 0xd8, 0x9d, 0x78, 0xc8, 0x9d, 
-				0x77, 0xb3, 0x46, 0x55, 0x87, 0x8c, 0x78, 0xc6, 0x8c, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x8d, 0x68, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
-				0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd7, 0x8d, 0x68, 0xd6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x6b, 0x56, 0xb5, 0x6c, 0x67, 0xd7, 0x9e, 
-				0x79, 0xf7, 0x9f, 0x79, 0xf7, 0xaf, 0x7a, 0xf6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8d, 
-				0x68, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 0x68, 0xe6, 0x9e, 0x69, 0xe6, 0x9e, 
-				0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8d, 0x56, 0xb2, 0x37, 0x23, 0x52, 0x36, 0x45, 0x86, 0x6a, 0x78, 0xd8, 0x9e, 0x89, 0xe7, 0x8e, 0x67, 0xd7, 0x7d, 
-				0x87, 0xd8, 0x8d, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0x88, 0xd7, 0x7c, 
-				0x78, 0xd7, 0x8d, 0x77, 0xc8, 0x8d, 0x89, 0xd5, 0x58, 0x55, 0x87, 0x8c, 0x78, 0xd7, 0x8d, 0x67, 0xd6, 0x7c, 0x67, 0xd6, 0x8d, 0x68, 0xd7, 0x8e, 
-				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x7c, 0x67, 0xc5, 0x6b, 
-				0x56, 0xb5, 0x7c, 0x68, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xf7, 0xaf, 0x7a, 0xf6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x79, 0xe7, 0x9e, 
-				0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x79, 0xe7, 0x9e, 0x79, 0xe6, 0x9e, 
-				0x68, 0xe6, 0x8e, 0x69, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8d, 0x56, 0xa2, 0x37, 0x23, 0x64, 0x57, 0x77, 0xb7, 0x7c, 0x78, 0xd7, 0x8e, 
-				0x89, 0xe7, 0x8e, 0x67, 0xd7, 0x7d, 0x88, 0xd9, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xfe, 0xff, 0x99, 0xd7, 0x7c, 0x77, 0xd7, 0x8c, 0x67, 0xb7, 0x7b, 0x89, 0xd6, 0x7a, 0x55, 0x97, 0x8c, 0x78, 0xd7, 0x8d, 0x67, 0xc6, 0x7c, 
-				0x67, 0xd6, 0x7d, 0x68, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xd7, 0x8d, 
-				0x78, 0xd7, 0x8d, 0x67, 0xc5, 0x6b, 0x56, 0xb6, 0x7d, 0x78, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xf7, 0xaf, 0x7a, 0xf6, 0x9e, 0x69, 0xe6, 0x8e, 
-				0x68, 0xe6, 0x8e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
-				0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x69, 0xe6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x79, 0xe6, 0x8d, 0x56, 0xa2, 0x37, 0x33, 0x67, 0x7b, 
-				0x9a, 0xe8, 0x9d, 0x78, 0xd8, 0x9e, 0x89, 0xe7, 0x8e, 0x67, 0xd7, 0x7d, 0x88, 0xdb, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xe7, 0x8c, 0x77, 0xd8, 0x8d, 0x77, 0xc6, 0x6b, 0x77, 0xb6, 0x7a, 0x56, 0x97, 0x8c, 
-				0x78, 0xd7, 0x8d, 0x67, 0xc6, 0x7d, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x7d, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe8, 0x9e, 
-				0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xd7, 0x8d, 0x67, 0xb5, 0x6b, 0x67, 0xc6, 0x8d, 0x78, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x8a, 0xf8, 0xaf, 
-				0x7a, 0xf6, 0x9e, 0x69, 0xe6, 0x8e, 0x57, 0xd6, 0x8e, 0x79, 0xe7, 0x9e, 0x8a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 
-				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x78, 0xe6, 0x8d, 
-				0x45, 0x92, 0x37, 0x55, 0x89, 0xae, 0xab, 0xe9, 0x9e, 0x88, 0xd8, 0x9e, 0x8a, 0xe7, 0x8e, 0x67, 0xd8, 0x8d, 0x99, 0xee, 0xef, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf8, 0x8d, 0x77, 0xc7, 0x8d, 0x77, 0xc7, 0x7b, 
-				0x67, 0xb6, 0x6a, 0x55, 0x96, 0x7b, 0x78, 0xd7, 0x8c, 0x67, 0xc6, 0x7c, 0x67, 0xd6, 0x7d, 0x67, 0xd7, 0x7d, 0x77, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 
-				0x78, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe6, 0x7c, 0x56, 0xb5, 0x6b, 0x67, 0xd6, 0x8d, 0x78, 0xd7, 0x9e, 
-				0x89, 0xe8, 0xae, 0x8a, 0xf8, 0xaf, 0x79, 0xe7, 0x9e, 0x69, 0xe6, 0x8e, 0x67, 0xd6, 0x7d, 0x78, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0x9e, 
-				0x89, 0xe8, 0x9e, 0x79, 0xe8, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x79, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 
-				0x68, 0xe6, 0x8e, 0x78, 0xe6, 0x8d, 0x45, 0x93, 0x47, 0x77, 0xc9, 0xae, 0xaa, 0xe9, 0x9e, 0x78, 0xd8, 0x8e, 0x89, 0xe7, 0x8e, 0x77, 0xd8, 0x8d, 
-				0xbb, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbe, 
-				0x78, 0xc7, 0x7d, 0x77, 0xc7, 0x8d, 0x88, 0xd7, 0x7c, 0x56, 0x96, 0x7b, 0x78, 0xd7, 0x8c, 0x67, 0xc6, 0x7c, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x7d, 
-				0x78, 0xe7, 0x8e, 0x78, 0xe8, 0x8e, 0x88, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x89, 0xe6, 0x7c, 0x67, 0xb6, 0x8d, 
-				0x78, 0xd6, 0x8d, 0x68, 0xd7, 0x8e, 0x79, 0xe7, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe6, 0x8e, 0x79, 0xe6, 0x8e, 0x68, 0xe6, 0x7d, 0x68, 0xd8, 0x9e, 
-				0x8a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 
-				0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x78, 0xe6, 0x8d, 0x45, 0x95, 0x6a, 0x89, 0xea, 0xae, 0xaa, 0xe8, 0x9e, 0x78, 0xd7, 0x8e, 
-				0x89, 0xe7, 0x8d, 0x77, 0xd8, 0x9d, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xd7, 0x8d, 0x77, 0xd7, 0x8c, 0x89, 0xd8, 0x9d, 0x67, 0xb6, 0x7b, 0x78, 0xd7, 0x8c, 0x67, 0xc6, 0x7c, 
-				0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x8d, 0x78, 0xd7, 0x8e, 0x78, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
-				0x88, 0xd6, 0x7c, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x67, 0xc7, 0x8d, 0x79, 0xe7, 0x8e, 0x79, 0xe7, 0x8e, 0x68, 0xd6, 0x8d, 0x79, 0xe7, 0x9e, 
-				0x79, 0xe6, 0x8e, 0x68, 0xd7, 0x9e, 0x8a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 
-				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x78, 0xe6, 0x7d, 0x56, 0xa7, 0x9d, 0xab, 0xea, 0xbe, 
-				0x9a, 0xe7, 0x7d, 0x67, 0xc7, 0x8e, 0x89, 0xe7, 0x8d, 0x88, 0xda, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xe8, 0x8c, 0x78, 0xc7, 0x8c, 0x88, 0xd8, 0x9d, 0x78, 0xd7, 0x8c, 
-				0x78, 0xd7, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 
-				0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x78, 0xd6, 0x7c, 0x78, 0xd7, 0x8d, 0x67, 0xc3, 0x48, 0x23, 0x75, 0x6b, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x7d, 
-				0x45, 0xa3, 0x59, 0x56, 0xc7, 0x8e, 0x79, 0xe7, 0x9e, 0x78, 0xd7, 0x9e, 0x8a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x89, 0xe8, 0x9e, 
-				0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe7, 0x8e, 0x78, 0xe6, 0x7c, 
-				0x67, 0xc8, 0x9e, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x7d, 0x78, 0xd8, 0x9e, 0x88, 0xe7, 0x8d, 0x89, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xc7, 0x7c, 
-				0x78, 0xc7, 0x8d, 0x78, 0xd7, 0x8c, 0x78, 0xd7, 0x8d, 0x68, 0xc6, 0x7c, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x7d, 0x77, 0xd7, 0x8d, 0x78, 0xe8, 0x8e, 
-				0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x78, 0xd6, 0x7c, 0x78, 0xd7, 0x7c, 0x56, 0xb3, 0x48, 0x35, 0x85, 0x6b, 
-				0x67, 0xc7, 0x8d, 0x68, 0xd6, 0x7c, 0x55, 0xa3, 0x48, 0x45, 0xa6, 0x7c, 0x78, 0xd7, 0x8e, 0x78, 0xe8, 0x9e, 0x8a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
-				0x9a, 0xe9, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 
-				0x68, 0xe7, 0x8e, 0x68, 0xd6, 0x7d, 0x56, 0xb5, 0x6a, 0x56, 0xb7, 0x8d, 0x78, 0xe7, 0x8e, 0x89, 0xe8, 0x8e, 0x78, 0xe8, 0x8d, 0xaa, 0xef, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0x99, 0xd7, 0x8c, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8c, 0x78, 0xd7, 0x8d, 0x77, 0xc6, 0x7c, 0x67, 0xd7, 0x7d, 0x77, 0xd7, 0x7d, 
-				0x77, 0xd7, 0x8e, 0x88, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 0xaa, 0xe9, 0xae, 0x9a, 0xe8, 0x8d, 0x78, 0xc6, 0x7c, 0x67, 0xc7, 0x8c, 
-				0x78, 0xd7, 0x7c, 0x78, 0xc6, 0x7c, 0x67, 0xc7, 0x8d, 0x68, 0xd7, 0x8d, 0x78, 0xd8, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x78, 0xe8, 0x9e, 
-				0x89, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9f, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x9e, 
-				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x68, 0xd6, 0x7c, 0x56, 0xb5, 0x6c, 0x78, 0xe8, 0x9e, 0x89, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
-				0x88, 0xe9, 0x9e, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xf8, 0x8c, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x7c, 0x78, 0xc7, 0x8d, 0x77, 0xc7, 0x7c, 
-				0x77, 0xd7, 0x7d, 0x77, 0xd7, 0x7d, 0x77, 0xd7, 0x8d, 0x78, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x89, 0xe7, 0x8d, 
-				0x78, 0xc7, 0x7c, 0x67, 0xc6, 0x7c, 0x77, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x9e, 0x78, 0xd6, 0x8d, 
-				0x78, 0xd7, 0x8e, 0x79, 0xe8, 0x9e, 0x89, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 
-				0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe6, 0x8d, 0x68, 0xd8, 0x9e, 0x8a, 0xe8, 0xae, 
-				0x89, 0xe7, 0x8e, 0x88, 0xe8, 0x8e, 0x99, 0xec, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x9d, 0x78, 0xd7, 0x8d, 0x88, 0xd7, 0x8c, 
-				0x78, 0xc7, 0x8c, 0x77, 0xc6, 0x7c, 0x67, 0xc7, 0x7d, 0x77, 0xd7, 0x7d, 0x77, 0xd7, 0x8d, 0x88, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 
-				0x9a, 0xe9, 0xae, 0x89, 0xd7, 0x8d, 0x78, 0xc7, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc7, 0x7c, 0x78, 0xd8, 0x9d, 0x79, 0xd7, 0x8d, 0x79, 0xd8, 0x9e, 
-				0x79, 0xe7, 0x8d, 0x78, 0xd6, 0x8d, 0x78, 0xe7, 0x8e, 0x89, 0xe8, 0x9e, 0x89, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0xae, 
-				0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x68, 0xd6, 0x8d, 
-				0x78, 0xe8, 0x9e, 0x8a, 0xe8, 0x9e, 0x78, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0xbb, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 
-				0x78, 0xc8, 0x8d, 0x88, 0xd7, 0x8c, 0x77, 0xc7, 0x8c, 0x77, 0xc7, 0x7c, 0x67, 0xc7, 0x7d, 0x77, 0xd7, 0x7d, 0x77, 0xd7, 0x8d, 0x88, 0xe8, 0x8e, 
-				0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x89, 0xd7, 0x8d, 0x68, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc7, 0x7c, 0x78, 0xd7, 0x9d, 
-				0x89, 0xe7, 0x9d, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xe7, 0x8e, 0x79, 0xe8, 0x9e, 0x89, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
-				0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
-				0x78, 0xe7, 0x8e, 0x68, 0xd6, 0x8d, 0x78, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe8, 0x8e, 0x99, 0xeb, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd8, 0x8c, 0x78, 0xc8, 0x8c, 0x88, 0xc7, 0x8c, 0x77, 0xc7, 0x7c, 0x77, 0xc7, 0x7c, 0x77, 0xd7, 0x7d, 
-				0x77, 0xd7, 0x8d, 0x88, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x8d, 0x78, 0xd7, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 
-				0x67, 0xc7, 0x7c, 0x78, 0xd8, 0x9d, 0x89, 0xe7, 0x9d, 0x79, 0xd7, 0x9e, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8e, 0x79, 0xe8, 0x9e, 
-				0x89, 0xe8, 0x9e, 0x89, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
-				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x68, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x89, 0xe8, 0x9e, 0xbc, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xde, 0xdd, 0xfe, 0xef, 0x9a, 0xe7, 0x8c, 0x77, 0xb6, 0x7c, 
-				0x77, 0xc7, 0x7c, 0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x8e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8c, 
-				0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x78, 0xd8, 0x9d, 0x89, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
-				0x68, 0xd7, 0x8d, 0x78, 0xe7, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x9a, 0xe9, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x78, 0xe7, 0x8e, 
-				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8d, 0x67, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
-				0x89, 0xdc, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xbc, 0xe8, 0x8c, 0x77, 0xb6, 0x7b, 0x67, 0xc7, 0x7c, 0x77, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x8e, 0x89, 0xe8, 0x9e, 0x79, 0xd7, 0x9d, 
-				0x78, 0xd7, 0x8d, 0x68, 0xc6, 0x7c, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x67, 0xd7, 0x8d, 
-				0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8e, 0x79, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe9, 0xae, 0x8a, 0xe8, 0x9e, 
-				0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x9e, 0x89, 0xd7, 0x8d, 0x78, 0xc7, 0x8d, 
-				0x88, 0xe7, 0x8e, 0x78, 0xe8, 0x8e, 0xaa, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf8, 0x9c, 0x77, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8e, 
-				0x78, 0xe7, 0x9d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8c, 0x67, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x77, 0xc7, 0x7c, 
-				0x67, 0xc6, 0x7c, 0x67, 0xc7, 0x7d, 0x77, 0xd6, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x9e, 0x89, 0xe8, 0x9e, 
-				0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe8, 0x9e, 
-				0x89, 0xe9, 0xae, 0xde, 0xfa, 0xae, 0x78, 0xd8, 0x8d, 0x88, 0xe8, 0x8d, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xad, 0x78, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x77, 0xc7, 0x7d, 
-				0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8c, 0x67, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 
-				0x67, 0xc7, 0x7c, 0x77, 0xc7, 0x7c, 0x77, 0xc7, 0x7d, 0x77, 0xd7, 0x7d, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x8d, 0x78, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 
-				0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
-				0x78, 0xe7, 0x8e, 0x78, 0xd8, 0x9d, 0x89, 0xdc, 0xce, 0xff, 0xff, 0xff, 0xde, 0xfb, 0xbe, 0xbb, 0xed, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xb7, 0x7b, 
-				0x67, 0xb6, 0x7c, 0x77, 0xc7, 0x7d, 0x77, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xc6, 0x7c, 0x67, 0xc6, 0x7b, 0x67, 0xb6, 0x6b, 
-				0x66, 0xb6, 0x6b, 0x66, 0xb6, 0x6b, 0x66, 0xb6, 0x6b, 0x65, 0xa6, 0x5a, 0x66, 0xb6, 0x6c, 0x66, 0xb5, 0x5b, 0x55, 0xa6, 0x5b, 0x66, 0xb6, 0x7d, 
-				0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x79, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 
-				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x9e, 0x78, 0xe7, 0x8d, 0x79, 0xd8, 0x9d, 0x9a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xfd, 0xde, 0x89, 0xc7, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x7c, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x67, 0xc6, 0x7b, 
-				0x67, 0xb5, 0x6b, 0x56, 0xa5, 0x6a, 0x66, 0xb5, 0x6a, 0x55, 0xa5, 0x5a, 0x54, 0x95, 0x49, 0x54, 0x95, 0x49, 0x44, 0x95, 0x49, 0x44, 0x94, 0x49, 
-				0x44, 0x94, 0x49, 0x44, 0x94, 0x4a, 0x55, 0xb6, 0x6c, 0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x7c, 0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x9e, 0x89, 0xe8, 0x9e, 
-				0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x89, 0xd9, 0x9d, 0xbb, 0xef, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd7, 0x8b, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x7c, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 
-				0x79, 0xd7, 0x8d, 0x67, 0xc6, 0x7b, 0x56, 0xa4, 0x59, 0x34, 0x83, 0x48, 0x34, 0x83, 0x38, 0x32, 0x73, 0x27, 0x43, 0x84, 0x38, 0x54, 0x95, 0x5a, 
-				0x54, 0x94, 0x38, 0x54, 0x94, 0x49, 0x43, 0x83, 0x38, 0x32, 0x82, 0x28, 0x32, 0x83, 0x39, 0x44, 0x95, 0x5a, 0x55, 0xa5, 0x6a, 0x66, 0xb6, 0x7c, 
-				0x78, 0xd8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xd7, 0x8d, 0x89, 0xd9, 0x9d, 
-				0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0x8b, 0x77, 0xb7, 0x7b, 0x67, 0xc7, 0x7c, 
-				0x77, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x68, 0xc5, 0x7b, 0x56, 0xa4, 0x59, 0x34, 0x83, 0x37, 0x33, 0x84, 0x38, 0x43, 0x84, 0x38, 
-				0x53, 0x95, 0x38, 0x53, 0x85, 0x49, 0x54, 0x94, 0x28, 0x43, 0x94, 0x39, 0x43, 0x94, 0x39, 0x43, 0x94, 0x39, 0x43, 0x94, 0x49, 0x33, 0x83, 0x38, 
-				0x34, 0x85, 0x5a, 0x66, 0xb6, 0x7b, 0x78, 0xd7, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
-				0x78, 0xd7, 0x8d, 0x89, 0xda, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf9, 0x9c, 
-				0x77, 0xb7, 0x7b, 0x67, 0xb6, 0x7c, 0x77, 0xc7, 0x8c, 0x78, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x68, 0xd6, 0x7b, 0x56, 0xa5, 0x6a, 0x45, 0x94, 0x49, 
-				0x44, 0x94, 0x49, 0x54, 0x95, 0x4a, 0x54, 0xa5, 0x4a, 0x54, 0x95, 0x4a, 0x54, 0xa5, 0x4a, 0x54, 0xa5, 0x4a, 0x54, 0xa5, 0x4a, 0x55, 0xb5, 0x5b, 
-				0x55, 0xb4, 0x5a, 0x45, 0xa4, 0x5a, 0x56, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x78, 0xd7, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 
-				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xd8, 0x8d, 0x89, 0xdc, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xfb, 0xbe, 0x78, 0xb7, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x7c, 0x78, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x68, 0xd6, 0x7b, 
-				0x57, 0xb5, 0x6a, 0x56, 0xa5, 0x5a, 0x55, 0xa4, 0x59, 0x54, 0x95, 0x4a, 0x55, 0xa5, 0x5a, 0x65, 0xb6, 0x5b, 0x65, 0xb6, 0x5b, 0x65, 0xb6, 0x5b, 
-				0x55, 0xb6, 0x5b, 0x55, 0xb5, 0x5b, 0x55, 0xb5, 0x5b, 0x56, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x8d, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 
-				0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8d, 0x78, 0xd8, 0x9d, 0x9a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0x89, 0xc7, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x78, 0xc7, 0x8d, 
-				0x78, 0xd6, 0x8c, 0x68, 0xc6, 0x7c, 0x57, 0xb5, 0x6b, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x5a, 0x55, 0xa5, 0x5a, 0x65, 0xb6, 0x5b, 0x66, 0xc6, 0x6c, 
-				0x65, 0xc6, 0x5c, 0x65, 0xc6, 0x6c, 0x66, 0xd6, 0x6d, 0x66, 0xc5, 0x6c, 0x56, 0xc6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
-				0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 0x68, 0xe7, 0x8e, 0x78, 0xe7, 0x8d, 0x78, 0xd8, 0x9d, 0xcc, 0xef, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0x7b, 0x67, 0xb6, 0x7b, 
-				0x67, 0xb6, 0x7c, 0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x8c, 0x57, 0xb5, 0x7b, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x66, 0xb6, 0x6b, 
-				0x65, 0xb6, 0x6c, 0x66, 0xc6, 0x6c, 0x66, 0xc6, 0x6c, 0x66, 0xd6, 0x6d, 0x66, 0xd6, 0x6d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x68, 0xd6, 0x8d, 
-				0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xd7, 0x8e, 0x78, 0xd7, 0x8d, 
-				0x78, 0xd9, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xef, 0xf8, 0x9c, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x8c, 0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x7b, 0x57, 0xb5, 0x7b, 0x57, 0xb5, 0x6b, 
-				0x56, 0xb5, 0x6b, 0x66, 0xb6, 0x6c, 0x66, 0xc6, 0x7c, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7c, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x78, 0xe6, 0x8d, 
-				0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x9e, 0x78, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xd6, 0x8e, 
-				0x68, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x89, 0xcb, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7b, 0x67, 0xb5, 0x7b, 
-				0x57, 0xb5, 0x7b, 0x57, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc7, 0x7d, 0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 
-				0x78, 0xd7, 0x8d, 0x78, 0xe7, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x79, 0xe7, 0x9e, 0x78, 0xe6, 0x8e, 
-				0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x78, 0xd7, 0x8c, 0x9a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x89, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb5, 0x7b, 0x57, 0xb6, 0x7b, 0x57, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x68, 0xc6, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 
-				0x78, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xe6, 0x8e, 
-				0x68, 0xe7, 0x8e, 0x68, 0xe6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x78, 0xd7, 0x8c, 0xbb, 0xef, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xde, 0x89, 0xc6, 0x7b, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb5, 0x7b, 0x67, 0xb6, 0x7b, 0x57, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x8c, 0x78, 0xd7, 0x8d, 
-				0x78, 0xd7, 0x8d, 0x79, 0xe7, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x68, 0xe6, 0x8d, 
-				0x68, 0xd6, 0x8d, 0x68, 0xe6, 0x9e, 0x68, 0xe6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8c, 0x78, 0xc8, 0x9c, 
-				0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xfd, 0xee, 0x89, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb5, 0x7a, 0x56, 0xa5, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 
-				0x68, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x9d, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 
-				0x79, 0xe7, 0x9e, 0x69, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x7d, 
-				0x67, 0xd7, 0x8c, 0x78, 0xc9, 0xad, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0x89, 0xc6, 0x7a, 0x67, 0xa6, 0x7a, 0x57, 0xa5, 0x7a, 0x56, 0xa5, 0x6a, 0x57, 0xb6, 0x7b, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x68, 0xc7, 0x8c, 0x78, 0xd7, 0x8d, 0x79, 0xd8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 
-				0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x69, 0xe6, 0x9e, 0x68, 0xd6, 0x8d, 0x68, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
-				0x68, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xc7, 0x8c, 0x78, 0xc9, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x8a, 0xc6, 0x7a, 0x67, 0xa6, 0x7a, 0x66, 0xa5, 0x6a, 
-				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x68, 0xc7, 0x8c, 0x78, 0xd7, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xe8, 0x9e, 
-				0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xe8, 0xae, 0x8a, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
-				0x68, 0xd6, 0x8d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xc6, 0x7c, 0x68, 0xc7, 0x8c, 0x88, 0xca, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x7a, 
-				0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x57, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x68, 0xc7, 0x8d, 0x78, 0xd7, 0x9d, 
-				0x89, 0xd8, 0x9e, 0x89, 0xe8, 0x9e, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe6, 0x8e, 
-				0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xd6, 0x7c, 0x67, 0xd6, 0x7c, 0x67, 0xc6, 0x7c, 0x68, 0xc7, 0x8c, 0x88, 0xcc, 0xde, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xab, 0xd6, 0x7a, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xb5, 0x7b, 0x67, 0xb6, 0x7c, 
-				0x68, 0xc7, 0x8d, 0x78, 0xd7, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xe8, 0x9e, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 
-				0x79, 0xe7, 0x9e, 0x69, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xd6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 
-				0x68, 0xc7, 0x8c, 0x89, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xd6, 0x7a, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 
-				0x56, 0xa5, 0x7b, 0x67, 0xb6, 0x7c, 0x67, 0xc7, 0x8d, 0x78, 0xd7, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 
-				0x8a, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd5, 0x7c, 0x57, 0xc5, 0x7c, 0x57, 0xb5, 0x7b, 
-				0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x68, 0xc7, 0x8c, 0x99, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0x8a, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x7a, 
-				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x8c, 0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x9e, 0x89, 0xe8, 0x9e, 
-				0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x68, 0xe6, 0x8d, 0x68, 0xd5, 0x8d, 0x57, 0xc5, 0x7c, 
-				0x57, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x57, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x78, 0xc7, 0x8b, 0xab, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0x8b, 
-				0x67, 0xa6, 0x7a, 0x67, 0xb6, 0x7a, 0x67, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x7c, 0x78, 0xc7, 0x8d, 
-				0x78, 0xd8, 0x9d, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x68, 0xe6, 0x8d, 
-				0x68, 0xd5, 0x7d, 0x57, 0xc5, 0x7b, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x68, 0xb7, 0x8b, 0xbc, 0xef, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xcd, 0xe7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x66, 0xa6, 0x7b, 
-				0x67, 0xb6, 0x7c, 0x78, 0xc7, 0x8c, 0x78, 0xd7, 0x9d, 0x89, 0xe8, 0x9e, 0x79, 0xd7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 
-				0x78, 0xe6, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xd5, 0x7c, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x7b, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 
-				0x68, 0xb7, 0x8b, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xe7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xa5, 0x6a, 
-				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x78, 0xc7, 0x8d, 0x78, 0xd7, 0x9d, 0x79, 0xd8, 0x9e, 0x79, 0xe7, 0x9d, 
-				0x78, 0xd7, 0x9e, 0x78, 0xd7, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x7c, 0x57, 0xc5, 0x6b, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x57, 0xb6, 0x7c, 
-				0x67, 0xc6, 0x7c, 0x68, 0xc6, 0x8c, 0x68, 0xb8, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xe7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x66, 0xa6, 0x6a, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x78, 0xd7, 0x8d, 
-				0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x7d, 0x67, 0xc5, 0x7b, 0x56, 0xb4, 0x6a, 0x56, 0xa5, 0x6a, 
-				0x56, 0xb6, 0x7c, 0x67, 0xc6, 0x8c, 0x67, 0xc6, 0x8c, 0x68, 0xc6, 0x7c, 0x68, 0xb8, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xe7, 0x8b, 
-				0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa6, 0x6a, 
-				0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x8c, 0x68, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xc6, 0x8c, 0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x7b, 0x56, 0xb5, 0x6a, 
-				0x56, 0xa5, 0x6a, 0x56, 0xb5, 0x7b, 0x67, 0xc6, 0x7c, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8c, 0x68, 0xc6, 0x7c, 0x68, 0xb9, 0xad, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xce, 0xf7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x66, 0xa6, 0x6a, 
-				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x66, 0xb5, 0x6b, 
-				0x66, 0xb5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6b, 0x67, 0xb6, 0x7c, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 
-				0x68, 0xba, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0x8b, 0x67, 0xa5, 0x7a, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7a, 0x66, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x55, 0x95, 0x59, 0x55, 0x95, 0x6a, 
-				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6b, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
-				0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 0x68, 0xba, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0x8b, 0x67, 0xa6, 0x7a, 0x67, 0xb6, 0x7b, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8b, 0x67, 0xb6, 0x7b, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x6a, 0x66, 0xa6, 0x7a, 0x66, 0xa5, 0x6a, 
-				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa6, 0x6b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x8d, 0x68, 0xd7, 0x8d, 
-				0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 0x68, 0xbb, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0x8b, 
-				0x67, 0xa6, 0x7a, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x77, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x7b, 0x67, 0xb6, 0x7a, 0x67, 0xb6, 0x7b, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 
-				0x68, 0xc6, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 0x68, 0xbb, 0xce, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xde, 0xf7, 0x8b, 0x67, 0xa6, 0x7a, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8c, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 
-				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 
-				0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 
-				0x68, 0xbb, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xe7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xc7, 0x8c, 
-				0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x77, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x8b, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x79, 0xd8, 0x9d, 
-				0x79, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
-				0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 0x78, 0xbb, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xe7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 
-				0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8b, 0x77, 0xb7, 0x8b, 0x78, 0xb7, 0x7b, 0x67, 0xb7, 0x8b, 0x78, 0xc7, 0x8c, 
-				0x89, 0xc8, 0x9d, 0x89, 0xd8, 0x9d, 0x79, 0xd7, 0x9d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8d, 0x78, 0xd7, 0x9d, 
-				0x79, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x7c, 0x68, 0xba, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xd7, 0x8b, 
-				0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 
-				0x78, 0xb7, 0x8b, 0x78, 0xc7, 0x9c, 0x89, 0xd8, 0x9d, 0x89, 0xd7, 0x9d, 0x79, 0xd7, 0x9d, 0x79, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 
-				0x78, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xb9, 0xad, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xfe, 0xff, 0x89, 0xc6, 0x7b, 0x66, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8b, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 
-				0x78, 0xc7, 0x8b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x78, 0xc7, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x79, 0xd7, 0x9d, 0x78, 0xd7, 0x8d, 
-				0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xc6, 0x7c, 
-				0x67, 0xb8, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbd, 0x78, 0xb6, 0x7b, 0x67, 0xa6, 0x6a, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x77, 0xb7, 0x8b, 
-				0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xb7, 0x8b, 0x78, 0xc7, 0x8b, 0x78, 0xc7, 0x9c, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 
-				0x79, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x79, 0xe7, 0x9d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
-				0x68, 0xd6, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xb7, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-				
-};
-#ifdef __cplusplus
-}
-#endif //to close extern "C" if used
-
-#endif //exclude large bmp if not used
-
+/*************************************************************************
+ *
+ *	Author: Slavcho Tomov
+ *
+ *    (c) Copyright Olimex 2006
+ *  B.K - this file was generated using Olimex BmpToArray.exe utility
+ * and is used by lcd.c to write entire bit map into LCD
+ **************************************************************************/
+
+const unsigned char bmp [] = {};
+
+#if 0 //disable big bitmap with Kuba face as it is not used now
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+	
+const unsigned char bmp [] = {
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xee, 0xed, 0xde, 0xde, 0xed, 0xee, 0xdd, 0xee, 0xee, 0xff, 0xff, 0xff, 0xde, 0xec, 0xde, 0xdd, 0xee, 0xee, 0xee, 0xef, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xef, 0xfc, 0xef, 0xcd, 0xeb, 0xbe, 0x9a, 0xc8, 0x8a, 0x77, 0x97, 0x79, 0x77, 0x97, 0x78, 0x88, 0x99, 0x9a, 0x89, 0xa8, 0x89, 
+				0x77, 0x87, 0x89, 0x88, 0x9a, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xde, 0xec, 0xde, 0xbc, 0xe9, 0xac, 0x78, 0xb6, 0x79, 0x45, 0x62, 0x34, 0x23, 0x42, 0x34, 0x23, 0x42, 0x34, 
+				0x34, 0x53, 0x45, 0x34, 0x53, 0x34, 0x23, 0x42, 0x34, 0x34, 0x54, 0x45, 0x77, 0x8c, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfc, 0xde, 0xbc, 0xda, 0xbc, 0x9a, 0xb7, 0x8a, 0x78, 0x95, 0x67, 0x23, 0x51, 0x24, 0x12, 0x31, 0x23, 
+				0x12, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x31, 0x23, 0x12, 0x31, 0x23, 0x11, 0x31, 0x23, 0x22, 0x32, 0x24, 0x33, 0x45, 0x56, 0x88, 0xae, 0xee, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xde, 0xeb, 0xce, 0xab, 0xd9, 0xac, 0x78, 0xa5, 0x67, 0x45, 0x62, 0x45, 0x23, 0x51, 0x24, 
+				0x12, 0x31, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x31, 0x23, 0x12, 0x31, 0x23, 0x11, 0x21, 0x22, 0x11, 0x21, 0x23, 0x22, 0x32, 0x34, 
+				0x33, 0x43, 0x35, 0x44, 0x57, 0x89, 0xbc, 0xdd, 0xde, 0xdd, 0xed, 0xde, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xea, 0xcd, 0x9a, 0xc7, 0x8a, 0x56, 0x74, 0x56, 0x34, 0x51, 0x24, 
+				0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x22, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x12, 0x21, 0x23, 0x22, 0x32, 0x23, 0x22, 0x43, 0x34, 0x34, 0x54, 0x45, 0x66, 0x77, 0x79, 0x88, 0xa8, 0x8a, 0x99, 0xbc, 0xcd, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xce, 0xea, 0xcd, 0x9a, 0xc7, 0x8a, 0x55, 0x73, 0x45, 
+				0x24, 0x52, 0x35, 0x12, 0x41, 0x24, 0x23, 0x42, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 
+				0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x22, 0x32, 0x23, 0x12, 0x32, 0x23, 0x23, 0x42, 0x34, 0x33, 0x43, 0x45, 0x34, 0x53, 0x35, 
+				0x45, 0x57, 0x78, 0xaa, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfa, 0xce, 0x8a, 0xd6, 0x8a, 
+				0x46, 0x73, 0x46, 0x23, 0x52, 0x35, 0x24, 0x52, 0x34, 0x23, 0x42, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x31, 0x23, 0x12, 0x32, 0x23, 
+				0x12, 0x31, 0x22, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x22, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x32, 0x23, 
+				0x22, 0x32, 0x24, 0x23, 0x42, 0x24, 0x22, 0x43, 0x45, 0x55, 0x6b, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfb, 0xde, 
+				0x9b, 0xd7, 0x9b, 0x57, 0x92, 0x56, 0x24, 0x52, 0x35, 0x12, 0x41, 0x24, 0x13, 0x42, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 
+				0x12, 0x21, 0x23, 0x12, 0x21, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x12, 0x21, 0x23, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x31, 0x23, 0x12, 0x32, 0x24, 0x33, 0x46, 0x67, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xfe, 0xff, 0xac, 0xd8, 0x9b, 0x66, 0x84, 0x56, 0x34, 0x52, 0x35, 0x23, 0x41, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
+				0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x21, 0x12, 
+				0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x32, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x11, 0x22, 0x23, 0x33, 0x44, 0x45, 
+				0x88, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf9, 0xce, 0x8a, 0xc5, 0x67, 0x34, 0x53, 0x45, 0x23, 0x42, 0x34, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x21, 0x12, 
+				0x12, 0x21, 0x23, 0x33, 0x43, 0x34, 0x55, 0x6a, 0xab, 0xcd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xac, 0xe7, 0x9c, 0x56, 0x83, 0x46, 0x24, 0x52, 0x34, 0x12, 0x42, 0x24, 
+				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x10, 0x11, 0x01, 0x21, 0x12, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 
+				0x12, 0x21, 0x12, 0x11, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x22, 0x23, 0x23, 0x42, 0x34, 0x33, 0x45, 0x67, 0x88, 0xa9, 0xab, 0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfa, 0xce, 0x89, 0xb5, 0x67, 0x34, 0x62, 0x45, 
+				0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x10, 0x11, 0x01, 0x21, 0x22, 
+				0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x12, 0x11, 0x21, 0x22, 0x12, 0x21, 0x12, 0x11, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x22, 0x23, 0x22, 0x32, 0x24, 0x23, 0x43, 0x35, 0x44, 0x55, 0x56, 
+				0x77, 0x8a, 0xac, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xee, 0xac, 0xe8, 0xac, 
+				0x45, 0x72, 0x45, 0x23, 0x52, 0x34, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x23, 0x12, 0x31, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
+				0x01, 0x10, 0x12, 0x01, 0x21, 0x22, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x11, 0x21, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x12, 0x11, 0x21, 0x12, 
+				0x11, 0x21, 0x22, 0x12, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x32, 0x23, 
+				0x23, 0x42, 0x24, 0x22, 0x43, 0x35, 0x34, 0x55, 0x56, 0x89, 0xac, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xce, 0xea, 0xce, 0x79, 0xb5, 0x68, 0x24, 0x51, 0x34, 0x23, 0x41, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x11, 0x20, 0x12, 0x01, 0x21, 0x12, 
+				0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x12, 0x21, 0x22, 0x12, 0x32, 0x23, 0x23, 0x42, 0x24, 0x12, 0x31, 0x23, 0x23, 0x43, 0x45, 0x45, 0x66, 0x67, 0x9a, 0xbe, 0xee, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xfc, 0xef, 0x9c, 0xe7, 0x9b, 0x45, 0x72, 0x45, 0x13, 0x51, 0x24, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x12, 0x20, 0x12, 
+				0x01, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x11, 0x20, 0x12, 0x01, 0x20, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x02, 0x21, 0x22, 
+				0x11, 0x21, 0x12, 0x12, 0x21, 0x22, 0x11, 0x21, 0x22, 0x12, 0x31, 0x23, 0x22, 0x31, 0x23, 0x11, 0x31, 0x23, 0x22, 0x42, 0x34, 0x23, 0x43, 0x35, 
+				0x55, 0x68, 0x89, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf8, 0xce, 0x7a, 0xc4, 0x57, 0x13, 0x51, 0x35, 0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 
+				0x02, 0x20, 0x12, 0x12, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x12, 0x12, 0x21, 0x22, 
+				0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x11, 0x21, 0x12, 0x11, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x12, 0x20, 0x12, 0x02, 0x21, 0x22, 0x01, 0x21, 0x12, 0x12, 0x21, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x11, 0x31, 0x23, 
+				0x22, 0x42, 0x34, 0x33, 0x53, 0x35, 0x34, 0x56, 0x67, 0x89, 0xae, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x9c, 0xe6, 0xac, 0x36, 0x81, 0x35, 0x12, 0x41, 0x24, 
+				0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x02, 0x20, 0x12, 0x11, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
+				0x01, 0x21, 0x12, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x23, 0x12, 0x21, 0x22, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 
+				0x01, 0x21, 0x22, 0x12, 0x31, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x22, 0x01, 0x21, 0x12, 0x12, 0x21, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x34, 0x23, 0x53, 0x35, 0x44, 0x55, 0x56, 0x66, 0x8a, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfa, 0xce, 0x7a, 0xc3, 0x67, 
+				0x13, 0x51, 0x35, 0x02, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x02, 0x20, 0x12, 0x02, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x01, 0x21, 0x23, 
+				0x12, 0x31, 0x22, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 
+				0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x23, 0x42, 0x35, 0x34, 0x53, 0x45, 0x45, 0x66, 0x78, 
+				0xbc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xad, 0xe7, 0xad, 0x36, 0x81, 0x45, 0x13, 0x50, 0x35, 0x02, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x31, 0x22, 
+				0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x12, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 
+				0x01, 0x20, 0x22, 0x12, 0x20, 0x22, 0x02, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x42, 0x35, 
+				0x23, 0x52, 0x35, 0x23, 0x43, 0x45, 0x77, 0x8d, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xfc, 0xef, 0x8b, 0xe5, 0x7a, 0x14, 0x61, 0x35, 0x13, 0x50, 0x24, 0x02, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 
+				0x02, 0x31, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x01, 0x21, 0x22, 0x01, 0x20, 0x12, 
+				0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x01, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x22, 0x02, 0x20, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x42, 0x34, 0x23, 0x42, 0x34, 0x23, 0x42, 0x24, 0x44, 0x58, 0x89, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfa, 0xbe, 0x78, 0xb2, 0x46, 0x13, 0x51, 0x35, 0x13, 0x50, 0x24, 0x12, 0x41, 0x24, 
+				0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x02, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x22, 
+				0x12, 0x31, 0x22, 0x02, 0x20, 0x22, 0x02, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 
+				0x01, 0x21, 0x22, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x02, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x02, 0x20, 0x22, 0x12, 0x20, 0x22, 
+				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x34, 0x23, 0x42, 0x34, 0x23, 0x42, 0x24, 0x22, 0x45, 0x56, 0x9a, 0xbf, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0xe8, 0xac, 0x45, 0x71, 0x25, 0x13, 0x51, 0x35, 
+				0x13, 0x51, 0x24, 0x12, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x02, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x01, 0x21, 0x22, 
+				0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x20, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x02, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x02, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x23, 0x41, 0x34, 0x23, 0x42, 0x34, 
+				0x22, 0x43, 0x45, 0x66, 0x7c, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x8a, 0xd6, 0x79, 
+				0x13, 0x51, 0x25, 0x13, 0x51, 0x35, 0x13, 0x51, 0x24, 0x12, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x22, 0x02, 0x20, 0x22, 0x02, 0x20, 0x12, 
+				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
+				0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x22, 
+				0x02, 0x21, 0x22, 0x12, 0x21, 0x22, 0x01, 0x20, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x30, 0x23, 0x02, 0x31, 0x23, 0x12, 0x31, 0x24, 
+				0x12, 0x41, 0x24, 0x22, 0x42, 0x24, 0x22, 0x42, 0x34, 0x45, 0x58, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xef, 0xfa, 0xbd, 0x78, 0xa2, 0x46, 0x12, 0x51, 0x25, 0x13, 0x51, 0x35, 0x12, 0x41, 0x34, 0x12, 0x41, 0x23, 0x12, 0x30, 0x22, 0x02, 0x20, 0x12, 
+				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 
+				0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
+				0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x02, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
+				0x02, 0x31, 0x23, 0x12, 0x31, 0x24, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 0x12, 0x42, 0x34, 0x44, 0x55, 0x56, 0xcc, 0xdf, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe8, 0xac, 0x45, 0x71, 0x35, 0x12, 0x51, 0x35, 0x13, 0x51, 0x24, 0x12, 0x41, 0x34, 0x12, 0x40, 0x23, 
+				0x02, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x23, 0x11, 0x31, 0x13, 
+				0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 
+				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x22, 
+				0x02, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x30, 0x23, 0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 0x12, 0x42, 0x24, 0x34, 0x54, 0x45, 
+				0x77, 0x8f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xee, 0x9a, 0xd5, 0x69, 0x24, 0x61, 0x25, 0x12, 0x41, 0x24, 0x12, 0x41, 0x24, 
+				0x12, 0x41, 0x24, 0x12, 0x30, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 
+				0x01, 0x31, 0x13, 0x11, 0x31, 0x23, 0x01, 0x30, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x11, 0x01, 0x20, 0x12, 
+				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 
+				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x02, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 
+				0x12, 0x42, 0x24, 0x33, 0x53, 0x45, 0x55, 0x6d, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xce, 0x78, 0xb3, 0x46, 0x23, 0x51, 0x24, 
+				0x12, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 
+				0x01, 0x20, 0x12, 0x01, 0x21, 0x12, 0x11, 0x31, 0x23, 0x12, 0x31, 0x23, 0x01, 0x30, 0x13, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x10, 0x11, 
+				0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 
+				0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
+				0x12, 0x41, 0x24, 0x22, 0x42, 0x24, 0x12, 0x41, 0x24, 0x33, 0x53, 0x35, 0x34, 0x58, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xf8, 0xad, 
+				0x45, 0x82, 0x35, 0x13, 0x51, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x01, 0x20, 0x12, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 
+				0x01, 0x10, 0x11, 0x01, 0x21, 0x12, 0x11, 0x20, 0x12, 0x11, 0x21, 0x13, 0x12, 0x31, 0x24, 0x12, 0x41, 0x24, 0x12, 0x30, 0x13, 0x01, 0x30, 0x12, 
+				0x01, 0x21, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x21, 0x12, 0x12, 0x20, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
+				0x11, 0x20, 0x12, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x12, 0x21, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 0x12, 0x41, 0x24, 0x23, 0x52, 0x35, 0x33, 0x56, 0x57, 0xcc, 0xdf, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xac, 0xe6, 0x8b, 0x13, 0x62, 0x35, 0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x11, 0x21, 0x12, 0x01, 0x20, 0x11, 
+				0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x11, 0x21, 0x23, 0x12, 0x31, 0x12, 0x11, 0x31, 0x23, 0x12, 0x42, 0x24, 0x22, 0x52, 0x25, 
+				0x12, 0x41, 0x24, 0x11, 0x31, 0x23, 0x12, 0x31, 0x23, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x23, 0x11, 0x31, 0x23, 
+				0x12, 0x31, 0x23, 0x01, 0x20, 0x12, 0x12, 0x30, 0x12, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x11, 
+				0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 0x22, 0x52, 0x35, 
+				0x33, 0x54, 0x45, 0x99, 0xaf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 0x8a, 0xd3, 0x57, 0x12, 0x51, 0x35, 0x12, 0x41, 0x23, 0x12, 0x31, 0x13, 0x12, 0x31, 0x22, 
+				0x11, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x11, 0x21, 0x12, 0x11, 0x22, 0x24, 0x22, 0x31, 0x13, 0x12, 0x32, 0x24, 
+				0x22, 0x42, 0x35, 0x23, 0x52, 0x35, 0x12, 0x52, 0x25, 0x12, 0x42, 0x35, 0x23, 0x52, 0x34, 0x01, 0x30, 0x12, 0x01, 0x21, 0x12, 0x11, 0x20, 0x12, 
+				0x01, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x13, 0x12, 0x31, 0x23, 0x01, 0x20, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 
+				0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x02, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 
+				0x12, 0x42, 0x24, 0x22, 0x52, 0x35, 0x33, 0x53, 0x35, 0x66, 0x8f, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0x78, 0xa2, 0x35, 0x13, 0x51, 0x24, 0x12, 0x41, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x11, 0x21, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x13, 0x22, 0x42, 0x34, 
+				0x22, 0x41, 0x24, 0x22, 0x42, 0x25, 0x22, 0x53, 0x36, 0x34, 0x63, 0x36, 0x23, 0x52, 0x35, 0x22, 0x53, 0x46, 0x44, 0x62, 0x35, 0x12, 0x41, 0x13, 
+				0x11, 0x31, 0x13, 0x11, 0x30, 0x12, 0x01, 0x32, 0x24, 0x22, 0x41, 0x24, 0x12, 0x41, 0x24, 0x12, 0x41, 0x23, 0x23, 0x42, 0x34, 0x01, 0x20, 0x11, 
+				0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 0x12, 0x42, 0x24, 0x23, 0x52, 0x35, 0x23, 0x53, 0x35, 0x45, 0x6c, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbd, 0x56, 0x81, 0x35, 
+				0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x12, 0x21, 0x22, 0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x13, 
+				0x11, 0x32, 0x24, 0x33, 0x53, 0x35, 0x23, 0x52, 0x25, 0x23, 0x53, 0x35, 0x23, 0x63, 0x47, 0x34, 0x73, 0x36, 0x34, 0x62, 0x36, 0x23, 0x65, 0x57, 
+				0x55, 0x74, 0x46, 0x22, 0x42, 0x24, 0x11, 0x42, 0x24, 0x12, 0x31, 0x13, 0x11, 0x32, 0x24, 0x23, 0x52, 0x35, 0x22, 0x51, 0x25, 0x12, 0x41, 0x24, 
+				0x33, 0x53, 0x45, 0x12, 0x30, 0x12, 0x01, 0x10, 0x11, 0x01, 0x10, 0x11, 0x01, 0x20, 0x12, 0x01, 0x20, 0x11, 0x01, 0x10, 0x12, 0x01, 0x20, 0x12, 
+				0x01, 0x20, 0x12, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x12, 0x42, 0x34, 0x23, 0x52, 0x35, 0x23, 0x53, 0x35, 0x44, 0x59, 0x9a, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xef, 0xf9, 0xac, 0x35, 0x61, 0x35, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x11, 0x21, 0x12, 0x11, 0x21, 0x12, 
+				0x11, 0x21, 0x23, 0x12, 0x32, 0x23, 0x12, 0x42, 0x34, 0x33, 0x53, 0x35, 0x33, 0x52, 0x25, 0x33, 0x63, 0x36, 0x34, 0x64, 0x58, 0x45, 0x73, 0x47, 
+				0x44, 0x72, 0x36, 0x34, 0x66, 0x69, 0x66, 0x94, 0x57, 0x23, 0x52, 0x35, 0x12, 0x42, 0x35, 0x33, 0x51, 0x13, 0x12, 0x43, 0x35, 0x33, 0x52, 0x35, 
+				0x23, 0x52, 0x35, 0x12, 0x51, 0x25, 0x34, 0x64, 0x56, 0x22, 0x40, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x12, 0x01, 0x20, 0x12, 
+				0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x12, 0x42, 0x34, 0x22, 0x42, 0x35, 
+				0x23, 0x53, 0x35, 0x34, 0x57, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf8, 0x9b, 0x35, 0x61, 0x35, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 
+				0x12, 0x21, 0x22, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x42, 0x34, 0x22, 0x43, 0x45, 0x44, 0x63, 0x46, 0x34, 0x63, 0x36, 0x34, 0x63, 0x46, 
+				0x45, 0x75, 0x69, 0x45, 0x83, 0x47, 0x45, 0x82, 0x36, 0x34, 0x77, 0x7a, 0x67, 0xa5, 0x57, 0x34, 0x63, 0x46, 0x22, 0x53, 0x46, 0x55, 0x71, 0x24, 
+				0x22, 0x55, 0x57, 0x44, 0x63, 0x36, 0x23, 0x62, 0x35, 0x23, 0x52, 0x35, 0x45, 0x75, 0x57, 0x33, 0x50, 0x13, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
+				0x01, 0x21, 0x22, 0x12, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 
+				0x12, 0x42, 0x34, 0x22, 0x42, 0x24, 0x23, 0x52, 0x35, 0x34, 0x56, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0x8a, 0x34, 0x61, 0x34, 0x12, 0x41, 0x23, 0x12, 0x32, 0x23, 
+				0x12, 0x21, 0x22, 0x12, 0x22, 0x22, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x42, 0x24, 0x33, 0x53, 0x35, 0x33, 0x54, 0x46, 0x44, 0x74, 0x47, 
+				0x44, 0x64, 0x46, 0x45, 0x74, 0x47, 0x55, 0x86, 0x6a, 0x55, 0x84, 0x57, 0x55, 0x83, 0x47, 0x55, 0x87, 0x8b, 0x78, 0xb5, 0x68, 0x45, 0x75, 0x57, 
+				0x23, 0x54, 0x46, 0x66, 0x92, 0x35, 0x23, 0x56, 0x68, 0x45, 0x73, 0x47, 0x34, 0x73, 0x36, 0x23, 0x63, 0x46, 0x56, 0x86, 0x69, 0x45, 0x71, 0x24, 
+				0x01, 0x30, 0x12, 0x01, 0x20, 0x12, 0x11, 0x21, 0x23, 0x12, 0x31, 0x13, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 
+				0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x42, 0x34, 0x22, 0x41, 0x24, 0x23, 0x52, 0x35, 0x34, 0x56, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xd5, 0x68, 0x23, 0x52, 0x34, 
+				0x12, 0x41, 0x23, 0x22, 0x32, 0x33, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x32, 0x24, 0x22, 0x43, 0x34, 0x33, 0x53, 0x35, 
+				0x33, 0x64, 0x47, 0x44, 0x74, 0x47, 0x44, 0x74, 0x47, 0x55, 0x94, 0x58, 0x55, 0x96, 0x6a, 0x55, 0x95, 0x59, 0x56, 0x94, 0x58, 0x66, 0xa7, 0x8c, 
+				0x78, 0xb6, 0x6a, 0x56, 0x85, 0x68, 0x44, 0x74, 0x46, 0x77, 0xa3, 0x46, 0x33, 0x66, 0x7a, 0x55, 0x84, 0x57, 0x44, 0x73, 0x47, 0x34, 0x74, 0x57, 
+				0x66, 0x96, 0x7a, 0x55, 0x72, 0x35, 0x11, 0x30, 0x13, 0x11, 0x31, 0x13, 0x12, 0x31, 0x24, 0x23, 0x41, 0x23, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 
+				0x01, 0x20, 0x12, 0x01, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x24, 0x12, 0x41, 0x24, 0x23, 0x42, 0x34, 0x34, 0x56, 0x67, 
+				0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 
+				0x8a, 0xc4, 0x56, 0x23, 0x51, 0x24, 0x12, 0x41, 0x23, 0x23, 0x32, 0x34, 0x22, 0x32, 0x23, 0x22, 0x32, 0x23, 0x23, 0x32, 0x34, 0x22, 0x32, 0x24, 
+				0x33, 0x43, 0x35, 0x33, 0x53, 0x35, 0x33, 0x65, 0x57, 0x45, 0x74, 0x58, 0x45, 0x85, 0x58, 0x56, 0x95, 0x58, 0x66, 0xa6, 0x6a, 0x55, 0x95, 0x69, 
+				0x56, 0xa5, 0x69, 0x67, 0xb7, 0x8c, 0x78, 0xc6, 0x7a, 0x66, 0x96, 0x69, 0x55, 0x84, 0x57, 0x77, 0xa4, 0x47, 0x34, 0x67, 0x7a, 0x56, 0x94, 0x58, 
+				0x45, 0x84, 0x58, 0x44, 0x75, 0x69, 0x77, 0xb6, 0x7a, 0x55, 0x83, 0x46, 0x12, 0x41, 0x13, 0x12, 0x31, 0x23, 0x12, 0x32, 0x24, 0x33, 0x52, 0x34, 
+				0x01, 0x30, 0x13, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x21, 0x22, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x24, 0x12, 0x41, 0x24, 
+				0x22, 0x42, 0x34, 0x34, 0x56, 0x67, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x89, 0xb3, 0x46, 0x23, 0x41, 0x24, 0x22, 0x42, 0x34, 0x23, 0x42, 0x34, 0x23, 0x32, 0x23, 0x22, 0x32, 0x23, 
+				0x23, 0x32, 0x23, 0x22, 0x32, 0x24, 0x33, 0x53, 0x35, 0x33, 0x53, 0x36, 0x34, 0x64, 0x57, 0x55, 0x85, 0x59, 0x55, 0x85, 0x59, 0x66, 0xa6, 0x6a, 
+				0x66, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 0x66, 0xa5, 0x6a, 0x77, 0xb8, 0x8c, 0x88, 0xc7, 0x8b, 0x67, 0xa6, 0x7a, 0x56, 0x95, 0x58, 0x67, 0xa4, 0x57, 
+				0x45, 0x86, 0x7a, 0x66, 0x95, 0x69, 0x56, 0x95, 0x59, 0x55, 0x86, 0x7a, 0x78, 0xc7, 0x7b, 0x66, 0x93, 0x47, 0x12, 0x51, 0x24, 0x12, 0x41, 0x24, 
+				0x22, 0x42, 0x35, 0x34, 0x62, 0x35, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x21, 0x22, 0x12, 0x31, 0x23, 
+				0x12, 0x31, 0x24, 0x12, 0x41, 0x24, 0x22, 0x42, 0x34, 0x33, 0x55, 0x56, 0xcc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x78, 0xa3, 0x45, 0x12, 0x41, 0x24, 0x22, 0x42, 0x34, 0x33, 0x42, 0x34, 
+				0x23, 0x32, 0x33, 0x23, 0x32, 0x23, 0x22, 0x32, 0x23, 0x22, 0x42, 0x25, 0x33, 0x53, 0x36, 0x33, 0x63, 0x36, 0x44, 0x75, 0x58, 0x55, 0x86, 0x6a, 
+				0x55, 0x86, 0x6a, 0x66, 0xa6, 0x6a, 0x67, 0xb6, 0x7b, 0x66, 0xa6, 0x6a, 0x66, 0xa6, 0x7a, 0x78, 0xc8, 0x8c, 0x89, 0xc8, 0x8c, 0x77, 0xb6, 0x7a, 
+				0x66, 0xa6, 0x69, 0x77, 0xa5, 0x58, 0x55, 0x87, 0x7b, 0x67, 0xa6, 0x69, 0x66, 0xa6, 0x6a, 0x55, 0x97, 0x7b, 0x78, 0xc7, 0x8c, 0x67, 0xa4, 0x57, 
+				0x22, 0x51, 0x24, 0x22, 0x41, 0x24, 0x22, 0x53, 0x46, 0x45, 0x73, 0x46, 0x12, 0x41, 0x24, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x41, 0x24, 0x22, 0x42, 0x34, 0x34, 0x54, 0x56, 0xbb, 0xcf, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x78, 0xa2, 0x45, 0x12, 0x41, 0x24, 
+				0x22, 0x32, 0x34, 0x33, 0x42, 0x34, 0x23, 0x32, 0x33, 0x22, 0x32, 0x23, 0x22, 0x31, 0x23, 0x22, 0x43, 0x35, 0x33, 0x63, 0x36, 0x34, 0x74, 0x47, 
+				0x45, 0x85, 0x58, 0x56, 0x95, 0x69, 0x55, 0x96, 0x6a, 0x67, 0xb6, 0x6a, 0x77, 0xb7, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xa6, 0x7b, 0x78, 0xc8, 0x9d, 
+				0x89, 0xd8, 0x9c, 0x77, 0xb6, 0x7a, 0x67, 0xa7, 0x7b, 0x67, 0xa5, 0x69, 0x55, 0x87, 0x7b, 0x77, 0xb6, 0x7a, 0x66, 0xa6, 0x7a, 0x66, 0xa8, 0x8c, 
+				0x89, 0xd8, 0x8c, 0x77, 0xb4, 0x57, 0x23, 0x52, 0x35, 0x23, 0x51, 0x25, 0x23, 0x54, 0x57, 0x56, 0x83, 0x46, 0x23, 0x52, 0x35, 0x12, 0x42, 0x24, 
+				0x22, 0x42, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x42, 0x34, 0x34, 0x54, 0x45, 
+				0x99, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 
+				0x67, 0x92, 0x35, 0x12, 0x41, 0x24, 0x22, 0x42, 0x34, 0x33, 0x42, 0x33, 0x23, 0x32, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x53, 0x36, 
+				0x33, 0x63, 0x47, 0x45, 0x85, 0x58, 0x55, 0x95, 0x59, 0x56, 0xa5, 0x6a, 0x56, 0xa6, 0x7b, 0x67, 0xb7, 0x7b, 0x78, 0xc7, 0x8c, 0x78, 0xc8, 0x8c, 
+				0x78, 0xc7, 0x8c, 0x88, 0xc8, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xb7, 0x8c, 0x78, 0xb7, 0x8b, 0x77, 0xb6, 0x6a, 0x56, 0x97, 0x8c, 0x77, 0xb7, 0x8b, 
+				0x67, 0xa6, 0x7b, 0x67, 0xb8, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xb5, 0x58, 0x33, 0x62, 0x36, 0x23, 0x52, 0x35, 0x23, 0x65, 0x68, 0x56, 0x93, 0x57, 
+				0x23, 0x62, 0x35, 0x23, 0x52, 0x34, 0x23, 0x42, 0x34, 0x23, 0x42, 0x34, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 
+				0x22, 0x42, 0x34, 0x33, 0x53, 0x45, 0x88, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x56, 0x82, 0x35, 0x13, 0x41, 0x23, 0x22, 0x32, 0x33, 0x23, 0x32, 0x23, 0x22, 0x31, 0x22, 0x11, 0x21, 0x13, 
+				0x12, 0x32, 0x24, 0x33, 0x64, 0x47, 0x44, 0x74, 0x58, 0x55, 0x95, 0x6a, 0x56, 0xa5, 0x6a, 0x66, 0xa6, 0x6a, 0x66, 0xa6, 0x7c, 0x78, 0xc7, 0x8c, 
+				0x78, 0xc7, 0x8d, 0x88, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x88, 0xd8, 0x8c, 0x88, 0xc7, 0x7b, 
+				0x67, 0xa8, 0x8c, 0x88, 0xd8, 0x8c, 0x77, 0xb6, 0x7b, 0x78, 0xc8, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xb4, 0x58, 0x34, 0x72, 0x36, 0x23, 0x62, 0x36, 
+				0x34, 0x75, 0x69, 0x56, 0x93, 0x58, 0x24, 0x62, 0x46, 0x23, 0x52, 0x35, 0x23, 0x52, 0x34, 0x23, 0x42, 0x34, 0x22, 0x31, 0x23, 0x12, 0x31, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x42, 0x34, 0x33, 0x53, 0x45, 0x88, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x56, 0x82, 0x35, 0x12, 0x41, 0x23, 0x22, 0x32, 0x33, 0x23, 0x31, 0x23, 
+				0x12, 0x21, 0x22, 0x11, 0x21, 0x13, 0x11, 0x42, 0x25, 0x34, 0x74, 0x58, 0x55, 0x95, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xb5, 0x6b, 0x67, 0xb6, 0x7b, 
+				0x67, 0xb7, 0x7c, 0x78, 0xc7, 0x8c, 0x88, 0xd8, 0x8d, 0x89, 0xd8, 0x8d, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd9, 0x9d, 0x99, 0xd9, 0xad, 
+				0x99, 0xd9, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xc8, 0x9d, 0x99, 0xd8, 0x9d, 0x89, 0xd7, 0x8c, 0x78, 0xc8, 0x9d, 0x89, 0xe8, 0x9d, 0x78, 0xc4, 0x59, 
+				0x34, 0x73, 0x47, 0x34, 0x73, 0x47, 0x45, 0x85, 0x6a, 0x56, 0xa3, 0x58, 0x24, 0x72, 0x47, 0x13, 0x62, 0x35, 0x23, 0x52, 0x34, 0x23, 0x42, 0x34, 
+				0x23, 0x32, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x42, 0x34, 0x33, 0x53, 0x35, 0x88, 0x9f, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xce, 0x56, 0x81, 0x34, 0x12, 0x41, 0x23, 
+				0x23, 0x42, 0x33, 0x12, 0x31, 0x22, 0x12, 0x21, 0x12, 0x11, 0x21, 0x23, 0x12, 0x43, 0x46, 0x45, 0x85, 0x59, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6b, 
+				0x56, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x78, 0xc7, 0x8d, 0x88, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd9, 0x9d, 0x9a, 0xd9, 0xad, 
+				0x99, 0xd9, 0xad, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x99, 0xd9, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xd8, 0x9d, 
+				0x89, 0xe8, 0x9d, 0x67, 0xc5, 0x6a, 0x45, 0x84, 0x58, 0x45, 0x94, 0x59, 0x46, 0x95, 0x6a, 0x56, 0xa3, 0x59, 0x24, 0x82, 0x47, 0x13, 0x62, 0x35, 
+				0x22, 0x52, 0x24, 0x23, 0x42, 0x23, 0x23, 0x32, 0x33, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x42, 0x35, 0x33, 0x53, 0x35, 
+				0x88, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xce, 
+				0x56, 0x82, 0x34, 0x12, 0x41, 0x23, 0x22, 0x32, 0x23, 0x12, 0x21, 0x12, 0x11, 0x21, 0x12, 0x11, 0x32, 0x24, 0x33, 0x54, 0x57, 0x55, 0x85, 0x59, 
+				0x56, 0xa5, 0x6b, 0x56, 0xb6, 0x6b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x8c, 0x78, 0xc8, 0x8d, 0x88, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 
+				0x99, 0xd9, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0xae, 
+				0x8a, 0xe8, 0x9d, 0x89, 0xd8, 0x9e, 0x89, 0xe7, 0x9d, 0x67, 0xc6, 0x7b, 0x45, 0x95, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6b, 0x46, 0xb4, 0x6a, 
+				0x35, 0x93, 0x48, 0x23, 0x62, 0x36, 0x22, 0x51, 0x24, 0x12, 0x41, 0x23, 0x22, 0x32, 0x33, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 
+				0x22, 0x42, 0x34, 0x33, 0x53, 0x45, 0x88, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xf9, 0xbd, 0x56, 0x71, 0x34, 0x13, 0x41, 0x24, 0x23, 0x32, 0x23, 0x11, 0x21, 0x12, 0x11, 0x20, 0x12, 0x12, 0x32, 0x35, 
+				0x44, 0x75, 0x58, 0x55, 0x95, 0x6a, 0x56, 0xa5, 0x6b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x78, 0xc7, 0x8c, 0x78, 0xd8, 0x8d, 
+				0x89, 0xd8, 0x9d, 0x89, 0xd9, 0x9d, 0x99, 0xd9, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
+				0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x89, 0xd7, 0x9d, 0x78, 0xd6, 0x8c, 0x57, 0xb5, 0x7b, 0x57, 0xb5, 0x7b, 
+				0x56, 0xb5, 0x7c, 0x57, 0xb4, 0x6b, 0x36, 0xa3, 0x59, 0x24, 0x71, 0x36, 0x12, 0x61, 0x25, 0x12, 0x41, 0x23, 0x12, 0x32, 0x23, 0x12, 0x31, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x42, 0x34, 0x33, 0x53, 0x45, 0x88, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x9c, 0x34, 0x61, 0x34, 0x23, 0x42, 0x34, 0x23, 0x42, 0x23, 0x11, 0x21, 0x12, 
+				0x11, 0x20, 0x12, 0x12, 0x43, 0x36, 0x55, 0x85, 0x59, 0x55, 0xa5, 0x6a, 0x56, 0xb6, 0x7b, 0x56, 0xb5, 0x6b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 
+				0x78, 0xc7, 0x8c, 0x88, 0xc8, 0x8d, 0x89, 0xd8, 0x8d, 0x89, 0xd9, 0x9d, 0x99, 0xd9, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
+				0x9a, 0xea, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xd7, 0x9d, 0x78, 0xd7, 0x8d, 
+				0x68, 0xc6, 0x8c, 0x67, 0xc5, 0x7c, 0x57, 0xc5, 0x7c, 0x57, 0xc4, 0x7c, 0x46, 0xb3, 0x6a, 0x35, 0x92, 0x48, 0x13, 0x61, 0x25, 0x12, 0x41, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x42, 0x34, 0x33, 0x53, 0x45, 0x99, 0xaf, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0x8b, 0x24, 0x51, 0x34, 0x22, 0x42, 0x24, 
+				0x22, 0x32, 0x23, 0x11, 0x20, 0x12, 0x01, 0x20, 0x13, 0x22, 0x43, 0x47, 0x55, 0x95, 0x5a, 0x56, 0xa5, 0x6a, 0x56, 0xb5, 0x6b, 0x56, 0xb6, 0x6b, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x7b, 0x78, 0xc7, 0x8c, 0x88, 0xc8, 0x8c, 0x88, 0xc8, 0x8d, 0x88, 0xd8, 0x9d, 0x99, 0xd9, 0x9d, 0x9a, 0xe9, 0xae, 
+				0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xea, 0xbe, 0xab, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0xae, 0x8a, 0xe8, 0x9d, 
+				0x79, 0xd7, 0x9d, 0x79, 0xd6, 0x8d, 0x68, 0xd6, 0x8c, 0x67, 0xc6, 0x7d, 0x67, 0xd5, 0x7d, 0x57, 0xd4, 0x7c, 0x47, 0xc4, 0x6b, 0x35, 0xa3, 0x59, 
+				0x24, 0x72, 0x36, 0x12, 0x51, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x22, 0x43, 0x34, 0x33, 0x43, 0x45, 
+				0x99, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xe6, 0x79, 
+				0x23, 0x51, 0x34, 0x12, 0x41, 0x23, 0x12, 0x31, 0x23, 0x11, 0x20, 0x12, 0x01, 0x21, 0x13, 0x23, 0x54, 0x58, 0x55, 0x95, 0x6a, 0x56, 0xa5, 0x6a, 
+				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa6, 0x6a, 0x66, 0xa6, 0x7a, 0x77, 0xb7, 0x7b, 0x78, 0xb7, 0x8c, 0x78, 0xb7, 0x8b, 0x88, 0xc8, 0x8c, 
+				0x89, 0xd9, 0x9d, 0x9a, 0xd9, 0xae, 0xaa, 0xea, 0xae, 0x9a, 0xe9, 0xae, 0xaa, 0xea, 0xbe, 0xab, 0xe9, 0xbe, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9d, 
+				0x89, 0xd8, 0x9d, 0x89, 0xd7, 0x9d, 0x79, 0xd7, 0x9d, 0x79, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x7c, 0x68, 0xd5, 0x7d, 0x57, 0xd5, 0x7d, 
+				0x57, 0xc4, 0x6c, 0x46, 0xb4, 0x6a, 0x35, 0x92, 0x47, 0x12, 0x51, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
+				0x22, 0x42, 0x34, 0x33, 0x43, 0x45, 0x99, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xbc, 0xe5, 0x68, 0x23, 0x51, 0x24, 0x12, 0x41, 0x23, 0x12, 0x32, 0x23, 0x11, 0x20, 0x12, 0x01, 0x21, 0x14, 0x34, 0x65, 0x59, 
+				0x46, 0x94, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x59, 0x55, 0x95, 0x58, 0x55, 0x85, 0x58, 0x55, 0x85, 0x58, 0x55, 0x85, 0x69, 0x66, 0x96, 0x6a, 
+				0x77, 0xa6, 0x7a, 0x77, 0xa7, 0x8b, 0x88, 0xc8, 0x9d, 0x9a, 0xd9, 0xae, 0xaa, 0xea, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xea, 0xbe, 0xab, 0xe9, 0xae, 
+				0x9a, 0xe9, 0xae, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x79, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x79, 0xd7, 0x8d, 0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x7c, 
+				0x67, 0xd6, 0x8d, 0x68, 0xd5, 0x7d, 0x57, 0xd4, 0x7c, 0x46, 0xc4, 0x6b, 0x35, 0xa2, 0x47, 0x12, 0x50, 0x24, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 
+				0x12, 0x31, 0x23, 0x12, 0x21, 0x23, 0x22, 0x42, 0x34, 0x23, 0x43, 0x45, 0x99, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0xd5, 0x67, 0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x22, 0x32, 0x23, 0x12, 0x20, 0x12, 
+				0x01, 0x21, 0x24, 0x45, 0x75, 0x59, 0x56, 0xa5, 0x6a, 0x56, 0x94, 0x59, 0x44, 0x84, 0x48, 0x44, 0x84, 0x47, 0x34, 0x73, 0x47, 0x44, 0x74, 0x47, 
+				0x44, 0x75, 0x57, 0x55, 0x85, 0x58, 0x66, 0x96, 0x6a, 0x77, 0xa7, 0x7b, 0x77, 0xb7, 0x8b, 0x89, 0xd9, 0xad, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
+				0x9a, 0xea, 0xbe, 0xab, 0xe9, 0xae, 0x9a, 0xe8, 0x9d, 0x88, 0xd8, 0x8d, 0x78, 0xc7, 0x8c, 0x78, 0xb7, 0x8b, 0x78, 0xc7, 0x8c, 0x79, 0xd7, 0x8c, 
+				0x78, 0xc6, 0x8c, 0x68, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x68, 0xd6, 0x8d, 0x57, 0xd5, 0x7c, 0x57, 0xc4, 0x6b, 0x46, 0xa3, 0x58, 0x13, 0x60, 0x24, 
+				0x12, 0x32, 0x34, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x11, 0x21, 0x23, 0x22, 0x42, 0x34, 0x23, 0x44, 0x45, 0xaa, 0xbf, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xd4, 0x57, 0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 
+				0x12, 0x32, 0x23, 0x12, 0x20, 0x12, 0x01, 0x32, 0x35, 0x55, 0x85, 0x69, 0x56, 0xa4, 0x59, 0x34, 0x83, 0x37, 0x34, 0x74, 0x47, 0x44, 0x74, 0x58, 
+				0x45, 0x84, 0x57, 0x44, 0x74, 0x47, 0x44, 0x74, 0x57, 0x55, 0x85, 0x58, 0x66, 0x96, 0x6a, 0x77, 0xa7, 0x7b, 0x77, 0xb7, 0x7b, 0x89, 0xc9, 0x9d, 
+				0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xad, 0x9a, 0xea, 0xbe, 0x9b, 0xe9, 0xae, 0x89, 0xd8, 0x8d, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x7b, 0x67, 0xa6, 0x7a, 
+				0x66, 0xa6, 0x6a, 0x67, 0xa6, 0x7a, 0x77, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x56, 0xb5, 0x7b, 0x67, 0xc6, 0x8d, 0x67, 0xd5, 0x7d, 0x57, 0xc5, 0x7b, 
+				0x46, 0xb3, 0x59, 0x13, 0x60, 0x24, 0x12, 0x32, 0x34, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x11, 0x21, 0x23, 0x22, 0x32, 0x24, 0x23, 0x43, 0x45, 
+				0xaa, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xc4, 0x56, 
+				0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x22, 0x32, 0x23, 0x12, 0x21, 0x12, 0x12, 0x43, 0x46, 0x56, 0x95, 0x6a, 0x45, 0x93, 0x48, 0x33, 0x74, 0x47, 
+				0x55, 0x85, 0x59, 0x55, 0x95, 0x69, 0x66, 0xa6, 0x7a, 0x67, 0xa6, 0x69, 0x66, 0x95, 0x69, 0x56, 0x96, 0x69, 0x66, 0x96, 0x7a, 0x67, 0xa7, 0x7b, 
+				0x77, 0xb7, 0x8b, 0x78, 0xc8, 0x9d, 0x9a, 0xd9, 0xad, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9d, 0x78, 0xd7, 0x8c, 0x78, 0xc7, 0x8c, 
+				0x78, 0xb6, 0x7b, 0x66, 0xa5, 0x69, 0x45, 0x74, 0x47, 0x44, 0x75, 0x58, 0x56, 0x96, 0x6a, 0x56, 0x95, 0x69, 0x56, 0xa5, 0x6a, 0x56, 0xb5, 0x7c, 
+				0x68, 0xd5, 0x7d, 0x57, 0xc5, 0x7c, 0x46, 0xb4, 0x59, 0x24, 0x60, 0x24, 0x02, 0x32, 0x34, 0x12, 0x31, 0x23, 0x12, 0x31, 0x22, 0x01, 0x21, 0x23, 
+				0x12, 0x32, 0x23, 0x23, 0x43, 0x34, 0x77, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0x9a, 0xc4, 0x56, 0x12, 0x41, 0x24, 0x12, 0x31, 0x23, 0x22, 0x32, 0x23, 0x12, 0x31, 0x13, 0x22, 0x54, 0x58, 0x56, 0xa5, 0x6a, 
+				0x45, 0x93, 0x48, 0x44, 0x85, 0x59, 0x55, 0x96, 0x6a, 0x67, 0xa7, 0x7b, 0x77, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x7b, 0x67, 0xa6, 0x7a, 
+				0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x7b, 0x77, 0xb7, 0x8b, 0x78, 0xc8, 0x9d, 0x89, 0xd9, 0xad, 0x9a, 0xd9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9d, 
+				0x78, 0xd7, 0x8c, 0x78, 0xc7, 0x8c, 0x77, 0xb6, 0x7b, 0x66, 0xa5, 0x69, 0x45, 0x84, 0x47, 0x44, 0x73, 0x47, 0x34, 0x64, 0x47, 0x45, 0x84, 0x59, 
+				0x45, 0x95, 0x6a, 0x56, 0xa5, 0x6a, 0x57, 0xc5, 0x7c, 0x57, 0xc5, 0x7c, 0x56, 0xb4, 0x6a, 0x24, 0x70, 0x25, 0x02, 0x32, 0x34, 0x12, 0x31, 0x23, 
+				0x12, 0x30, 0x12, 0x01, 0x21, 0x23, 0x12, 0x32, 0x23, 0x22, 0x43, 0x34, 0x55, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xd4, 0x57, 0x12, 0x41, 0x24, 0x12, 0x42, 0x23, 0x22, 0x32, 0x23, 0x12, 0x31, 0x13, 
+				0x24, 0x55, 0x69, 0x56, 0xa5, 0x6a, 0x45, 0x94, 0x59, 0x56, 0xa6, 0x6a, 0x66, 0xa6, 0x6a, 0x67, 0xb7, 0x7b, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8b, 
+				0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x7b, 0x77, 0xb6, 0x7a, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x9c, 0x89, 0xd8, 0xad, 0x9a, 0xd9, 0xae, 
+				0x9a, 0xe9, 0xae, 0x8a, 0xe8, 0x9d, 0x78, 0xd7, 0x8c, 0x68, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7a, 0x67, 0xa6, 0x6a, 0x66, 0x95, 0x69, 
+				0x55, 0x85, 0x58, 0x45, 0x84, 0x58, 0x45, 0x95, 0x6a, 0x56, 0xa4, 0x5a, 0x56, 0xa5, 0x6b, 0x57, 0xc5, 0x7c, 0x56, 0xb4, 0x6a, 0x34, 0x70, 0x25, 
+				0x02, 0x42, 0x34, 0x12, 0x31, 0x23, 0x12, 0x30, 0x12, 0x01, 0x21, 0x23, 0x12, 0x32, 0x23, 0x22, 0x42, 0x34, 0x44, 0x5c, 0xcd, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfb, 0xce, 0x8a, 0xd4, 0x68, 0x12, 0x51, 0x24, 0x12, 0x32, 0x23, 
+				0x22, 0x32, 0x23, 0x12, 0x31, 0x24, 0x45, 0x75, 0x6a, 0x57, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x7b, 
+				0x78, 0xb7, 0x7b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x77, 0xb7, 0x7a, 0x77, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x8c, 
+				0x89, 0xd8, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x8a, 0xe7, 0x9d, 0x78, 0xd6, 0x8c, 0x68, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x7b, 
+				0x77, 0xb7, 0x8b, 0x88, 0xc8, 0x8c, 0x88, 0xc7, 0x8c, 0x67, 0xb6, 0x7a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x45, 0x94, 0x59, 0x46, 0xb5, 0x7c, 
+				0x56, 0xb4, 0x6a, 0x35, 0x80, 0x25, 0x02, 0x42, 0x34, 0x12, 0x31, 0x23, 0x12, 0x20, 0x12, 0x12, 0x21, 0x23, 0x12, 0x31, 0x23, 0x22, 0x42, 0x34, 
+				0x44, 0x59, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xe8, 0x9d, 0x79, 0xc5, 0x68, 
+				0x12, 0x51, 0x24, 0x12, 0x42, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x24, 0x56, 0x85, 0x7a, 0x57, 0xb5, 0x6a, 0x56, 0xa5, 0x6a, 0x57, 0xb6, 0x7b, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7a, 0x66, 0xa6, 0x69, 0x66, 0x96, 0x69, 0x66, 0x96, 0x69, 0x66, 0x96, 0x69, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x7a, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x8c, 0x79, 0xd8, 0x9d, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0xae, 0x8a, 0xe7, 0x9d, 0x78, 0xd6, 0x8c, 0x68, 0xc6, 0x8c, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x88, 0xc8, 0x9c, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x78, 0xd6, 0x7c, 0x67, 0xb6, 0x6b, 
+				0x56, 0xa4, 0x5a, 0x45, 0xa5, 0x6b, 0x57, 0xc5, 0x7b, 0x45, 0x91, 0x36, 0x02, 0x42, 0x34, 0x13, 0x31, 0x23, 0x12, 0x20, 0x12, 0x12, 0x21, 0x23, 
+				0x12, 0x31, 0x24, 0x22, 0x43, 0x34, 0x55, 0x68, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 
+				0x89, 0xd7, 0x8d, 0x67, 0xc5, 0x69, 0x23, 0x61, 0x24, 0x12, 0x42, 0x23, 0x12, 0x31, 0x23, 0x12, 0x32, 0x35, 0x66, 0x96, 0x7b, 0x57, 0xb5, 0x7b, 
+				0x56, 0xb5, 0x7b, 0x57, 0xb5, 0x7b, 0x56, 0xa6, 0x6a, 0x56, 0x95, 0x58, 0x55, 0x75, 0x58, 0x66, 0x86, 0x68, 0x66, 0x86, 0x68, 0x66, 0x85, 0x58, 
+				0x56, 0x85, 0x69, 0x66, 0xa6, 0x6a, 0x66, 0xa5, 0x6a, 0x67, 0xb6, 0x7c, 0x78, 0xc8, 0x9d, 0x89, 0xe9, 0xae, 0x8a, 0xe8, 0xae, 0x89, 0xe7, 0x9d, 
+				0x68, 0xd6, 0x8c, 0x67, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x7b, 0x78, 0xb7, 0x8b, 0x78, 0xb8, 0x9c, 0x89, 0xc8, 0x9d, 0x89, 0xd8, 0x9d, 
+				0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x7c, 0x67, 0xb5, 0x6a, 0x45, 0xa5, 0x6b, 0x57, 0xc5, 0x7c, 0x56, 0xa2, 0x46, 0x02, 0x42, 0x34, 0x23, 0x41, 0x23, 
+				0x12, 0x30, 0x12, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x43, 0x35, 0x55, 0x68, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xd6, 0x7d, 0x67, 0xd6, 0x6b, 0x34, 0x71, 0x25, 0x12, 0x42, 0x24, 0x12, 0x31, 0x23, 0x12, 0x44, 0x57, 
+				0x67, 0xa6, 0x7b, 0x57, 0xb5, 0x7b, 0x57, 0xb5, 0x7b, 0x56, 0xb5, 0x6a, 0x56, 0x94, 0x58, 0x45, 0x85, 0x58, 0x55, 0x73, 0x36, 0x34, 0x53, 0x35, 
+				0x33, 0x53, 0x35, 0x44, 0x65, 0x57, 0x66, 0x85, 0x58, 0x55, 0x85, 0x69, 0x56, 0x95, 0x69, 0x56, 0xa6, 0x7b, 0x78, 0xc7, 0x9d, 0x89, 0xe9, 0xae, 
+				0x8a, 0xe8, 0x9e, 0x79, 0xd6, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x6a, 0x66, 0xa5, 0x69, 0x56, 0x96, 0x69, 0x66, 0x96, 0x7a, 
+				0x77, 0xa7, 0x8c, 0x89, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x67, 0xd6, 0x7c, 0x56, 0xb4, 0x6b, 0x57, 0xc6, 0x7c, 0x57, 0xb3, 0x58, 
+				0x02, 0x41, 0x24, 0x23, 0x41, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x23, 0x12, 0x31, 0x24, 0x22, 0x43, 0x35, 0x55, 0x69, 0x9b, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xd6, 0x7d, 0x66, 0xd6, 0x6c, 0x45, 0x81, 0x25, 0x12, 0x42, 0x24, 
+				0x12, 0x31, 0x23, 0x22, 0x55, 0x68, 0x67, 0xb6, 0x7c, 0x67, 0xb5, 0x7b, 0x57, 0xb5, 0x7b, 0x56, 0xa5, 0x69, 0x45, 0x84, 0x47, 0x44, 0x73, 0x35, 
+				0x21, 0x41, 0x13, 0x00, 0x21, 0x02, 0x10, 0x21, 0x13, 0x11, 0x43, 0x35, 0x55, 0x75, 0x58, 0x55, 0x85, 0x59, 0x55, 0x95, 0x59, 0x56, 0xa6, 0x7b, 
+				0x67, 0xc7, 0x8d, 0x89, 0xe8, 0xae, 0x8a, 0xe7, 0x9e, 0x78, 0xd6, 0x8d, 0x67, 0xc5, 0x7b, 0x57, 0xb5, 0x7b, 0x56, 0xa5, 0x58, 0x55, 0x85, 0x58, 
+				0x55, 0x75, 0x58, 0x66, 0x86, 0x68, 0x66, 0x96, 0x69, 0x66, 0xa6, 0x7b, 0x68, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xc5, 0x6b, 
+				0x57, 0xc6, 0x7c, 0x67, 0xc5, 0x6a, 0x12, 0x51, 0x24, 0x23, 0x41, 0x23, 0x12, 0x31, 0x23, 0x22, 0x41, 0x24, 0x12, 0x41, 0x24, 0x12, 0x42, 0x35, 
+				0x66, 0x7c, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xd6, 0x7d, 0x67, 0xd6, 0x6b, 
+				0x55, 0x91, 0x25, 0x12, 0x42, 0x34, 0x12, 0x31, 0x23, 0x23, 0x56, 0x69, 0x67, 0xb6, 0x7c, 0x67, 0xb5, 0x7b, 0x57, 0xb5, 0x6b, 0x56, 0xa4, 0x59, 
+				0x45, 0x83, 0x36, 0x22, 0x53, 0x36, 0x33, 0x51, 0x13, 0x10, 0x33, 0x35, 0x55, 0x61, 0x13, 0x22, 0x46, 0x67, 0x66, 0x85, 0x57, 0x55, 0x85, 0x58, 
+				0x55, 0x94, 0x59, 0x56, 0xa5, 0x6a, 0x67, 0xc7, 0x8d, 0x79, 0xd7, 0x9e, 0x79, 0xe7, 0x8d, 0x68, 0xd6, 0x7c, 0x57, 0xc5, 0x6b, 0x56, 0xb5, 0x6a, 
+				0x55, 0x95, 0x58, 0x55, 0x74, 0x56, 0x33, 0x52, 0x25, 0x23, 0x53, 0x35, 0x55, 0x65, 0x57, 0x55, 0x85, 0x69, 0x66, 0xa6, 0x7b, 0x67, 0xc6, 0x8d, 
+				0x68, 0xd6, 0x8d, 0x67, 0xd6, 0x7d, 0x67, 0xc6, 0x8d, 0x68, 0xd6, 0x7b, 0x23, 0x61, 0x24, 0x23, 0x42, 0x24, 0x22, 0x41, 0x23, 0x22, 0x42, 0x24, 
+				0x22, 0x41, 0x24, 0x12, 0x43, 0x46, 0x89, 0xbe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xce, 
+				0x78, 0xd7, 0x7d, 0x67, 0xd6, 0x6b, 0x56, 0xa2, 0x36, 0x12, 0x42, 0x34, 0x12, 0x31, 0x24, 0x34, 0x66, 0x7a, 0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x7b, 
+				0x57, 0xb5, 0x6a, 0x56, 0xa3, 0x58, 0x33, 0x72, 0x25, 0x44, 0x67, 0x79, 0x66, 0x71, 0x13, 0x11, 0x22, 0x34, 0x54, 0x51, 0x12, 0x22, 0x48, 0x89, 
+				0x99, 0xb6, 0x69, 0x55, 0x85, 0x59, 0x55, 0x94, 0x59, 0x55, 0xa5, 0x6a, 0x67, 0xb6, 0x7d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xd5, 0x7c, 
+				0x57, 0xb5, 0x6b, 0x57, 0xb5, 0x6a, 0x56, 0x95, 0x57, 0x55, 0x65, 0x66, 0x22, 0x41, 0x12, 0x11, 0x21, 0x12, 0x01, 0x21, 0x13, 0x23, 0x54, 0x57, 
+				0x66, 0x95, 0x69, 0x56, 0xb6, 0x7c, 0x67, 0xd6, 0x8d, 0x68, 0xd6, 0x7d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x7c, 0x34, 0x70, 0x14, 0x22, 0x42, 0x34, 
+				0x23, 0x42, 0x24, 0x22, 0x42, 0x24, 0x12, 0x41, 0x24, 0x23, 0x55, 0x58, 0x99, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xfa, 0xce, 0x78, 0xd7, 0x7d, 0x67, 0xd6, 0x6b, 0x66, 0xa3, 0x47, 0x22, 0x52, 0x34, 0x12, 0x31, 0x24, 0x34, 0x66, 0x7a, 
+				0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x7b, 0x57, 0xb5, 0x6a, 0x45, 0x92, 0x47, 0x22, 0x63, 0x36, 0x54, 0x76, 0x68, 0x66, 0x82, 0x24, 0x11, 0x21, 0x12, 
+				0x11, 0x21, 0x13, 0x33, 0x47, 0x78, 0x77, 0x96, 0x69, 0x45, 0x85, 0x69, 0x55, 0x94, 0x59, 0x45, 0xa5, 0x6a, 0x56, 0xb6, 0x7d, 0x68, 0xd6, 0x8e, 
+				0x68, 0xd6, 0x7d, 0x57, 0xd5, 0x7c, 0x57, 0xb5, 0x6b, 0x67, 0xb5, 0x6a, 0x55, 0x96, 0x68, 0x88, 0xa8, 0x8a, 0x22, 0x41, 0x12, 0x54, 0x54, 0x45, 
+				0x00, 0x20, 0x13, 0x11, 0x42, 0x25, 0x44, 0x75, 0x59, 0x56, 0xa6, 0x6b, 0x67, 0xc6, 0x7d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
+				0x45, 0x90, 0x14, 0x22, 0x42, 0x34, 0x23, 0x42, 0x34, 0x23, 0x41, 0x24, 0x12, 0x41, 0x25, 0x56, 0x97, 0x7b, 0x78, 0xcb, 0xce, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0x89, 0xd7, 0x8d, 0x77, 0xd6, 0x6b, 0x67, 0xb5, 0x69, 0x23, 0x62, 0x35, 
+				0x22, 0x41, 0x24, 0x45, 0x76, 0x7b, 0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x7c, 0x57, 0xb5, 0x6b, 0x46, 0xa3, 0x58, 0x45, 0x95, 0x59, 0x55, 0x85, 0x58, 
+				0x55, 0x73, 0x46, 0x22, 0x53, 0x35, 0x44, 0x63, 0x46, 0x55, 0x76, 0x68, 0x66, 0x85, 0x69, 0x56, 0x95, 0x69, 0x55, 0x94, 0x59, 0x45, 0xa4, 0x5a, 
+				0x56, 0xb6, 0x7d, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x7d, 0x57, 0xd5, 0x7c, 0x57, 0xc5, 0x7b, 0x67, 0xb5, 0x6a, 0x45, 0x85, 0x69, 0x78, 0xa7, 0x8a, 
+				0x22, 0x40, 0x03, 0x22, 0x42, 0x24, 0x00, 0x30, 0x13, 0x44, 0x64, 0x47, 0x12, 0x53, 0x47, 0x56, 0xa5, 0x6b, 0x67, 0xc6, 0x7d, 0x68, 0xd6, 0x8d, 
+				0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x56, 0xa0, 0x25, 0x12, 0x42, 0x34, 0x23, 0x42, 0x34, 0x23, 0x51, 0x25, 0x12, 0x55, 0x58, 0x78, 0xd7, 0x8d, 
+				0x78, 0xd8, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0x89, 0xd8, 0x8d, 0x77, 0xd6, 0x6b, 
+				0x67, 0xb6, 0x7b, 0x45, 0x72, 0x35, 0x22, 0x42, 0x24, 0x45, 0x76, 0x7b, 0x67, 0xc6, 0x8c, 0x67, 0xc6, 0x7c, 0x57, 0xc5, 0x7b, 0x57, 0xb5, 0x6b, 
+				0x56, 0xa5, 0x6a, 0x66, 0xa6, 0x6a, 0x66, 0x96, 0x69, 0x66, 0x96, 0x79, 0x77, 0xa7, 0x7a, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 
+				0x45, 0x94, 0x59, 0x45, 0xa4, 0x5a, 0x67, 0xc6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe5, 0x7d, 0x57, 0xd5, 0x7c, 0x57, 0xc5, 0x7c, 0x67, 0xc6, 0x7b, 
+				0x66, 0xa6, 0x69, 0x56, 0x85, 0x57, 0x33, 0x51, 0x24, 0x23, 0x51, 0x13, 0x01, 0x31, 0x24, 0x66, 0x85, 0x58, 0x22, 0x51, 0x25, 0x44, 0x85, 0x6a, 
+				0x67, 0xc6, 0x7d, 0x67, 0xd6, 0x8d, 0x68, 0xe6, 0x8e, 0x68, 0xe7, 0x8d, 0x56, 0xb1, 0x25, 0x12, 0x42, 0x35, 0x23, 0x52, 0x35, 0x22, 0x51, 0x25, 
+				0x44, 0x86, 0x7c, 0x67, 0xd6, 0x7d, 0x67, 0xd8, 0x8d, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 
+				0x89, 0xd8, 0x8d, 0x78, 0xd6, 0x6b, 0x67, 0xc7, 0x7b, 0x66, 0x93, 0x36, 0x23, 0x52, 0x35, 0x45, 0x76, 0x8b, 0x68, 0xc6, 0x8c, 0x67, 0xc6, 0x7c, 
+				0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x66, 0xb6, 0x6b, 0x67, 0xb6, 0x7b, 0x77, 0xb7, 0x7b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x77, 0xb6, 0x7b, 
+				0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x5a, 0x45, 0x94, 0x59, 0x45, 0xa5, 0x6c, 0x67, 0xd6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe5, 0x7e, 0x57, 0xd5, 0x7c, 
+				0x57, 0xc5, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xb6, 0x7a, 0x67, 0xa6, 0x69, 0x66, 0x96, 0x69, 0x66, 0x84, 0x56, 0x34, 0x64, 0x47, 0x55, 0x85, 0x58, 
+				0x55, 0x84, 0x47, 0x44, 0x85, 0x5a, 0x56, 0xb6, 0x7d, 0x68, 0xd6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8d, 0x67, 0xb2, 0x36, 0x12, 0x42, 0x35, 
+				0x23, 0x52, 0x35, 0x22, 0x53, 0x46, 0x67, 0xb7, 0x8d, 0x67, 0xd6, 0x6d, 0x67, 0xd7, 0x7d, 0xaa, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xde, 0xfa, 0xad, 0x89, 0xd8, 0x8d, 0x78, 0xd6, 0x6b, 0x77, 0xc7, 0x8c, 0x77, 0xb3, 0x47, 0x23, 0x52, 0x35, 0x45, 0x87, 0x8b, 
+				0x68, 0xc6, 0x8c, 0x67, 0xc6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7b, 0x67, 0xc7, 0x7b, 0x78, 0xb7, 0x7b, 
+				0x77, 0xb6, 0x7b, 0x67, 0xa6, 0x7b, 0x67, 0xa5, 0x6a, 0x56, 0xa4, 0x5a, 0x45, 0xa4, 0x5a, 0x56, 0xb5, 0x7c, 0x67, 0xd6, 0x8e, 0x68, 0xe6, 0x8e, 
+				0x68, 0xe5, 0x8e, 0x57, 0xd5, 0x7d, 0x57, 0xc5, 0x7c, 0x57, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xa6, 0x7a, 0x77, 0xb8, 0x8b, 0x78, 0xb7, 0x8b, 
+				0x77, 0xa6, 0x7a, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x56, 0xa5, 0x6b, 0x56, 0xb6, 0x7d, 0x68, 0xd6, 0x8e, 0x68, 0xe6, 0x8e, 0x78, 0xe6, 0x8e, 
+				0x67, 0xc2, 0x47, 0x12, 0x52, 0x35, 0x23, 0x52, 0x35, 0x34, 0x66, 0x7a, 0x89, 0xd7, 0x8e, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x7d, 0xaa, 0xef, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf9, 0xad, 0x88, 0xd8, 0x8d, 0x77, 0xd6, 0x6b, 0x77, 0xc7, 0x8d, 0x77, 0xb4, 0x47, 
+				0x23, 0x62, 0x35, 0x45, 0x87, 0x8b, 0x78, 0xc6, 0x8c, 0x67, 0xc6, 0x7d, 0x67, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8d, 0x68, 0xd6, 0x7c, 
+				0x67, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb5, 0x6a, 0x56, 0xa4, 0x5a, 0x45, 0xa4, 0x5b, 0x56, 0xc5, 0x7d, 
+				0x67, 0xe6, 0x8e, 0x79, 0xe6, 0x9e, 0x68, 0xe5, 0x8e, 0x58, 0xe5, 0x7d, 0x57, 0xd5, 0x7c, 0x57, 0xc6, 0x7c, 0x67, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 
+				0x67, 0xb7, 0x7b, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x77, 0xc6, 0x7c, 0x67, 0xc6, 0x7d, 0x67, 0xd6, 0x7d, 0x57, 0xd6, 0x7d, 0x68, 0xe6, 0x8e, 
+				0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x67, 0xc3, 0x47, 0x22, 0x52, 0x35, 0x23, 0x52, 0x35, 0x55, 0x88, 0xae, 0x8a, 0xe7, 0x8e, 0x67, 0xd6, 0x7d, 
+				0x77, 0xe7, 0x7d, 0x99, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xce, 0x99, 0xd8, 0x8d, 0x77, 0xd6, 0x7b, 
+				0x78, 0xd8, 0x8d, 0x77, 0xb5, 0x58, 0x23, 0x62, 0x36, 0x55, 0x87, 0x8c, 0x78, 0xc6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
+				0x68, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb5, 0x6b, 0x56, 0xa4, 0x5a, 
+				0x45, 0xb5, 0x6b, 0x56, 0xc5, 0x7d, 0x68, 0xe7, 0x9e, 0x79, 0xf7, 0x9f, 0x69, 0xf6, 0x8e, 0x68, 0xe5, 0x8e, 0x68, 0xd5, 0x7d, 0x67, 0xd6, 0x7c, 
+				0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xb7, 0x7c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 
+				0x68, 0xd6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x67, 0xc3, 0x47, 0x22, 0x53, 0x35, 0x23, 0x53, 0x46, 0x67, 0xa8, 0x9e, 
+				0x89, 0xe7, 0x8e, 0x67, 0xd6, 0x7d, 0x87, 0xe7, 0x7d, 0x99, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xab, 0xe8, 0x8d, 0x77, 0xd6, 0x7b, 0x88, 0xd8, 0x9d, 0x78, 0xc6, 0x6a, 0x34, 0x62, 0x36, 0x55, 0x87, 0x8c, 0x78, 0xc6, 0x8c, 0x68, 0xd6, 0x7d, 
+				0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 
+				0x67, 0xb5, 0x6b, 0x56, 0xa5, 0x6b, 0x56, 0xb5, 0x6b, 0x56, 0xc6, 0x8e, 0x79, 0xe7, 0x9f, 0x79, 0xf7, 0xaf, 0x69, 0xf6, 0x9e, 0x68, 0xe6, 0x8e, 
+				0x68, 0xe6, 0x8d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x8d, 0x68, 0xd6, 0x7c, 0x67, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x67, 0xd6, 0x8d, 
+				0x68, 0xd6, 0x8d, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x67, 0xc2, 0x47, 0x22, 0x52, 0x35, 
+				0x23, 0x55, 0x58, 0x78, 0xc8, 0x9e, 0x89, 0xe7, 0x8e, 0x67, 0xd7, 0x7d, 0x77, 0xe7, 0x7d, 0xaa, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf8, 0x9d, 0x77, 0xd6, 0x7b, 0x88, 0xd8, 0x9d, 0x78, 0xc7, 0x7b, 0x55, 0x82, 0x36, 0x55, 0x87, 0x8c, 
+				0x78, 0xc6, 0x8c, 0x67, 0xc6, 0x7d, 0x68, 0xd6, 0x8d, 0x68, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
+				0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x6b, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x57, 0xd6, 0x8e, 0x79, 0xe7, 0x9f, 0x69, 0xf7, 0xaf, 
+				0x69, 0xf6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x67, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 
+				0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 0x68, 0xe6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 
+				0x57, 0xb2, 0x47, 0x23, 0x52, 0x35, 0x23, 0x66, 0x6a, 0x89, 0xd8, 0xae, 0x79, 0xe7, 0x8e, 0x67, 0xd7, 0x7d, 0x77, 0xd8, 0x7d, 0xba, 0xef, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xad, 0x78, 0xd6, 0x7c, 0x78, 0xd8, 0x9d, 0x78, 0xc8, 0x9d, 
+				0x77, 0xb3, 0x46, 0x55, 0x87, 0x8c, 0x78, 0xc6, 0x8c, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x8d, 0x68, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
+				0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd7, 0x8d, 0x68, 0xd6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x6b, 0x56, 0xb5, 0x6c, 0x67, 0xd7, 0x9e, 
+				0x79, 0xf7, 0x9f, 0x79, 0xf7, 0xaf, 0x7a, 0xf6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8d, 
+				0x68, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 0x68, 0xe6, 0x9e, 0x69, 0xe6, 0x9e, 
+				0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8d, 0x56, 0xb2, 0x37, 0x23, 0x52, 0x36, 0x45, 0x86, 0x6a, 0x78, 0xd8, 0x9e, 0x89, 0xe7, 0x8e, 0x67, 0xd7, 0x7d, 
+				0x87, 0xd8, 0x8d, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0x88, 0xd7, 0x7c, 
+				0x78, 0xd7, 0x8d, 0x77, 0xc8, 0x8d, 0x89, 0xd5, 0x58, 0x55, 0x87, 0x8c, 0x78, 0xd7, 0x8d, 0x67, 0xd6, 0x7c, 0x67, 0xd6, 0x8d, 0x68, 0xd7, 0x8e, 
+				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x7c, 0x67, 0xc5, 0x6b, 
+				0x56, 0xb5, 0x7c, 0x68, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xf7, 0xaf, 0x7a, 0xf6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x79, 0xe7, 0x9e, 
+				0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x79, 0xe7, 0x9e, 0x79, 0xe6, 0x9e, 
+				0x68, 0xe6, 0x8e, 0x69, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8d, 0x56, 0xa2, 0x37, 0x23, 0x64, 0x57, 0x77, 0xb7, 0x7c, 0x78, 0xd7, 0x8e, 
+				0x89, 0xe7, 0x8e, 0x67, 0xd7, 0x7d, 0x88, 0xd9, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xfe, 0xff, 0x99, 0xd7, 0x7c, 0x77, 0xd7, 0x8c, 0x67, 0xb7, 0x7b, 0x89, 0xd6, 0x7a, 0x55, 0x97, 0x8c, 0x78, 0xd7, 0x8d, 0x67, 0xc6, 0x7c, 
+				0x67, 0xd6, 0x7d, 0x68, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xd7, 0x8d, 
+				0x78, 0xd7, 0x8d, 0x67, 0xc5, 0x6b, 0x56, 0xb6, 0x7d, 0x78, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xf7, 0xaf, 0x7a, 0xf6, 0x9e, 0x69, 0xe6, 0x8e, 
+				0x68, 0xe6, 0x8e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
+				0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x69, 0xe6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x79, 0xe6, 0x8d, 0x56, 0xa2, 0x37, 0x33, 0x67, 0x7b, 
+				0x9a, 0xe8, 0x9d, 0x78, 0xd8, 0x9e, 0x89, 0xe7, 0x8e, 0x67, 0xd7, 0x7d, 0x88, 0xdb, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xe7, 0x8c, 0x77, 0xd8, 0x8d, 0x77, 0xc6, 0x6b, 0x77, 0xb6, 0x7a, 0x56, 0x97, 0x8c, 
+				0x78, 0xd7, 0x8d, 0x67, 0xc6, 0x7d, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x7d, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe8, 0x9e, 
+				0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xd7, 0x8d, 0x67, 0xb5, 0x6b, 0x67, 0xc6, 0x8d, 0x78, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x8a, 0xf8, 0xaf, 
+				0x7a, 0xf6, 0x9e, 0x69, 0xe6, 0x8e, 0x57, 0xd6, 0x8e, 0x79, 0xe7, 0x9e, 0x8a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 
+				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe6, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x78, 0xe6, 0x8d, 
+				0x45, 0x92, 0x37, 0x55, 0x89, 0xae, 0xab, 0xe9, 0x9e, 0x88, 0xd8, 0x9e, 0x8a, 0xe7, 0x8e, 0x67, 0xd8, 0x8d, 0x99, 0xee, 0xef, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf8, 0x8d, 0x77, 0xc7, 0x8d, 0x77, 0xc7, 0x7b, 
+				0x67, 0xb6, 0x6a, 0x55, 0x96, 0x7b, 0x78, 0xd7, 0x8c, 0x67, 0xc6, 0x7c, 0x67, 0xd6, 0x7d, 0x67, 0xd7, 0x7d, 0x77, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 
+				0x78, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe6, 0x7c, 0x56, 0xb5, 0x6b, 0x67, 0xd6, 0x8d, 0x78, 0xd7, 0x9e, 
+				0x89, 0xe8, 0xae, 0x8a, 0xf8, 0xaf, 0x79, 0xe7, 0x9e, 0x69, 0xe6, 0x8e, 0x67, 0xd6, 0x7d, 0x78, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0x9e, 
+				0x89, 0xe8, 0x9e, 0x79, 0xe8, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x79, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 
+				0x68, 0xe6, 0x8e, 0x78, 0xe6, 0x8d, 0x45, 0x93, 0x47, 0x77, 0xc9, 0xae, 0xaa, 0xe9, 0x9e, 0x78, 0xd8, 0x8e, 0x89, 0xe7, 0x8e, 0x77, 0xd8, 0x8d, 
+				0xbb, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbe, 
+				0x78, 0xc7, 0x7d, 0x77, 0xc7, 0x8d, 0x88, 0xd7, 0x7c, 0x56, 0x96, 0x7b, 0x78, 0xd7, 0x8c, 0x67, 0xc6, 0x7c, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x7d, 
+				0x78, 0xe7, 0x8e, 0x78, 0xe8, 0x8e, 0x88, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x89, 0xe6, 0x7c, 0x67, 0xb6, 0x8d, 
+				0x78, 0xd6, 0x8d, 0x68, 0xd7, 0x8e, 0x79, 0xe7, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe6, 0x8e, 0x79, 0xe6, 0x8e, 0x68, 0xe6, 0x7d, 0x68, 0xd8, 0x9e, 
+				0x8a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 
+				0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x78, 0xe6, 0x8d, 0x45, 0x95, 0x6a, 0x89, 0xea, 0xae, 0xaa, 0xe8, 0x9e, 0x78, 0xd7, 0x8e, 
+				0x89, 0xe7, 0x8d, 0x77, 0xd8, 0x9d, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xd7, 0x8d, 0x77, 0xd7, 0x8c, 0x89, 0xd8, 0x9d, 0x67, 0xb6, 0x7b, 0x78, 0xd7, 0x8c, 0x67, 0xc6, 0x7c, 
+				0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x8d, 0x78, 0xd7, 0x8e, 0x78, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
+				0x88, 0xd6, 0x7c, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x67, 0xc7, 0x8d, 0x79, 0xe7, 0x8e, 0x79, 0xe7, 0x8e, 0x68, 0xd6, 0x8d, 0x79, 0xe7, 0x9e, 
+				0x79, 0xe6, 0x8e, 0x68, 0xd7, 0x9e, 0x8a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 
+				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x78, 0xe6, 0x7d, 0x56, 0xa7, 0x9d, 0xab, 0xea, 0xbe, 
+				0x9a, 0xe7, 0x7d, 0x67, 0xc7, 0x8e, 0x89, 0xe7, 0x8d, 0x88, 0xda, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xe8, 0x8c, 0x78, 0xc7, 0x8c, 0x88, 0xd8, 0x9d, 0x78, 0xd7, 0x8c, 
+				0x78, 0xd7, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 
+				0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x78, 0xd6, 0x7c, 0x78, 0xd7, 0x8d, 0x67, 0xc3, 0x48, 0x23, 0x75, 0x6b, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x7d, 
+				0x45, 0xa3, 0x59, 0x56, 0xc7, 0x8e, 0x79, 0xe7, 0x9e, 0x78, 0xd7, 0x9e, 0x8a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x89, 0xe8, 0x9e, 
+				0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe7, 0x8e, 0x78, 0xe6, 0x7c, 
+				0x67, 0xc8, 0x9e, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x7d, 0x78, 0xd8, 0x9e, 0x88, 0xe7, 0x8d, 0x89, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xc7, 0x7c, 
+				0x78, 0xc7, 0x8d, 0x78, 0xd7, 0x8c, 0x78, 0xd7, 0x8d, 0x68, 0xc6, 0x7c, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x7d, 0x77, 0xd7, 0x8d, 0x78, 0xe8, 0x8e, 
+				0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x78, 0xd6, 0x7c, 0x78, 0xd7, 0x7c, 0x56, 0xb3, 0x48, 0x35, 0x85, 0x6b, 
+				0x67, 0xc7, 0x8d, 0x68, 0xd6, 0x7c, 0x55, 0xa3, 0x48, 0x45, 0xa6, 0x7c, 0x78, 0xd7, 0x8e, 0x78, 0xe8, 0x9e, 0x8a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
+				0x9a, 0xe9, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 
+				0x68, 0xe7, 0x8e, 0x68, 0xd6, 0x7d, 0x56, 0xb5, 0x6a, 0x56, 0xb7, 0x8d, 0x78, 0xe7, 0x8e, 0x89, 0xe8, 0x8e, 0x78, 0xe8, 0x8d, 0xaa, 0xef, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0x99, 0xd7, 0x8c, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8c, 0x78, 0xd7, 0x8d, 0x77, 0xc6, 0x7c, 0x67, 0xd7, 0x7d, 0x77, 0xd7, 0x7d, 
+				0x77, 0xd7, 0x8e, 0x88, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 0xaa, 0xe9, 0xae, 0x9a, 0xe8, 0x8d, 0x78, 0xc6, 0x7c, 0x67, 0xc7, 0x8c, 
+				0x78, 0xd7, 0x7c, 0x78, 0xc6, 0x7c, 0x67, 0xc7, 0x8d, 0x68, 0xd7, 0x8d, 0x78, 0xd8, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x78, 0xe8, 0x9e, 
+				0x89, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9f, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x9e, 
+				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x68, 0xd6, 0x7c, 0x56, 0xb5, 0x6c, 0x78, 0xe8, 0x9e, 0x89, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
+				0x88, 0xe9, 0x9e, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xf8, 0x8c, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x7c, 0x78, 0xc7, 0x8d, 0x77, 0xc7, 0x7c, 
+				0x77, 0xd7, 0x7d, 0x77, 0xd7, 0x7d, 0x77, 0xd7, 0x8d, 0x78, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x89, 0xe7, 0x8d, 
+				0x78, 0xc7, 0x7c, 0x67, 0xc6, 0x7c, 0x77, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x9e, 0x78, 0xd6, 0x8d, 
+				0x78, 0xd7, 0x8e, 0x79, 0xe8, 0x9e, 0x89, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 
+				0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe6, 0x8d, 0x68, 0xd8, 0x9e, 0x8a, 0xe8, 0xae, 
+				0x89, 0xe7, 0x8e, 0x88, 0xe8, 0x8e, 0x99, 0xec, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x9d, 0x78, 0xd7, 0x8d, 0x88, 0xd7, 0x8c, 
+				0x78, 0xc7, 0x8c, 0x77, 0xc6, 0x7c, 0x67, 0xc7, 0x7d, 0x77, 0xd7, 0x7d, 0x77, 0xd7, 0x8d, 0x88, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 
+				0x9a, 0xe9, 0xae, 0x89, 0xd7, 0x8d, 0x78, 0xc7, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc7, 0x7c, 0x78, 0xd8, 0x9d, 0x79, 0xd7, 0x8d, 0x79, 0xd8, 0x9e, 
+				0x79, 0xe7, 0x8d, 0x78, 0xd6, 0x8d, 0x78, 0xe7, 0x8e, 0x89, 0xe8, 0x9e, 0x89, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0xae, 
+				0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x68, 0xd6, 0x8d, 
+				0x78, 0xe8, 0x9e, 0x8a, 0xe8, 0x9e, 0x78, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0xbb, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 
+				0x78, 0xc8, 0x8d, 0x88, 0xd7, 0x8c, 0x77, 0xc7, 0x8c, 0x77, 0xc7, 0x7c, 0x67, 0xc7, 0x7d, 0x77, 0xd7, 0x7d, 0x77, 0xd7, 0x8d, 0x88, 0xe8, 0x8e, 
+				0x89, 0xe8, 0x9e, 0x99, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x89, 0xd7, 0x8d, 0x68, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc7, 0x7c, 0x78, 0xd7, 0x9d, 
+				0x89, 0xe7, 0x9d, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xe7, 0x8e, 0x79, 0xe8, 0x9e, 0x89, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 
+				0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
+				0x78, 0xe7, 0x8e, 0x68, 0xd6, 0x8d, 0x78, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe8, 0x8e, 0x99, 0xeb, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd8, 0x8c, 0x78, 0xc8, 0x8c, 0x88, 0xc7, 0x8c, 0x77, 0xc7, 0x7c, 0x77, 0xc7, 0x7c, 0x77, 0xd7, 0x7d, 
+				0x77, 0xd7, 0x8d, 0x88, 0xe8, 0x8e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x8d, 0x78, 0xd7, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 
+				0x67, 0xc7, 0x7c, 0x78, 0xd8, 0x9d, 0x89, 0xe7, 0x9d, 0x79, 0xd7, 0x9e, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8e, 0x79, 0xe8, 0x9e, 
+				0x89, 0xe8, 0x9e, 0x89, 0xe9, 0xae, 0x9a, 0xe9, 0xae, 0x9a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
+				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x68, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x89, 0xe8, 0x9e, 0xbc, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xde, 0xdd, 0xfe, 0xef, 0x9a, 0xe7, 0x8c, 0x77, 0xb6, 0x7c, 
+				0x77, 0xc7, 0x7c, 0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x8e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8c, 
+				0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x78, 0xd8, 0x9d, 0x89, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
+				0x68, 0xd7, 0x8d, 0x78, 0xe7, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x9a, 0xe9, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x78, 0xe7, 0x8e, 
+				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8d, 0x67, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
+				0x89, 0xdc, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xbc, 0xe8, 0x8c, 0x77, 0xb6, 0x7b, 0x67, 0xc7, 0x7c, 0x77, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x8e, 0x89, 0xe8, 0x9e, 0x79, 0xd7, 0x9d, 
+				0x78, 0xd7, 0x8d, 0x68, 0xc6, 0x7c, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x67, 0xd7, 0x8d, 
+				0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8e, 0x79, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe9, 0xae, 0x8a, 0xe8, 0x9e, 
+				0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x9e, 0x89, 0xd7, 0x8d, 0x78, 0xc7, 0x8d, 
+				0x88, 0xe7, 0x8e, 0x78, 0xe8, 0x8e, 0xaa, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf8, 0x9c, 0x77, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8e, 
+				0x78, 0xe7, 0x9d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8c, 0x67, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x77, 0xc7, 0x7c, 
+				0x67, 0xc6, 0x7c, 0x67, 0xc7, 0x7d, 0x77, 0xd6, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x9e, 0x89, 0xe8, 0x9e, 
+				0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe8, 0x9e, 
+				0x89, 0xe9, 0xae, 0xde, 0xfa, 0xae, 0x78, 0xd8, 0x8d, 0x88, 0xe8, 0x8d, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xad, 0x78, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x77, 0xc7, 0x7d, 
+				0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8c, 0x67, 0xc6, 0x7c, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 
+				0x67, 0xc7, 0x7c, 0x77, 0xc7, 0x7c, 0x77, 0xc7, 0x7d, 0x77, 0xd7, 0x7d, 0x67, 0xd6, 0x7d, 0x77, 0xd7, 0x8d, 0x78, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 
+				0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
+				0x78, 0xe7, 0x8e, 0x78, 0xd8, 0x9d, 0x89, 0xdc, 0xce, 0xff, 0xff, 0xff, 0xde, 0xfb, 0xbe, 0xbb, 0xed, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xb7, 0x7b, 
+				0x67, 0xb6, 0x7c, 0x77, 0xc7, 0x7d, 0x77, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xc6, 0x7c, 0x67, 0xc6, 0x7b, 0x67, 0xb6, 0x6b, 
+				0x66, 0xb6, 0x6b, 0x66, 0xb6, 0x6b, 0x66, 0xb6, 0x6b, 0x65, 0xa6, 0x5a, 0x66, 0xb6, 0x6c, 0x66, 0xb5, 0x5b, 0x55, 0xa6, 0x5b, 0x66, 0xb6, 0x7d, 
+				0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x79, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 
+				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x9e, 0x78, 0xe7, 0x8d, 0x79, 0xd8, 0x9d, 0x9a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xfd, 0xde, 0x89, 0xc7, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x7c, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x67, 0xc6, 0x7b, 
+				0x67, 0xb5, 0x6b, 0x56, 0xa5, 0x6a, 0x66, 0xb5, 0x6a, 0x55, 0xa5, 0x5a, 0x54, 0x95, 0x49, 0x54, 0x95, 0x49, 0x44, 0x95, 0x49, 0x44, 0x94, 0x49, 
+				0x44, 0x94, 0x49, 0x44, 0x94, 0x4a, 0x55, 0xb6, 0x6c, 0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x7c, 0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x9e, 0x89, 0xe8, 0x9e, 
+				0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x89, 0xd9, 0x9d, 0xbb, 0xef, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd7, 0x8b, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x7c, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 
+				0x79, 0xd7, 0x8d, 0x67, 0xc6, 0x7b, 0x56, 0xa4, 0x59, 0x34, 0x83, 0x48, 0x34, 0x83, 0x38, 0x32, 0x73, 0x27, 0x43, 0x84, 0x38, 0x54, 0x95, 0x5a, 
+				0x54, 0x94, 0x38, 0x54, 0x94, 0x49, 0x43, 0x83, 0x38, 0x32, 0x82, 0x28, 0x32, 0x83, 0x39, 0x44, 0x95, 0x5a, 0x55, 0xa5, 0x6a, 0x66, 0xb6, 0x7c, 
+				0x78, 0xd8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xd7, 0x8d, 0x89, 0xd9, 0x9d, 
+				0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0x8b, 0x77, 0xb7, 0x7b, 0x67, 0xc7, 0x7c, 
+				0x77, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x68, 0xc5, 0x7b, 0x56, 0xa4, 0x59, 0x34, 0x83, 0x37, 0x33, 0x84, 0x38, 0x43, 0x84, 0x38, 
+				0x53, 0x95, 0x38, 0x53, 0x85, 0x49, 0x54, 0x94, 0x28, 0x43, 0x94, 0x39, 0x43, 0x94, 0x39, 0x43, 0x94, 0x39, 0x43, 0x94, 0x49, 0x33, 0x83, 0x38, 
+				0x34, 0x85, 0x5a, 0x66, 0xb6, 0x7b, 0x78, 0xd7, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 
+				0x78, 0xd7, 0x8d, 0x89, 0xda, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf9, 0x9c, 
+				0x77, 0xb7, 0x7b, 0x67, 0xb6, 0x7c, 0x77, 0xc7, 0x8c, 0x78, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x68, 0xd6, 0x7b, 0x56, 0xa5, 0x6a, 0x45, 0x94, 0x49, 
+				0x44, 0x94, 0x49, 0x54, 0x95, 0x4a, 0x54, 0xa5, 0x4a, 0x54, 0x95, 0x4a, 0x54, 0xa5, 0x4a, 0x54, 0xa5, 0x4a, 0x54, 0xa5, 0x4a, 0x55, 0xb5, 0x5b, 
+				0x55, 0xb4, 0x5a, 0x45, 0xa4, 0x5a, 0x56, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x78, 0xd7, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 
+				0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xd8, 0x8d, 0x89, 0xdc, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xfb, 0xbe, 0x78, 0xb7, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x7c, 0x78, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x68, 0xd6, 0x7b, 
+				0x57, 0xb5, 0x6a, 0x56, 0xa5, 0x5a, 0x55, 0xa4, 0x59, 0x54, 0x95, 0x4a, 0x55, 0xa5, 0x5a, 0x65, 0xb6, 0x5b, 0x65, 0xb6, 0x5b, 0x65, 0xb6, 0x5b, 
+				0x55, 0xb6, 0x5b, 0x55, 0xb5, 0x5b, 0x55, 0xb5, 0x5b, 0x56, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x8d, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 
+				0x79, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8e, 0x78, 0xe7, 0x8d, 0x78, 0xd8, 0x9d, 0x9a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0x89, 0xc7, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x78, 0xc7, 0x8d, 
+				0x78, 0xd6, 0x8c, 0x68, 0xc6, 0x7c, 0x57, 0xb5, 0x6b, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x5a, 0x55, 0xa5, 0x5a, 0x65, 0xb6, 0x5b, 0x66, 0xc6, 0x6c, 
+				0x65, 0xc6, 0x5c, 0x65, 0xc6, 0x6c, 0x66, 0xd6, 0x6d, 0x66, 0xc5, 0x6c, 0x56, 0xc6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
+				0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x78, 0xe6, 0x8e, 0x68, 0xe7, 0x8e, 0x78, 0xe7, 0x8d, 0x78, 0xd8, 0x9d, 0xcc, 0xef, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0x7b, 0x67, 0xb6, 0x7b, 
+				0x67, 0xb6, 0x7c, 0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x8c, 0x57, 0xb5, 0x7b, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x66, 0xb6, 0x6b, 
+				0x65, 0xb6, 0x6c, 0x66, 0xc6, 0x6c, 0x66, 0xc6, 0x6c, 0x66, 0xd6, 0x6d, 0x66, 0xd6, 0x6d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x68, 0xd6, 0x8d, 
+				0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xd7, 0x8e, 0x78, 0xd7, 0x8d, 
+				0x78, 0xd9, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xef, 0xf8, 0x9c, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x8c, 0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x7b, 0x57, 0xb5, 0x7b, 0x57, 0xb5, 0x6b, 
+				0x56, 0xb5, 0x6b, 0x66, 0xb6, 0x6c, 0x66, 0xc6, 0x7c, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7c, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x78, 0xe6, 0x8d, 
+				0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x9e, 0x78, 0xe6, 0x8e, 0x68, 0xe6, 0x8e, 0x68, 0xd6, 0x8e, 
+				0x68, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x89, 0xcb, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbe, 0x78, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7b, 0x67, 0xb5, 0x7b, 
+				0x57, 0xb5, 0x7b, 0x57, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc7, 0x7d, 0x77, 0xd7, 0x7d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 
+				0x78, 0xd7, 0x8d, 0x78, 0xe7, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x79, 0xe7, 0x9e, 0x78, 0xe6, 0x8e, 
+				0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x78, 0xd7, 0x8c, 0x9a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x89, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb5, 0x7b, 0x57, 0xb6, 0x7b, 0x57, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x68, 0xc6, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 
+				0x78, 0xd7, 0x8e, 0x78, 0xe7, 0x8e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xe6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xe6, 0x8e, 
+				0x68, 0xe7, 0x8e, 0x68, 0xe6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x78, 0xd7, 0x8c, 0xbb, 0xef, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xde, 0x89, 0xc6, 0x7b, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb5, 0x7b, 0x67, 0xb6, 0x7b, 0x57, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x8c, 0x78, 0xd7, 0x8d, 
+				0x78, 0xd7, 0x8d, 0x79, 0xe7, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe7, 0x8e, 0x68, 0xe6, 0x8d, 
+				0x68, 0xd6, 0x8d, 0x68, 0xe6, 0x9e, 0x68, 0xe6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8c, 0x78, 0xc8, 0x9c, 
+				0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xfd, 0xee, 0x89, 0xc6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb5, 0x7a, 0x56, 0xa5, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 
+				0x68, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x9d, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 
+				0x79, 0xe7, 0x9e, 0x69, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x7d, 
+				0x67, 0xd7, 0x8c, 0x78, 0xc9, 0xad, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0x89, 0xc6, 0x7a, 0x67, 0xa6, 0x7a, 0x57, 0xa5, 0x7a, 0x56, 0xa5, 0x6a, 0x57, 0xb6, 0x7b, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x68, 0xc7, 0x8c, 0x78, 0xd7, 0x8d, 0x79, 0xd8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 
+				0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x69, 0xe6, 0x9e, 0x68, 0xd6, 0x8d, 0x68, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
+				0x68, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xc7, 0x8c, 0x78, 0xc9, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x8a, 0xc6, 0x7a, 0x67, 0xa6, 0x7a, 0x66, 0xa5, 0x6a, 
+				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x68, 0xc7, 0x8c, 0x78, 0xd7, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xe8, 0x9e, 
+				0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xe8, 0xae, 0x8a, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x78, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
+				0x68, 0xd6, 0x8d, 0x67, 0xd6, 0x7d, 0x67, 0xd6, 0x7d, 0x67, 0xc6, 0x7c, 0x68, 0xc7, 0x8c, 0x88, 0xca, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x7a, 
+				0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x57, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x68, 0xc7, 0x8d, 0x78, 0xd7, 0x9d, 
+				0x89, 0xd8, 0x9e, 0x89, 0xe8, 0x9e, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe6, 0x8e, 
+				0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xd6, 0x7c, 0x67, 0xd6, 0x7c, 0x67, 0xc6, 0x7c, 0x68, 0xc7, 0x8c, 0x88, 0xcc, 0xde, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xab, 0xd6, 0x7a, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xb5, 0x7b, 0x67, 0xb6, 0x7c, 
+				0x68, 0xc7, 0x8d, 0x78, 0xd7, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xe8, 0x9e, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0xae, 0x8a, 0xe8, 0x9e, 0x89, 0xe7, 0x9e, 
+				0x79, 0xe7, 0x9e, 0x69, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xd6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 
+				0x68, 0xc7, 0x8c, 0x89, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xd6, 0x7a, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 
+				0x56, 0xa5, 0x7b, 0x67, 0xb6, 0x7c, 0x67, 0xc7, 0x8d, 0x78, 0xd7, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 
+				0x8a, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x68, 0xe6, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd5, 0x7c, 0x57, 0xc5, 0x7c, 0x57, 0xb5, 0x7b, 
+				0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x68, 0xc7, 0x8c, 0x99, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0x8a, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x7a, 
+				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x8c, 0x78, 0xd7, 0x8d, 0x78, 0xd8, 0x9e, 0x89, 0xe8, 0x9e, 
+				0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x68, 0xe6, 0x8d, 0x68, 0xd5, 0x8d, 0x57, 0xc5, 0x7c, 
+				0x57, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x57, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x78, 0xc7, 0x8b, 0xab, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0x8b, 
+				0x67, 0xa6, 0x7a, 0x67, 0xb6, 0x7a, 0x67, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x67, 0xb6, 0x7b, 0x67, 0xc7, 0x7c, 0x78, 0xc7, 0x8d, 
+				0x78, 0xd8, 0x9d, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x89, 0xe8, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 0x68, 0xe6, 0x8d, 
+				0x68, 0xd5, 0x7d, 0x57, 0xc5, 0x7b, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x68, 0xb7, 0x8b, 0xbc, 0xef, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xcd, 0xe7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x66, 0xa6, 0x7b, 
+				0x67, 0xb6, 0x7c, 0x78, 0xc7, 0x8c, 0x78, 0xd7, 0x9d, 0x89, 0xe8, 0x9e, 0x79, 0xd7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x8e, 
+				0x78, 0xe6, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xd5, 0x7c, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x7b, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 
+				0x68, 0xb7, 0x8b, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xe7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xa5, 0x6a, 
+				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x78, 0xc7, 0x8d, 0x78, 0xd7, 0x9d, 0x79, 0xd8, 0x9e, 0x79, 0xe7, 0x9d, 
+				0x78, 0xd7, 0x9e, 0x78, 0xd7, 0x8e, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x7c, 0x57, 0xc5, 0x6b, 0x56, 0xb5, 0x6b, 0x56, 0xb5, 0x6b, 0x57, 0xb6, 0x7c, 
+				0x67, 0xc6, 0x7c, 0x68, 0xc6, 0x8c, 0x68, 0xb8, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xe7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x66, 0xa6, 0x6a, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x7c, 0x78, 0xd7, 0x8d, 
+				0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x7d, 0x67, 0xc5, 0x7b, 0x56, 0xb4, 0x6a, 0x56, 0xa5, 0x6a, 
+				0x56, 0xb6, 0x7c, 0x67, 0xc6, 0x8c, 0x67, 0xc6, 0x8c, 0x68, 0xc6, 0x7c, 0x68, 0xb8, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xe7, 0x8b, 
+				0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xa6, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa6, 0x6a, 
+				0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x8c, 0x68, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xc6, 0x8c, 0x67, 0xc6, 0x7c, 0x67, 0xc5, 0x7b, 0x56, 0xb5, 0x6a, 
+				0x56, 0xa5, 0x6a, 0x56, 0xb5, 0x7b, 0x67, 0xc6, 0x7c, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8c, 0x68, 0xc6, 0x7c, 0x68, 0xb9, 0xad, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xce, 0xf7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x66, 0xa6, 0x6a, 
+				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x66, 0xb5, 0x6b, 
+				0x66, 0xb5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6b, 0x67, 0xb6, 0x7c, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 
+				0x68, 0xba, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0x8b, 0x67, 0xa5, 0x7a, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7a, 0x66, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x55, 0x95, 0x59, 0x55, 0x95, 0x6a, 
+				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6b, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
+				0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 0x68, 0xba, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0x8b, 0x67, 0xa6, 0x7a, 0x67, 0xb6, 0x7b, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8b, 0x67, 0xb6, 0x7b, 0x67, 0xa6, 0x7a, 0x67, 0xa6, 0x6a, 0x66, 0xa6, 0x7a, 0x66, 0xa5, 0x6a, 
+				0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa5, 0x6a, 0x56, 0xa6, 0x6b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xc6, 0x8d, 0x68, 0xd7, 0x8d, 
+				0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 0x68, 0xbb, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0x8b, 
+				0x67, 0xa6, 0x7a, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x77, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x7b, 0x67, 0xb6, 0x7a, 0x67, 0xb6, 0x7b, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 0x67, 0xc6, 0x7c, 
+				0x68, 0xc6, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 0x68, 0xbb, 0xce, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xde, 0xf7, 0x8b, 0x67, 0xa6, 0x7a, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8c, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 
+				0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8d, 0x78, 0xd7, 0x8d, 
+				0x68, 0xc6, 0x8c, 0x68, 0xc6, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 
+				0x68, 0xbb, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xe7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xc7, 0x8c, 
+				0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x77, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb7, 0x8b, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x79, 0xd8, 0x9d, 
+				0x79, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd6, 0x8d, 0x68, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
+				0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x8c, 0x78, 0xbb, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xe7, 0x8b, 0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 
+				0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8b, 0x77, 0xb7, 0x8b, 0x78, 0xb7, 0x7b, 0x67, 0xb7, 0x8b, 0x78, 0xc7, 0x8c, 
+				0x89, 0xc8, 0x9d, 0x89, 0xd8, 0x9d, 0x79, 0xd7, 0x9d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd7, 0x8d, 0x78, 0xd7, 0x9d, 
+				0x79, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xc6, 0x7c, 0x68, 0xba, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xd7, 0x8b, 
+				0x67, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 
+				0x78, 0xb7, 0x8b, 0x78, 0xc7, 0x9c, 0x89, 0xd8, 0x9d, 0x89, 0xd7, 0x9d, 0x79, 0xd7, 0x9d, 0x79, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 
+				0x78, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xb9, 0xad, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xfe, 0xff, 0x89, 0xc6, 0x7b, 0x66, 0xa6, 0x7b, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x78, 0xb7, 0x8b, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 
+				0x78, 0xc7, 0x8b, 0x78, 0xb7, 0x8b, 0x78, 0xb7, 0x8b, 0x78, 0xc7, 0x9d, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 0x79, 0xd7, 0x9d, 0x78, 0xd7, 0x8d, 
+				0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x79, 0xd7, 0x9d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 0x67, 0xc6, 0x7c, 
+				0x67, 0xb8, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbd, 0x78, 0xb6, 0x7b, 0x67, 0xa6, 0x6a, 0x67, 0xb6, 0x7b, 0x67, 0xb6, 0x7b, 0x77, 0xb7, 0x8b, 
+				0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xc7, 0x8c, 0x78, 0xb7, 0x8b, 0x78, 0xc7, 0x8b, 0x78, 0xc7, 0x9c, 0x89, 0xd8, 0x9d, 0x89, 0xd8, 0x9d, 
+				0x79, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x78, 0xd7, 0x8d, 0x79, 0xe7, 0x9d, 0x68, 0xd6, 0x8d, 0x68, 0xd6, 0x8d, 
+				0x68, 0xd6, 0x8d, 0x67, 0xc6, 0x7c, 0x67, 0xb7, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+				
+};
+#ifdef __cplusplus
+}
+#endif //to close extern "C" if used
+
+#endif //exclude large bmp if not used
+
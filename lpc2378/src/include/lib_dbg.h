@@ -1,145 +1,313 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2017, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        lib_dbg.h
-* Description: Functions for remote debug handling from through mng_rtm (remote) manager commands
-* Author:      Bogdan Kowalczyk
-* Date:        06-Jan-2017
-* Note:        This module reuse concept and source code of Robert Ward / Dr. Rainer Storn build-in debugger
-*              as published in Dr. Dobb's Journal (not sure probably in 1997)
-* History:
-* 06-Jan-2017 - Initial version of remote commands processing library
-* 
-*********************************************************************************************************
-*/
-#ifndef LIB_DBG_H_
-#define LIB_DBG_H_
-#ifdef __cplusplus
-   extern "C" {
-#endif
-
-//constant for Uart0DebugMessage to print but without exception to be generated
-#define DO_NOT_GEN_EXCEPTION 0
-	   
-#define TRACE_LIST_LEN			10 //maximum namber of trace patterns
-#define STOP_LIST_LEN			10 //maximum number of stop patterns	   
-#define MAX_PATTERN_NAME_LEN  	11 //maximum length of the trace pattern allowed
-	   
-//define remote command prompt but executed from stop state
-#define STR_CMD_PROMPT_STOP_STATE			"\nS>>>"
-
-/*
-*********************************************************************************************************
-* Name:                                    DbgInit  
-* 
-* Description: Initialize Debugger
-*
-* Arguments:
-*			   none
-*
-* Returns:     none
-*
-* Note(s):     
-* 
-*********************************************************************************************************
-*/
-extern void DbgInit(void);
-	   
-/*
-*********************************************************************************************************
-* Name:                                    DbgTraceStrVal 
-* 
-* Description: Debug command placed in source code at those places where we would like to trace
-*              with both a message and a value
-*
-* Arguments:
-* 			InLevel - debug point levels (defined levels are managed by remote LEVEL command)
-* 			pInLabel - debug point label matching algo is used to prcess those Dbg points which matches to the pattern
-* 			pMessageText - pointer to message text which is displayed for the debug point
-* 			InValue - debug value which is converted to string and displayed
-*
-* Returns:     none
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-extern void DbgTraceStrVal(int InLevel, char *pInLabel, char *pMessageText, long InValue);
-
-
-/*
-*********************************************************************************************************
-* Name:                                    DbgTraceStr 
-* 
-* Description: Debug command placed in source code at those places where we would like to trace
-*              with a message. Similar to DbgTraceStrVal but displays only string text when enabled.
-*
-* Arguments:
-* 			InLevel - debug point levels (defined levels are managed by remote LEVEL command)
-* 			pInLabel - debug point label matching algo is used to prcess those Dbg points which matches to the pattern
-* 			pMessageText - pointer to message text which is displayed for the debug point
-*
-* Returns:     none
-*
-* Note(s):     
-* 			inLevel 0 should not be used, this level is reserved to turn off all messages by LEVEL 0 command
-* 
-* *********************************************************************************************************
-*/
-extern void DbgTraceStr(int InLevel, char *pInLabel, char *pMessageText);
-
-
-
-/*
-*********************************************************************************************************
-* Name:                                    DbgStopStrVal 
-* 
-* Description: Debug command placed in source code at those places where we would like to stop execution
-*              with both a message and a value
-*
-* Arguments:
-* 			InLevel - debug point levels (defined levels are managed by remote LEVEL command)
-* 			pInLabel - debug point label matching algo is used to prcess those Dbg points which matches to the pattern
-* 			pMessageText - pointer to message text which is displayed for the debug point
-* 			InValue - debug value which is converted to string and displayed
-*
-* Returns:     none
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-extern void DbgStopStrVal(int InLevel, char *pInLabel, char *pMessageText, long InValue);
-
-
-/*
-*********************************************************************************************************
-* Name:                                    DbgStopStr 
-* 
-* Description: Debug command placed in source code at those places where we would like to stop execution
-*              with a message. Similar to DbgStopStrVal but displays only string text when enabled.
-*
-* Arguments:
-* 			InLevel - debug point levels (defined levels are managed by remote LEVEL command)
-* 			pInLabel - debug point label matching algo is used to prcess those Dbg points which matches to the pattern
-* 			pMessageText - pointer to message text which is displayed for the debug point
-*
-* Returns:     none
-*
-* Note(s):     
-* 			inLevel 0 should not be used, this level is reserved to turn off all messages by LEVEL 0 command
-* 
-* *********************************************************************************************************
-*/
-extern void DbgStopStr(int InLevel, char *pInLabel, char *pMessageText);
-
-
-#ifdef __cplusplus
-}
-#endif //to close extern "C" if used
-#endif /*LIB_DBG_H_*/
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2017, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        lib_dbg.h
+* Description: Functions for remote debug handling from through mng_rtm (remote) manager commands
+* Author:      Bogdan Kowalczyk
+* Date:        06-Jan-2017
+* Note:        This module reuse concept and source code of Robert Ward / Dr. Rainer Storn build-in debugger
+*              as published in Dr. Dobb's Journal (not sure probably in 1997)
+* History:
+* 06-Jan-2017 - Initial version of remote commands processing library
+* 17-Oct-2026 - Tokenized trace log - binary trace records put into RAM ring buffer drained by LOG command
+* 17-Oct-2026 - Trace and stop filters precompiled into per call site enabled flags, compile time level threshold
+* 17-Oct-2026 - Tokenized trace log disabled by default (DBG_TOKENIZED_LOG 0), traces are sent as strings to UART0
+* 
+*********************************************************************************************************
+*/
+#ifndef LIB_DBG_H_
+#define LIB_DBG_H_
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+#include "type.h"
+#include "hw_uart.h" //Uart0Message and Uart0PutStr used by traces when tokenized trace log is not used
+
+//constant for Uart0DebugMessage to print but without exception to be generated
+#define DO_NOT_GEN_EXCEPTION 0
+	   
+#define TRACE_LIST_LEN			10 //maximum namber of trace patterns
+#define STOP_LIST_LEN			10 //maximum number of stop patterns	   
+#define MAX_PATTERN_NAME_LEN  	11 //maximum length of the trace pattern allowed
+	   
+//define remote command prompt but executed from stop state
+#define STR_CMD_PROMPT_STOP_STATE			"\nS>>>"
+
+//Tokenized trace log
+//When enabled DbgTraceStr and DbgTraceStrVal do not format and send messages to UART0 but put
+//compact binary records into RAM ring buffer which is drained by remote LOG command.
+//Message texts are placed into .dbg_str section and record identifies message by its offset in that section.
+//make extracts .dbg_str into main.dbg string table which is used by host tools/dbgdec to decode LOG output.
+#define DBG_TOKENIZED_LOG	0 //1 - tokenized trace log, 0 - traces sent as strings to UART0 (default)
+
+#define DBG_LOG_SIZE		32 //number of trace records in the ring buffer (must be power of 2)
+
+//type of trace record
+#define DBG_LOG_STR			0 //record of DbgTraceStr - message only
+#define DBG_LOG_STR_VAL		1 //record of DbgTraceStrVal - message followed by value
+
+//prefixes of LOG command output lines decoded by tools/dbgdec
+#define DBG_LOG_REC_PREFIX	"#DBG " //#DBG <msg id> <level> <type> <tick> <value> - all fields hex
+#define DBG_LOG_LOST_PREFIX	"#DBGLOST " //#DBGLOST <number of records lost because ring buffer was full> - hex
+
+//binary trace record
+typedef struct
+{
+	WORD mMsgId;//offset of the message text in .dbg_str section
+	BYTE mLevel;//trace level
+	BYTE mType;//DBG_LOG_STR or DBG_LOG_STR_VAL
+	DWORD mTick;//OS Ticks when trace was recorded
+	long mValue;//traced value (0 for DBG_LOG_STR)
+} sDbgLogRecord;
+
+#define DBG_STR_SECTION		__attribute__((section(".dbg_str")))
+//places message string literal into .dbg_str section and returns pointer to it
+#define DBG_MSG(Msg)		({static const char DbgMsg[] DBG_STR_SECTION = Msg; DbgMsg;})
+
+//Precompiled trace and stop filters
+//Every DbgTraceStr, DbgTraceStrVal, DbgStopStr and DbgStopStrVal call site gets its own descriptor which linker
+//collects into .dbg_site table in flash (no run time registration needed) and its own enabled flag in RAM.
+//DbgCompileFilters matches descriptors against current level and TRACE/STOP patterns and sets enabled flags
+//so a disabled call site costs only load and test of its flag.
+//IMPORTANT! DbgLevel and patterns must be changed by DbgSetLevel and followed by DbgCompileFilters
+
+//call sites with level above this threshold are removed from the build (level 1 to 4 are allowed, 0 removes all)
+#define DBG_COMPILE_LEVEL	2
+
+//kind of call site
+#define DBG_SITE_TRACE		0 //matched against TRACE patterns
+#define DBG_SITE_STOP		1 //matched against STOP patterns
+
+//call site descriptor
+typedef struct
+{
+	const char *pLabel;//debug point label matched against patterns
+	volatile BYTE *pOn;//enabled flag of the call site set by DbgCompileFilters
+	BYTE mLevel;//debug point level
+	BYTE mKind;//DBG_SITE_TRACE or DBG_SITE_STOP
+} sDbgSite;
+
+//IMPORTANT! Descriptor alignment is given explicitly so compiler does not pad descriptors in the table
+#define DBG_SITE_SECTION	__attribute__((section(".dbg_site"),used,aligned(__alignof__(sDbgSite))))
+#define DBG_ON_SECTION		__attribute__((section(".dbg_on")))
+//defines call site descriptor with its enabled flag and returns the flag
+#define DBG_SITE_ON(InLevel,pInLabel,Kind)	\
+	({static volatile BYTE DbgOn DBG_ON_SECTION; \
+	static const sDbgSite DbgSite DBG_SITE_SECTION = {pInLabel,&DbgOn,InLevel,Kind}; \
+	DbgOn;})
+
+//level threshold - IMPORTANT! InLevel of debug points must be a number (1 to 4) so it can be pasted here
+#define DBG_IF_LEVEL(InLevel,Site)	DBG_IF_LEVEL_##InLevel(Site)
+#if DBG_COMPILE_LEVEL >= 1
+#define DBG_IF_LEVEL_1(Site)	Site
+#else
+#define DBG_IF_LEVEL_1(Site)	((void)0)
+#endif
+#if DBG_COMPILE_LEVEL >= 2
+#define DBG_IF_LEVEL_2(Site)	Site
+#else
+#define DBG_IF_LEVEL_2(Site)	((void)0)
+#endif
+#if DBG_COMPILE_LEVEL >= 3
+#define DBG_IF_LEVEL_3(Site)	Site
+#else
+#define DBG_IF_LEVEL_3(Site)	((void)0)
+#endif
+#if DBG_COMPILE_LEVEL >= 4
+#define DBG_IF_LEVEL_4(Site)	Site
+#else
+#define DBG_IF_LEVEL_4(Site)	((void)0)
+#endif
+
+/*
+*********************************************************************************************************
+* Name:                                    DbgInit  
+* 
+* Description: Initialize Debugger
+*
+* Arguments:
+*			   none
+*
+* Returns:     none
+*
+* Note(s):     
+* 
+*********************************************************************************************************
+*/
+extern void DbgInit(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    DbgCompileFilters  
+* 
+* Description: Sets enabled flag of every trace and stop call site according to current level and patterns
+*
+* Arguments:
+*			   none
+*
+* Returns:     none
+*
+* Note(s):     
+* 			Must be called after TRACE or STOP patterns are changed
+*********************************************************************************************************
+*/
+extern void DbgCompileFilters(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    DbgSetLevel  
+* 
+* Description: Changes current debugging level and compiles filters for it
+*
+* Arguments:
+*			   InLevel - new debugging level (0 disables all traces and stops)
+*
+* Returns:     none
+*
+* Note(s):     
+* 
+*********************************************************************************************************
+*/
+extern void DbgSetLevel(int InLevel);
+
+/*
+*********************************************************************************************************
+* Name:                                    DbgTraceStrVal, DbgTraceStr 
+* 
+* Description: Debug commands placed in source code at those places where we would like to trace
+*              with both a message and a value or with a message only
+*
+* Arguments:
+* 			InLevel - debug point level number 1 to 4 (defined levels are managed by remote LEVEL command)
+* 			pInLabel - debug point label matching algo is used to prcess those Dbg points which matches to the pattern
+* 			MessageText - message text string literal which is displayed for the debug point
+* 			InValue - debug value which is converted to string and displayed
+*
+* Returns:     none
+*
+* Note(s):     
+* 			inLevel 0 should not be used, this level is reserved to turn off all messages by LEVEL 0 command
+* *********************************************************************************************************
+*/
+#if DBG_TOKENIZED_LOG
+#define DbgTraceStrVal(InLevel,pInLabel,MessageText,InValue)	DBG_IF_LEVEL(InLevel, \
+	(DBG_SITE_ON(InLevel,pInLabel,DBG_SITE_TRACE) ? DbgLogStrVal(InLevel,DBG_MSG(MessageText),InValue,DBG_LOG_STR_VAL) : (void)0))
+#define DbgTraceStr(InLevel,pInLabel,MessageText)	DBG_IF_LEVEL(InLevel, \
+	(DBG_SITE_ON(InLevel,pInLabel,DBG_SITE_TRACE) ? DbgLogStrVal(InLevel,DBG_MSG(MessageText),0,DBG_LOG_STR) : (void)0))
+#else
+#define DbgTraceStrVal(InLevel,pInLabel,MessageText,InValue)	DBG_IF_LEVEL(InLevel, \
+	(DBG_SITE_ON(InLevel,pInLabel,DBG_SITE_TRACE) ? Uart0Message(MessageText,InValue) : (void)0))
+#define DbgTraceStr(InLevel,pInLabel,MessageText)	DBG_IF_LEVEL(InLevel, \
+	(DBG_SITE_ON(InLevel,pInLabel,DBG_SITE_TRACE) ? Uart0PutStr(MessageText) : (void)0))
+#endif //DBG_TOKENIZED_LOG
+
+/*
+*********************************************************************************************************
+* Name:                                    DbgStopStrVal, DbgStopStr 
+* 
+* Description: Debug commands placed in source code at those places where we would like to stop execution
+*              with both a message and a value or with a message only
+*
+* Arguments:
+* 			InLevel - debug point level number 1 to 4 (defined levels are managed by remote LEVEL command)
+* 			pInLabel - debug point label matching algo is used to prcess those Dbg points which matches to the pattern
+* 			MessageText - message text which is displayed for the debug point
+* 			InValue - debug value which is converted to string and displayed
+*
+* Returns:     none
+*
+* Note(s):     
+* 			inLevel 0 should not be used, this level is reserved to turn off all messages by LEVEL 0 command
+* *********************************************************************************************************
+*/
+#define DbgStopStrVal(InLevel,pInLabel,MessageText,InValue)	DBG_IF_LEVEL(InLevel, \
+	(DBG_SITE_ON(InLevel,pInLabel,DBG_SITE_STOP) ? DbgStop(MessageText,InValue,DBG_LOG_STR_VAL) : (void)0))
+#define DbgStopStr(InLevel,pInLabel,MessageText)	DBG_IF_LEVEL(InLevel, \
+	(DBG_SITE_ON(InLevel,pInLabel,DBG_SITE_STOP) ? DbgStop(MessageText,0,DBG_LOG_STR) : (void)0))
+
+#if DBG_TOKENIZED_LOG
+/*
+*********************************************************************************************************
+* Name:                                    DbgLogStrVal 
+* 
+* Description: Puts binary trace record into trace log ring buffer (called by enabled DbgTraceStr and DbgTraceStrVal)
+*
+* Arguments:
+* 			InLevel - debug point level
+* 			pMessageText - pointer to message text placed in .dbg_str section
+* 			InValue - traced value
+* 			InType - DBG_LOG_STR or DBG_LOG_STR_VAL
+*
+* Returns:     none
+*
+* Note(s):     
+* 			When ring buffer is full record is dropped and counted as lost
+* 			Can be called from ISR
+* *********************************************************************************************************
+*/
+extern void DbgLogStrVal(int InLevel, const char *pMessageText, long InValue, BYTE InType);
+
+/*
+*********************************************************************************************************
+* Name:                                    DbgLogGet 
+* 
+* Description: Takes the oldest trace record out of trace log ring buffer
+*
+* Arguments:
+* 			pOutRecord - pointer to record filled with the oldest trace record
+*
+* Returns:     TRUE - record taken, FALSE - trace log is empty
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+extern BOOL DbgLogGet(sDbgLogRecord *pOutRecord);
+
+/*
+*********************************************************************************************************
+* Name:                                    DbgLogGetLost 
+* 
+* Description: Returns number of trace records lost because trace log ring buffer was full and clears it
+*
+* Arguments:   none
+*
+* Returns:     number of records lost since previous call
+*
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+extern DWORD DbgLogGetLost(void);
+#endif //DBG_TOKENIZED_LOG
+
+/*
+*********************************************************************************************************
+* Name:                                    DbgStop 
+* 
+* Description: Stops execution of the calling task at enabled stop call site until GO command
+*
+* Arguments:
+* 			pMessageText - pointer to message text which is displayed for the debug point
+* 			InValue - debug value which is converted to string and displayed
+* 			InType - DBG_LOG_STR (message only) or DBG_LOG_STR_VAL (message and value)
+*
+* Returns:     none
+*
+* Note(s):     
+* 			Called by DbgStopStr and DbgStopStrVal
+* *********************************************************************************************************
+*/
+extern void DbgStop(char *pMessageText, long InValue, BYTE InType);
+
+
+#ifdef __cplusplus
+}
+#endif //to close extern "C" if used
+#endif /*LIB_DBG_H_*/
@@ -0,0 +1,108 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        lib_event.h
+* Description: Hardware events event flag group - ISRs set flags, tasks wait for their combinations
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+*              Flags are only set by ISRs and drivers. Add a flag only together with the task which waits for it,
+*              every OSFlagPost() from ISR costs a walk of the group wait list.
+*              Task which waits for an event clears its flag before it starts the action which generates
+*              the event (or consumes flags with OS_FLAG_CONSUME).
+*              C++ code uses the group through Kernel.HwEvents (cEventFlags).
+* History:
+*              17-Oct-2026 - Initial version created
+*              17-Oct-2026 - Removed ARS angle, RTC alarm and UART0 RX flags which had no task waiting for them
+*********************************************************************************************************
+*/
+#ifndef LIB_EVENT_H_
+#define LIB_EVENT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "type.h"
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+
+//hardware events flags
+#define HW_EVT_TRACKS_STOPPED		BIT0	//StopTracks() called (by track tasks at movement end, Timer1Isr at ARS target angle or on a stall)
+#define HW_EVT_LEFT_TRACK_PULSE		BIT1	//Port2Isr received left track pulse
+#define HW_EVT_RIGHT_TRACK_PULSE	BIT2	//Port2Isr received right track pulse
+
+/*
+*********************************************************************************************************
+* Name:                                    InitHwEvents
+*
+* Description: Creates hardware events flag group (all flags cleared)
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 			Must be called after OSInit() and before any ISR which sets the flags is enabled.
+* *********************************************************************************************************
+*/
+extern void InitHwEvents(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    SetHwEvents
+*
+* Description: Sets hardware events flags and readies tasks waiting for them
+*
+* Arguments:   Flags - HW_EVT_xxx flags to set
+*
+* Returns:     none
+*
+* Note(s):
+* 			Can be called from ISR. Does nothing when called before InitHwEvents().
+* *********************************************************************************************************
+*/
+extern void SetHwEvents(WORD Flags);
+
+/*
+*********************************************************************************************************
+* Name:                                    ClrHwEvents
+*
+* Description: Clears hardware events flags
+*
+* Arguments:   Flags - HW_EVT_xxx flags to clear
+*
+* Returns:     none
+*
+* Note(s):
+* 			Does nothing when called before InitHwEvents().
+* *********************************************************************************************************
+*/
+extern void ClrHwEvents(WORD Flags);
+
+/*
+*********************************************************************************************************
+* Name:                                    GetHwEventsGrp
+*
+* Description: Returns hardware events flag group
+*
+* Arguments:   none
+*
+* Returns:     pointer to uCOS-II event flag group
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+extern OS_FLAG_GRP* GetHwEventsGrp(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*LIB_EVENT_H_*/
@@ -1,553 +1,553 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2017, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        lib_g_bitmap.h
-* Description: Stores bitmaps of icons used by Wall-e Graphic Library
-* Author:      Bogdan Kowalczyk
-* Date:        11-Nov-2017
-* Note:		   Icon's bitmap generated by BmpToArray tool (version modified by me so
-* 			   that first byte of bmp is width while second byte of bmp is hight (in pixel)
-* History:
-*              	11-Nov-2017 - Initial version created with try icons
-* 				01-Jun-2018 - Added Icons generated from 66 Free Icons File
-*********************************************************************************************************
-*/
-
-#ifndef LIB_G_ICONS_H_
-#define LIB_G_ICONS_H_
-
-
-extern const unsigned char BatteryHighBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x22, 0x28, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5d, 0xdd, 0xaa, 0xa9, 0x9a, 0xaa, 0xac, 0xcc, 0xbb, 0xb1, 0x11, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x48, 0x88, 
-	0xbb, 0xbe, 0xee, 0xbb, 0xba, 0xaa, 0xaa, 0xad, 0xdd, 0xee, 0xe9, 0x99, 0x77, 0x72, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xab, 0xaa, 0xa9, 0x99, 0x99, 0x9a, 0xaa, 0xaa, 0xba, 0xaa, 
-	0xcc, 0xc7, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xd7, 0x77, 
-	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0xbb, 0xb9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
-	0x99, 0x9a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0xaa, 0xa9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
-	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
-	0xaa, 0xaa, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0x99, 0x99, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xd5, 0x55, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc9, 0x99, 
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xcc, 0xc9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x88, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	
-};
-
-extern const unsigned char BatteryMidBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x22, 0x28, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5d, 0xdd, 0xaa, 0xa9, 0x9a, 0xaa, 0xac, 0xcc, 0xbb, 0xb1, 0x11, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x48, 0x88, 
-	0xbb, 0xbe, 0xee, 0xbb, 0xba, 0xaa, 0xaa, 0xad, 0xdd, 0xee, 0xe9, 0x99, 0x77, 0x72, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xab, 0xaa, 0xa9, 0x99, 0x99, 0x9a, 0xaa, 0xaa, 0xba, 0xaa, 
-	0xcc, 0xc7, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xd7, 0x77, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xb9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-	0x99, 0x9a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xaa, 0xa9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
-	0xaa, 0xaa, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0x99, 0x99, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xd5, 0x55, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc9, 0x99, 
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xcc, 0xc9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x88, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	
-}; 
-
-extern const unsigned char BatteryLowBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x22, 0x28, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5d, 0xdd, 0xaa, 0xa9, 0x9a, 0xaa, 0xac, 0xcc, 0xbb, 0xb1, 0x11, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x48, 0x88, 
-	0xbb, 0xbe, 0xee, 0xbb, 0xba, 0xaa, 0xaa, 0xad, 0xdd, 0xee, 0xe9, 0x99, 0x77, 0x72, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xab, 0xaa, 0xa9, 0x99, 0x99, 0x9a, 0xaa, 0xaa, 0xba, 0xaa, 
-	0xcc, 0xc7, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xd7, 0x77, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xb9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-	0x99, 0x9a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xaa, 0xa9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
-	0xaa, 0xaa, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0x99, 0x99, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xd5, 0x55, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc9, 0x99, 
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xcc, 0xc9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x88, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	
-};
-
-extern const unsigned char BatteryEmptyBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x22, 0x28, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5d, 0xdd, 0xaa, 0xa9, 0x9a, 0xaa, 0xac, 0xcc, 0xbb, 0xb1, 0x11, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x48, 0x88, 
-	0xbb, 0xbe, 0xee, 0xbb, 0xba, 0xaa, 0xaa, 0xad, 0xdd, 0xee, 0xe9, 0x99, 0x77, 0x72, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xab, 0xaa, 0xa9, 0x99, 0x99, 0x9a, 0xaa, 0xaa, 0xba, 0xaa, 
-	0xcc, 0xc7, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xd7, 0x77, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xb9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-	0x99, 0x9a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xaa, 0xa9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
-	0xaa, 0xaa, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x11, 
-	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
-	0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x11, 0x99, 0x99, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xd5, 0x55, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc9, 0x99, 
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xcc, 0xc9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x88, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	
-};
-
-extern const unsigned char AlarmOnBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0xdd, 0xd1, 0x11, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x22, 0x26, 0x66, 0x99, 0x9d, 0xdd, 0xee, 0xea, 0xaa, 0x77, 0x73, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x17, 0x77, 0xdd, 0xde, 0xee, 0xcc, 0xca, 0xaa, 0xaa, 0xab, 0xbb, 0xdd, 0xde, 0xee, 
-	0x99, 0x92, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0x9e, 0xee, 
-	0x99, 0x93, 0x33, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x22, 0x27, 0x77, 0xdd, 0xdc, 0xcc, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x33, 0x3d, 0xdd, 0xbb, 0xb1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2d, 0xdd, 0x99, 0x90, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xee, 0xe5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x11, 0xbb, 0xca, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9c, 0xcc, 0x11, 0x10, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x8c, 0xcd, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xba, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x66, 0x7d, 0xde, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xba, 0xaa, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xbb, 0xc9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xc8, 0x88, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5e, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x44, 0x4e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xee, 0xe4, 0x44, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2d, 0xde, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xdd, 0xd2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x11, 0x1c, 0xcc, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1c, 0xcc, 0x99, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0xcc, 0xc1, 0x11, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x26, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xef, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
-	0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfe, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x01, 0x11, 0x66, 0x66, 0x66, 0x77, 0x7d, 0xdd, 0xdd, 0xd8, 0x88, 0x99, 0x9e, 0xee, 0xbb, 0xb6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xec, 0xcc, 
-	0xdd, 0xdd, 0xdd, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x47, 0x78, 0x77, 0x72, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	
-};
-
-extern const unsigned char AlarmOffBmp[]= {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xee, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0xdd, 0xd1, 0x11, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x22, 0x26, 0x66, 0x99, 0x9d, 0xdd, 0xee, 0xea, 0xaa, 0x77, 0x73, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x11, 0x17, 0x77, 0xdd, 0xde, 0xee, 0xcc, 0xca, 0xaa, 0xaa, 0xab, 0xbb, 0xdd, 0xde, 0xee, 
-	0x99, 0x92, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x6e, 0xee, 
-	0x99, 0x93, 0x33, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x22, 0x27, 0x77, 0xdd, 0xdc, 0xcc, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x33, 0x3d, 0xdd, 0xbb, 0xb1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2d, 0xdd, 0x66, 0x6e, 0xee, 
-	0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xee, 0xe5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x33, 0x36, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x11, 0xbb, 0xca, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9c, 0xcc, 0x11, 0x10, 0x00, 
-	0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xec, 0xcd, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xba, 0xab, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x66, 0x7d, 0xde, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xba, 0xaa, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xbb, 0xc9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xc8, 0x88, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5e, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 
-	0x00, 0x00, 0x00, 0x44, 0x4e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xee, 0xe4, 0x44, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 0x22, 0x2d, 0xde, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xdd, 0xd2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 
-	0xee, 0xe6, 0x66, 0x11, 0x1c, 0xcc, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1c, 0xcc, 0x99, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x69, 0x99, 0xcc, 0xc1, 0x11, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-	0x22, 0x26, 0x66, 0xee, 0xe6, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xef, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
-	0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x66, 0x6e, 0xee, 0x66, 0x6e, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x01, 0x11, 0x66, 0x66, 0x66, 0x77, 0x7d, 0xdd, 0xdd, 0xd8, 0x88, 0x99, 0x9e, 0xee, 0xbb, 0xb6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0xe6, 0x66, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xec, 0xcc, 
-	0xdd, 0xdd, 0xdd, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x47, 0x78, 0x77, 0x72, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 
-	
-};
-
-extern const unsigned char RamPreservedBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x66, 0x7a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0x88, 
-	0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xee, 0xed, 0xdd, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xdd, 0xdf, 0xff, 0xcc, 0xc4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaf, 0xff, 
-	0xdd, 0xed, 0xde, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x42, 0x22, 0x00, 0x00, 0x00, 0xaa, 0xae, 0xee, 0x55, 0x5a, 0xaa, 0xee, 0xe8, 0x89, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x07, 0x77, 0xdd, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xe8, 0x88, 0x00, 0x00, 0x00, 0xaa, 0xae, 0xee, 
-	0x33, 0x32, 0x22, 0x99, 0x9e, 0xef, 0xbb, 0xb3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x33, 0x33, 0x33, 
-	0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x00, 0x00, 0x00, 0x99, 0x9f, 0xff, 0xcc, 0xcb, 0xbb, 0xcc, 0xce, 0xef, 0xff, 0xfc, 0xcc, 0x22, 0x20, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x38, 0x88, 
-	0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0xbb, 0xbe, 0xef, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x06, 0x66, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xba, 0xaa, 0xaa, 0xbb, 0xbb, 0x77, 0x70, 0x00, 0x77, 0x7e, 0xef, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x05, 0x55, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-	0x99, 0x99, 0x99, 0x66, 0x60, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x07, 0x77, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
-	0xdd, 0xdd, 0xdd, 0x99, 0x90, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x03, 0x33, 0x66, 0x66, 0x66, 
-	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x44, 0x40, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-	0x33, 0x33, 0x33, 0x22, 0x20, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x07, 0x77, 0xee, 0xed, 0xdd, 
-	0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xee, 0x99, 0x90, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x44, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-	0x33, 0x33, 0x34, 0x22, 0x20, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5a, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xab, 0x77, 0x70, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x66, 0x70, 0x00, 0x77, 0x7e, 0xef, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xea, 0xaa, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x88, 0x8e, 0xef, 0x55, 0x50, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xde, 0xee, 0xdd, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 
-	0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xee, 0xee, 0xee, 0x44, 0x40, 0x00, 
-	0x00, 0x00, 0x00, 0x44, 0x46, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	
-};
-
-extern const unsigned char RamNotPreservedBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x66, 0x7a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0x88, 
-	0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xee, 0xed, 0xdd, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xdd, 0xdf, 0xff, 0xcc, 0xc4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaf, 0xff, 
-	0xdd, 0xed, 0xde, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xae, 0xee, 0x55, 0x5a, 0xaa, 0xee, 0xe8, 0x89, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xae, 0xee, 
-	0x33, 0x32, 0x22, 0x99, 0x9e, 0xef, 0xbb, 0xb3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9f, 0xff, 0xcc, 0xcb, 0xbb, 0xcc, 0xce, 0xef, 0xff, 0xfc, 0xcc, 0x22, 0x20, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x38, 0x88, 
-	0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0xbb, 0xbe, 0xef, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xef, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-	0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xef, 0x55, 0x50, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xea, 0xaa, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x88, 0x8e, 0xef, 0x55, 0x50, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xde, 0xee, 0xdd, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 
-	0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xee, 0xee, 0xee, 0x44, 0x40, 0x00, 
-	0x00, 0x00, 0x00, 0x44, 0x46, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	
-}; 
-
-extern const unsigned char BathBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x99, 0x9e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x99, 0x99, 0x99, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0xee, 0xee, 0xee, 0x33, 0x33, 0x33, 
-	0x33, 0x33, 0x33, 0xee, 0xee, 0xee, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0xdd, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xee, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xdd, 0xee, 0xee, 0x33, 0x30, 0x00, 0xdd, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x99, 0x90, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xed, 0xdd, 0x00, 0x00, 0x00, 0xdd, 0xde, 0xee, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xde, 0xee, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0x33, 0xee, 0xed, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xde, 0xee, 0x99, 0x99, 0x99, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0x33, 0x30, 0x00, 0xdd, 0xde, 0xee, 
-	0x99, 0x90, 0x00, 0x00, 0x03, 0x33, 0xee, 0xed, 0xde, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0xdd, 0xee, 0xee, 0xee, 0xed, 0xdd, 0x99, 0x90, 0x00, 0x00, 0x0d, 0xde, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3e, 0xee, 0xee, 0xee, 0xee, 0x99, 0x90, 0x00, 
-	0x00, 0x03, 0x33, 0xdd, 0xee, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xe0, 0x00, 0x33, 0x33, 0x33, 0x33, 0x3e, 0xee, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xee, 0xdd, 0xee, 0xee, 
-	0xee, 0xed, 0xde, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x99, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2d, 0xde, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0xdd, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x22, 0x2d, 0xde, 0x99, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-	0x22, 0x22, 0x22, 0x99, 0x9e, 0xee, 0x22, 0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3e, 0xee, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x22, 0x2e, 0xee, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2e, 0xee, 0xbb, 0xb3, 0x33, 0x33, 0x33, 0x33, 
-	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x23, 0x99, 0x9f, 0xff, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x22, 0x2d, 0xdd, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-	0x99, 0x99, 0x99, 0x99, 0x9f, 0xff, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x66, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-	0x77, 0x77, 0x77, 0x77, 0x74, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	
-};
-
-
-extern const unsigned char VoiceBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x33, 0x37, 0x77, 0x99, 0x9a, 0xaa, 0xaa, 0xa8, 0x88, 0x66, 0x62, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4a, 0xaa, 0xee, 0xef, 0xff, 0xee, 0xed, 0xdd, 0xdd, 0xde, 0xee, 0xff, 0xfd, 0xdd, 
-	0x99, 0x93, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x88, 0xee, 0xee, 0xee, 
-	0xaa, 0xa5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x23, 0x33, 0x66, 0x6b, 0xbb, 0xee, 0xfd, 0xdd, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0x9f, 0xff, 0xbb, 0xb4, 0x44, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-	0x66, 0x6d, 0xdd, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xff, 0xfa, 0xaa, 0x11, 0x10, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xce, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x33, 0x4e, 0xee, 0xcc, 0xc2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x44, 0x4e, 0xee, 0xcc, 0xc1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xff, 0xf6, 0x66, 0x00, 0x00, 0x00, 
-	0x00, 0x02, 0x22, 0xdd, 0xeb, 0xbb, 0x00, 0x10, 0x00, 0x00, 0x0d, 0xdd, 0xdd, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 
-	0xdd, 0xd0, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xdb, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xff, 0xf6, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 
-	0xee, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 0xee, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xad, 0xde, 0x22, 0x20, 0x00, 
-	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x8e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x08, 0x88, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x7e, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x08, 0x88, 0xee, 0xf3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd2, 0x22, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x06, 0x66, 0xff, 0xf5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 
-	0xcc, 0xcb, 0xbb, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xbb, 0xbc, 0xcc, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x33, 0x30, 0x00, 
-	0x00, 0x04, 0x44, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xcc, 0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5b, 0xbb, 
-	0xcc, 0xc0, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xcc, 0xcc, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xcd, 0xdd, 0x22, 0x20, 0x00, 0x00, 0x0c, 0xcc, 
-	0xbb, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xbb, 0xcc, 0xc0, 0x00, 0x00, 0x05, 0x55, 0xee, 0xf8, 0x88, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x66, 0x6f, 0xff, 0x88, 0x80, 0x00, 0x00, 0x0a, 0xaa, 0xcc, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5c, 0xcc, 
-	0xaa, 0xa0, 0x00, 0x11, 0x1b, 0xbb, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0xbb, 0xee, 0xe6, 0x66, 0x00, 0x03, 0x33, 
-	0xdd, 0xdb, 0xbb, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcc, 0xcc, 0xcc, 0x33, 0x31, 0x11, 0x99, 0x9f, 0xff, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xde, 0xee, 0x66, 0x70, 0x00, 0x00, 0x0d, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xd0, 0x00, 
-	0x00, 0x09, 0x99, 0xee, 0xfa, 0xaa, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3c, 0xcc, 0xff, 0xfa, 0xaa, 
-	0x44, 0x41, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x26, 0x66, 0xcc, 0xcf, 0xff, 0xaa, 0xa4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x99, 0x9e, 0xee, 0xee, 0xec, 0xcc, 0xaa, 0xa8, 0x89, 0x99, 0x9a, 0xaa, 0xdd, 0xdf, 0xff, 
-	0xdd, 0xda, 0xaa, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 
-	0x88, 0x9c, 0xcc, 0xee, 0xee, 0xee, 0xee, 0xed, 0xdd, 0xbb, 0xb7, 0x77, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x23, 0x33, 0x33, 0x32, 0x22, 0x11, 0x10, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	
-};
-
-extern const unsigned char TestBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5a, 0xaa, 0xaa, 0xa5, 0x55, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x06, 0x66, 0xdd, 0xde, 0xee, 0xee, 0xed, 0xdd, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x55, 0x5e, 0xee, 0xbb, 0xb4, 0x44, 0x44, 0x4b, 0xbb, 0xee, 0xe5, 0x55, 
-	0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4d, 0xdd, 
-	0xee, 0xee, 0xef, 0x55, 0x50, 0x00, 0x00, 0x05, 0x55, 0xee, 0xfe, 0xee, 0xdd, 0xd4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x02, 0x22, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0xbb, 0xbf, 0xff, 0xaa, 0xa5, 0x55, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x55, 0x5a, 0xaa, 
-	0xff, 0xfb, 0xbb, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x22, 0x20, 0x00, 0x00, 0x06, 0x66, 0xff, 0xfd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xdf, 0xff, 
-	0x99, 0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x39, 0x99, 0xff, 0xfc, 0xcd, 0xcc, 0xcc, 0xcc, 0xdd, 0xdf, 0xff, 0x66, 0x60, 0x00, 
-	0x00, 0x07, 0x77, 0xff, 0xf5, 0x55, 0x11, 0x11, 0x11, 0x55, 0x5e, 0xee, 0xee, 0xed, 0xde, 0xdd, 0xed, 0xde, 0xdd, 0xed, 0xde, 0xdd, 0xee, 0xee, 
-	0xee, 0xe5, 0x55, 0x11, 0x11, 0x11, 0x55, 0x5f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x11, 0x15, 0x55, 
-	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x11, 0x00, 0x00, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
-	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x24, 0x44, 0x99, 0x92, 0x22, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
-	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x01, 0x12, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x70, 0x00, 0x00, 0x08, 0x88, 
-	0xdd, 0xde, 0xee, 0xdd, 0xd3, 0x33, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x02, 0x22, 0xbb, 0xbc, 0xcc, 
-	0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x99, 0x90, 0x00, 0x00, 0x03, 0x33, 0x99, 0x9a, 0xab, 0x33, 0x30, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
-	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x03, 0x33, 0x55, 0x57, 0x77, 0xcc, 0xc3, 0x33, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
-	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x02, 0x22, 0xbb, 0xbc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xaa, 0xa0, 0x00, 0x00, 0x08, 0x88, 
-	0xee, 0xef, 0xff, 0xbb, 0xb2, 0x22, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x01, 0x11, 0x88, 0x89, 0x99, 
-	0x88, 0x98, 0x89, 0x88, 0x99, 0x99, 0x77, 0x70, 0x00, 0x00, 0x01, 0x11, 0x66, 0x67, 0x77, 0x11, 0x10, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
-	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x11, 0x33, 0x30, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 
-	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x20, 0x00, 0x00, 0x05, 0x55, 0x88, 0x8a, 0xaa, 0xdd, 0xd4, 0x44, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
-	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x02, 0x22, 0xdd, 0xde, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xb0, 0x00, 0x00, 0x07, 0x77, 
-	0xee, 0xee, 0xee, 0x88, 0x81, 0x11, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x01, 0x11, 0x55, 0x55, 0x55, 
-	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x33, 0x34, 0x44, 0x00, 0x00, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
-	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf9, 0x99, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x99, 0x9f, 0xff, 0x77, 0x70, 0x00, 
-	0x00, 0x05, 0x55, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
-	0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x00, 0x00, 0x00, 
-	
-};
-
-extern const unsigned char EnjoyBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x33, 0x37, 0x77, 0x99, 0x9a, 0xaa, 0xaa, 0xa8, 0x88, 0x66, 0x62, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4a, 0xaa, 0xee, 0xef, 0xff, 0xee, 0xed, 0xdd, 0xdd, 0xde, 0xee, 0xff, 0xfd, 0xdd, 
-	0x99, 0x93, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x88, 0xee, 0xee, 0xee, 
-	0xaa, 0xa5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x23, 0x33, 0x66, 0x6b, 0xbb, 0xee, 0xfd, 0xdd, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0x9f, 0xff, 0xbb, 0xb4, 0x44, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-	0x66, 0x6d, 0xdd, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xff, 0xfa, 0xaa, 0x11, 0x10, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xce, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x33, 0x4e, 0xee, 0xcc, 0xc2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x44, 0x4e, 0xee, 0xcc, 0xc1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xff, 0xf6, 0x66, 0x00, 0x00, 0x00, 
-	0x00, 0x02, 0x22, 0xdd, 0xeb, 0xbb, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xdb, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xff, 0xf6, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 
-	0xee, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 0xee, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xad, 0xde, 0x22, 0x20, 0x00, 
-	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 0xdd, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 
-	0xdd, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x88, 0x8e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x08, 0x88, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x7e, 0xee, 0x55, 0x50, 0x00, 
-	0x00, 0x08, 0x88, 0xee, 0xf3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x06, 0x66, 0xff, 0xf5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 
-	0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x33, 0x30, 0x00, 
-	0x00, 0x04, 0x44, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xcc, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 
-	0xcc, 0xc0, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xcc, 0xcc, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xcd, 0xdd, 0x22, 0x20, 0x00, 0x00, 0x0c, 0xcc, 
-	0xbb, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xbb, 0xcc, 0xc0, 0x00, 0x00, 0x05, 0x55, 0xee, 0xf8, 0x88, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x66, 0x6f, 0xff, 0x88, 0x80, 0x00, 0x00, 0x0a, 0xaa, 0xcc, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5c, 0xcc, 
-	0xaa, 0xa0, 0x00, 0x11, 0x1b, 0xbb, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0xbb, 0xee, 0xe6, 0x66, 0x00, 0x03, 0x33, 
-	0xdd, 0xdc, 0xcc, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcc, 0xcc, 0xcc, 0x33, 0x31, 0x11, 0x99, 0x9f, 0xff, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xde, 0xee, 0x66, 0x70, 0x00, 0x00, 0x0d, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xd0, 0x00, 
-	0x00, 0x09, 0x99, 0xee, 0xfa, 0xaa, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3c, 0xcc, 0xff, 0xfa, 0xaa, 
-	0x44, 0x41, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x26, 0x66, 0xcc, 0xcf, 0xff, 0xaa, 0xa4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x99, 0x9e, 0xee, 0xee, 0xec, 0xcc, 0xaa, 0xa8, 0x89, 0x99, 0x9a, 0xaa, 0xdd, 0xdf, 0xff, 
-	0xdd, 0xda, 0xaa, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 
-	0x88, 0x9c, 0xcc, 0xee, 0xee, 0xee, 0xee, 0xed, 0xdd, 0xbb, 0xb7, 0x77, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x23, 0x33, 0x33, 0x32, 0x22, 0x11, 0x10, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	
-};
-
-extern const unsigned char HeartBmp[] = {
-//Bitmap width, highth in pixel and next pixel data 12bpp
-	0x10, 0x10,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x88, 0x88, 0x88, 0x44, 0x40, 0x00, 0x11, 0x15, 0x55, 0x88, 0x87, 0x77, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x66, 0x6b, 0xbb, 0x77, 0x77, 0x77, 0xbb, 0xb8, 0x88, 0x99, 0x9a, 0xaa, 0x66, 0x68, 0x88, 0xbb, 0xb4, 0x44, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0x33, 0xbb, 0xb2, 0x22, 0x00, 0x00, 0x00, 0x11, 0x1b, 0xbb, 0x88, 0x90, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4a, 0xaa, 0x11, 0x10, 0x00, 
-	0x00, 0x07, 0x77, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x44, 0x40, 0x00, 
-	0x00, 0x08, 0x88, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x66, 0x60, 0x00, 
-	0x00, 0x07, 0x77, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x44, 0x40, 0x00, 
-	0x00, 0x04, 0x44, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2a, 0xaa, 0x11, 0x10, 0x00, 
-	0x00, 0x00, 0x00, 0x99, 0x96, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x87, 0x77, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x33, 0x3b, 0xbb, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xaa, 0xa1, 0x11, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xaa, 0xa1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3b, 0xbb, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7a, 0xaa, 0x11, 0x10, 0x00, 0x00, 0x03, 0x33, 0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xaa, 0xa1, 0x11, 0x33, 0x3b, 0xbb, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7b, 0xbb, 0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	
-};
-
-
-#endif /*LIB_G_ICONS_H_*/
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2017, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        lib_g_bitmap.h
+* Description: Stores bitmaps of icons used by Wall-e Graphic Library
+* Author:      Bogdan Kowalczyk
+* Date:        11-Nov-2017
+* Note:		   Icon's bitmap generated by BmpToArray tool (version modified by me so
+* 			   that first byte of bmp is width while second byte of bmp is hight (in pixel)
+* History:
+*              	11-Nov-2017 - Initial version created with try icons
+* 				01-Jun-2018 - Added Icons generated from 66 Free Icons File
+*********************************************************************************************************
+*/
+
+#ifndef LIB_G_ICONS_H_
+#define LIB_G_ICONS_H_
+
+
+extern const unsigned char BatteryHighBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x22, 0x28, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5d, 0xdd, 0xaa, 0xa9, 0x9a, 0xaa, 0xac, 0xcc, 0xbb, 0xb1, 0x11, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x48, 0x88, 
+	0xbb, 0xbe, 0xee, 0xbb, 0xba, 0xaa, 0xaa, 0xad, 0xdd, 0xee, 0xe9, 0x99, 0x77, 0x72, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xab, 0xaa, 0xa9, 0x99, 0x99, 0x9a, 0xaa, 0xaa, 0xba, 0xaa, 
+	0xcc, 0xc7, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xd7, 0x77, 
+	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0xbb, 0xb9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
+	0x99, 0x9a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0xaa, 0xa9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
+	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
+	0xaa, 0xaa, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0x99, 0x99, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xd5, 0x55, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
+	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc9, 0x99, 
+	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xcc, 0xc9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x88, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
+	0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x22, 
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	
+};
+
+extern const unsigned char BatteryMidBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x22, 0x28, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5d, 0xdd, 0xaa, 0xa9, 0x9a, 0xaa, 0xac, 0xcc, 0xbb, 0xb1, 0x11, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x48, 0x88, 
+	0xbb, 0xbe, 0xee, 0xbb, 0xba, 0xaa, 0xaa, 0xad, 0xdd, 0xee, 0xe9, 0x99, 0x77, 0x72, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xab, 0xaa, 0xa9, 0x99, 0x99, 0x9a, 0xaa, 0xaa, 0xba, 0xaa, 
+	0xcc, 0xc7, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xd7, 0x77, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xb9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
+	0x99, 0x9a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xaa, 0xa9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
+	0xaa, 0xaa, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0x99, 0x99, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xd5, 0x55, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
+	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc9, 0x99, 
+	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xcc, 0xc9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x88, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
+	0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x22, 
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	
+}; 
+
+extern const unsigned char BatteryLowBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x22, 0x28, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5d, 0xdd, 0xaa, 0xa9, 0x9a, 0xaa, 0xac, 0xcc, 0xbb, 0xb1, 0x11, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x48, 0x88, 
+	0xbb, 0xbe, 0xee, 0xbb, 0xba, 0xaa, 0xaa, 0xad, 0xdd, 0xee, 0xe9, 0x99, 0x77, 0x72, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xab, 0xaa, 0xa9, 0x99, 0x99, 0x9a, 0xaa, 0xaa, 0xba, 0xaa, 
+	0xcc, 0xc7, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xd7, 0x77, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xb9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
+	0x99, 0x9a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xaa, 0xa9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
+	0xaa, 0xaa, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x71, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x88, 0x81, 0x11, 0x99, 0x99, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xd5, 0x55, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
+	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc9, 0x99, 
+	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xcc, 0xc9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x88, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
+	0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x22, 
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	
+};
+
+extern const unsigned char BatteryEmptyBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x22, 0x28, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5d, 0xdd, 0xaa, 0xa9, 0x9a, 0xaa, 0xac, 0xcc, 0xbb, 0xb1, 0x11, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x48, 0x88, 
+	0xbb, 0xbe, 0xee, 0xbb, 0xba, 0xaa, 0xaa, 0xad, 0xdd, 0xee, 0xe9, 0x99, 0x77, 0x72, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xab, 0xaa, 0xa9, 0x99, 0x99, 0x9a, 0xaa, 0xaa, 0xba, 0xaa, 
+	0xcc, 0xc7, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xd7, 0x77, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xb9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
+	0x99, 0x9a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xaa, 0xa9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
+	0xaa, 0xaa, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x11, 
+	0x99, 0xa9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc5, 0x55, 
+	0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x11, 0x99, 0x99, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xd5, 0x55, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
+	0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xc9, 0x99, 
+	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xcc, 0xc9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x88, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
+	0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x22, 
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	
+};
+
+extern const unsigned char AlarmOnBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0xdd, 0xd1, 0x11, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x22, 0x26, 0x66, 0x99, 0x9d, 0xdd, 0xee, 0xea, 0xaa, 0x77, 0x73, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x17, 0x77, 0xdd, 0xde, 0xee, 0xcc, 0xca, 0xaa, 0xaa, 0xab, 0xbb, 0xdd, 0xde, 0xee, 
+	0x99, 0x92, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0x9e, 0xee, 
+	0x99, 0x93, 0x33, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x22, 0x27, 0x77, 0xdd, 0xdc, 0xcc, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x33, 0x3d, 0xdd, 0xbb, 0xb1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2d, 0xdd, 0x99, 0x90, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xee, 0xe5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x11, 0xbb, 0xca, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9c, 0xcc, 0x11, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x8c, 0xcd, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xba, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x7d, 0xde, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xba, 0xaa, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xbb, 0xc9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xc8, 0x88, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5e, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x44, 0x4e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xee, 0xe4, 0x44, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2d, 0xde, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xdd, 0xd2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x11, 0x1c, 0xcc, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1c, 0xcc, 0x99, 0xa0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0xcc, 0xc1, 0x11, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
+	0x22, 0x22, 0x22, 0x22, 0x26, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xef, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
+	0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfe, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x01, 0x11, 0x66, 0x66, 0x66, 0x77, 0x7d, 0xdd, 0xdd, 0xd8, 0x88, 0x99, 0x9e, 0xee, 0xbb, 0xb6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xec, 0xcc, 
+	0xdd, 0xdd, 0xdd, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x47, 0x78, 0x77, 0x72, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	
+};
+
+extern const unsigned char AlarmOffBmp[]= {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xee, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0xdd, 0xd1, 0x11, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 
+	0x22, 0x26, 0x66, 0x99, 0x9d, 0xdd, 0xee, 0xea, 0xaa, 0x77, 0x73, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x11, 0x17, 0x77, 0xdd, 0xde, 0xee, 0xcc, 0xca, 0xaa, 0xaa, 0xab, 0xbb, 0xdd, 0xde, 0xee, 
+	0x99, 0x92, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x6e, 0xee, 
+	0x99, 0x93, 0x33, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x22, 0x27, 0x77, 0xdd, 0xdc, 0xcc, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x33, 0x3d, 0xdd, 0xbb, 0xb1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2d, 0xdd, 0x66, 0x6e, 0xee, 
+	0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xee, 0xe5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x33, 0x36, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x11, 0xbb, 0xca, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9c, 0xcc, 0x11, 0x10, 0x00, 
+	0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xec, 0xcd, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xba, 0xab, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x7d, 0xde, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xba, 0xaa, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xbb, 0xc9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xc8, 0x88, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5e, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 
+	0x00, 0x00, 0x00, 0x44, 0x4e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xee, 0xe4, 0x44, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 0x22, 0x2d, 0xde, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xdd, 0xd2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 
+	0xee, 0xe6, 0x66, 0x11, 0x1c, 0xcc, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1c, 0xcc, 0x99, 0xa0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x69, 0x99, 0xcc, 0xc1, 0x11, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
+	0x22, 0x26, 0x66, 0xee, 0xe6, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xef, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
+	0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x66, 0x6e, 0xee, 0x66, 0x6e, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x01, 0x11, 0x66, 0x66, 0x66, 0x77, 0x7d, 0xdd, 0xdd, 0xd8, 0x88, 0x99, 0x9e, 0xee, 0xbb, 0xb6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0xe6, 0x66, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xec, 0xcc, 
+	0xdd, 0xdd, 0xdd, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 0x66, 0x60, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x47, 0x78, 0x77, 0x72, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0xee, 
+	
+};
+
+extern const unsigned char RamPreservedBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x7a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0x88, 
+	0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xee, 0xed, 0xdd, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xdd, 0xdf, 0xff, 0xcc, 0xc4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaf, 0xff, 
+	0xdd, 0xed, 0xde, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x44, 0x44, 0x44, 
+	0x44, 0x44, 0x44, 0x44, 0x42, 0x22, 0x00, 0x00, 0x00, 0xaa, 0xae, 0xee, 0x55, 0x5a, 0xaa, 0xee, 0xe8, 0x89, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x07, 0x77, 0xdd, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xe8, 0x88, 0x00, 0x00, 0x00, 0xaa, 0xae, 0xee, 
+	0x33, 0x32, 0x22, 0x99, 0x9e, 0xef, 0xbb, 0xb3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x33, 0x33, 0x33, 
+	0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x00, 0x00, 0x00, 0x99, 0x9f, 0xff, 0xcc, 0xcb, 0xbb, 0xcc, 0xce, 0xef, 0xff, 0xfc, 0xcc, 0x22, 0x20, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x38, 0x88, 
+	0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0xbb, 0xbe, 0xef, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x06, 0x66, 0xbb, 0xbb, 0xbb, 
+	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xba, 0xaa, 0xaa, 0xbb, 0xbb, 0x77, 0x70, 0x00, 0x77, 0x7e, 0xef, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x05, 0x55, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
+	0x99, 0x99, 0x99, 0x66, 0x60, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x07, 0x77, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
+	0xdd, 0xdd, 0xdd, 0x99, 0x90, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x03, 0x33, 0x66, 0x66, 0x66, 
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x44, 0x40, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
+	0x33, 0x33, 0x33, 0x22, 0x20, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x07, 0x77, 0xee, 0xed, 0xdd, 
+	0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xee, 0x99, 0x90, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x44, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
+	0x33, 0x33, 0x34, 0x22, 0x20, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5a, 0xaa, 0xaa, 0xaa, 0xaa, 
+	0xaa, 0xaa, 0xab, 0x77, 0x70, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x66, 0x70, 0x00, 0x77, 0x7e, 0xef, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xea, 0xaa, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x88, 0x8e, 0xef, 0x55, 0x50, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xde, 0xee, 0xdd, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 
+	0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xee, 0xee, 0xee, 0x44, 0x40, 0x00, 
+	0x00, 0x00, 0x00, 0x44, 0x46, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
+	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	
+};
+
+extern const unsigned char RamNotPreservedBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x7a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0x88, 
+	0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xee, 0xed, 0xdd, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xdd, 0xdf, 0xff, 0xcc, 0xc4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaf, 0xff, 
+	0xdd, 0xed, 0xde, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xae, 0xee, 0x55, 0x5a, 0xaa, 0xee, 0xe8, 0x89, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xae, 0xee, 
+	0x33, 0x32, 0x22, 0x99, 0x9e, 0xef, 0xbb, 0xb3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9f, 0xff, 0xcc, 0xcb, 0xbb, 0xcc, 0xce, 0xef, 0xff, 0xfc, 0xcc, 0x22, 0x20, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x38, 0x88, 
+	0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0xbb, 0xbe, 0xef, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xef, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
+	0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x55, 0x50, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xef, 0x55, 0x50, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xea, 0xaa, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x88, 0x8e, 0xef, 0x55, 0x50, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xde, 0xee, 0xdd, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 
+	0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xcc, 0xdc, 0xcd, 0xee, 0xee, 0xee, 0x44, 0x40, 0x00, 
+	0x00, 0x00, 0x00, 0x44, 0x46, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
+	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	
+}; 
+
+extern const unsigned char BathBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x99, 0x9e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x99, 0x99, 0x99, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0xee, 0xee, 0xee, 0x33, 0x33, 0x33, 
+	0x33, 0x33, 0x33, 0xee, 0xee, 0xee, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0xdd, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xee, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0xdd, 0xee, 0xee, 0x33, 0x30, 0x00, 0xdd, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xe9, 0x99, 0x99, 0x90, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xee, 0xed, 0xdd, 0x00, 0x00, 0x00, 0xdd, 0xde, 0xee, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xde, 0xee, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x33, 0xee, 0xed, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xde, 0xee, 0x99, 0x99, 0x99, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0x33, 0x30, 0x00, 0xdd, 0xde, 0xee, 
+	0x99, 0x90, 0x00, 0x00, 0x03, 0x33, 0xee, 0xed, 0xde, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0xdd, 0xee, 0xee, 0xee, 0xed, 0xdd, 0x99, 0x90, 0x00, 0x00, 0x0d, 0xde, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3e, 0xee, 0xee, 0xee, 0xee, 0x99, 0x90, 0x00, 
+	0x00, 0x03, 0x33, 0xdd, 0xee, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xe0, 0x00, 0x33, 0x33, 0x33, 0x33, 0x3e, 0xee, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xee, 0xdd, 0xee, 0xee, 
+	0xee, 0xed, 0xde, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
+	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x99, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2d, 0xde, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0xdd, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x22, 0x2d, 0xde, 0x99, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
+	0x22, 0x22, 0x22, 0x99, 0x9e, 0xee, 0x22, 0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3e, 0xee, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x22, 0x2e, 0xee, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2e, 0xee, 0xbb, 0xb3, 0x33, 0x33, 0x33, 0x33, 
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x23, 0x99, 0x9f, 0xff, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x22, 0x2d, 0xdd, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
+	0x99, 0x99, 0x99, 0x99, 0x9f, 0xff, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x66, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
+	0x77, 0x77, 0x77, 0x77, 0x74, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	
+};
+
+
+extern const unsigned char VoiceBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x33, 0x37, 0x77, 0x99, 0x9a, 0xaa, 0xaa, 0xa8, 0x88, 0x66, 0x62, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4a, 0xaa, 0xee, 0xef, 0xff, 0xee, 0xed, 0xdd, 0xdd, 0xde, 0xee, 0xff, 0xfd, 0xdd, 
+	0x99, 0x93, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x88, 0xee, 0xee, 0xee, 
+	0xaa, 0xa5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x23, 0x33, 0x66, 0x6b, 0xbb, 0xee, 0xfd, 0xdd, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0x9f, 0xff, 0xbb, 0xb4, 0x44, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
+	0x66, 0x6d, 0xdd, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xff, 0xfa, 0xaa, 0x11, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xce, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x33, 0x4e, 0xee, 0xcc, 0xc2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x44, 0x4e, 0xee, 0xcc, 0xc1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xff, 0xf6, 0x66, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x22, 0xdd, 0xeb, 0xbb, 0x00, 0x10, 0x00, 0x00, 0x0d, 0xdd, 0xdd, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 
+	0xdd, 0xd0, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xdb, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xff, 0xf6, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 
+	0xee, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 0xee, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xad, 0xde, 0x22, 0x20, 0x00, 
+	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x8e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x08, 0x88, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x7e, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x08, 0x88, 0xee, 0xf3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd2, 0x22, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x06, 0x66, 0xff, 0xf5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 
+	0xcc, 0xcb, 0xbb, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xbb, 0xbc, 0xcc, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x33, 0x30, 0x00, 
+	0x00, 0x04, 0x44, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xcc, 0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5b, 0xbb, 
+	0xcc, 0xc0, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xcc, 0xcc, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xcd, 0xdd, 0x22, 0x20, 0x00, 0x00, 0x0c, 0xcc, 
+	0xbb, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xbb, 0xcc, 0xc0, 0x00, 0x00, 0x05, 0x55, 0xee, 0xf8, 0x88, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x6f, 0xff, 0x88, 0x80, 0x00, 0x00, 0x0a, 0xaa, 0xcc, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5c, 0xcc, 
+	0xaa, 0xa0, 0x00, 0x11, 0x1b, 0xbb, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0xbb, 0xee, 0xe6, 0x66, 0x00, 0x03, 0x33, 
+	0xdd, 0xdb, 0xbb, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcc, 0xcc, 0xcc, 0x33, 0x31, 0x11, 0x99, 0x9f, 0xff, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xde, 0xee, 0x66, 0x70, 0x00, 0x00, 0x0d, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xd0, 0x00, 
+	0x00, 0x09, 0x99, 0xee, 0xfa, 0xaa, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3c, 0xcc, 0xff, 0xfa, 0xaa, 
+	0x44, 0x41, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x26, 0x66, 0xcc, 0xcf, 0xff, 0xaa, 0xa4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x99, 0x9e, 0xee, 0xee, 0xec, 0xcc, 0xaa, 0xa8, 0x89, 0x99, 0x9a, 0xaa, 0xdd, 0xdf, 0xff, 
+	0xdd, 0xda, 0xaa, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 
+	0x88, 0x9c, 0xcc, 0xee, 0xee, 0xee, 0xee, 0xed, 0xdd, 0xbb, 0xb7, 0x77, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x23, 0x33, 0x33, 0x32, 0x22, 0x11, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	
+};
+
+extern const unsigned char TestBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5a, 0xaa, 0xaa, 0xa5, 0x55, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x06, 0x66, 0xdd, 0xde, 0xee, 0xee, 0xed, 0xdd, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x55, 0x5e, 0xee, 0xbb, 0xb4, 0x44, 0x44, 0x4b, 0xbb, 0xee, 0xe5, 0x55, 
+	0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4d, 0xdd, 
+	0xee, 0xee, 0xef, 0x55, 0x50, 0x00, 0x00, 0x05, 0x55, 0xee, 0xfe, 0xee, 0xdd, 0xd4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x22, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0xbb, 0xbf, 0xff, 0xaa, 0xa5, 0x55, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x55, 0x5a, 0xaa, 
+	0xff, 0xfb, 0xbb, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x22, 0x20, 0x00, 0x00, 0x06, 0x66, 0xff, 0xfd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xdf, 0xff, 
+	0x99, 0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x39, 0x99, 0xff, 0xfc, 0xcd, 0xcc, 0xcc, 0xcc, 0xdd, 0xdf, 0xff, 0x66, 0x60, 0x00, 
+	0x00, 0x07, 0x77, 0xff, 0xf5, 0x55, 0x11, 0x11, 0x11, 0x55, 0x5e, 0xee, 0xee, 0xed, 0xde, 0xdd, 0xed, 0xde, 0xdd, 0xed, 0xde, 0xdd, 0xee, 0xee, 
+	0xee, 0xe5, 0x55, 0x11, 0x11, 0x11, 0x55, 0x5f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x11, 0x15, 0x55, 
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x11, 0x00, 0x00, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
+	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x24, 0x44, 0x99, 0x92, 0x22, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
+	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x01, 0x12, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x70, 0x00, 0x00, 0x08, 0x88, 
+	0xdd, 0xde, 0xee, 0xdd, 0xd3, 0x33, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x02, 0x22, 0xbb, 0xbc, 0xcc, 
+	0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x99, 0x90, 0x00, 0x00, 0x03, 0x33, 0x99, 0x9a, 0xab, 0x33, 0x30, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
+	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x03, 0x33, 0x55, 0x57, 0x77, 0xcc, 0xc3, 0x33, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
+	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x02, 0x22, 0xbb, 0xbc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xaa, 0xa0, 0x00, 0x00, 0x08, 0x88, 
+	0xee, 0xef, 0xff, 0xbb, 0xb2, 0x22, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x01, 0x11, 0x88, 0x89, 0x99, 
+	0x88, 0x98, 0x89, 0x88, 0x99, 0x99, 0x77, 0x70, 0x00, 0x00, 0x01, 0x11, 0x66, 0x67, 0x77, 0x11, 0x10, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
+	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x11, 0x33, 0x30, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x20, 0x00, 0x00, 0x05, 0x55, 0x88, 0x8a, 0xaa, 0xdd, 0xd4, 0x44, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
+	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x02, 0x22, 0xdd, 0xde, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xb0, 0x00, 0x00, 0x07, 0x77, 
+	0xee, 0xee, 0xee, 0x88, 0x81, 0x11, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x01, 0x11, 0x55, 0x55, 0x55, 
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x33, 0x34, 0x44, 0x00, 0x00, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 
+	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4f, 0xff, 0x77, 0x70, 0x00, 0x00, 0x07, 0x77, 0xff, 0xf9, 0x99, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x99, 0x9f, 0xff, 0x77, 0x70, 0x00, 
+	0x00, 0x05, 0x55, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
+	0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x00, 0x00, 0x00, 
+	
+};
+
+extern const unsigned char EnjoyBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x33, 0x37, 0x77, 0x99, 0x9a, 0xaa, 0xaa, 0xa8, 0x88, 0x66, 0x62, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4a, 0xaa, 0xee, 0xef, 0xff, 0xee, 0xed, 0xdd, 0xdd, 0xde, 0xee, 0xff, 0xfd, 0xdd, 
+	0x99, 0x93, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x88, 0xee, 0xee, 0xee, 
+	0xaa, 0xa5, 0x55, 0x33, 0x32, 0x22, 0x22, 0x23, 0x33, 0x66, 0x6b, 0xbb, 0xee, 0xfd, 0xdd, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0x9f, 0xff, 0xbb, 0xb4, 0x44, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
+	0x66, 0x6d, 0xdd, 0xee, 0xe6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xff, 0xfa, 0xaa, 0x11, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xcc, 0xce, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x33, 0x4e, 0xee, 0xcc, 0xc2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x44, 0x4e, 0xee, 0xcc, 0xc1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xff, 0xf6, 0x66, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x22, 0xdd, 0xeb, 0xbb, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0xdd, 0xdb, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xff, 0xf6, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 
+	0xee, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 0xee, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xad, 0xde, 0x22, 0x20, 0x00, 
+	0x00, 0x07, 0x77, 0xff, 0xf4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 0xdd, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 
+	0xdd, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x88, 0x8e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x08, 0x88, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x7e, 0xee, 0x55, 0x50, 0x00, 
+	0x00, 0x08, 0x88, 0xee, 0xf3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7e, 0xee, 0x44, 0x40, 0x00, 0x00, 0x06, 0x66, 0xff, 0xf5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 
+	0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x99, 0x9e, 0xee, 0x33, 0x30, 0x00, 
+	0x00, 0x04, 0x44, 0xee, 0xe9, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xcc, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 
+	0xcc, 0xc0, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xcc, 0xcc, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0xcc, 0xcd, 0xdd, 0x22, 0x20, 0x00, 0x00, 0x0c, 0xcc, 
+	0xbb, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xbb, 0xcc, 0xc0, 0x00, 0x00, 0x05, 0x55, 0xee, 0xf8, 0x88, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x6f, 0xff, 0x88, 0x80, 0x00, 0x00, 0x0a, 0xaa, 0xcc, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5c, 0xcc, 
+	0xaa, 0xa0, 0x00, 0x11, 0x1b, 0xbb, 0xee, 0xe3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0xbb, 0xee, 0xe6, 0x66, 0x00, 0x03, 0x33, 
+	0xdd, 0xdc, 0xcc, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcc, 0xcc, 0xcc, 0x33, 0x31, 0x11, 0x99, 0x9f, 0xff, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xdd, 0xde, 0xee, 0x66, 0x70, 0x00, 0x00, 0x0d, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xd0, 0x00, 
+	0x00, 0x09, 0x99, 0xee, 0xfa, 0xaa, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3c, 0xcc, 0xff, 0xfa, 0xaa, 
+	0x44, 0x41, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x26, 0x66, 0xcc, 0xcf, 0xff, 0xaa, 0xa4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x99, 0x9e, 0xee, 0xee, 0xec, 0xcc, 0xaa, 0xa8, 0x89, 0x99, 0x9a, 0xaa, 0xdd, 0xdf, 0xff, 
+	0xdd, 0xda, 0xaa, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 
+	0x88, 0x9c, 0xcc, 0xee, 0xee, 0xee, 0xee, 0xed, 0xdd, 0xbb, 0xb7, 0x77, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x23, 0x33, 0x33, 0x32, 0x22, 0x11, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	
+};
+
+extern const unsigned char HeartBmp[] = {
+//Bitmap width, highth in pixel and next pixel data 12bpp
+	0x10, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x88, 0x88, 0x88, 0x44, 0x40, 0x00, 0x11, 0x15, 0x55, 0x88, 0x87, 0x77, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x6b, 0xbb, 0x77, 0x77, 0x77, 0xbb, 0xb8, 0x88, 0x99, 0x9a, 0xaa, 0x66, 0x68, 0x88, 0xbb, 0xb4, 0x44, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x33, 0xbb, 0xb2, 0x22, 0x00, 0x00, 0x00, 0x11, 0x1b, 0xbb, 0x88, 0x90, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4a, 0xaa, 0x11, 0x10, 0x00, 
+	0x00, 0x07, 0x77, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x44, 0x40, 0x00, 
+	0x00, 0x08, 0x88, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x66, 0x60, 0x00, 
+	0x00, 0x07, 0x77, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x44, 0x40, 0x00, 
+	0x00, 0x04, 0x44, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2a, 0xaa, 0x11, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x99, 0x96, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x87, 0x77, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x33, 0x3b, 0xbb, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xaa, 0xa1, 0x11, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0xaa, 0xa1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3b, 0xbb, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7a, 0xaa, 0x11, 0x10, 0x00, 0x00, 0x03, 0x33, 0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xaa, 0xa1, 0x11, 0x33, 0x3b, 0xbb, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7b, 0xbb, 0xbb, 0xb5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	
+};
+
+
+#endif /*LIB_G_ICONS_H_*/
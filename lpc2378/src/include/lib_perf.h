@@ -0,0 +1,110 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        lib_perf.h
+* Description: Per task CPU utilisation accounting done by uCOS-II context switch hook
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+*              Time is measured by Timer3 fine time stamp (Timer3 Ticks and Timer Counter, about 0.48us resolution).
+*              Time spent in IRQ handlers is accounted separately and is not charged to interrupted task.
+* History:
+*              17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+#ifndef LIB_PERF_H_
+#define LIB_PERF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "type.h"
+#include "os_cfg.h"
+
+//set to 0 to remove accounting from context switch hook and IRQ dispatcher
+#define PERF_ACCOUNTING_EN	1
+
+//max number of tasks reported (application tasks + idle and statistic system tasks)
+#define PERF_MAX_TASKS		(OS_MAX_TASKS+2)
+
+//CPU usage of one task within accounting window
+typedef struct
+{
+	BYTE mPrio;//task priority (uCOS-II task identifier)
+	WORD mSwitches;//number of times the task was switched in
+	WORD mLoad;//CPU time used by the task in 0.1% of the window
+	DWORD mRunTime;//CPU time used by the task in Timer3 counts (about 0.48us)
+} 	sPerfTask;
+
+//CPU usage of all tasks which run within accounting window
+typedef struct
+{
+	DWORD mWindow;//accounting window length in Timer3 ticks (120us)
+	DWORD mIsrTime;//CPU time used by IRQ handlers in Timer3 counts (about 0.48us)
+	WORD mIsrLoad;//CPU time used by IRQ handlers in 0.1% of the window
+	BYTE mTaskNo;//number of valid mTask entries (sorted by priority)
+	sPerfTask mTask[PERF_MAX_TASKS];
+} 	sPerfStatus;
+
+/*
+*********************************************************************************************************
+* Name:                                    PerfTaskSwHook
+*
+* Description: Charges time elapsed since the last context switch to the task being switched out and counts
+*              switch in of the new task
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 			Called by OSTaskSwHook with interrupts disabled. OSPrioCur is the task being switched out and
+*           OSPrioHighRdy the task being switched in.
+* *********************************************************************************************************
+*/
+extern void PerfTaskSwHook(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    PerfIsrEnter, PerfIsrExit
+*
+* Description: Mark start and end of IRQ handlers execution
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 			Called by OS_CPU_ExceptHndlr around IRQ handlers dispatch loop (no nesting)
+* *********************************************************************************************************
+*/
+extern void PerfIsrEnter(void);
+extern void PerfIsrExit(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    PerfSnapshot
+*
+* Description: Get CPU usage of all tasks and IRQ handlers since the previous snapshot and start a new window
+*
+* Arguments:   pOutStatus - pointer to structure where CPU usage is stored
+*
+* Returns:     none
+*
+* Note(s):
+* 			Only one task should take snapshots (cMonitorMngr) otherwise windows would be shortened
+* *********************************************************************************************************
+*/
+extern void PerfSnapshot(sPerfStatus *pOutStatus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*LIB_PERF_H_*/
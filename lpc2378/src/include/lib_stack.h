@@ -0,0 +1,74 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        lib_stack.h
+* Description: Tasks and exception stacks high-water mark measurement
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+*              Stacks are filled with OS_TASK_STK_FILL pattern when tasks are created (OSTaskCreateExt with
+*              OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR) and exception stack when uCOS-II is initialized.
+*              Pattern is never restored so stack entries overwritten once show the deepest stack usage.
+* History:
+*              17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+#ifndef LIB_STACK_H_
+#define LIB_STACK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "type.h"
+#include "os_cfg.h"
+
+//max number of tasks reported (application tasks + idle and statistic system tasks)
+#define STACK_MAX_TASKS		(OS_MAX_TASKS+2)
+
+//stack usage of one task
+typedef struct
+{
+	BYTE mPrio;//task priority (uCOS-II task identifier)
+	WORD mSize;//stack size in bytes
+	WORD mUsed;//the highest number of stack bytes used so far (high-water mark)
+} 	sStackTask;
+
+//stack usage of all tasks created with stack checking and of exception stack
+typedef struct
+{
+	WORD mExceptSize;//exception (IRQ) stack size in bytes
+	WORD mExceptUsed;//exception stack high-water mark in bytes
+	WORD mTotalFree;//number of task stacks bytes never used so far (exception stack not included)
+	BYTE mTaskNo;//number of valid mTask entries (sorted by priority)
+	sStackTask mTask[STACK_MAX_TASKS];
+} 	sStackStatus;
+
+/*
+*********************************************************************************************************
+* Name:                                    StackScan
+*
+* Description: Get stack high-water mark of all tasks and of exception stack
+*
+* Arguments:   pOutStatus - pointer to structure where stack usage is stored
+*
+* Returns:     none
+*
+* Note(s):
+* 			Only untouched part of every stack is scanned and with interrupts enabled so it should be
+*           called periodically by low priority task (cMonitorMngr).
+*           Tasks created without OS_TASK_OPT_STK_CHK are not reported.
+* *********************************************************************************************************
+*/
+extern void StackScan(sStackStatus *pOutStatus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*LIB_STACK_H_*/
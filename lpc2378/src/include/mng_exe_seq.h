@@ -0,0 +1,52 @@
+/*
+* File: mng_exe_seq.h
+* Description: Walle Simply Sequencer programs compiled by tools/seqc from mng_exe.seq
+* IMPORTANT! Generated file - do not edit, change sequence source and rebuild
+*/
+#ifndef MNG_EXE_SEQ_H_
+#define MNG_EXE_SEQ_H_
+
+#include "type.h"
+#include "mng_exe_seq_def.h"
+
+//sequence of commands executed by WALL-E when TEST program is executed
+const static BYTE WalleTestSeqProg[]={
+	0x89,0xA5,0x03,          	/*    0: ! HTR 933 //turn left 45 deg */
+	0x81,0xF4,0x01,0x00,0x00,	/*    3: ! DLY 500 //wait 500ms */
+	0x89,0xE3,0x01,          	/*    8: ! HTR 483 //turn right 45 deg */
+	0x81,0xF4,0x01,0x00,0x00,	/*   11: ! DLY 500 //wait 500ms */
+	0x89,0xC4,0x02,          	/*   16: ! HTR 708 //turn central */
+	0x81,0xF4,0x01,0x00,0x00,	/*   19: ! DLY 500 //wait 500ms */
+	0x8E,                    	/*   24: ! AON  //turn on arms servo */
+	0x8A,0x09,0x02,          	/*   25: ! LAM 521 //left arm max up */
+	0x81,0xF4,0x01,0x00,0x00,	/*   28: ! DLY 500 //wait 500ms */
+	0x8B,0x99,0x03,          	/*   33: ! RAM 921 //right arm max up */
+	0x81,0xF4,0x01,0x00,0x00,	/*   36: ! DLY 500 //wait 500ms */
+	0x8F,                    	/*   41: ! AOF  //turn off arms servo */
+	0x84,0x1E,0x00,0x02,     	/*   42: ! MFD 30 2 //move forward 30 steps using LOW_PROFILE */
+	0x85,0x1E,0x00,0x02,     	/*   46: ! MRD 30 2 //move backward 30 steps using LOW_PROFILE */
+	0x86,                    	/*   50: ! TRL  //turn left 90 degs */
+	0x87,                    	/*   51: ! TRR  //turn right 90 degs */
+	0x80,                    	/*   52: ! END  //terminate sequence */
+};
+
+//sequence of commands executed by Wall-e for ENJOY program
+const static BYTE WalleEnjoySeqProg[]={
+	                         	/*    0: l start */
+	0x84,0x0A,0x00,0x02,     	/*    0: ! MFD 10 2 //move forward 10 steps using LOW_PROFILE */
+	0x85,0x0A,0x00,0x02,     	/*    4: ! MRD 10 2 //move backward 10 steps using LOW_PROFILE */
+	0x8E,                    	/*    8: ! AON  //turn on arms servo */
+	0x8D,0x99,0x03,          	/*    9: ! AOM 921 //move oposit so right arm is max up */
+	0x8D,0x62,0x02,          	/*   12: ! AOM 610 //move oposit so right arm is max down */
+	0x4A,0xB0,0x02,          	/*   15: * LAM 688 //left arm horizontal position, */
+	0x4B,0xEA,0x02,          	/*   18: * RAM 746 //right arm horizontal position */
+	0x8F,                    	/*   21: ! AOF  //turn off arms servo */
+	0x89,0x0F,0x03,          	/*   22: ! HTR 783 //turn left 15 deg */
+	0x89,0x79,0x02,          	/*   25: ! HTR 633 //turn right 15 deg */
+	0x89,0xC4,0x02,          	/*   28: ! HTR 708 //turn central */
+	0x87,                    	/*   31: ! TRR  //turn Walle right 90 degs */
+	0x83,0x00,0x00,0x04,0x00,	/*   32: ! RPT start 4 //repeat 4 times to make full 360 deg movement */
+	0x80,                    	/*   37: ! END  //terminate sequence */
+};
+
+#endif /*MNG_EXE_SEQ_H_*/
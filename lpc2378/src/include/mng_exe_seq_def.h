@@ -0,0 +1,99 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        mng_exe_seq_def.h
+* Description: Walle Simply Sequencer language and compiled sequence program format
+*              shared by the ExeMngr sequence interpreter and the host sequence compiler (tools/seqc.c)
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created (definitions moved from mng_exe.hpp)
+*********************************************************************************************************
+*/
+#ifndef MNG_EXE_SEQ_DEF_H_
+#define MNG_EXE_SEQ_DEF_H_
+
+//IMPORTANT! This file is included by host compiled tools/seqc.c so keep it free of target specific includes
+
+#define MAX_SEQ_TOKEN_LENGTH	20 //assumes longes sequence token is 19 characters plus terminating null
+
+//constants related to sequence pasring and programming
+//strings to define exe code types
+#define SEQ_EXE_CODE_ASYNC_STR	"*" //used to request asycnchronous command call (if allowed)
+#define SEQ_EXE_CODE_SYNC_STR	"!" //used to request synchronous command call (if allowed)
+#define SEQ_EXE_CODE_LABEL_STR	"l" //l <label name> used to mark line with a label (not a command)
+
+//exe code IDs
+#define SEQ_EXE_CODE_NO		0 //undefined execution code
+#define SEQ_EXE_CODE_ASYNC	1 //used to request asycnchronous command call (if allowed)
+#define SEQ_EXE_CODE_SYNC	2 //used to request synchronous command call (if allowed)
+#define SEQ_EXE_CODE_LABEL	3 //used to mark line with a label (not a command)
+
+#define SEQ_ACTION_UNKNOWN_MSG	"\nUNKNOWN SEQUENCE COMMAND\n"
+
+#define SEQ_HALT_DELAY_TICKS 1000 //number of OS Ticks used by infinite delay loop in HALT sequence
+
+//action token strings
+#define SEQ_ACT_DELAY_STR				"DLY" //DLY <Time In Miliseconds> - delay sequence execution
+#define SEQ_ACT_HALT_STR				"HLT" //HLT - halt sequence execution for infinite time
+#define	SEQ_ACT_RPT_STR					"RPT" //RPT <Label Name> [<Number>] - repeat jumping to label otional number of times
+#define SEQ_ACT_END_STR					"END" //mark end of sequence
+#define SEQ_ACT_MOVE_FRD_STR			"MFD" //MFD <Distance> <Profile> - move forward
+#define SEQ_ACT_MOVE_BWR_STR			"MRD" //MRD <Distance> <Profile> - move backward
+#define SEQ_ACT_TURN_LEFT_STR			"TRL" //TRL - turn left 90 degrees
+#define SEQ_ACT_TURN_RIGHT_STR			"TRR" //TRR - turn right 90 degrees
+#define	SEQ_ACT_TURN_AROUND_STR			"TRA" //TRA - turn around 360 degrees with randomly selected direction
+#define SEQ_ACT_TURN_HEAD_STR			"HTR" //HTR <PositionCount> - turn head as defined by position count
+#define SEQ_ACT_LEFT_ARM_STR			"LAM" //LAM <PositionCount> - move left arm as specified by position count
+#define SEQ_ACT_RIGHT_ARM_STR			"RAM" //RAM <PositionCount> - move right are as specified by position count
+#define SEQ_ACT_ARMS_SYNC_MOVE_STR		"ASM" //ASM <PositionCount> - move both arms to position specified by position count
+#define SEQ_ACT_ARMS_OPOSIT_MOVE_STR	"AOM" //AOM <PositionCount> - move both arme but oposit direction (one up other down)
+#define SEQ_ACT_ARMS_ON_STR				"AON" //AON - turn on arms servo
+#define SEQ_ACT_ARMS_OFF_STR			"AOF" //AOF - turn off arms servo
+
+
+//sequence actions ID
+#define SEQ_ACT_END					0 //end of sequence commands - terminate sequence processing
+#define SEQ_ACT_DELAY       		1 //delay
+#define SEQ_ACT_HALT				2 //halt sequence execution
+#define	SEQ_ACT_RPT					3 //repeat
+#define SEQ_ACT_MOVE_FRD			4 //move forward
+#define SEQ_ACT_MOVE_BWR			5 //move backward
+#define SEQ_ACT_TURN_LEFT			6 //turn left 90 deg
+#define SEQ_ACT_TURN_RIGHT			7 //turn right 90 deg
+#define	SEQ_ACT_TURN_AROUND			8 //turn 360 deg direction selected rundomly
+#define SEQ_ACT_TURN_HEAD			9 //turn head to sepcified position
+#define SEQ_ACT_LEFT_ARM			10//trun left ar to specified position
+#define SEQ_ACT_RIGHT_ARM			11//turn right arm to specified position
+#define SEQ_ACT_ARMS_SYNC_MOVE		12//turn both arms synchronously to specified position
+#define SEQ_ACT_ARMS_OPOSIT_MOVE 	13//move both arm but oposit direction (one up other down)
+#define SEQ_ACT_ARMS_ON				14//turn on arms servo
+#define SEQ_ACT_ARMS_OFF			15//turn off arms servo
+
+#define SEQ_ACT_NO					16//number of sequence actions (actions ID are 0..SEQ_ACT_NO-1)
+
+//compiled sequence program is a const BYTE table in flash generated by tools/seqc from mng_exe.seq
+//every instruction is opcode byte followed by binary arguments of the action (little endian, no alignment)
+//opcode byte keeps action ID in bits 0-5 and exe code ID in bits 6-7
+#define SEQ_OP_ACT_MASK		0x3F
+#define SEQ_OP_EXE_SHIFT	6
+#define SEQ_OP(Act,Exe)		((Act)|((Exe)<<SEQ_OP_EXE_SHIFT))
+
+//bytes of arguments following opcode of every action (indexed by action ID)
+//DLY: DWORD time in miliseconds
+//RPT: WORD jump target (offset of instruction following the label from program start), WORD number of repetitions
+//MFD, MRD: WORD distance, BYTE speed profile
+//HTR, LAM, RAM, ASM, AOM: WORD position count
+#define SEQ_ACT_ARG_SIZES	{0,4,0,4,3,3,0,0,0,2,2,2,2,2,0,0}
+
+#define SEQ_NO_JUMP_TARGET	0xFFFF //RPT jump target when label is not found in the sequence (RPT does not jump)
+
+//lines which do nothing (empty lines, labels, unknown actions, actions with missing arguments) are not compiled
+//and program is compiled up to the first END so every compiled program is terminated by SEQ_ACT_END opcode
+
+#endif /*MNG_EXE_SEQ_DEF_H_*/
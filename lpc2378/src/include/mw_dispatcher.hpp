@@ -1,357 +1,525 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        mw_dispatcher.hpp
-* Description: Key communication middleware class.
-*              Defines dispatcher capable to dispatch notifiers from registered publishers to registered
-*              subscribers without subscribers knowing publishers and vice versa.
-* Author:      Bogdan Kowalczyk
-* Date:        13-Dec-2008
-* History:
-* 13-Dec-2008 - Initial version created
-*********************************************************************************************************
-*/
-#ifndef DISPATCHER_HPP_
-#define DISPATCHER_HPP_
-
-#include "type.h"
-#include "lib_error.h"
-#include "mw_notifier.hpp"
-#include "wrp_sem.hpp"
-#include "mw_publisher.hpp"
-#include "mw_subscriber.hpp"
-
-//forward declaration
-class cDispatchThread;
-
-//defines for cDispatcher return errors
-#define DISPATCHER_NO_ERROR			0
-#define PUBLISHER_REGISTER_ERROR	2
-#define SUBSCRIBER_REGISTER_ERROR	4
-#define PUBLISHER_UNREGISTER_ERROR	8
-#define SUBSCRIBER_UNREGISTER_ERROR	10
-
-/*
-*********************************************************************************************************
-* Name:                            cDispatcher Class 
-* 
-* Description: Key class of middleware keeps list of publishers and subscribers and
-*              dispatches notifiers from publisher to their subscribers
-*       
-*
-* *********************************************************************************************************
-*/
-template <BYTE PublisherTableSize,BYTE SubscriberTableSize> 
-class cDispatcher
-{
-private:
-	// NotifierIdFlags
-	//           |31|30|29|......................|2|1|0|
-	//           Bit0=1 - Notifier ID = 1 to be received by subscriber
-	//           Bit1=1 - Notifier ID = 2 to be receved by subscriber
-	//
-	//           Bit31=1 - Notifier ID = 32 to be received by subscriber
-	struct sSubscriberEntry
-	{
-		cBaseSubscriber* m_pSubscriber;//address of subscriber for notifiers defined by m_IdFilags 
-		DWORD m_NotifierIdFlags;// list of Notifiers m_pSubscribers wants to receive
-		WORD m_Error_Counter;//counts errors when dispatcher cannot put Notifier to the receiver queue
-	};
-	WORD m_Total_Dispatch_Error_Counter;//counts errors total number of Notifier dipstacher errors not related to particular subscriber
-	cBasePublisher* m_PublisherTable[PublisherTableSize];
-	sSubscriberEntry m_SubscriberTable[SubscriberTableSize];
-	cMutex m_PublisherMutex, m_SubscriberMutex; //mutexes to synchronize access to subscriber and publisher tables
-	void DispatchNotifier(cNotifier* pNotifier); //dispatch Notifier pointed by pNotifier to its all subscribers
-	
-	//makes one dispatching sequence i.e. polls all publisher send queues
-	//and get notifiers out of them dispatching to receive queues of all registered subscribers
-	void Dispatch();
-public:
-	
-	//constructor - initialize empty publisher and subscribers lists
-	cDispatcher();
-	
-	//return number of counted cases when notifier was not dispatched because of subscriber receive queue problems
-	inline WORD GetTotalDispatchErrorCounter(void){return m_Total_Dispatch_Error_Counter;};
-	
-	//register publishers to know what send queue need to be polled
-	//IMPORTANT! Exception is generated when publisher cannot be registered
-	void RegisterPublisher(cBasePublisher& rPublisher);
-	
-	//remove publisher from the list of registered publishers
-	void UnregisterPublisher(cBasePublisher& rPublisher);
-	
-	//pSubscriber subscribes for specified notifiers usung notifiers mask
-	//
-	//input:
-	//	pSubscriber - adress of subscriber which subscribes for notifiers
-	//  NotifierIdMask - mask of notifiers ID subscriber subscribes
-	//IMPORTANT! Exception is generated when subscriber cannot be registered
-	void RegisterSubscriber(cBaseSubscriber& rSubscriber, DWORD NotifierIdMask);
-	
-	// rSubscriber unsubscribes for specified notifiers usung notifiers mask or completely unsubscribe
-	//
-	//input:
-	//	rSubscriber - subscriber which unsubscribes for notifiers
-	//  NotifierIdMask - mask of notifiers ID subscriber unsubscribes - NT_NONE means remove subscriber form the list
-	void UnregisterSubscriber(cBaseSubscriber& pSubscriber, DWORD NotifierIdMask=NT_NONE);
-	
-	//get mask of notifiers subscriber subscribe for
-	DWORD GetSubscriberNotifiers(BYTE InSubscriberNo);
-	//get counter of not received notifiers of the subscriber
-	WORD GetNotifierErrorCounter(BYTE InSubscriberNo);
-	
-	friend class cDispatchThread;//only cKernel's cDispatchThread is allowed to dispatch notifiers
-};//cDispatcher
-
-//create dispatcher and setup publisher and subscriber lists as empty
-template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
-cDispatcher<PublisherTableSize,SubscriberTableSize>::cDispatcher()
-{
-	BYTE i;
-
-	for(i=0;i<PublisherTableSize;i++)
-	{
-		m_PublisherMutex.Acquire();//get O.K. for access
-		m_PublisherTable[i]=static_cast<cBasePublisher*>(NULL);
-		m_PublisherMutex.Release();//release mutex to signal that resource is free
-	};
-	for(i=0;i<SubscriberTableSize;i++)
-	{
-		m_SubscriberMutex.Acquire();//get O.K. for access
-		m_SubscriberTable[i].m_pSubscriber=static_cast<cBaseSubscriber*>(NULL);
-		m_SubscriberTable[i].m_NotifierIdFlags = NT_NONE;
-		m_SubscriberTable[i].m_Error_Counter = 0;//none errors when initialized
-		m_SubscriberMutex.Release();//release mutex to signal that resource is free
-	};
-	m_Total_Dispatch_Error_Counter=0;//none errors when initialized
-}//cDispatcher
-
-
-//register publishers to know what send queue need to be polled
-//return:
-//	DISPATCHER_NO_ERROR - when no error and Publisher is registered in dispatcher
-//  PUBLISHER_REGISTER_ERROR - when cannot register publsher no place for it
-template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
-void cDispatcher<PublisherTableSize,SubscriberTableSize>::RegisterPublisher(cBasePublisher& rPublisher)
-{
-	BYTE i;
-	//check if publisher not already registered
-	for(i=0;i<PublisherTableSize;i++)
-	{
-		m_PublisherMutex.Acquire();//get O.K. for access
-		if(m_PublisherTable[i]==&rPublisher)//check if we do not have publisher already registered
-			{
-			m_PublisherMutex.Release();//release mutex to signal that resource is free
-			return; 
-			};
-		m_PublisherMutex.Release();//release mutex to signal that resource is free
-	};
-	//publisher not already registered find free place and register
-	for(i=0;i<PublisherTableSize;i++)
-	{
-		m_PublisherMutex.Acquire();//get O.K. for access
-		//find first empty entry in m_PublisherTable and register publisher
-		if(m_PublisherTable[i]==static_cast<cBasePublisher*>(NULL))
-			{
-			m_PublisherTable[i]=&rPublisher;
-			m_PublisherMutex.Release();//release mutex to signal that resource is free
-			return;
-			};
-		m_PublisherMutex.Release();//release mutex to signal that resource is free
-	};
-	//if we got this place there is not free place in m_PublisherTable to register publisher so generate an exception
-	PUBLISHER_REGISTER_EXCEPTION;
-}// cDispatcher::RegisterPublisher
-
-
-//remove publisher from the list of registered publishers
-template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
-void cDispatcher<PublisherTableSize,SubscriberTableSize>::UnregisterPublisher(cBasePublisher& rPublisher)
-{
-	BYTE i;
-	//check if publisher registered
-	for(i=0;i<PublisherTableSize;i++)
-	{
-		m_PublisherMutex.Acquire();//get O.K. for access
-		if(m_PublisherTable[i]==&rPublisher)//remove it when found
-			{
-			m_PublisherTable[i]=static_cast<cBasePublisher*>(NULL);
-			m_PublisherMutex.Release();//release mutex to signal that resource is free
-			return; 
-			};
-		m_PublisherMutex.Release();//release mutex to signal that resource is free
-	};
-	//if we get this place there was not publisher subscribed so it is unsubscribed anyhow
-	return; 
-}//cDispatcher::UnregisterPublisher
-
-
-//rSubscriber subscribes for specified notifiers usung notifiers mask
-//
-//input:
-//	rSubscriber - subscriber which subscribes for notifiers
-//  NotifierIdMask - mask of notifiers ID subscriber subscribes
-//return:
-//	DISPATCHER_NO_ERROR - when no error and subscriber is registered in dispatcher for notifiers
-//  SUBSCRIBER_REGISTER_ERROR - when cannot register subscriber for notifiers
-template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
-void cDispatcher<PublisherTableSize,SubscriberTableSize>::RegisterSubscriber(cBaseSubscriber& rSubscriber, DWORD NotifierIdMask)
-{
-	BYTE i;
-	//check if subscriber not already registered
-	for(i=0;i<SubscriberTableSize;i++)
-	{
-		m_SubscriberMutex.Acquire();//get O.K. for access
-		if(m_SubscriberTable[i].m_pSubscriber==&rSubscriber)//if subscriber already registered update its mask
-			{
-			m_SubscriberTable[i].m_NotifierIdFlags|=NotifierIdMask;//set mask bits as requested by NotifierIdMask
-			m_SubscriberMutex.Release();//release mutex to signal that resource is free
-			return; 
-			};
-		m_SubscriberMutex.Release();//release mutex to signal that resource is free
-	};
-	//subscriber not already registered find free place and register
-	for(i=0;i<SubscriberTableSize;i++)
-	{
-		m_SubscriberMutex.Acquire();//get O.K. for access
-		//find first empty entry in m_PublisherTable and register subscriber
-		if(m_SubscriberTable[i].m_pSubscriber==static_cast<cBaseSubscriber*>(NULL))
-			{
-			m_SubscriberTable[i].m_pSubscriber=&rSubscriber;//register subscriber
-			m_SubscriberTable[i].m_NotifierIdFlags=NotifierIdMask;//set mask bits as requested by NotifierIdMask
-			m_SubscriberTable[i].m_Error_Counter = 0;//none errors when initialized
-			m_SubscriberMutex.Release();//release mutex to signal that resource is free
-			return;
-			};
-		m_SubscriberMutex.Release();//release mutex to signal that resource is free
-	};
-	//if we got this place there is not free place in m_SubscriberTable to register subscriber so generate an exception
-	SUBSCRIBER_REGISTER_EXCEPTION;	
-}//cDispatcher::RegisterSubscriber
-
-
-// rSubscriber unsubscribes for specified notifiers usung notifiers mask or completely unsubscribe
-//
-//input:
-//	rSubscriber - subscriber which unsubscribes for notifiers
-//  NotifierIdMask - mask of notifiers ID subscriber unsubscribes - NT_NONE means remove subscriber form the list
-template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
-void cDispatcher<PublisherTableSize,SubscriberTableSize>::UnregisterSubscriber(cBaseSubscriber& rSubscriber, DWORD NotifierIdMask)
-{
-	BYTE i;
-	//check if subscriber not already registered
-	for(i=0;i<SubscriberTableSize;i++)
-	{
-		m_SubscriberMutex.Acquire();//get O.K. for access
-		if(m_SubscriberTable[i].m_pSubscriber==&rSubscriber)//if subscriber registered update its mask
-		{
-			if(NotifierIdMask==NT_NONE)//if request to unsubscribe completely
-			{
-				m_SubscriberTable[i].m_NotifierIdFlags=NT_NONE;//clear mask bits
-				m_SubscriberTable[i].m_pSubscriber=static_cast<cBaseSubscriber*>(NULL);//mark entry in subscriber table as empty
-				m_SubscriberTable[i].m_Error_Counter = 0;//none errors when unsubscribed
-			}else
-			{
-				m_SubscriberTable[i].m_NotifierIdFlags&=(~NotifierIdMask);//clear mask bits as requested by NotifierIdMask&=(~NotifierIdMask)	
-			}
-		m_SubscriberMutex.Release();//release mutex to signal that resource is free
-		return; 
-		};
-		m_SubscriberMutex.Release();//release mutex to signal that resource is free
-	};
-	//if we got this place there is not subscriber registered so there is nothing to unregister
-	return;		
-}//cDispatcher::UnregisterSubscriber
-
-//pNotifier is the address of Notifier to be dispatched to all its subscribers receive queue
-template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
-void cDispatcher<PublisherTableSize,SubscriberTableSize>::DispatchNotifier(cNotifier* pNotifier)
-{
-	BYTE i;
-	BYTE Result;//hold result of Send operation
-	//go through whole subscriber list
-	for(i=0;i<SubscriberTableSize;i++)
-	{
-		m_SubscriberMutex.Acquire();//get O.K. for access the subscriber lists
-
-		if((m_SubscriberTable[i].m_NotifierIdFlags & (pNotifier->GetNotifierId()))&& (m_SubscriberTable[i].m_pSubscriber))//if subscriber wants to received this notifier ID send it
-		{
-			pNotifier->Inc();//increment referencies to Notifier befor we place it into receiver queue of subscriber
-			if(pNotifier->GetHandling() & NT_HND_HIGH_PRT)//if high priority notifier handling set
-			{//put notifier on the front of the queue if high priority treatment requested
-				Result=((m_SubscriberTable[i].m_pSubscriber)->GetReceiveQueue())->SendFront(pNotifier);	
-			}else
-			{//standard handling of notifier requested
-				Result=((m_SubscriberTable[i].m_pSubscriber)->GetReceiveQueue())->Send(pNotifier);
-			}
-			if (Result!=OS_NO_ERR)//if Notifier was not able to be delivered
-			{
-			//may DO: Consider to empty Queue when full
-			//To make full queue empty you cannot flash it but only to Receive notifier by notifier to release	
-			//occupied memory via SmartPointer automatically	
-			m_SubscriberTable[i].m_Error_Counter += 1;//increment error count as Notifier was not transfered
-			m_Total_Dispatch_Error_Counter+=1; //not only individual subscriber erro counter is increased but also total one
-
-			pNotifier->Dec();//decrement referencies because Notifier was finally not placed into receiver queue of subscriber
-			};
-		}
-		m_SubscriberMutex.Release();//release mutex to signal that resource is free
-	}
-}//cDispatcher::DispatchNotifier
-
-
-//makes one dispatching sequence i.e. polls all publisher send queues
-//and get notifiers out of them dispatching to receive queues of all registered subscribers
-template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
-void cDispatcher<PublisherTableSize,SubscriberTableSize>::Dispatch()
-{
-	BYTE i;
-	//check if publisher registered
-	cNotifier* pNotifier;//temporary message holder
-
-	//go through all publishers
-	for(i=0;i<PublisherTableSize;i++)
-	{
-		m_PublisherMutex.Acquire();//get O.K. for access
-		if (m_PublisherTable[i])//if there is any publisher registered at this table position
-		{
-			pNotifier=static_cast<cNotifier*>((m_PublisherTable[i]->GetSendQueue())->Accept());//get message from the publisher's send queue
-			if(pNotifier)//if Notifier received
-			{
-				DispatchNotifier(pNotifier);//dispatch Notifier to all subscribers queues
-				pNotifier->Dec();//decrement reference count because pNotifier is not any longer kept in Send queue
-			}
-		}
-		m_PublisherMutex.Release();//release mutex to signal that resource is free
-	}	
-}//cDispatcher<PublisherTableSize,SubscriberTableSize>::Dispatch
-
-//get mask of notifiers subscriber subscribe for
-template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
-DWORD cDispatcher<PublisherTableSize,SubscriberTableSize>::GetSubscriberNotifiers(BYTE InSubscriberNo)
-{
-	if(InSubscriberNo < SubscriberTableSize)//if that is from the range of allwed subscribes
-		return m_SubscriberTable[InSubscriberNo].m_NotifierIdFlags;
-	else
-		return NT_NONE;
-}//cDispatcher<PublisherTableSize,SubscriberTableSize>::GetSubscriberNotifiers(BYTE InSubscriberNo)
-
- 
-//get counter of not received notifiers of the subscriber
-template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
-WORD cDispatcher<PublisherTableSize,SubscriberTableSize>::GetNotifierErrorCounter(BYTE InSubscriberNo)
-{
-	if(InSubscriberNo < SubscriberTableSize)//if that is from the range of allwed subscribes
-		return m_SubscriberTable[InSubscriberNo].m_Error_Counter;
-	else
-		return 0;
-}//cDispatcher<PublisherTableSize,SubscriberTableSize>::GetNotifierErrorCounter(BYTE InSubscriberNo)
-
-#endif /*DISPATCHER_HPP_*/
-
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        mw_dispatcher.hpp
+* Description: Key communication middleware class.
+*              Defines dispatcher capable to dispatch notifiers from registered publishers to registered
+*              subscribers without subscribers knowing publishers and vice versa.
+* Author:      Bogdan Kowalczyk
+* Date:        13-Dec-2008
+* History:
+* 13-Dec-2008 - Initial version created
+* 17-Oct-2026 - Dispatching is triggered by publishers through m_DispatchEvent instead of periodic polling
+* 17-Oct-2026 - Dispatch() drains all send queues round-robin up to configurable per cycle budget
+* 17-Oct-2026 - Added routing table from notifier ID to its subscribers rebuilt on (un)subscription
+* 17-Oct-2026 - Added cBaseDispatcher interface used by publishers to wake up dispatcher or to dispatch directly
+* 17-Oct-2026 - Publisher and subscriber mutexes with priority inheritance and their contention statistic
+*********************************************************************************************************
+*/
+#ifndef DISPATCHER_HPP_
+#define DISPATCHER_HPP_
+
+#include "type.h"
+#include "lib_error.h"
+#include "mw_notifier.hpp"
+#include "wrp_sem.hpp"
+#include "mw_publisher.hpp"
+#include "mw_subscriber.hpp"
+
+//forward declaration
+class cDispatchThread;
+
+//defines for cDispatcher return errors
+#define DISPATCHER_NO_ERROR			0
+#define PUBLISHER_REGISTER_ERROR	2
+#define SUBSCRIBER_REGISTER_ERROR	4
+#define PUBLISHER_UNREGISTER_ERROR	8
+#define SUBSCRIBER_UNREGISTER_ERROR	10
+
+//Dispatch() budget value which means drain all send queues until they are empty
+#define DISPATCH_UNLIMITED_BUDGET	0
+
+//priority inheritance priorities of the publisher and subscriber table mutexes
+//must be higher than dispatcher thread priority as all managers and dispatcher use them (see a_res_list.h)
+#define DISPATCHER_SUBSCRIBER_MUTEX_PIP	1
+#define DISPATCHER_PUBLISHER_MUTEX_PIP	2
+
+//number of different notifier IDs i.e. number of bits in DWORD notifier ID
+#define NO_OF_NOTIFIER_IDS			32
+
+/*
+*********************************************************************************************************
+* Name:                            cBaseDispatcher Class 
+* 
+* Description: Base class for the dispatcher template which defines interface used by publishers 
+*              registered in the dispatcher
+*       
+*
+* *********************************************************************************************************
+*/
+class cBaseDispatcher
+{
+protected:
+	//signaled by registered publishers on every successful cBasePublisher::Post()
+	//so dispatching thread runs only when there is a work to do
+	cEvent m_DispatchEvent;
+public:
+	virtual ~cBaseDispatcher(){};//virtual destructor
+	//called by registered publisher when notifier is placed into its send queue to wake up dispatcher
+	void NotifierPosted(){m_DispatchEvent.Signal();};
+	//called by registered publisher to dispatch notifier in the context of calling thread
+	//pure virtual function cannot be defined as DirectDispatch()=0 because g++ generates very big size of code
+	virtual void DirectDispatch(cNotifier* pNotifier){NOT_ALLOWED_STATE;};
+};//cBaseDispatcher
+
+/*
+*********************************************************************************************************
+* Name:                            cDispatcher Class 
+* 
+* Description: Key class of middleware keeps list of publishers and subscribers and
+*              dispatches notifiers from publisher to their subscribers
+*       
+*
+* *********************************************************************************************************
+*/
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize> 
+class cDispatcher:public cBaseDispatcher
+{
+private:
+	// NotifierIdFlags
+	//           |31|30|29|......................|2|1|0|
+	//           Bit0=1 - Notifier ID = 1 to be received by subscriber
+	//           Bit1=1 - Notifier ID = 2 to be receved by subscriber
+	//
+	//           Bit31=1 - Notifier ID = 32 to be received by subscriber
+	struct sSubscriberEntry
+	{
+		cBaseSubscriber* m_pSubscriber;//address of subscriber for notifiers defined by m_IdFilags 
+		DWORD m_NotifierIdFlags;// list of Notifiers m_pSubscribers wants to receive
+		WORD m_Error_Counter;//counts errors when dispatcher cannot put Notifier to the receiver queue
+	};
+	WORD m_Total_Dispatch_Error_Counter;//counts errors total number of Notifier dipstacher errors not related to particular subscriber
+	cBasePublisher* m_PublisherTable[PublisherTableSize];
+	sSubscriberEntry m_SubscriberTable[SubscriberTableSize];
+	//routing table - for every notifier ID bit keeps dense list of m_SubscriberTable positions of its subscribers
+	//m_RouteTable[IdBit][0..m_RouteCount[IdBit]-1] are kept in m_SubscriberTable order to preserve delivery order
+	//IMPORTANT! Routing table is rebuilt by BuildRoutingTable() on every subscription change
+	BYTE m_RouteTable[NO_OF_NOTIFIER_IDS][SubscriberTableSize];
+	BYTE m_RouteCount[NO_OF_NOTIFIER_IDS];
+	cMutex m_PublisherMutex, m_SubscriberMutex; //mutexes to synchronize access to subscriber and publisher tables
+	WORD m_DispatchBudget;//max number of notifiers dispatched in one Dispatch() cycle (DISPATCH_UNLIMITED_BUDGET - no limit)
+	BYTE m_NextPublisher;//publisher table position from which next Dispatch() cycle starts (round-robin)
+	void DispatchNotifier(cNotifier* pNotifier); //dispatch Notifier pointed by pNotifier to its all subscribers
+	//place pNotifier into receive queue of subscriber from m_SubscriberTable[SubscriberNo]
+	void DeliverNotifier(cNotifier* pNotifier, BYTE SubscriberNo);
+	
+	//rebuild m_RouteTable out of m_SubscriberTable
+	//IMPORTANT! must be called with m_SubscriberMutex acquired
+	void BuildRoutingTable(void);
+	
+	//translate one bit notifier ID into its bit number (NT_ID01->0, NT_ID02->1 ... NT_ID32->31)
+	static BYTE NotifierIdToBitNo(DWORD NotifierId);
+	
+	//makes one dispatching cycle i.e. polls all publisher send queues in round-robin order
+	//and get notifiers out of them dispatching to receive queues of all registered subscribers
+	//until all send queues are empty or dispatch budget is used
+	void Dispatch();
+	
+	//block calling (dispatching) thread until any registered publisher posts a notifier
+	void WaitForNotifiers(){m_DispatchEvent.Wait();};
+public:
+	
+	//constructor - initialize empty publisher and subscribers lists
+	//DispatchBudget - max number of notifiers dispatched in one cycle, DISPATCH_UNLIMITED_BUDGET drains all send queues
+	cDispatcher(WORD DispatchBudget=DISPATCH_UNLIMITED_BUDGET);
+	
+	//dispatch pNotifier to receive queues of all its subscribers in the context of calling thread
+	//used by registered publishers for directly dispatched notifiers (see NT_HND_DIRECT)
+	virtual void DirectDispatch(cNotifier* pNotifier){DispatchNotifier(pNotifier);};
+	
+	//return number of counted cases when notifier was not dispatched because of subscriber receive queue problems
+	inline WORD GetTotalDispatchErrorCounter(void){return m_Total_Dispatch_Error_Counter;};
+	
+	//get contention statistic of the publisher and subscriber table mutexes
+	void GetPublisherMutexStatus(sMutexStatus& rStatus){m_PublisherMutex.GetStatus(rStatus);};
+	void GetSubscriberMutexStatus(sMutexStatus& rStatus){m_SubscriberMutex.GetStatus(rStatus);};
+	
+	//register publishers to know what send queue need to be polled
+	//IMPORTANT! Exception is generated when publisher cannot be registered
+	void RegisterPublisher(cBasePublisher& rPublisher);
+	
+	//remove publisher from the list of registered publishers
+	void UnregisterPublisher(cBasePublisher& rPublisher);
+	
+	//pSubscriber subscribes for specified notifiers usung notifiers mask
+	//
+	//input:
+	//	pSubscriber - adress of subscriber which subscribes for notifiers
+	//  NotifierIdMask - mask of notifiers ID subscriber subscribes
+	//IMPORTANT! Exception is generated when subscriber cannot be registered
+	void RegisterSubscriber(cBaseSubscriber& rSubscriber, DWORD NotifierIdMask);
+	
+	// rSubscriber unsubscribes for specified notifiers usung notifiers mask or completely unsubscribe
+	//
+	//input:
+	//	rSubscriber - subscriber which unsubscribes for notifiers
+	//  NotifierIdMask - mask of notifiers ID subscriber unsubscribes - NT_NONE means remove subscriber form the list
+	void UnregisterSubscriber(cBaseSubscriber& pSubscriber, DWORD NotifierIdMask=NT_NONE);
+	
+	//get mask of notifiers subscriber subscribe for
+	DWORD GetSubscriberNotifiers(BYTE InSubscriberNo);
+	//get counter of not received notifiers of the subscriber
+	WORD GetNotifierErrorCounter(BYTE InSubscriberNo);
+	
+	friend class cDispatchThread;//only cKernel's cDispatchThread is allowed to dispatch notifiers
+};//cDispatcher
+
+//create dispatcher and setup publisher and subscriber lists as empty
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+cDispatcher<PublisherTableSize,SubscriberTableSize>::cDispatcher(WORD DispatchBudget):
+	m_PublisherMutex(DISPATCHER_PUBLISHER_MUTEX_PIP),m_SubscriberMutex(DISPATCHER_SUBSCRIBER_MUTEX_PIP)
+{
+	BYTE i;
+
+	for(i=0;i<PublisherTableSize;i++)
+	{
+		m_PublisherMutex.Acquire();//get O.K. for access
+		m_PublisherTable[i]=static_cast<cBasePublisher*>(NULL);
+		m_PublisherMutex.Release();//release mutex to signal that resource is free
+	};
+	for(i=0;i<SubscriberTableSize;i++)
+	{
+		m_SubscriberMutex.Acquire();//get O.K. for access
+		m_SubscriberTable[i].m_pSubscriber=static_cast<cBaseSubscriber*>(NULL);
+		m_SubscriberTable[i].m_NotifierIdFlags = NT_NONE;
+		m_SubscriberTable[i].m_Error_Counter = 0;//none errors when initialized
+		m_SubscriberMutex.Release();//release mutex to signal that resource is free
+	};
+	m_SubscriberMutex.Acquire();//get O.K. for access
+	BuildRoutingTable();//start with routing table with no subscribers
+	m_SubscriberMutex.Release();//release mutex to signal that resource is free
+	m_Total_Dispatch_Error_Counter=0;//none errors when initialized
+	m_DispatchBudget=DispatchBudget;
+	m_NextPublisher=0;//start dispatching from the first publisher
+}//cDispatcher
+
+
+//register publishers to know what send queue need to be polled
+//return:
+//	DISPATCHER_NO_ERROR - when no error and Publisher is registered in dispatcher
+//  PUBLISHER_REGISTER_ERROR - when cannot register publsher no place for it
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+void cDispatcher<PublisherTableSize,SubscriberTableSize>::RegisterPublisher(cBasePublisher& rPublisher)
+{
+	BYTE i;
+	//check if publisher not already registered
+	for(i=0;i<PublisherTableSize;i++)
+	{
+		m_PublisherMutex.Acquire();//get O.K. for access
+		if(m_PublisherTable[i]==&rPublisher)//check if we do not have publisher already registered
+			{
+			m_PublisherMutex.Release();//release mutex to signal that resource is free
+			return; 
+			};
+		m_PublisherMutex.Release();//release mutex to signal that resource is free
+	};
+	//publisher not already registered find free place and register
+	for(i=0;i<PublisherTableSize;i++)
+	{
+		m_PublisherMutex.Acquire();//get O.K. for access
+		//find first empty entry in m_PublisherTable and register publisher
+		if(m_PublisherTable[i]==static_cast<cBasePublisher*>(NULL))
+			{
+			m_PublisherTable[i]=&rPublisher;
+			rPublisher.SetDispatcher(this);//let publisher wake up dispatcher on every Post()
+			m_PublisherMutex.Release();//release mutex to signal that resource is free
+			m_DispatchEvent.Signal();//dispatch anything publisher eventually posted before it was registered
+			return;
+			};
+		m_PublisherMutex.Release();//release mutex to signal that resource is free
+	};
+	//if we got this place there is not free place in m_PublisherTable to register publisher so generate an exception
+	PUBLISHER_REGISTER_EXCEPTION;
+}// cDispatcher::RegisterPublisher
+
+
+//remove publisher from the list of registered publishers
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+void cDispatcher<PublisherTableSize,SubscriberTableSize>::UnregisterPublisher(cBasePublisher& rPublisher)
+{
+	BYTE i;
+	//check if publisher registered
+	for(i=0;i<PublisherTableSize;i++)
+	{
+		m_PublisherMutex.Acquire();//get O.K. for access
+		if(m_PublisherTable[i]==&rPublisher)//remove it when found
+			{
+			m_PublisherTable[i]=static_cast<cBasePublisher*>(NULL);
+			rPublisher.SetDispatcher(static_cast<cBaseDispatcher*>(NULL));//not registered publisher does not wake up dispatcher
+			m_PublisherMutex.Release();//release mutex to signal that resource is free
+			return; 
+			};
+		m_PublisherMutex.Release();//release mutex to signal that resource is free
+	};
+	//if we get this place there was not publisher subscribed so it is unsubscribed anyhow
+	return; 
+}//cDispatcher::UnregisterPublisher
+
+
+//rSubscriber subscribes for specified notifiers usung notifiers mask
+//
+//input:
+//	rSubscriber - subscriber which subscribes for notifiers
+//  NotifierIdMask - mask of notifiers ID subscriber subscribes
+//return:
+//	DISPATCHER_NO_ERROR - when no error and subscriber is registered in dispatcher for notifiers
+//  SUBSCRIBER_REGISTER_ERROR - when cannot register subscriber for notifiers
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+void cDispatcher<PublisherTableSize,SubscriberTableSize>::RegisterSubscriber(cBaseSubscriber& rSubscriber, DWORD NotifierIdMask)
+{
+	BYTE i;
+	//check if subscriber not already registered
+	for(i=0;i<SubscriberTableSize;i++)
+	{
+		m_SubscriberMutex.Acquire();//get O.K. for access
+		if(m_SubscriberTable[i].m_pSubscriber==&rSubscriber)//if subscriber already registered update its mask
+			{
+			m_SubscriberTable[i].m_NotifierIdFlags|=NotifierIdMask;//set mask bits as requested by NotifierIdMask
+			BuildRoutingTable();//subscription changed so update routing
+			m_SubscriberMutex.Release();//release mutex to signal that resource is free
+			return; 
+			};
+		m_SubscriberMutex.Release();//release mutex to signal that resource is free
+	};
+	//subscriber not already registered find free place and register
+	for(i=0;i<SubscriberTableSize;i++)
+	{
+		m_SubscriberMutex.Acquire();//get O.K. for access
+		//find first empty entry in m_PublisherTable and register subscriber
+		if(m_SubscriberTable[i].m_pSubscriber==static_cast<cBaseSubscriber*>(NULL))
+			{
+			m_SubscriberTable[i].m_pSubscriber=&rSubscriber;//register subscriber
+			m_SubscriberTable[i].m_NotifierIdFlags=NotifierIdMask;//set mask bits as requested by NotifierIdMask
+			m_SubscriberTable[i].m_Error_Counter = 0;//none errors when initialized
+			BuildRoutingTable();//subscription changed so update routing
+			m_SubscriberMutex.Release();//release mutex to signal that resource is free
+			return;
+			};
+		m_SubscriberMutex.Release();//release mutex to signal that resource is free
+	};
+	//if we got this place there is not free place in m_SubscriberTable to register subscriber so generate an exception
+	SUBSCRIBER_REGISTER_EXCEPTION;	
+}//cDispatcher::RegisterSubscriber
+
+
+// rSubscriber unsubscribes for specified notifiers usung notifiers mask or completely unsubscribe
+//
+//input:
+//	rSubscriber - subscriber which unsubscribes for notifiers
+//  NotifierIdMask - mask of notifiers ID subscriber unsubscribes - NT_NONE means remove subscriber form the list
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+void cDispatcher<PublisherTableSize,SubscriberTableSize>::UnregisterSubscriber(cBaseSubscriber& rSubscriber, DWORD NotifierIdMask)
+{
+	BYTE i;
+	//check if subscriber not already registered
+	for(i=0;i<SubscriberTableSize;i++)
+	{
+		m_SubscriberMutex.Acquire();//get O.K. for access
+		if(m_SubscriberTable[i].m_pSubscriber==&rSubscriber)//if subscriber registered update its mask
+		{
+			if(NotifierIdMask==NT_NONE)//if request to unsubscribe completely
+			{
+				m_SubscriberTable[i].m_NotifierIdFlags=NT_NONE;//clear mask bits
+				m_SubscriberTable[i].m_pSubscriber=static_cast<cBaseSubscriber*>(NULL);//mark entry in subscriber table as empty
+				m_SubscriberTable[i].m_Error_Counter = 0;//none errors when unsubscribed
+			}else
+			{
+				m_SubscriberTable[i].m_NotifierIdFlags&=(~NotifierIdMask);//clear mask bits as requested by NotifierIdMask&=(~NotifierIdMask)	
+			}
+		BuildRoutingTable();//subscription changed so update routing
+		m_SubscriberMutex.Release();//release mutex to signal that resource is free
+		return; 
+		};
+		m_SubscriberMutex.Release();//release mutex to signal that resource is free
+	};
+	//if we got this place there is not subscriber registered so there is nothing to unregister
+	return;		
+}//cDispatcher::UnregisterSubscriber
+
+//rebuild m_RouteTable out of m_SubscriberTable
+//IMPORTANT! must be called with m_SubscriberMutex acquired
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+void cDispatcher<PublisherTableSize,SubscriberTableSize>::BuildRoutingTable(void)
+{
+	BYTE IdBitNo;
+	BYTE i;
+	
+	for(IdBitNo=0;IdBitNo<NO_OF_NOTIFIER_IDS;IdBitNo++)
+	{
+		m_RouteCount[IdBitNo]=0;
+		//go through subscribers in table order to keep same delivery order as without routing table
+		for(i=0;i<SubscriberTableSize;i++)
+		{
+			if((m_SubscriberTable[i].m_pSubscriber) && (m_SubscriberTable[i].m_NotifierIdFlags & (((DWORD)1)<<IdBitNo)))
+			{
+				m_RouteTable[IdBitNo][m_RouteCount[IdBitNo]]=i;
+				m_RouteCount[IdBitNo]+=1;
+			}
+		}
+	}
+}//cDispatcher::BuildRoutingTable
+
+//translate one bit notifier ID into its bit number (NT_ID01->0, NT_ID02->1 ... NT_ID32->31)
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+BYTE cDispatcher<PublisherTableSize,SubscriberTableSize>::NotifierIdToBitNo(DWORD NotifierId)
+{
+	BYTE BitNo=0;
+	//binary search for the set bit
+	if(!(NotifierId & 0x0000FFFF)){BitNo+=16;NotifierId>>=16;}
+	if(!(NotifierId & 0x000000FF)){BitNo+=8;NotifierId>>=8;}
+	if(!(NotifierId & 0x0000000F)){BitNo+=4;NotifierId>>=4;}
+	if(!(NotifierId & 0x00000003)){BitNo+=2;NotifierId>>=2;}
+	if(!(NotifierId & 0x00000001)){BitNo+=1;}
+	return BitNo;
+}//cDispatcher::NotifierIdToBitNo
+
+//place pNotifier into receive queue of subscriber from m_SubscriberTable[SubscriberNo]
+//IMPORTANT! must be called with m_SubscriberMutex acquired
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+void cDispatcher<PublisherTableSize,SubscriberTableSize>::DeliverNotifier(cNotifier* pNotifier, BYTE SubscriberNo)
+{
+	BYTE Result;//hold result of Send operation
+
+	pNotifier->Inc();//increment referencies to Notifier befor we place it into receiver queue of subscriber
+	if(pNotifier->GetHandling() & NT_HND_HIGH_PRT)//if high priority notifier handling set
+	{//put notifier on the front of the queue if high priority treatment requested
+		Result=((m_SubscriberTable[SubscriberNo].m_pSubscriber)->GetReceiveQueue())->SendFront(pNotifier);	
+	}else
+	{//standard handling of notifier requested
+		Result=((m_SubscriberTable[SubscriberNo].m_pSubscriber)->GetReceiveQueue())->Send(pNotifier);
+	}
+	if (Result!=OS_NO_ERR)//if Notifier was not able to be delivered
+	{
+	//may DO: Consider to empty Queue when full
+	//To make full queue empty you cannot flash it but only to Receive notifier by notifier to release	
+	//occupied memory via SmartPointer automatically	
+	m_SubscriberTable[SubscriberNo].m_Error_Counter += 1;//increment error count as Notifier was not transfered
+	m_Total_Dispatch_Error_Counter+=1; //not only individual subscriber erro counter is increased but also total one
+
+	pNotifier->Dec();//decrement referencies because Notifier was finally not placed into receiver queue of subscriber
+	};
+}//cDispatcher::DeliverNotifier
+
+//pNotifier is the address of Notifier to be dispatched to all its subscribers receive queue
+//Subscribers are taken from the routing table so only interested ones are visited and
+//subscriber tables are locked only once for the whole notifier fan-out
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+void cDispatcher<PublisherTableSize,SubscriberTableSize>::DispatchNotifier(cNotifier* pNotifier)
+{
+	BYTE i;
+	BYTE IdBitNo;//notifier ID bit number used to index routing table
+	DWORD NotifierId=pNotifier->GetNotifierId();
+	
+	if(NotifierId==NT_NONE)return;//nobody can subscribe for none notifier
+	
+	m_SubscriberMutex.Acquire();//get O.K. for access the subscriber lists
+	if(NotifierId & (NotifierId-1))
+	{//notifier with more than one ID bit set is not routed and goes to every subscriber of any of its bits
+		for(i=0;i<SubscriberTableSize;i++)
+		{
+			if((m_SubscriberTable[i].m_NotifierIdFlags & NotifierId)&& (m_SubscriberTable[i].m_pSubscriber))//if subscriber wants to received this notifier ID send it
+				DeliverNotifier(pNotifier,i);
+		}
+	}else
+	{
+		IdBitNo=NotifierIdToBitNo(NotifierId);
+		for(i=0;i<m_RouteCount[IdBitNo];i++)
+		{
+			DeliverNotifier(pNotifier,m_RouteTable[IdBitNo][i]);
+		}
+	}
+	m_SubscriberMutex.Release();//release mutex to signal that resource is free
+}//cDispatcher::DispatchNotifier
+
+
+//makes one dispatching cycle i.e. polls all publisher send queues in round-robin order
+//and get notifiers out of them dispatching to receive queues of all registered subscribers
+//Every pass takes at most one notifier from every send queue so bursting publisher cannot starve
+//other ones. Passes are repeated until all send queues are found empty or m_DispatchBudget notifiers
+//are dispatched. In the second case next cycle continues from the publisher which was not served.
+//IMPORTANT! m_DispatchEvent is reset at the cycle beginning because everything posted so far is 
+//           dispatched by this cycle while notifiers posted later signal the event again
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+void cDispatcher<PublisherTableSize,SubscriberTableSize>::Dispatch()
+{
+	BYTE i;
+	BYTE EmptyQueues;//number of subsequently polled send queues found empty
+	WORD Dispatched;//number of notifiers dispatched in this cycle
+	cNotifier* pNotifier;//temporary message holder
+
+	m_DispatchEvent.Reset();//notifiers posted before this point are dispatched by this cycle
+	
+	i=m_NextPublisher;
+	Dispatched=0;
+	EmptyQueues=0;
+	//go through all publishers until their send queues are empty
+	while(EmptyQueues<PublisherTableSize)
+	{
+		if((m_DispatchBudget!=DISPATCH_UNLIMITED_BUDGET) && (Dispatched>=m_DispatchBudget))
+		{//budget used so leave remaining notifiers for the next cycle
+			m_DispatchEvent.Signal();
+			break;
+		}
+		pNotifier=static_cast<cNotifier*>(NULL);
+		m_PublisherMutex.Acquire();//get O.K. for access
+		if (m_PublisherTable[i])//if there is any publisher registered at this table position
+		{
+			pNotifier=static_cast<cNotifier*>((m_PublisherTable[i]->GetSendQueue())->Accept());//get message from the publisher's send queue
+			if(pNotifier)//if Notifier received
+			{
+				DispatchNotifier(pNotifier);//dispatch Notifier to all subscribers queues
+				pNotifier->Dec();//decrement reference count because pNotifier is not any longer kept in Send queue
+			}
+		}
+		m_PublisherMutex.Release();//release mutex to signal that resource is free
+		if(pNotifier)
+		{
+			Dispatched++;
+			EmptyQueues=0;//start counting empty queues again
+		}else
+		{
+			EmptyQueues++;
+		}
+		if(++i>=PublisherTableSize)i=0;//next publisher in round-robin order
+	}
+	m_NextPublisher=i;
+}//cDispatcher<PublisherTableSize,SubscriberTableSize>::Dispatch
+
+//get mask of notifiers subscriber subscribe for
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+DWORD cDispatcher<PublisherTableSize,SubscriberTableSize>::GetSubscriberNotifiers(BYTE InSubscriberNo)
+{
+	if(InSubscriberNo < SubscriberTableSize)//if that is from the range of allwed subscribes
+		return m_SubscriberTable[InSubscriberNo].m_NotifierIdFlags;
+	else
+		return NT_NONE;
+}//cDispatcher<PublisherTableSize,SubscriberTableSize>::GetSubscriberNotifiers(BYTE InSubscriberNo)
+
+ 
+//get counter of not received notifiers of the subscriber
+template <BYTE PublisherTableSize,BYTE SubscriberTableSize>
+WORD cDispatcher<PublisherTableSize,SubscriberTableSize>::GetNotifierErrorCounter(BYTE InSubscriberNo)
+{
+	if(InSubscriberNo < SubscriberTableSize)//if that is from the range of allwed subscribes
+		return m_SubscriberTable[InSubscriberNo].m_Error_Counter;
+	else
+		return 0;
+}//cDispatcher<PublisherTableSize,SubscriberTableSize>::GetNotifierErrorCounter(BYTE InSubscriberNo)
+
+#endif /*DISPATCHER_HPP_*/
+
@@ -0,0 +1,59 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        mw_timer.hpp
+* Description: Defines timer which delivers EVT_TIMER notifiers to the subscriber's receive queue.
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+#ifndef TIMER_HPP_
+#define TIMER_HPP_
+
+#include "type.h"
+#include "wrp_tmr.hpp"
+#include "mw_notifier.hpp"
+#include "mw_subscriber.hpp"
+
+/*
+*********************************************************************************************************
+* Name:                            cNotifierTimer Class 
+* 
+* Description: Timer which on every expiration places EVT_TIMER notifier with m_TimerId data into
+*              receive queue of its subscriber. Notifier is not dispatched so it is received only by
+*              the timer owner what allows manager to wait for its periodic jobs and for notifiers from
+*              other managers in the same Receive() call instead of waking up every tick to count time.
+*       
+* Example:
+*   cNotifierTimer BatteryTimer(this,MONITOR_BATTERY_TIMER_ID,100);
+*   BatteryTimer.Start();
+*   ...
+*   pNotifier=Receive();
+*   if(pNotifier->GetNotifierId()==EVT_TIMER && *static_cast<BYTE*>(pNotifier->GetDataPtr())==MONITOR_BATTERY_TIMER_ID)
+*          
+* *********************************************************************************************************
+*/
+#if OS_TMR_EN
+class cNotifierTimer:public cTimer
+{
+private:
+	cBaseSubscriber* m_pSubscriber;//subscriber which receives EVT_TIMER notifiers
+	BYTE m_TimerId;//timer ID passed as EVT_TIMER notifier data
+	WORD m_Lost_Counter;//number of EVT_TIMER notifiers not delivered because receive queue was full
+protected:
+	virtual void Expired();//called by uCOS-II timer task - delivers EVT_TIMER notifier
+public:
+	cNotifierTimer(cBaseSubscriber* pSubscriber, BYTE TimerId, WORD Period, BYTE Opt=OS_TMR_OPT_PERIODIC, WORD Delay=0):
+		cTimer(Period,Opt,Delay),m_pSubscriber(pSubscriber),m_TimerId(TimerId),m_Lost_Counter(0){};
+	WORD GetLostCounter(){return m_Lost_Counter;};
+};//cNotifierTimer
+#endif //OS_TMR_EN
+
+#endif /*TIMER_HPP_*/
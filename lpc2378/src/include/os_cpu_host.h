@@ -0,0 +1,79 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        os_cpu_host.h
+* Description: uCOS-II CPU port for Linux host (simulation and benchmarking of Wall-e SW without the robot)
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+*              Used only by HOST_RUN build (make host) and by host stub drivers (hw_host.c).
+*              Peripheral registers are plain memory mapped at their LPC2378 addresses so drivers which
+*              only read and write registers are used unchanged. Host files descriptors (OS tick timer,
+*              terminal) are IRQ sources of the simulated Vectored Interrupt Controller.
+* History:
+*              17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+#ifndef OS_CPU_HOST_H_
+#define OS_CPU_HOST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "os_cpu.h"
+
+#define OS_CPU_HOST_IRQ_NO		32 //number of VIC IRQ channels (VICVectAddr0..31)
+
+//VIC IRQ channels used by host drivers (same as LPC2378 peripherals they simulate)
+#define OS_CPU_HOST_IRQ_UART0	6
+#define OS_CPU_HOST_IRQ_RTC		13
+#define OS_CPU_HOST_IRQ_PORT2	17
+#define OS_CPU_HOST_IRQ_TIMER2	26
+
+/*
+*********************************************************************************************************
+* Name:                                    OS_CPU_HostIrqSource
+*
+* Description: Connects host file descriptor to VIC IRQ channel
+*
+* Arguments:   InIrqNo - VIC IRQ channel (0..31)
+*              InFd    - host file descriptor which readiness to read requests the IRQ or -1 to disconnect
+*
+* Returns:     none
+*
+* Note(s):
+* 			IRQ is served by handler setup in VICVectAddrN when enabled in VICIntEnable as on LPC2378.
+*           The handler must read the descriptor otherwise the IRQ is requested again.
+*           The descriptor is not watched until its IRQ is served.
+* *********************************************************************************************************
+*/
+extern void OS_CPU_HostIrqSource(INT8U InIrqNo, int InFd);
+
+/*
+*********************************************************************************************************
+* Name:                                    OS_CPU_HostIrqRequest
+*
+* Description: Requests VIC IRQ channel interrupt
+*
+* Arguments:   InIrqNo - VIC IRQ channel (0..31)
+*
+* Returns:     none
+*
+* Note(s):
+* 			Can be called from task, ISR or host thread. When called from ISR the IRQ is served just after
+*           the current handler.
+* *********************************************************************************************************
+*/
+extern void OS_CPU_HostIrqRequest(INT8U InIrqNo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*OS_CPU_HOST_H_*/
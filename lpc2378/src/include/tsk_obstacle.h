@@ -0,0 +1,195 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        tsk_obstacle.h
+* Description: Obstacle watch task which samples US, IRED and tilt sensors during track movement
+*              and stops tracks as soon as an obstacle is detected
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+* 17-Oct-2026 Priority moved to 6 as 0..4 are reserved for mutexes priority inheritance
+*********************************************************************************************************
+*/
+
+#ifndef TSK_OBSTACLE_H_
+#define TSK_OBSTACLE_H_
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+#include "type.h"
+#include "os_cfg.h"
+#include "os_cpu.h"
+
+//defines priority of the obstacle watch task
+//it must be higher than MOTION_THREAD_PRIORITY and track control tasks priorities
+//so sampling is not delayed by the movement control
+#define OBSTACLE_WATCH_TASK_PRIORITY  6
+#define OBSTACLE_WATCH_STACK_SIZE OS_TASK_STACK_SIZE
+
+//delay in OS Ticks between subsequent sensor samples
+//IMPORTANT! Sample period is this delay plus time of US measurement (up to US_MEASUREMENT_TIMEOUT+1 ticks)
+#define OBSTACLE_WATCH_PERIOD_TICKS	1
+
+//number of the latest IRED samples averaged before IRED reading is classified
+#define OBSTACLE_WATCH_IRED_SAMPLES	4
+
+//number of the latest acceleration samples averaged before tilt is classified (the same filtering as CheckForTilt)
+#define OBSTACLE_WATCH_TILT_SAMPLES	NO_OF_ADC_READINGS_FOR_TILT
+
+//size of the moving average buffer which must fit both above sample numbers
+#define OBSTACLE_WATCH_MAX_SAMPLES	10
+
+//results of the obstacle watch returned by GetObstacleWatchResult
+#define OBSTACLE_WATCH_NONE		0 //movement finished without an obstacle detected
+#define OBSTACLE_WATCH_DISTANCE	1 //tracks stopped because of US or IRED detected obstacle (very close or chasm)
+#define OBSTACLE_WATCH_TILT		2 //tracks stopped because of Wall-e tilt
+
+extern OS_STK ObstacleWatchTaskStack[OBSTACLE_WATCH_STACK_SIZE];//stack for obstacle watch task
+
+/*
+*********************************************************************************************************
+* Name:                                   InitObstacleWatch
+*
+* Description: Creates semaphores used to start obstacle watch and signal its end
+*
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 		Must be called before ObstacleWatchTask is created
+* 		Rise UCOSII_RES_EXCEPTION when semaphores cannot be created
+* *********************************************************************************************************
+*/
+extern void InitObstacleWatch(void);
+
+/*
+*********************************************************************************************************
+* Name:                                   StartObstacleWatch
+*
+* Description: Wakes up obstacle watch task to sample sensors as long as tracks are moving
+*
+*
+* Arguments:   InDirection - direction of the movement (MOTOR_FORWARD, MOTOR_REVERSE)
+*
+* Returns:     none
+*
+* Note(s):
+* 		Call it just after RunTracksPulses. For MOTOR_REVERSE only tilt is watched.
+* 		Every StartObstacleWatch must be followed by WaitObstacleWatch which returns TRUE
+* *********************************************************************************************************
+*/
+extern void StartObstacleWatch(BYTE InDirection);
+
+/*
+*********************************************************************************************************
+* Name:                                   WaitObstacleWatch
+*
+* Description: Waits until obstacle watch is finished (tracks stopped)
+*
+*
+* Arguments:   InTimeout - timeout in OS Ticks (0 - wait forever)
+*
+* Returns:     TRUE - watch is finished GetObstacleWatchResult can be read, FALSE - timeout
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+extern BOOL WaitObstacleWatch(WORD InTimeout);
+
+/*
+*********************************************************************************************************
+* Name:                                   GetObstacleWatchResult
+*
+* Description: Returns result of the last finished obstacle watch
+*
+*
+* Arguments:   none
+*
+* Returns:     OBSTACLE_WATCH_NONE, OBSTACLE_WATCH_DISTANCE, OBSTACLE_WATCH_TILT
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+extern BYTE GetObstacleWatchResult(void);
+
+/*
+*********************************************************************************************************
+* Name:                                   GetObstacleWatchCoveredPulses
+*
+* Description: Returns number of track pulses covered when obstacle watch stopped tracks
+*
+*
+* Arguments:   none
+*
+* Returns:     Total track pulses counted just before tracks were stopped
+*
+* Note(s):
+* 		Valid only when GetObstacleWatchResult is not OBSTACLE_WATCH_NONE
+* *********************************************************************************************************
+*/
+extern WORD GetObstacleWatchCoveredPulses(void);
+
+/*
+*********************************************************************************************************
+* Name:                                   GetObstacleWatchMaxLatency
+*
+* Description: Returns worst case obstacle detection latency measured so far
+*
+*
+* Arguments:   none
+*
+* Returns:     Max time in Timer3 ticks (120us) from start of the sample which detected an obstacle
+* 				until tracks were stopped
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+extern WORD GetObstacleWatchMaxLatency(void);
+
+/*
+*********************************************************************************************************
+* Name:                                   GetObstacleWatchMaxPeriod
+*
+* Description: Returns the longest sensor sampling period measured so far
+*
+*
+* Arguments:   none
+*
+* Returns:     Max time in Timer3 ticks (120us) between start of subsequent samples
+*
+* Note(s):
+* 		Obstacle which shows up just after a sample is stopped not later than period + latency
+* *********************************************************************************************************
+*/
+extern WORD GetObstacleWatchMaxPeriod(void);
+
+/*
+******************************************************************************************************
+* Name:                                   ObstacleWatchTask
+*
+* Description: Task which samples obstacle sensors during the movement and stops tracks on an obstacle
+*
+*
+* Arguments:   pdata - uCOS-II task argument
+*
+* Returns:     none
+*
+* Note(s):
+*
+* *********************************************************************************************************
+*/
+extern void ObstacleWatchTask(void *pdata);
+
+#ifdef __cplusplus
+}
+#endif //to close extern "C" if used
+#endif /*TSK_OBSTACLE_H_*/
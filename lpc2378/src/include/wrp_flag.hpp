@@ -0,0 +1,81 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        wrp_flag.hpp
+* Description: objective wrapper to uCOS-II event flags
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+* History:
+*              17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+
+#ifndef WRP_FLAG_HPP_
+#define WRP_FLAG_HPP_
+
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+#include "type.h"
+
+/*
+*********************************************************************************************************
+* Name:                            cEventFlags Class 
+* 
+* Description: Objective wraper to uCOS event flag group
+*       
+*
+* Arguments:   InitFlags - initial value of the flags of the created group
+*              pOsFlagGrp - flag group created by C code (for example by driver which ISR sets the flags)
+*
+* Returns:  
+*
+* Note(s):     
+*              Task can wait for ALL or ANY of the flags to be set (OS_FLAG_WAIT_SET_ALL, OS_FLAG_WAIT_SET_ANY)
+*              or cleared (OS_FLAG_WAIT_CLR_ALL, OS_FLAG_WAIT_CLR_ANY) with timeout. OS_FLAG_CONSUME added
+*              to the wait type clears flags which made the task ready.
+*              Set() and Clear() can be also called by ISRs through OSFlagPost().
+* *********************************************************************************************************
+*/
+#if OS_FLAG_EN
+class cEventFlags
+   {
+   public:
+      //create event flag group with initial flags value
+      cEventFlags(WORD InitFlags=0);
+      
+      //wrap event flag group already created by C code
+      cEventFlags(OS_FLAG_GRP* pOsFlagGrp);
+      
+      //wait for combination of the flags
+      //returns:
+      //   flags which made the task ready or 0 on timeout (pResult is set to OS_TIMEOUT)
+      //   WaitType - OS_FLAG_WAIT_xxx optionally with OS_FLAG_CONSUME
+      //   TimeOut - timeout period (in clock ticks) 
+      WORD Pend(WORD Flags, BYTE WaitType, WORD TimeOut=OS_INFINITE, BYTE* pResult=0);
+      
+      //check combination of the flags without waiting
+      //returns:
+      //   flags which satisfy WaitType condition or 0 when condition not satisfied
+      WORD Accept(WORD Flags, BYTE WaitType);
+      
+      //set flags and ready tasks waiting for them
+      BYTE Set(WORD Flags);
+      
+      //clear flags and ready tasks waiting for them to be cleared
+      BYTE Clear(WORD Flags);
+      
+      //current value of the flags
+      WORD Query();
+   private:
+      OS_FLAG_GRP* m_OsFlagGrp;//pointer to event flag group allocated by uCOS
+   };//class cEventFlags
+#endif //OS_FLAG_EN
+
+#endif /*WRP_FLAG_HPP_*/
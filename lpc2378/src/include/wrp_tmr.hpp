@@ -0,0 +1,71 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        wrp_tmr.hpp
+* Description: objective wrapper to uCOS-II - software timers
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+* History:
+*              17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+#ifndef WRP_TMR_HPP_
+#define WRP_TMR_HPP_
+
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+#include "type.h"
+
+/*
+*********************************************************************************************************
+* Name:                            cTimer Class 
+* 
+* Description: 	Timer Class - wraps uCOS software timer
+*       
+*
+* Arguments:   Period - number of OS ticks between expirations of periodic timer
+*              Opt - OS_TMR_OPT_PERIODIC or OS_TMR_OPT_ONE_SHOT
+*              Delay - number of OS ticks to the first expiration (0 means Period for periodic timer)
+*
+* Returns:  
+*
+* Note(s):     
+*              Timer is created stopped, Start() need to be called to run it.
+*              Expired() is called in the context of uCOS-II timer task (OS_TASK_TMR_PRIO) so it must
+*              be short - it should only signal or post to the task which does the real job.
+* *********************************************************************************************************
+*/ 
+#if OS_TMR_EN
+class cTimer
+   {
+   public:
+      //create stopped timer
+      cTimer(WORD Period, BYTE Opt=OS_TMR_OPT_PERIODIC, WORD Delay=0);
+      
+      //start timer (running timer is started again from the beginning)
+      BYTE Start();
+      
+      //stop timer (Expired() is not called)
+      BYTE Stop();
+      
+      //number of OS ticks to the timer expiration
+      DWORD Remain();
+      
+   protected:
+      //called by uCOS-II timer task when timer expires
+      virtual void Expired(){};
+      
+   private:
+      OS_TMR* m_pOsTmr;//pointer to the timer allocated by uCOS
+      static void Callback(void* pOsTmr, void* pArg);//uCOS timer callback which calls Expired()
+   };//class cTimer
+#endif //OS_TMR_EN
+
+#endif /*WRP_TMR_HPP_*/
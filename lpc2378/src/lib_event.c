@@ -0,0 +1,103 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        lib_event.c
+* Description: Hardware events event flag group - ISRs set flags, tasks wait for their combinations
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+* History:
+*              17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+#include "lib_event.h"
+#include "lib_error.h"
+
+static OS_FLAG_GRP* HwEvents;//hardware events flag group
+
+/*
+*********************************************************************************************************
+* Name:                                    InitHwEvents
+*
+* Description: Creates hardware events flag group (all flags cleared)
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 			Must be called after OSInit() and before any ISR which sets the flags is enabled.
+* *********************************************************************************************************
+*/
+void InitHwEvents(void)
+{
+	BYTE Result;
+	
+	HwEvents=OSFlagCreate(0,&Result);
+	if(!HwEvents)UCOSII_RES_EXCEPTION;//when no OS resources to create event flag group rise an exception
+}//InitHwEvents
+
+/*
+*********************************************************************************************************
+* Name:                                    SetHwEvents
+*
+* Description: Sets hardware events flags and readies tasks waiting for them
+*
+* Arguments:   Flags - HW_EVT_xxx flags to set
+*
+* Returns:     none
+*
+* Note(s):
+* 			Can be called from ISR. Does nothing when called before InitHwEvents().
+* *********************************************************************************************************
+*/
+void SetHwEvents(WORD Flags)
+{
+	BYTE Result;
+	
+	if(HwEvents)OSFlagPost(HwEvents,Flags,OS_FLAG_SET,&Result);
+}//SetHwEvents
+
+/*
+*********************************************************************************************************
+* Name:                                    ClrHwEvents
+*
+* Description: Clears hardware events flags
+*
+* Arguments:   Flags - HW_EVT_xxx flags to clear
+*
+* Returns:     none
+*
+* Note(s):
+* 			Does nothing when called before InitHwEvents().
+* *********************************************************************************************************
+*/
+void ClrHwEvents(WORD Flags)
+{
+	BYTE Result;
+	
+	if(HwEvents)OSFlagPost(HwEvents,Flags,OS_FLAG_CLR,&Result);
+}//ClrHwEvents
+
+/*
+*********************************************************************************************************
+* Name:                                    GetHwEventsGrp
+*
+* Description: Returns hardware events flag group
+*
+* Arguments:   none
+*
+* Returns:     pointer to uCOS-II event flag group
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+OS_FLAG_GRP* GetHwEventsGrp(void)
+{
+	return HwEvents;
+}//GetHwEventsGrp
@@ -1,268 +1,416 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        lib_memalloc.c
-* Description: Functions to control dynamic memory allocations
-* Author:      Bogdan Kowalczyk
-* Date:        30-Sep-2008
-* Note:
-* 	This is based on the source code from article "memory allocation in C"
-*   by Leslie Aldridge avaliable on embedded.com
-* History:
-*              30-Sep-2008 - Initial version created
-* 				2-Nov-2008 - Added critical mem exception generation when allocations fail
-*********************************************************************************************************
-*/
-
-/*
- * Produced by Programming ARTS
- * 8/18/88
- * Programmers: Les Aldridge, Travis I. Seay
- */
-
-#include "type.h"
-#include "lib_memalloc.h"
-#include "lib_error.h"
-
-
-//HEADER occupy 8 bytes
-typedef struct hdr {
-	struct hdr	*ptr; // 4 byte long pointer (in ARM)to other free blocks (NULL if there are not any free blocks - end of free block list) 
-	unsigned int size; //4 byte long size of allocated space in HEADER size units
-} HEADER;
-
-/*	Defined in the linker file. _heapstart is the first byte allocated to the heap; _heapend
-is the last. */
-
-extern HEADER _heapstart, _heapend;
-
-// this function is removed extern void	warm_boot(char *str);
-
-static HEADER 	*frhd=NULL; //head of the list of free blocks
-static volatile unsigned int	memleft;	/* memory left on the heap in HEADER size units*/
-static volatile unsigned int	minmemleft; /* the smallest amount of free memory noticed measured in HEADER size units*/
-
-
-/*
-*********************************************************************************************************
-* Name:                                   freeleft
-* 
-* Description: returns number of free bytes on the heap
-*  
-*
-* Arguments:   none
-*
-* Returns:     number of free bytes on the heap
-*
-* 			
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-unsigned int freeleft(void)
-{
-	return  memleft*sizeof(HEADER);//calculate number of free bytes on the heap
-}//freeleft
-
-/*
-*********************************************************************************************************
-* Name:                                   minfreeleft
-* 
-* Description: returns registered smallest number of free bytes on the heap
-*  
-*
-* Arguments:   none
-*
-* Returns:     smallest number of free bytes on the heap so far
-*
-* 			
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-unsigned int minfreeleft(void)
-{
-	return minmemleft*sizeof(HEADER);//return calculated number of minimum free bytes on the heap
-}//minfreeleft
-
-/*
-*********************************************************************************************************
-* Name:                                    free 
-* 
-* Description: Release heap space allocated by malloc
-*       IMPORTANT! This function is not multi-thread safe and require external protection to be safe
-*
-* Arguments:   pointer to the allocated space intended to be free
-*
-* Returns:     none
-*
-* 			
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-void free(void *ap)
-{
-
-/*	Return memory to free list. Where possible, make contiguous blocks of free memory. (Assumes that 0 is not a valid address for allocation. Also, i_alloc() must be called prior to using either free() or malloc(); otherwise, the free list will be null.) */
-
-	HEADER *nxt, *prev, *f;
-
-	//it is assumed ap cannot be NULL
-	
-	f = (HEADER *)ap - 1;	/* Point to header of block being returned. */
-	memleft += f->size;	
-	
-	if(frhd==NULL)//NULL here means all heap is allocated (we assume i_alloc was called before first free call)
-	{//returned block will be the only on free list
-		frhd=f;//make free blocks pointer to point to the released block
-		f->ptr=NULL;//mark that this has to be the only free block on the list
-		return;
-	}
-
-/*	frhd is never null unless i_alloc() wasn't called to initialize package. */
-
-if (frhd > f)
-	{
-
-	/* Free-space head is higher up in memory than returnee. */
-
-	nxt = frhd; 	/* old head */
-	frhd = f; 	/* new head */
-	prev = f + f->size; 	/* right after new head */
-
-	if (prev==nxt)  /* Old and new are contiguous. */
-		{//B.K. looks this was missed in origial implementation so I add it but this need to be checked
-		f->size += nxt->size;
-		f->ptr = nxt->ptr; 	/* Form one block. */
-		}
-	else 
-		{
-		f->ptr = nxt;
-		}
-	return;
-	}
-
-/*	Otherwise, current free-space head is lower in memory. Walk down free-space list looking for the block being returned. If the next pointer points past the block, make a new entry and link it. If next pointer plus its size points to the block, form one contiguous block. */
-
-nxt = frhd;
-for (nxt=frhd; nxt && nxt < f; prev=nxt,nxt=nxt->ptr)
-	{
-		if (nxt+nxt->size == f)
-		{
-			nxt->size += f->size; 	/* They're contiguous. */
-			f = nxt + nxt->size; 	/* Form one block. */
-			if (f==nxt->ptr)
-			{
-
-			/* The new, larger block is contiguous to the next free block, so form a larger block.There's no need to continue this checking since if the block following this free one were free, the two would already have been combined. */
-
-			nxt->size += f->size;
-			nxt->ptr = f->ptr;
-			}
-		return;
-		}
-	}
-
-/*	The address of the block being returned is greater than one in the free queue (nxt) or the end of the queue was reached. If at end, just link to the end of the queue. Therefore, nxt is null or points to a block higher up in memory than the one being returned. */
-
-prev->ptr = f; 	/* link to queue */
-prev = f + f->size; 	/* right after space to free */
-if (prev == nxt) 	/* 'f' and 'nxt' are contiguous. */
-	{
-	f->size += nxt->size;
-	f->ptr = nxt->ptr; 	/* Form a larger, contiguous block. */
-	}
-else 
-	f->ptr = nxt;
-return;
-}//void free
-
-/*
-*********************************************************************************************************
-* Name:                                    malloc 
-* 
-* Description: Request allocation of nbytes from the Heap
-*       IMPORTANT! This function is not multi-thread safe and require external protection to be safe
-*
-* Arguments:   nbytes - requested number of bytes from the heap
-* 		IMPORTANT! Works correctly only if nbytes > 0 otherwise exception is generated (MEM_ALLOC_EXCEPTION)
-*
-* Returns:     adress of the allocated space or NULL when there is not space avaliable
-*
-* Note(s):     
-* 		IMPORTANT! When memory cannot be allocated  MEM_ALLOC_EXCEPTION exception is generated through SWI
-* 
-* *********************************************************************************************************
-*/
-
-void *malloc(size_t nbytes) 	/* bytes to allocate */
-{
-HEADER *nxt, *prev;
-int 		nunits;
-
-
-if (!nbytes) MEM_ALLOC_EXCEPTION; //B.K. do not allocate for zero because for such a case malloc returned pointer points to not allocated area on the heap
-
-nunits = (nbytes+sizeof(HEADER)-1) / sizeof(HEADER) + 1;
-
-for (prev=NULL,nxt=frhd; nxt; prev=nxt,nxt = nxt->ptr)
-{
-	if (nxt->size >= nunits) 	/* big enough */
-	{
-		if (nxt->size > nunits) //if free block avaliable is larger than requested block
-		{
-			nxt->size -= nunits; 	/* Allocate requested block from the avalilable free block end. */
-			nxt += nxt->size;       //advance poiter to the block which will be allocated 
-			nxt->size = nunits; 	/* nxt now == pointer to be alloc'd. so update allocated block size value */
-		}
-		else //requested size in HEADER units exactly correspond to the released block
-		{
-			if (prev==NULL) frhd = nxt->ptr; //if we allocate first block from the free list let frhd point to next block if any or NULL if no more frr blocks
-			else prev->ptr = nxt->ptr; //if there is procedding block join it to the next block behind the one which is allocated
-		}
-		memleft -= nunits;
-		if(memleft < minmemleft) minmemleft=memleft;//if current memory left on heap smallet than lowest valus so far update lowest value so far to the new value
-
-		/* Return a pointer past the header to the actual space requested. */
-
-		return((void *)(nxt+1));
-	}
-}
-//memory cannot be allocated generate exception
-MEM_ALLOC_EXCEPTION;
-/* This function that explains what catastrophe befell us before resetting the system. */
-//warm_boot("Allocation Failed!");
-return(NULL);
-}//void *malloc
-
-
-/*
-*********************************************************************************************************
-* Name:                                    i_alloc 
-* 
-* Description: Initialize Heap (the list of free blocks) in the memory space dedicated for the heap
-*       IMPORTANT! This function is not multi-thread safe and require external protection to be safe
-*
-* Arguments:   none
-*
-* Returns:     none
-*
-* Note(s):     
-* 
-* *********************************************************************************************************
-*/
-void i_alloc(void)
-{
-frhd = &_heapstart; 	/* Initialize the allocator. */
-frhd->ptr = NULL;
-//cast to (char*) to count numbers of bytes
-frhd->size = ((char *)&_heapend - (char *)&_heapstart) / sizeof(HEADER);
-memleft = frhd->size; 	/* initial size in HEADER size units */
-minmemleft=memleft;/*smallest value at the beginning is same as mem left*/
-}//void i_alloc
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        lib_memalloc.c
+* Description: Functions to control dynamic memory allocations
+* Author:      Bogdan Kowalczyk
+* Date:        30-Sep-2008
+* Note:
+* 	Original version was based on the source code from article "memory allocation in C"
+*   by Leslie Aldridge avaliable on embedded.com
+*   Current version is Two-Level Segregated Fit (TLSF) allocator with O(1) malloc and free:
+*   Free blocks are kept on segregated lists. Size class of the block is defined by two indexes:
+*   first level (FL) - power of 2 range of the block size and second level (SL) - linear subdivision
+*   of the FL range into TLSF_SL_COUNT parts. Two level bitmaps tell which lists are not empty so
+*   suitable free block is found with a few bit operations and without any list walk.
+*   Every block has header with pointer to the physically previous block and block size so
+*   released block is merged with its free physical neighbors in constant time.
+* History:
+*              30-Sep-2008 - Initial version created
+* 				2-Nov-2008 - Added critical mem exception generation when allocations fail
+* 			   17-Oct-2026 - First fit free list replaced with TLSF allocator, added largestfree()
+* 			   17-Oct-2026 - largestfree() reports the lower bound of the largest size class, malloc never walks lists
+* 			   17-Oct-2026 - malloc and free calls recorded by host build into WALLE_HEAP_TRACE file (MEM_TRACE_EN)
+*********************************************************************************************************
+*/
+
+#include "type.h"
+#include "lib_memalloc.h"
+#include "lib_error.h"
+#if MEM_TRACE_EN
+#include "hw_host.h"
+#endif
+
+//TLSF CONFIGURATION
+#define TLSF_ALIGN_SHIFT	3 //all block sizes are multiplication of 8 bytes
+#define TLSF_ALIGN_SIZE		(1<<TLSF_ALIGN_SHIFT)
+#define TLSF_SL_SHIFT		3 //every first level range is divided into 8 second level lists
+#define TLSF_SL_COUNT		(1<<TLSF_SL_SHIFT)
+#define TLSF_FL_SHIFT		(TLSF_SL_SHIFT+TLSF_ALIGN_SHIFT)
+#define TLSF_SMALL_BLOCK	(1<<TLSF_FL_SHIFT) //blocks smaller than this are kept in first level 0 linear lists
+#define TLSF_FL_MAX			15 //the largest supported block is smaller than 2^(TLSF_FL_MAX+1) i.e. 64KB
+#define TLSF_FL_COUNT		(TLSF_FL_MAX-TLSF_FL_SHIFT+2)
+#define TLSF_MAX_BLOCK		((1<<(TLSF_FL_MAX+1))-TLSF_ALIGN_SIZE)
+
+//flags kept in the not used lowest bits of the block size
+#define TLSF_BLK_FREE		BIT0 //block is free
+#define TLSF_BLK_PREV_FREE	BIT1 //physically previous block is free
+#define TLSF_BLK_FLAGS		(TLSF_BLK_FREE|TLSF_BLK_PREV_FREE)
+
+//block header
+//mPrevFree and mNextFree are valid only for free blocks and are part of the user area for the allocated block
+typedef struct blk {
+	struct blk	*mPrevPhys;//physically previous block in the heap (valid only when TLSF_BLK_PREV_FREE set)
+	unsigned int mSize;//size of the whole block (header included) in bytes with block flags on lowest bits
+	struct blk	*mNextFree;//next block on the same segregated free list
+	struct blk	*mPrevFree;//previous block on the same segregated free list
+} BLOCK;
+
+//allocated block overhead - user area starts just after mSize
+#define TLSF_BLK_OVERHEAD	((unsigned int)offsetof(BLOCK,mNextFree))
+//the smallest block must be able to keep free list pointers when released
+#define TLSF_MIN_BLOCK		((sizeof(BLOCK)+TLSF_ALIGN_SIZE-1)&~(TLSF_ALIGN_SIZE-1))
+
+/*	Defined in the linker file. _heapstart is the first byte allocated to the heap; _heapend
+is the last. */
+
+extern BLOCK _heapstart, _heapend;
+
+static unsigned int FlBitmap;//bit n set when there is any free block in first level n
+static BYTE SlBitmap[TLSF_FL_COUNT];//bit n set when free list [fl][n] is not empty
+static BLOCK *FreeList[TLSF_FL_COUNT][TLSF_SL_COUNT];//heads of segregated free lists
+static volatile unsigned int	memleft;	/* memory left on the heap in bytes*/
+static volatile unsigned int	minmemleft; /* the smallest amount of free memory noticed measured in bytes*/
+
+//return index of the most significant set bit (Value must be != 0)
+//ARM7TDMI does not have CLZ instruction so it is done with constant number of steps
+static int TlsfFls(unsigned int Value)
+{
+	int Bit=0;
+	
+	if(Value & 0xFFFF0000){Value>>=16;Bit+=16;}
+	if(Value & 0x0000FF00){Value>>=8;Bit+=8;}
+	if(Value & 0x000000F0){Value>>=4;Bit+=4;}
+	if(Value & 0x0000000C){Value>>=2;Bit+=2;}
+	if(Value & 0x00000002){Bit+=1;}
+	return Bit;
+}//TlsfFls
+
+//return index of the least significant set bit (Value must be != 0)
+static int TlsfFfs(unsigned int Value)
+{
+	return TlsfFls(Value & (~Value+1));
+}//TlsfFfs
+
+//block size without flags
+static unsigned int BlkSize(BLOCK *pBlk)
+{
+	return pBlk->mSize & ~TLSF_BLK_FLAGS;
+}//BlkSize
+
+//physically next block
+static BLOCK* BlkNext(BLOCK *pBlk)
+{
+	return (BLOCK*)((char*)pBlk+BlkSize(pBlk));
+}//BlkNext
+
+//calculate free list indexes for the block of Size
+static void TlsfMapping(unsigned int Size,int *pFl,int *pSl)
+{
+	int Fl;
+	
+	if(Size<TLSF_SMALL_BLOCK)
+	{
+		*pFl=0;
+		*pSl=Size>>TLSF_ALIGN_SHIFT;
+	}
+	else
+	{
+		Fl=TlsfFls(Size);
+		*pSl=(int)((Size>>(Fl-TLSF_SL_SHIFT))^TLSF_SL_COUNT);
+		*pFl=Fl-TLSF_FL_SHIFT+1;
+	}
+}//TlsfMapping
+
+//put free block on the head of its segregated list
+static void TlsfInsert(BLOCK *pBlk)
+{
+	int Fl,Sl;
+	
+	TlsfMapping(BlkSize(pBlk),&Fl,&Sl);
+	pBlk->mPrevFree=NULL;
+	pBlk->mNextFree=FreeList[Fl][Sl];
+	if(pBlk->mNextFree)pBlk->mNextFree->mPrevFree=pBlk;
+	FreeList[Fl][Sl]=pBlk;
+	FlBitmap|=(1<<Fl);
+	SlBitmap[Fl]|=(BYTE)(1<<Sl);
+}//TlsfInsert
+
+//take free block out of its segregated list
+static void TlsfRemove(BLOCK *pBlk)
+{
+	int Fl,Sl;
+	
+	TlsfMapping(BlkSize(pBlk),&Fl,&Sl);
+	if(pBlk->mNextFree)pBlk->mNextFree->mPrevFree=pBlk->mPrevFree;
+	if(pBlk->mPrevFree)pBlk->mPrevFree->mNextFree=pBlk->mNextFree;
+	else
+	{
+		FreeList[Fl][Sl]=pBlk->mNextFree;
+		if(FreeList[Fl][Sl]==NULL)//list is empty now so update bitmaps
+		{
+			SlBitmap[Fl]&=(BYTE)~(1<<Sl);
+			if(!SlBitmap[Fl])FlBitmap&=~(1<<Fl);
+		}
+	}
+}//TlsfRemove
+
+
+/*
+*********************************************************************************************************
+* Name:                                   freeleft
+* 
+* Description: returns number of free bytes on the heap
+*  
+*
+* Arguments:   none
+*
+* Returns:     number of free bytes on the heap
+*
+* 			
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+unsigned int freeleft(void)
+{
+	return  memleft;//number of free bytes on the heap
+}//freeleft
+
+/*
+*********************************************************************************************************
+* Name:                                   minfreeleft
+* 
+* Description: returns registered smallest number of free bytes on the heap
+*  
+*
+* Arguments:   none
+*
+* Returns:     smallest number of free bytes on the heap so far
+*
+* 			
+* Note(s):     
+* 
+* *********************************************************************************************************
+*/
+unsigned int minfreeleft(void)
+{
+	return minmemleft;//return minimum number of free bytes on the heap
+}//minfreeleft
+
+/*
+*********************************************************************************************************
+* Name:                                   largestfree
+* 
+* Description: returns the largest number of bytes which can be allocated by single malloc() call
+*       IMPORTANT! This function is not multi-thread safe and require external protection to be safe
+*
+* Arguments:   none
+*
+* Returns:     user area size of the smallest block of the highest not empty size class in bytes
+*              (0 when heap is fully allocated), malloc() of the returned size is guaranteed to succeed
+* 			
+* Note(s):     
+* 		Largest free block can be up to one second level step (1/8 of its size) larger than reported
+* 		but malloc() takes only blocks of the size class which fits every block of the class.
+* 
+* *********************************************************************************************************
+*/
+unsigned int largestfree(void)
+{
+	int Fl,Sl;
+	
+	if(!FlBitmap)return 0;//no free blocks at all
+	
+	Fl=TlsfFls(FlBitmap);
+	Sl=TlsfFls(SlBitmap[Fl]);
+	if(!Fl)//first level 0 lists keep blocks of one size
+		return (Sl<<TLSF_ALIGN_SHIFT)-TLSF_BLK_OVERHEAD;
+	//reverse of TlsfMapping - the lowest size of the list
+	return ((TLSF_SL_COUNT+Sl)<<(Fl+TLSF_FL_SHIFT-1-TLSF_SL_SHIFT))-TLSF_BLK_OVERHEAD;
+}//largestfree
+
+/*
+*********************************************************************************************************
+* Name:                                    free 
+* 
+* Description: Release heap space allocated by malloc
+*       IMPORTANT! This function is not multi-thread safe and require external protection to be safe
+*
+* Arguments:   pointer to the allocated space intended to be free
+*
+* Returns:     none
+*
+* 			
+* Note(s):     
+* 		Released block is merged with its physically previous and next block when they are free.
+* 
+* *********************************************************************************************************
+*/
+void free(void *ap)
+{
+	BLOCK *pBlk,*pNext;
+
+	//it is assumed ap cannot be NULL
+	
+#if MEM_TRACE_EN
+	HostHeapTrace(ap,0);
+#endif
+	pBlk=(BLOCK*)((char*)ap-TLSF_BLK_OVERHEAD);//point to header of block being returned
+	memleft+=BlkSize(pBlk);
+	
+	if(pBlk->mSize & TLSF_BLK_PREV_FREE)//merge with previous free block
+	{
+		TlsfRemove(pBlk->mPrevPhys);
+		pBlk->mPrevPhys->mSize+=BlkSize(pBlk);
+		pBlk=pBlk->mPrevPhys;
+	}
+	pNext=BlkNext(pBlk);
+	if(pNext->mSize & TLSF_BLK_FREE)//merge with next free block
+	{
+		TlsfRemove(pNext);
+		pBlk->mSize+=BlkSize(pNext);
+		pNext=BlkNext(pBlk);
+	}
+	pBlk->mSize|=TLSF_BLK_FREE;
+	pNext->mPrevPhys=pBlk;
+	pNext->mSize|=TLSF_BLK_PREV_FREE;
+	TlsfInsert(pBlk);
+}//void free
+
+/*
+*********************************************************************************************************
+* Name:                                    malloc 
+* 
+* Description: Request allocation of nbytes from the Heap
+*       IMPORTANT! This function is not multi-thread safe and require external protection to be safe
+*
+* Arguments:   nbytes - requested number of bytes from the heap
+* 		IMPORTANT! Works correctly only if nbytes > 0 otherwise exception is generated (MEM_ALLOC_EXCEPTION)
+*
+* Returns:     adress of the allocated space or NULL when there is not space avaliable
+*
+* Note(s):     
+* 		IMPORTANT! When memory cannot be allocated  MEM_ALLOC_EXCEPTION exception is generated through SWI
+* 		Request is rounded up to the next segregated list size so any block from the found list fits
+* 		(good fit instead of best fit) and the rest of the block is returned to the free lists.
+* 		Lists are never walked so the exception can be generated even when a block of the request
+* 		size class is large enough - largestfree() reports only the size which is always allocated.
+* 
+* *********************************************************************************************************
+*/
+
+void *malloc(size_t nbytes) 	/* bytes to allocate */
+{
+	BLOCK *pBlk,*pRest;
+	unsigned int Size,SearchSize,Map;
+	int Fl,Sl;
+
+	if (!nbytes) MEM_ALLOC_EXCEPTION; //B.K. do not allocate for zero because for such a case malloc returned pointer points to not allocated area on the heap
+	if (nbytes > TLSF_MAX_BLOCK-TLSF_BLK_OVERHEAD) MEM_ALLOC_EXCEPTION; //larger than any block ever
+
+	Size=(nbytes+TLSF_BLK_OVERHEAD+TLSF_ALIGN_SIZE-1)&~(TLSF_ALIGN_SIZE-1);
+	if(Size<TLSF_MIN_BLOCK)Size=TLSF_MIN_BLOCK;
+
+	//round up to the next list size so every block of the found list is large enough
+	SearchSize=Size;
+	if(SearchSize>=TLSF_SMALL_BLOCK)SearchSize+=(1<<(TlsfFls(SearchSize)-TLSF_SL_SHIFT))-1;
+	TlsfMapping(SearchSize,&Fl,&Sl);
+
+	//find not empty list of the same or larger size class
+	Map=(Fl<TLSF_FL_COUNT)?(SlBitmap[Fl]&(~0U<<Sl)):0;
+	if(!Map)
+	{
+		Map=(Fl+1<TLSF_FL_COUNT)?(FlBitmap&(~0U<<(Fl+1))):0;
+		if(Map)
+		{
+			Fl=TlsfFfs(Map);
+			Map=SlBitmap[Fl];
+		}
+	}
+	if(!Map)
+	{
+		//memory cannot be allocated generate exception
+		MEM_ALLOC_EXCEPTION;
+		return(NULL);
+	}
+	Sl=TlsfFfs(Map);
+	pBlk=FreeList[Fl][Sl];
+	TlsfRemove(pBlk);
+
+	if(BlkSize(pBlk)-Size>=TLSF_MIN_BLOCK)//split - rest of the block is returned to free lists
+	{
+		pRest=(BLOCK*)((char*)pBlk+Size);
+		pRest->mSize=(BlkSize(pBlk)-Size)|TLSF_BLK_FREE;//previous (allocated) block is not free
+		pRest->mPrevPhys=pBlk;
+		pBlk->mSize=Size|(pBlk->mSize&TLSF_BLK_PREV_FREE);
+		BlkNext(pRest)->mPrevPhys=pRest;//next block flags already say previous one is free
+		TlsfInsert(pRest);
+	}
+	else//whole block is allocated so next block previous is not free any longer
+	{
+		BlkNext(pBlk)->mSize&=~TLSF_BLK_PREV_FREE;
+	}
+	pBlk->mSize&=~TLSF_BLK_FREE;
+
+	memleft-=BlkSize(pBlk);
+	if(memleft < minmemleft) minmemleft=memleft;//if current memory left on heap smallet than lowest valus so far update lowest value so far to the new value
+
+#if MEM_TRACE_EN
+	HostHeapTrace((char*)pBlk+TLSF_BLK_OVERHEAD,nbytes);
+#endif
+	/* Return a pointer past the header to the actual space requested. */
+	return((void *)((char*)pBlk+TLSF_BLK_OVERHEAD));
+}//void *malloc
+
+
+/*
+*********************************************************************************************************
+* Name:                                    i_alloc 
+* 
+* Description: Initialize Heap (the list of free blocks) in the memory space dedicated for the heap
+*       IMPORTANT! This function is not multi-thread safe and require external protection to be safe
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):     
+* 		Whole heap becomes one free block followed by the sentinel allocated block of zero size 
+* 		which terminates the physical blocks chain. Heap larger than TLSF_MAX_BLOCK is truncated.
+* 
+* *********************************************************************************************************
+*/
+void i_alloc(void)
+{
+	BLOCK *pBlk,*pSentinel;
+	unsigned long Start,End;//heap boundaries aligned to TLSF_ALIGN_SIZE
+	int Fl,Sl;
+	
+	for(Fl=0;Fl<TLSF_FL_COUNT;Fl++)
+	{
+		SlBitmap[Fl]=0;
+		for(Sl=0;Sl<TLSF_SL_COUNT;Sl++)FreeList[Fl][Sl]=NULL;
+	}
+	FlBitmap=0;
+	
+	Start=((unsigned long)&_heapstart+TLSF_ALIGN_SIZE-1)&~(unsigned long)(TLSF_ALIGN_SIZE-1);
+	End=((unsigned long)&_heapend)&~(unsigned long)(TLSF_ALIGN_SIZE-1);
+	if(End-Start-TLSF_BLK_OVERHEAD>TLSF_MAX_BLOCK)End=Start+TLSF_MAX_BLOCK+TLSF_BLK_OVERHEAD;
+	
+	pBlk=(BLOCK*)Start;
+	pBlk->mPrevPhys=NULL;
+	pBlk->mSize=(unsigned int)(End-TLSF_BLK_OVERHEAD-Start)|TLSF_BLK_FREE;//sentinel header is left at the end
+	pSentinel=BlkNext(pBlk);
+	pSentinel->mPrevPhys=pBlk;
+	pSentinel->mSize=0|TLSF_BLK_PREV_FREE;//allocated zero size block - it is never merged
+	TlsfInsert(pBlk);
+	
+	memleft = BlkSize(pBlk); 	/* initial size in bytes */
+	minmemleft=memleft;/*smallest value at the beginning is same as mem left*/
+}//void i_alloc
@@ -0,0 +1,152 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        lib_perf.c
+* Description: Per task CPU utilisation accounting done by uCOS-II context switch hook
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+* History:
+*              17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+#include "type.h"
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+#include "hw_timer.h"
+#include "lib_perf.h"
+
+//accounting data of the current window indexed by task priority
+static DWORD PerfRunTime[OS_LOWEST_PRIO+1];//Timer3 counts spent by the task
+static WORD PerfSwitches[OS_LOWEST_PRIO+1];//number of times task was switched in
+static DWORD PerfIsrTime;//Timer3 counts spent in IRQ handlers
+static DWORD PerfSliceStart;//time stamp when the current task was switched in (moved forward by IRQ time)
+static DWORD PerfIsrStart;//Timer3 Timer Counter value when IRQ handlers dispatch started
+static DWORD PerfWindowStart;//time stamp when the current window started
+
+/*
+*********************************************************************************************************
+* Name:                                    PerfTaskSwHook
+*
+* Description: Charges time elapsed since the last context switch to the task being switched out and counts
+*              switch in of the new task
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 			Called by OSTaskSwHook with interrupts disabled. OSPrioCur is the task being switched out and
+*           OSPrioHighRdy the task being switched in. The first call comes from OSStartHighRdy when there is
+*           no task to be switched out yet (OSRunning is still FALSE).
+* *********************************************************************************************************
+*/
+void PerfTaskSwHook(void)
+{
+	DWORD Now=GetTimer3TimeStamp();
+
+	if(OSRunning)
+		PerfRunTime[OSPrioCur]+=Now-PerfSliceStart;
+	else
+		PerfWindowStart=Now;//the very first window starts when multitasking starts
+	PerfSwitches[OSPrioHighRdy]++;
+	PerfSliceStart=Now;
+}//PerfTaskSwHook
+
+/*
+*********************************************************************************************************
+* Name:                                    PerfIsrEnter, PerfIsrExit
+*
+* Description: Mark start and end of IRQ handlers execution
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 			IRQ time is not charged to interrupted task - its slice start is moved forward by IRQ duration.
+*           IRQs come about 10000 times per second (mostly Timer3) so only Timer Counter is read and IRQ
+*           duration is taken modulo Timer3 period (IRQ handlers never run 120us in one go).
+* *********************************************************************************************************
+*/
+void PerfIsrEnter(void)
+{
+	PerfIsrStart=GetTimer3CounterValue();
+}//PerfIsrEnter
+
+void PerfIsrExit(void)
+{
+	DWORD IsrTime=GetTimer3CounterValue();
+
+	if(IsrTime<PerfIsrStart)
+		IsrTime+=INIT_TIMER3_MR2_COUNT+1;//Timer Counter was reset by MR2 match in the meantime
+	IsrTime-=PerfIsrStart;
+
+	PerfIsrTime+=IsrTime;
+	PerfSliceStart+=IsrTime;
+}//PerfIsrExit
+
+/*
+*********************************************************************************************************
+* Name:                                    PerfSnapshot
+*
+* Description: Get CPU usage of all tasks and IRQ handlers since the previous snapshot and start a new window
+*
+* Arguments:   pOutStatus - pointer to structure where CPU usage is stored
+*
+* Returns:     none
+*
+* Note(s):
+* 			Accounting data are taken and cleared within one critical section so no switch is lost.
+*           The calling task is charged with its current slice up to now.
+*           Tasks which did not run within the window are not reported.
+* *********************************************************************************************************
+*/
+void PerfSnapshot(sPerfStatus *pOutStatus)
+{
+	OS_CPU_SR  cpu_sr;
+	DWORD Now;
+	DWORD Permille;//number of Timer3 counts which make 0.1% of the window
+	BYTE Prio;
+	BYTE TaskNo=0;
+
+	OS_ENTER_CRITICAL();
+	Now=GetTimer3TimeStamp();
+	PerfRunTime[OSPrioCur]+=Now-PerfSliceStart;//calling task is running now
+	PerfSliceStart=Now;
+	pOutStatus->mWindow=Now-PerfWindowStart;
+	PerfWindowStart=Now;
+	pOutStatus->mIsrTime=PerfIsrTime;
+	PerfIsrTime=0;
+	for(Prio=0;Prio<=OS_LOWEST_PRIO;Prio++)
+	{
+		if((PerfSwitches[Prio]==0) && (PerfRunTime[Prio]==0))
+			continue;//task did not run within the window
+		if(TaskNo<PERF_MAX_TASKS)
+		{
+			pOutStatus->mTask[TaskNo].mPrio=Prio;
+			pOutStatus->mTask[TaskNo].mSwitches=PerfSwitches[Prio];
+			pOutStatus->mTask[TaskNo].mRunTime=PerfRunTime[Prio];
+			TaskNo++;
+		}
+		PerfSwitches[Prio]=0;
+		PerfRunTime[Prio]=0;
+	}
+	OS_EXIT_CRITICAL();
+
+	//scale times to the window outside critical section (division is not needed to be atomic)
+	pOutStatus->mTaskNo=TaskNo;
+	Permille=pOutStatus->mWindow/1000;
+	if(Permille==0)
+		Permille=1;//window shorter than 1000 counts - avoid division by 0
+	pOutStatus->mIsrLoad=(WORD)(pOutStatus->mIsrTime/Permille);
+	for(Prio=0;Prio<TaskNo;Prio++)
+		pOutStatus->mTask[Prio].mLoad=(WORD)(pOutStatus->mTask[Prio].mRunTime/Permille);
+	pOutStatus->mWindow/=(INIT_TIMER3_MR2_COUNT+1);//report window in Timer3 ticks
+}//PerfSnapshot
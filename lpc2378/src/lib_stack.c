@@ -0,0 +1,64 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        lib_stack.c
+* Description: Tasks and exception stacks high-water mark measurement
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+* History:
+*              17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+#include "type.h"
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+#include "lib_stack.h"
+
+/*
+*********************************************************************************************************
+* Name:                                    StackScan
+*
+* Description: Get stack high-water mark of all tasks and of exception stack
+*
+* Arguments:   pOutStatus - pointer to structure where stack usage is stored
+*
+* Returns:     none
+*
+* Note(s):
+* 			OSTaskStkChk disables interrupts only to get task stack bottom and size so the scan does not
+*           extend interrupts latency. Tasks are never deleted by Wall-e SW so stack cannot disappear
+*           while it is scanned.
+* *********************************************************************************************************
+*/
+void StackScan(sStackStatus *pOutStatus)
+{
+	OS_STK_DATA StackData;//free and used stack bytes counted by uCOS-II
+	BYTE Prio;
+	BYTE TaskNo=0;
+
+	pOutStatus->mTotalFree=0;
+	for(Prio=0;Prio<=OS_LOWEST_PRIO;Prio++)
+	{
+		if(OSTaskStkChk(Prio,&StackData)!=OS_NO_ERR)
+			continue;//no task or task created without stack checking
+		if(TaskNo<STACK_MAX_TASKS)
+		{
+			pOutStatus->mTask[TaskNo].mPrio=Prio;
+			pOutStatus->mTask[TaskNo].mSize=(WORD)(StackData.OSFree+StackData.OSUsed);
+			pOutStatus->mTask[TaskNo].mUsed=(WORD)StackData.OSUsed;
+			pOutStatus->mTotalFree+=(WORD)StackData.OSFree;
+			TaskNo++;
+		}
+	}
+	pOutStatus->mTaskNo=TaskNo;
+
+	pOutStatus->mExceptSize=OS_CPU_EXCEPT_STK_SIZE*sizeof(OS_STK);
+	pOutStatus->mExceptUsed=(WORD)((OS_CPU_EXCEPT_STK_SIZE-OS_CPU_ExceptStkChk())*sizeof(OS_STK));
+}//StackScan
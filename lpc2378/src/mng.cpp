@@ -1,24 +1,24 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        mng.cpp
-* Description: This defines manager base clase which is a thread (cThread) cabable to subscribe (cSubscribe)
-*              and publish (cPublish) notifiers
-* Author:      Bogdan Kowalczyk
-* Date:        17-Dec-2008
-* Notes:
-* History:
-* 	17-Dec-2008 - Initial version created
-*********************************************************************************************************
-*/
-
-#include "mng.hpp"
-
-
-
-
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        mng.cpp
+* Description: This defines manager base clase which is a thread (cThread) cabable to subscribe (cSubscribe)
+*              and publish (cPublish) notifiers
+* Author:      Bogdan Kowalczyk
+* Date:        17-Dec-2008
+* Notes:
+* History:
+* 	17-Dec-2008 - Initial version created
+*********************************************************************************************************
+*/
+
+#include "mng.hpp"
+
+
+
+
@@ -1,21 +1,21 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        mw_dispatcher.cpp
-* Description: Key communication middleware class.
-*              Defines dispatcher capable to dispatch notifiers from registered publishers to registered
-*              subscribers without subscribers knowing publishers and vice versa.
-* Author:      Bogdan Kowalczyk
-* Date:        13-Dec-2008
-* History:
-* 13-Dec-2008 - Initial version created
-*********************************************************************************************************
-*/
-
-#include "mw_dispatcher.hpp"
-
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        mw_dispatcher.cpp
+* Description: Key communication middleware class.
+*              Defines dispatcher capable to dispatch notifiers from registered publishers to registered
+*              subscribers without subscribers knowing publishers and vice versa.
+* Author:      Bogdan Kowalczyk
+* Date:        13-Dec-2008
+* History:
+* 13-Dec-2008 - Initial version created
+*********************************************************************************************************
+*/
+
+#include "mw_dispatcher.hpp"
+
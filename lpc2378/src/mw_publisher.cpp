@@ -1,43 +1,66 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        mw_publisher.cpp
-* Description: Defines class to be a base for all publishers in the communication middleware
-* Author:      Bogdan Kowalczyk
-* Date:        13-Dec-2008
-* History:
-* 13-Dec-2008 - Initial version created
-*********************************************************************************************************
-*/
-
-#include "mw_publisher.hpp"
-
-
-BYTE cBasePublisher::Post(cSmartPtrBase& smartPtr)
-{
-	BYTE Result;//temporary result holder
-	
-	if(!smartPtr.isValid())return OS_ERR_EVENT_TYPE;//if smartPtr does not point any valid managed memory do nothing
-	
-	smartPtr.m_pClass->Inc();//increment referencies to Notifier befor we place it into Send queue
-	
-	if ((static_cast<cNotifier*>(smartPtr.m_pClass))->GetHandling() & NT_HND_HIGH_PRT)//if high priority Notifier handling requested
-	{
-		Result = m_pSendQueue->SendFront(smartPtr.m_pClass);
-	}else
-	{
-		Result = m_pSendQueue->Send(smartPtr.m_pClass);
-	}
-	if(Result != OS_NO_ERR ) //notifier was not placed in the send queue because of error
-	{
-		smartPtr.m_pClass->Dec();//return back to original number of referencies to avoid mem leak
-	}
-	return Result;
-	
-}//cBasePublisher::Post
-
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        mw_publisher.cpp
+* Description: Defines class to be a base for all publishers in the communication middleware
+* Author:      Bogdan Kowalczyk
+* Date:        13-Dec-2008
+* History:
+* 13-Dec-2008 - Initial version created
+* 17-Oct-2026 - Post() signals dispatcher event to have notifiers dispatched on demand instead of polling
+* 17-Oct-2026 - Added direct dispatch mode where Post() delivers notifiers to subscribers without send queue
+*********************************************************************************************************
+*/
+
+#include "mw_publisher.hpp"
+#include "mw_dispatcher.hpp"
+
+
+//Post notifier pointed by smartPtr to all its subscribers
+//Notifier is placed into publisher send queue and dispatcher thread is woken up to dispatch it.
+//When direct dispatch is requested (NT_HND_DIRECT handling or publisher SetDirectDispatch(TRUE)) and the
+//publisher is registered the notifier is placed into subscribers receive queues in the context of
+//calling thread so it skips send queue and dispatcher thread.
+//IMPORTANT! Directly dispatched notifier can overtake notifiers of the same publisher waiting in its send queue
+//Return:
+//	OS_NO_ERR - when notifier is placed into send queue or directly dispatched
+//	OS_Q_FULL - when send queue is full
+//	OS_ERR_EVENT_TYPE - when smartPtr is not valid
+BYTE cBasePublisher::Post(cSmartPtrBase& smartPtr)
+{
+	BYTE Result;//temporary result holder
+	
+	if(!smartPtr.isValid())return OS_ERR_EVENT_TYPE;//if smartPtr does not point any valid managed memory do nothing
+	
+	if(m_pDispatcher && (m_DirectDispatch || ((static_cast<cNotifier*>(smartPtr.m_pClass))->GetHandling() & NT_HND_DIRECT)))
+	{//direct dispatch - smartPtr keeps notifier alive during delivery so no extra reference is needed
+		m_pDispatcher->DirectDispatch(static_cast<cNotifier*>(smartPtr.m_pClass));
+		return OS_NO_ERR;
+	}
+	
+	smartPtr.m_pClass->Inc();//increment referencies to Notifier befor we place it into Send queue
+	
+	if ((static_cast<cNotifier*>(smartPtr.m_pClass))->GetHandling() & NT_HND_HIGH_PRT)//if high priority Notifier handling requested
+	{
+		Result = m_pSendQueue->SendFront(smartPtr.m_pClass);
+	}else
+	{
+		Result = m_pSendQueue->Send(smartPtr.m_pClass);
+	}
+	if(Result != OS_NO_ERR ) //notifier was not placed in the send queue because of error
+	{
+		smartPtr.m_pClass->Dec();//return back to original number of referencies to avoid mem leak
+	}
+	else if(m_pDispatcher)//notifier is in the send queue so wake up dispatcher to deliver it
+	{
+		m_pDispatcher->NotifierPosted();
+	}
+	return Result;
+	
+}//cBasePublisher::Post
+
@@ -1,64 +1,202 @@
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        mw_smart_ptr.cpp
-* Description: Defines smart pointer class to be capable to deal with Notifiers dynamically allocated
-*              on the heap without taking care about memory management (delete) which is done
-*              automatically when data are not any longer needed.
-* Author:      Bogdan Kowalczyk
-* Date:        13-Dec-2008
-* History:
-* 13-Dec-2008 - Initial version created
-*********************************************************************************************************
-*/
-#include "mw_smart_ptr.hpp"
-#include "wrp_kernel.hpp"
-
-//on construction noone is using referenced object so counter is set to zero
-cMemMgrBase::cMemMgrBase(void)
-{
-	Kernel.MemMgrMutex.Acquire();
-	m_ClassRefs=0;
-	Kernel.MemMgrMutex.Release();
-}//cMemMgrBase::cMemMgrBase(void)
-
-//called when another reference to objecton the heap arrise
-void cMemMgrBase::Inc(void)
-{
-	Kernel.MemMgrMutex.Acquire();
-	++m_ClassRefs;
-	Kernel.MemMgrMutex.Release();
-}//void cMemMgrBase::Inc(void)
-
-//called when reference to object on the heap disappears
-void cMemMgrBase::Dec(void)
-{
-	Kernel.MemMgrMutex.Acquire();
-	if(--m_ClassRefs == 0)delete this;
-	Kernel.MemMgrMutex.Release();
-}//cMemMgrBase::Dec(void)
-
-cSmartPtrBase& cSmartPtrBase::operator=(cMemMgrBase* pClass)
-{
-	if(!pClass)//assign called for NULL pointer so only copy it
-		{
-		m_pClass=pClass;
-		}
-	else//pClass point to managed memory area
-		{
-		if(m_pClass!= pClass)//if we do not assign existing pointer to itself i.e. p1=p1
-			{
-			//if left smart pointer points to something lower reference counter as pointer will be substituted with new value
-			//received from the right pointer
-			if(m_pClass)m_pClass->Dec();
-			m_pClass=pClass;//left pointer receives same value as right pointer both will point to the same memory
-			if(m_pClass)m_pClass->Inc();//increase reference counter as now both left and right pointers points the same cMemMgrBase
-			}
-		}
-	return *this;
-}//cSmartPtrBase::operator=
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        mw_smart_ptr.cpp
+* Description: Defines smart pointer class to be capable to deal with Notifiers dynamically allocated
+*              on the heap without taking care about memory management (delete) which is done
+*              automatically when data are not any longer needed.
+* Author:      Bogdan Kowalczyk
+* Date:        13-Dec-2008
+* History:
+* 13-Dec-2008 - Initial version created
+* 17-Oct-2026 - Reference counting protected by short critical section instead of global MemMgrMutex
+* 17-Oct-2026 - cMemMgrBase objects allocated from fixed size block pools (uCOS-II memory partitions)
+* 17-Oct-2026 - Reference counter updates counted in HOST_RUN build (MEM_REF_STAT_EN)
+* 17-Oct-2026 - Memory pool of the largest notifiers (EVT_SYS_RES, EVT_PERF) so they are not allocated on the heap
+*********************************************************************************************************
+*/
+#include "mw_smart_ptr.hpp"
+#include "mw_notifier.hpp" //NT_MAX_SIZE of the largest pool block
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+#include "lib_new.hpp"
+#include "lib_error.h"
+
+#if MEM_POOL_NO > OS_MAX_MEM_PART
+#error "MEM_POOL_NO exceeds OS_MAX_MEM_PART"
+#endif
+
+//storage for memory pools blocks (DWORD used to have blocks 4 bytes aligned)
+static DWORD MemPool0[MEM_POOL0_BLK_NO][MEM_POOL0_BLK_SIZE/sizeof(DWORD)];
+static DWORD MemPool1[MEM_POOL1_BLK_NO][MEM_POOL1_BLK_SIZE/sizeof(DWORD)];
+static DWORD MemPool2[MEM_POOL2_BLK_NO][MEM_POOL2_BLK_SIZE/sizeof(DWORD)];
+static DWORD MemPool3[MEM_POOL3_BLK_NO][MEM_POOL3_BLK_SIZE/sizeof(DWORD)];
+
+//uCOS-II partitions of the memory pools ordered by ascending block size
+static OS_MEM* MemPoolPartition[MEM_POOL_NO];
+//maximum number of blocks allocated so far from every pool
+static BYTE MemPoolMaxUsed[MEM_POOL_NO];
+//number of objects allocated on the heap because there was no pool or no free block for them
+static WORD MemPoolHeapFallbacks;
+#if MEM_REF_STAT_EN > 0
+//number of reference counter updates (Inc() and Dec() calls)
+static DWORD MemRefOps;
+#endif
+
+//on construction noone is using referenced object so counter is set to zero
+//no protection needed as object is not yet visible for any other thread
+cMemMgrBase::cMemMgrBase(void)
+{
+	m_ClassRefs=0;
+}//cMemMgrBase::cMemMgrBase(void)
+
+//called when another reference to objecton the heap arrise
+void cMemMgrBase::Inc(void)
+{
+	OS_CPU_SR  cpu_sr;//required by OS_ENTER_CRITICAL/OS_EXIT_CRITICAL
+	
+	OS_ENTER_CRITICAL();
+	++m_ClassRefs;
+#if MEM_REF_STAT_EN > 0
+	MemRefOps++;
+#endif
+	OS_EXIT_CRITICAL();
+}//void cMemMgrBase::Inc(void)
+
+//called when reference to object on the heap disappears
+//IMPORTANT! delete is called outside of critical section because operator delete acquires MemMutex
+//           the last reference owner is the only one who can see zero so delete is still thread safe
+void cMemMgrBase::Dec(void)
+{
+	OS_CPU_SR  cpu_sr;//required by OS_ENTER_CRITICAL/OS_EXIT_CRITICAL
+	int ClassRefs;//value of the counter after decrement
+	
+	OS_ENTER_CRITICAL();
+	ClassRefs=--m_ClassRefs;
+#if MEM_REF_STAT_EN > 0
+	MemRefOps++;
+#endif
+	OS_EXIT_CRITICAL();
+	if(ClassRefs == 0)delete this;
+}//cMemMgrBase::Dec(void)
+
+//create memory pools used by operator new
+//must be called once after ::OSInit() and before any cMemMgrBase object is created
+void cMemMgrBase::InitPools(void)
+{
+	INT8U Err;//uCOS-II error code
+	
+	MemPoolPartition[0]=OSMemCreate(static_cast<void*>(MemPool0),MEM_POOL0_BLK_NO,MEM_POOL0_BLK_SIZE,&Err);
+	if(Err!=OS_NO_ERR)NOT_ALLOWED_STATE;
+	MemPoolPartition[1]=OSMemCreate(static_cast<void*>(MemPool1),MEM_POOL1_BLK_NO,MEM_POOL1_BLK_SIZE,&Err);
+	if(Err!=OS_NO_ERR)NOT_ALLOWED_STATE;
+	MemPoolPartition[2]=OSMemCreate(static_cast<void*>(MemPool2),MEM_POOL2_BLK_NO,MEM_POOL2_BLK_SIZE,&Err);
+	if(Err!=OS_NO_ERR)NOT_ALLOWED_STATE;
+	MemPoolPartition[3]=OSMemCreate(static_cast<void*>(MemPool3),MEM_POOL3_BLK_NO,MEM_POOL3_BLK_SIZE,&Err);
+	if(Err!=OS_NO_ERR)NOT_ALLOWED_STATE;
+}//cMemMgrBase::InitPools
+
+//allocate object from the first pool with large enough block or from the heap when it is not possible
+void* cMemMgrBase::operator new(size_t size) throw()
+{
+	OS_CPU_SR  cpu_sr;//required by OS_ENTER_CRITICAL/OS_EXIT_CRITICAL
+	INT8U Err;//uCOS-II error code
+	void* p;//allocated block
+	BYTE PoolNo;//index of the pool
+	BYTE Used;//number of used pool blocks
+	
+	for(PoolNo=0;PoolNo<MEM_POOL_NO;PoolNo++)
+	{
+		if(size<=MemPoolPartition[PoolNo]->OSMemBlkSize)//first pool with large enough blocks
+		{
+			p=OSMemGet(MemPoolPartition[PoolNo],&Err);
+			if(Err==OS_NO_ERR)
+			{
+				OS_ENTER_CRITICAL();
+				Used=static_cast<BYTE>(MemPoolPartition[PoolNo]->OSMemNBlks-MemPoolPartition[PoolNo]->OSMemNFree);
+				if(Used>MemPoolMaxUsed[PoolNo])MemPoolMaxUsed[PoolNo]=Used;
+				OS_EXIT_CRITICAL();
+				return p;
+			}
+			break;//pool is empty so fallback to the heap
+		}
+	}
+	OS_ENTER_CRITICAL();
+	++MemPoolHeapFallbacks;
+	OS_EXIT_CRITICAL();
+	return ::operator new(size);
+}//cMemMgrBase::operator new
+
+//return object memory to the pool it belongs to or to the heap
+//pool is found based on the block address so operator delete does not need object size
+void cMemMgrBase::operator delete(void* p) throw()
+{
+	BYTE PoolNo;//index of the pool
+	BYTE* pPoolStart;//first byte of the pool memory
+	
+	for(PoolNo=0;PoolNo<MEM_POOL_NO;PoolNo++)
+	{
+		pPoolStart=static_cast<BYTE*>(MemPoolPartition[PoolNo]->OSMemAddr);
+		if(static_cast<BYTE*>(p)>=pPoolStart && 
+		   static_cast<BYTE*>(p)<pPoolStart+MemPoolPartition[PoolNo]->OSMemNBlks*MemPoolPartition[PoolNo]->OSMemBlkSize)
+		{
+			OSMemPut(MemPoolPartition[PoolNo],p);
+			return;
+		}
+	}
+	::operator delete(p);//not a pool block so it was allocated on the heap
+}//cMemMgrBase::operator delete
+
+//get PoolNo (0..MEM_POOL_NO-1) occupancy and high-water mark
+void cMemMgrBase::GetPoolStatus(BYTE PoolNo,sMemPoolStatus& rStatus)
+{
+	OS_CPU_SR  cpu_sr;//required by OS_ENTER_CRITICAL/OS_EXIT_CRITICAL
+	
+	if(PoolNo>=MEM_POOL_NO)NOT_ALLOWED_STATE;
+	OS_ENTER_CRITICAL();
+	rStatus.mBlkSize=static_cast<WORD>(MemPoolPartition[PoolNo]->OSMemBlkSize);
+	rStatus.mBlkNo=static_cast<BYTE>(MemPoolPartition[PoolNo]->OSMemNBlks);
+	rStatus.mBlkUsed=static_cast<BYTE>(MemPoolPartition[PoolNo]->OSMemNBlks-MemPoolPartition[PoolNo]->OSMemNFree);
+	rStatus.mBlkMaxUsed=MemPoolMaxUsed[PoolNo];
+	OS_EXIT_CRITICAL();
+}//cMemMgrBase::GetPoolStatus
+
+//number of objects allocated on the heap instead of the pool so far
+WORD cMemMgrBase::GetHeapFallbackCounter(void)
+{
+	return MemPoolHeapFallbacks;
+}//cMemMgrBase::GetHeapFallbackCounter
+
+#if MEM_REF_STAT_EN > 0
+//number of reference counter updates (Inc() and Dec() calls) so far
+DWORD cMemMgrBase::GetRefOpsCounter(void)
+{
+	return MemRefOps;
+}//cMemMgrBase::GetRefOpsCounter
+#endif
+
+cSmartPtrBase& cSmartPtrBase::operator=(cMemMgrBase* pClass)
+{
+	if(!pClass)//assign called for NULL pointer so only copy it
+		{
+		m_pClass=pClass;
+		}
+	else//pClass point to managed memory area
+		{
+		if(m_pClass!= pClass)//if we do not assign existing pointer to itself i.e. p1=p1
+			{
+			//if left smart pointer points to something lower reference counter as pointer will be substituted with new value
+			//received from the right pointer
+			if(m_pClass)m_pClass->Dec();
+			m_pClass=pClass;//left pointer receives same value as right pointer both will point to the same memory
+			if(m_pClass)m_pClass->Inc();//increase reference counter as now both left and right pointers points the same cMemMgrBase
+			}
+		}
+	return *this;
+}//cSmartPtrBase::operator=
@@ -0,0 +1,33 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        mw_timer.cpp
+* Description: Defines timer which delivers EVT_TIMER notifiers to the subscriber's receive queue.
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+#include "mw_timer.hpp"
+
+#if OS_TMR_EN
+//place EVT_TIMER notifier into receive queue of the timer subscriber
+//executed by uCOS-II timer task with scheduler unlocked so operator new can wait for MemMutex
+void cNotifierTimer::Expired()
+{
+	cNotifier* pNotifier = new cTypeNotifier<BYTE>(EVT_TIMER,OS_TASK_TMR_PRIO,NT_HND_NORMAL_PRT,m_TimerId);
+	
+	pNotifier->Inc();//increment referencies to Notifier befor we place it into receiver queue of subscriber
+	if((m_pSubscriber->GetReceiveQueue())->Send(pNotifier)!=OS_NO_ERR)
+	{
+		m_Lost_Counter+=1;//receiver is late with its jobs so timer period is lost
+		pNotifier->Dec();//decrement referencies because Notifier was finally not placed into receiver queue
+	}
+}//cNotifierTimer::Expired
+#endif //OS_TMR_EN
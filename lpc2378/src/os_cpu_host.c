@@ -0,0 +1,552 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        os_cpu_host.c
+* Description: uCOS-II CPU port for Linux host (simulation and benchmarking of Wall-e SW without the robot)
+*              Replaces os_cpu_c.c, os_cpu_a.S and os_exch.c in HOST_RUN build (make host).
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+*              All tasks run in one host thread (CPU thread). Every task has its own ucontext and host stack,
+*              task stack given to OSTaskCreate is only kept for uCOS-II (stack checking etc.).
+*              CPU interrupt disable bit is a global flag (the global lock) set by OS_CPU_SR_Save.
+*              IRQ is SIGUSR1 sent to CPU thread by host IRQ thread which polls host file descriptors
+*              (OS tick timerfd, terminal) connected to VIC IRQ channels. When IRQs are disabled the signal
+*              only marks the IRQ pending and it is served by OS_CPU_SR_Restore which enables IRQs.
+*              Peripheral registers are anonymous memory mapped at LPC2378 addresses (see HostMapRegisters).
+* History:
+*              17-Oct-2026 - Initial version created
+*              17-Oct-2026 - OS_CPU_ExceptStkChk for stack high-water mark report
+*********************************************************************************************************
+*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+#include <signal.h>
+#include <ucontext.h>
+#include <pthread.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+
+#define  OS_CPU_GLOBALS
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+#include "os_cpu_host.h"
+#include "hw_lpc23xx.h"
+#include "hw_gpio.h"
+#include "lib_error.h"
+#include "lib_perf.h"
+
+#define HOST_TASK_NO			(OS_MAX_TASKS+OS_N_SYS_TASKS) //number of tasks contexts
+#define HOST_TASK_STK_SIZE		0x40000 //host stack of every task (host C library needs much more than firmware)
+#define HOST_FAULT_STK_SIZE		0x10000 //signal stack used to report faults
+#define HOST_IRQ_SIGNAL			SIGUSR1 //signal used as IRQ of the CPU thread
+#define HOST_CPSR_I_BIT			0x80 //OS_CPU_SR value when IRQs are disabled (I bit of ARM CPSR)
+
+//peripheral registers areas of LPC2378 mapped as memory
+#define HOST_FIO_REG_ADDR		0x3FFFC000 //Fast GPIO
+#define HOST_FIO_REG_SIZE		0x00004000
+#define HOST_APB_REG_ADDR		0xE0000000 //APB peripherals, battery RAM and System Control Block
+#define HOST_APB_REG_SIZE		0x00200000
+#define HOST_AHB_REG_ADDR		0xFFE00000 //AHB peripherals and Vectored Interrupt Controller
+#define HOST_AHB_REG_SIZE		0x00200000
+
+//VICVectAddrN register (handler addresses fit 32 bit register as executable is not position independent - see make host)
+#define HOST_VIC_VECT_ADDR(n)	((&VICVectAddr0)[n])
+
+typedef void (*BSP_FNCT_PTR)(void);
+
+//context of the task
+typedef struct
+{
+	ucontext_t mContext;//saved task context
+	OS_STK *mTopOfStk;//uCOS-II task stack top - identifies the task using this context (NULL when free)
+	void (*mTask)(void *p_arg);//task function
+	void *mArg;//task argument
+	char mStk[HOST_TASK_STK_SIZE] __attribute__((aligned(16)));//host stack of the task
+} sHostTask;
+
+static sHostTask HostTask[HOST_TASK_NO];
+
+//IRQs are disabled after reset until the first task is started by OSStartHighRdy
+static volatile OS_CPU_SR HostIntDis = HOST_CPSR_I_BIT;
+static volatile INT32U HostIrqPending;//VIC channels which IRQ is requested but not yet served
+static volatile int HostIrqFd[OS_CPU_HOST_IRQ_NO];//host file descriptors connected to VIC channels
+static pthread_t HostCpuThread;//thread which runs uCOS-II tasks and ISRs
+static int HostWakeFd;//wakes up IRQ thread to watch again descriptors of served IRQs
+
+static char HostFaultStk[HOST_FAULT_STK_SIZE];//CPU thread signal stack to report faults also on task stack overflow
+
+//prevents compiler from moving memory accesses over critical section boundaries
+#define HOST_BARRIER()	__asm__ __volatile__("" ::: "memory")
+
+/*
+*********************************************************************************************************
+* Name:                                    HostMapRegisters
+*
+* Description: Maps anonymous memory at LPC2378 peripheral registers addresses
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 			Called before any static constructor as cKernelInit and other constructors access registers.
+*           Registers do not have any hardware function - drivers reading and writing them work unchanged,
+*           drivers which need hardware response are replaced by hw_host.c stubs.
+* *********************************************************************************************************
+*/
+static void HostMapRegister(unsigned long InAddr, unsigned long InSize)
+{
+	void *pArea=mmap((void *)InAddr,InSize,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS|MAP_FIXED_NOREPLACE,-1,0);
+
+	if(pArea!=(void *)InAddr)
+	{
+		fprintf(stderr,"walle: cannot map registers at 0x%08lX\n",InAddr);
+		exit(EXIT_FAILURE);
+	}
+}//HostMapRegister
+
+/*
+*********************************************************************************************************
+* Name:                                    HostIrqThread
+*
+* Description: Host IRQ thread - requests IRQs of VIC channels which host file descriptors are ready to read
+*
+* Arguments:   pArg - not used
+*
+* Returns:     never returns
+*
+* Note(s):
+* 			Descriptor of requested IRQ is not watched until its handler is executed and reads it.
+* *********************************************************************************************************
+*/
+static void *HostIrqThread(void *pArg)
+{
+	struct pollfd Fds[OS_CPU_HOST_IRQ_NO+1];
+	INT8U IrqNo[OS_CPU_HOST_IRQ_NO+1];
+	INT32U Requested;
+	uint64_t Wake;
+	int FdNo;
+	int i;
+
+	(void)pArg;
+	for(;;)
+	{
+		Fds[0].fd=HostWakeFd;
+		Fds[0].events=POLLIN;
+		FdNo=1;
+		for(i=0;i<OS_CPU_HOST_IRQ_NO;i++)
+		{
+			if((HostIrqFd[i]<0) || (HostIrqPending&(1u<<i)))
+				continue;
+			Fds[FdNo].fd=HostIrqFd[i];
+			Fds[FdNo].events=POLLIN;
+			IrqNo[FdNo++]=(INT8U)i;
+		}
+		if(poll(Fds,FdNo,-1)<0)
+			continue;
+		if(Fds[0].revents)
+			while(read(HostWakeFd,&Wake,sizeof(Wake))<0 && errno==EINTR);
+		Requested=0;
+		for(i=1;i<FdNo;i++)
+			if(Fds[i].revents)
+				Requested|=1u<<IrqNo[i];
+		if(Requested)
+		{
+			__sync_fetch_and_or(&HostIrqPending,Requested);
+			pthread_kill(HostCpuThread,HOST_IRQ_SIGNAL);
+		}
+	}
+	return NULL;
+}//HostIrqThread
+
+/*
+*********************************************************************************************************
+* Name:                                    HostIrqSignal
+*
+* Description: IRQ exception entry - CPU thread signal handler
+*
+* Arguments:   InSigNo - not used
+*
+* Returns:     none
+*
+* Note(s):
+* 			When IRQs are disabled IRQ stays pending and it is served by OS_CPU_SR_Restore.
+*           Context switch (OSIntCtxSw) can be done from the signal handler - the handler returns when the
+*           interrupted task is switched in again.
+* *********************************************************************************************************
+*/
+static void HostIrqSignal(int InSigNo)
+{
+	int SavedErrno=errno;
+
+	(void)InSigNo;
+	if(!HostIntDis)
+		OS_CPU_ExceptHndlr(OS_CPU_ARM_EXCEPT_IRQ);
+	errno=SavedErrno;
+}//HostIrqSignal
+
+/*
+*********************************************************************************************************
+* Name:                                    HostPowerOff
+*
+* Description: Critical exception - the same result as on the board: reason in battery RAM and power off
+*
+* Arguments:   InExceptType - exception type
+*              pInPc        - code address where exception happened (use addr2line to find the source line)
+*
+* Returns:     never returns
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+static void HostPowerOff(INT32U InExceptType, void *pInPc)
+{
+	if (InExceptType != OS_CPU_ARM_EXCEPT_SWI)
+		EXCEPTION_REASON=OTHER_EXCEPTION;
+	POWER_OFF_REASON=EXCEPTION_TURN_OFF;
+	fprintf(stderr,"\nwalle: exception %u (reason 0x%02X) at %p - power off\n",(unsigned)InExceptType,
+		(unsigned)EXCEPTION_REASON,pInPc);
+	_exit(EXIT_FAILURE);//exit handlers are not called as CPU state is not known
+}//HostPowerOff
+
+/*
+*********************************************************************************************************
+* Name:                                    HostFaultSignal
+*
+* Description: Abort and undefined instruction exceptions entry - SIGSEGV, SIGBUS, SIGILL, SIGFPE handler
+*
+* Arguments:   InSigNo  - signal number
+*              pInInfo  - not used
+*              pInCtx   - CPU thread context when the signal came
+*
+* Returns:     never returns
+*
+* Note(s):
+* 			Runs on the signal stack so task stack overflow is reported as well.
+* *********************************************************************************************************
+*/
+static void HostFaultSignal(int InSigNo, siginfo_t *pInInfo, void *pInCtx)
+{
+	(void)pInInfo;
+	HostPowerOff((InSigNo==SIGILL)?OS_CPU_ARM_EXCEPT_UNDEF_INSTR:OS_CPU_ARM_EXCEPT_DATA_ABORT,
+		(void *)((ucontext_t *)pInCtx)->uc_mcontext.gregs[REG_RIP]);
+}//HostFaultSignal
+
+/*
+*********************************************************************************************************
+* Name:                                    HostInit
+*
+* Description: Host CPU initialization done before any static constructor (C++ constructors of cKernel,
+*              managers etc. call uCOS-II and drivers)
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 			IRQ thread is created with IRQ signal blocked so it is always delivered to the CPU thread.
+* *********************************************************************************************************
+*/
+__attribute__((constructor(101))) static void HostInit(void)
+{
+	struct sigaction Action;
+	sigset_t Mask;
+	sigset_t SavedMask;
+	pthread_t IrqThread;
+	stack_t SignalStk;
+	int i;
+
+	HostMapRegister(HOST_FIO_REG_ADDR,HOST_FIO_REG_SIZE);
+	HostMapRegister(HOST_APB_REG_ADDR,HOST_APB_REG_SIZE);
+	HostMapRegister(HOST_AHB_REG_ADDR,HOST_AHB_REG_SIZE);
+
+	for(i=0;i<OS_CPU_HOST_IRQ_NO;i++)
+		HostIrqFd[i]=-1;
+	HostWakeFd=eventfd(0,EFD_NONBLOCK);
+	HostCpuThread=pthread_self();
+
+	sigemptyset(&Action.sa_mask);
+	Action.sa_flags=SA_RESTART;
+	Action.sa_handler=HostIrqSignal;
+	sigaction(HOST_IRQ_SIGNAL,&Action,NULL);
+
+	SignalStk.ss_sp=HostFaultStk;
+	SignalStk.ss_size=sizeof(HostFaultStk);
+	SignalStk.ss_flags=0;
+	sigaltstack(&SignalStk,NULL);
+	Action.sa_flags=SA_SIGINFO|SA_ONSTACK;
+	Action.sa_sigaction=HostFaultSignal;
+	sigaction(SIGSEGV,&Action,NULL);
+	sigaction(SIGBUS,&Action,NULL);
+	sigaction(SIGILL,&Action,NULL);
+	sigaction(SIGFPE,&Action,NULL);
+
+	sigemptyset(&Mask);
+	sigaddset(&Mask,HOST_IRQ_SIGNAL);
+	pthread_sigmask(SIG_BLOCK,&Mask,&SavedMask);
+	if((HostWakeFd<0) || pthread_create(&IrqThread,NULL,HostIrqThread,NULL))
+	{
+		fprintf(stderr,"walle: cannot start host IRQ thread\n");
+		exit(EXIT_FAILURE);
+	}
+	pthread_sigmask(SIG_SETMASK,&SavedMask,NULL);
+}//HostInit
+
+void OS_CPU_HostIrqSource(INT8U InIrqNo, int InFd)
+{
+	uint64_t Wake=1;
+
+	HostIrqFd[InIrqNo]=InFd;
+	if(write(HostWakeFd,&Wake,sizeof(Wake))<0)
+		return;//IRQ thread is already woken up
+}//OS_CPU_HostIrqSource
+
+void OS_CPU_HostIrqRequest(INT8U InIrqNo)
+{
+	__sync_fetch_and_or(&HostIrqPending,1u<<InIrqNo);
+	pthread_kill(HostCpuThread,HOST_IRQ_SIGNAL);
+}//OS_CPU_HostIrqRequest
+
+/*
+*********************************************************************************************************
+*                                       CRITICAL SECTION
+*
+* Description: Disable and restore IRQs (OS_ENTER_CRITICAL/OS_EXIT_CRITICAL)
+*
+* Note(s)    : OS_CPU_SR is I bit of ARM CPSR so drivers checking it (hw_uart.c) work the same way.
+*              IRQs which came when they were disabled are served when they are enabled again.
+*********************************************************************************************************
+*/
+OS_CPU_SR OS_CPU_SR_Save(void)
+{
+	OS_CPU_SR cpu_sr=HostIntDis;
+
+	HostIntDis=HOST_CPSR_I_BIT;
+	HOST_BARRIER();
+	return cpu_sr;
+}//OS_CPU_SR_Save
+
+void OS_CPU_SR_Restore(OS_CPU_SR cpu_sr)
+{
+	HOST_BARRIER();
+	HostIntDis=cpu_sr;
+	if(!cpu_sr && HostIrqPending)
+		OS_CPU_ExceptHndlr(OS_CPU_ARM_EXCEPT_IRQ);
+}//OS_CPU_SR_Restore
+
+/*
+*********************************************************************************************************
+* Name:                                   OS_CPU_ExceptHndlr
+*
+* Description: Common exception handler - serves IRQs and powers off the board on any other exception
+*
+* Arguments:   except_type - exception type
+*
+* Returns:     none
+*
+* Note(s):
+* 			Called with IRQs enabled for IRQ exception. IRQ handlers are taken from VICVectAddrN registers
+*           the same way os_exch.c takes them from the VIC. Critical exceptions (SWI of lib_error.h macros
+*           in HOST_RUN build) store power off reason in battery RAM and exit the simulation.
+* *********************************************************************************************************
+*/
+void OS_CPU_ExceptHndlr (INT32U except_type)
+{
+	BSP_FNCT_PTR pfnct;
+	INT32U Pending;
+	INT8U IrqNo;
+	uint64_t Wake=1;
+
+	if (except_type == OS_CPU_ARM_EXCEPT_IRQ)
+	{
+		do
+		{
+			HostIntDis=HOST_CPSR_I_BIT;//IRQ exception disables IRQs (no nesting)
+			HOST_BARRIER();
+			OSIntNesting++;
+#if PERF_ACCOUNTING_EN > 0
+			PerfIsrEnter();
+#endif
+			while((Pending=__sync_fetch_and_and(&HostIrqPending,0))!=0)
+			{
+				for(IrqNo=0;Pending;IrqNo++,Pending>>=1)
+				{
+					if(!(Pending&BIT0) || !(VICIntEnable&(1u<<IrqNo)))
+						continue;//not requested or disabled in VIC
+					pfnct=(BSP_FNCT_PTR)(uintptr_t)HOST_VIC_VECT_ADDR(IrqNo);
+					if(pfnct)
+						(*pfnct)();
+				}
+				if(write(HostWakeFd,&Wake,sizeof(Wake))<0)
+					Wake=1;//IRQ thread is already woken up
+			}
+#if PERF_ACCOUNTING_EN > 0
+			PerfIsrExit();
+#endif
+			OSIntExit();//returns when interrupted task is switched in again
+			HOST_BARRIER();
+			HostIntDis=0;
+		}while(HostIrqPending);
+		return;
+	}
+	HostPowerOff(except_type,__builtin_return_address(0));
+}//OS_CPU_ExceptHndlr
+
+/*
+*********************************************************************************************************
+* Name:                                    HostTaskStart
+*
+* Description: Entry of every task context - enables IRQs and runs the task
+*
+* Arguments:   none
+*
+* Returns:     never returns
+*
+* Note(s):
+* 			Task must never return (on the board it would jump to 0x14141414 set as LR by OSTaskStkInit).
+* *********************************************************************************************************
+*/
+static void HostTaskStart(void)
+{
+	sHostTask *pTask=(sHostTask *)OSTCBCur->OSTCBStkPtr;
+
+	OS_CPU_SR_Restore(0);//task starts with IRQs enabled
+	pTask->mTask(pTask->mArg);
+	OS_CPU_ExceptHndlr(OS_CPU_ARM_EXCEPT_PREFETCH_ABORT);
+}//HostTaskStart
+
+/*
+*********************************************************************************************************
+*                                        INITIALIZE A TASK'S STACK
+*
+* Description: Prepares host context of the task
+*
+* Arguments  : task          is a pointer to the task code
+*              p_arg         is a pointer to a user supplied data area that will be passed to the task
+*              ptos          is a pointer to the top of stack
+*              opt           not used
+*
+* Returns    : Pointer to task context stored by uCOS-II as OSTCBStkPtr
+*
+* Note(s)    : Context is taken by the stack top so a task created again on the same stack gets the same
+*              context. Otherwise a free context or the context of deleted task is used.
+*********************************************************************************************************
+*/
+OS_STK *OSTaskStkInit (void (*task)(void *p_arg), void *p_arg, OS_STK *ptos, INT16U opt)
+{
+	sHostTask *pTask=NULL;
+	INT8U Prio;
+	int i;
+
+	opt=opt;
+	for(i=0;(i<HOST_TASK_NO) && !pTask;i++)
+		if(HostTask[i].mTopOfStk==ptos)
+			pTask=&HostTask[i];
+	for(i=0;(i<HOST_TASK_NO) && !pTask;i++)
+		if(!HostTask[i].mTopOfStk)
+			pTask=&HostTask[i];
+	for(i=0;(i<HOST_TASK_NO) && !pTask;i++)
+	{
+		pTask=&HostTask[i];
+		if(OSTCBCur && (OSTCBCur->OSTCBStkPtr==(OS_STK *)pTask))
+			pTask=NULL;//current task context
+		for(Prio=0;(Prio<=OS_LOWEST_PRIO) && pTask;Prio++)
+			if((OSTCBPrioTbl[Prio]>(OS_TCB *)1) && (OSTCBPrioTbl[Prio]->OSTCBStkPtr==(OS_STK *)pTask))
+				pTask=NULL;//context of existing task
+	}
+	if(!pTask)
+		THREAD_CREATE_EXCEPTION;//more tasks than uCOS-II supports
+
+	getcontext(&pTask->mContext);
+	pTask->mContext.uc_stack.ss_sp=pTask->mStk;
+	pTask->mContext.uc_stack.ss_size=sizeof(pTask->mStk);
+	pTask->mContext.uc_link=NULL;
+	sigemptyset(&pTask->mContext.uc_sigmask);
+	makecontext(&pTask->mContext,HostTaskStart,0);
+	pTask->mTopOfStk=ptos;
+	pTask->mTask=task;
+	pTask->mArg=p_arg;
+	return (OS_STK *)pTask;
+}//OSTaskStkInit
+
+/*
+*********************************************************************************************************
+*                                          CONTEXT SWITCH
+*
+* Description: Task level (OSCtxSw) and interrupt level (OSIntCtxSw) context switch, start of multitasking
+*              (OSStartHighRdy). Called with IRQs disabled as from os_cpu_a.S.
+*
+* Note(s)    : Interrupted task context is the IRQ signal handler context so both switches are the same.
+*********************************************************************************************************
+*/
+void OSCtxSw(void)
+{
+	sHostTask *pFrom=(sHostTask *)OSTCBCur->OSTCBStkPtr;
+
+	OSTaskSwHook();
+	OSPrioCur=OSPrioHighRdy;
+	OSTCBCur=OSTCBHighRdy;
+	swapcontext(&pFrom->mContext,&((sHostTask *)OSTCBHighRdy->OSTCBStkPtr)->mContext);
+}//OSCtxSw
+
+void OSIntCtxSw(void)
+{
+	OSCtxSw();
+}//OSIntCtxSw
+
+void OSStartHighRdy(void)
+{
+	OSTaskSwHook();
+	OSRunning=TRUE;
+	setcontext(&((sHostTask *)OSTCBHighRdy->OSTCBStkPtr)->mContext);
+}//OSStartHighRdy
+
+/*
+*********************************************************************************************************
+*                                            HOOKS
+*
+* Description: Hooks required by uCOS-II and os_core.c (see os_cpu_c.c)
+*********************************************************************************************************
+*/
+void OSTaskSwHook(void)
+{
+#if PERF_ACCOUNTING_EN > 0
+	PerfTaskSwHook();
+#endif
+}//OSTaskSwHook
+
+void OSInitExceptStk(void)
+{
+	INT32U   size;
+	OS_STK  *pstk;
+
+	pstk = &OS_CPU_ExceptStk[0];//exception stack is not used by host but is kept for stack checking
+	size = OS_CPU_EXCEPT_STK_SIZE;
+	while (size > 0) {
+		size--;
+		*pstk++ = (OS_STK)OS_TASK_STK_FILL;
+	}
+	OS_CPU_ExceptStkBase = &OS_CPU_ExceptStk[OS_CPU_EXCEPT_STK_SIZE - 1];
+}//OSInitExceptStk
+
+INT32U OS_CPU_ExceptStkChk(void)
+{
+	OS_STK  *pchk=&OS_CPU_ExceptStk[0];
+	INT32U   nfree=0;
+
+	while ((nfree < OS_CPU_EXCEPT_STK_SIZE) && (*pchk++ == (OS_STK)OS_TASK_STK_FILL))
+		nfree++;
+	return (nfree);
+}//OS_CPU_ExceptStkChk
@@ -0,0 +1,607 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                         EVENT FLAG  MANAGEMENT
+*
+*                        (c) Copyright 1992-1998, Jean J. Labrosse, Plantation, FL
+*                                           All Rights Reserved
+*
+*                                                  V2.00
+*
+* File : OS_FLAG.C
+* By   : Jean J. Labrosse
+*
+* B.K. Event flags are not part of uC/OS-II V2.00. This file adds them with API close to later
+*      uC/OS-II versions (OSFlagCreate(), OSFlagPend(), OSFlagPost(), OSFlagAccept(), OSFlagQuery())
+*      but without OSFlagDel() as none of the other V2.00 kernel objects can be deleted.
+*      Task can wait for ALL or ANY of the flags to be SET or CLR with timeout and optionally consume
+*      flags which made it ready. OSFlagPost() and OSFlagAccept() can be called from ISRs so hardware
+*      events can be signaled to tasks waiting for combination of them.
+*      Waiting tasks are linked into the group wait list through OS_FLAG_NODE kept on their stacks.
+*********************************************************************************************************
+*/
+
+#include    "os_cpu.h"
+#include    "os_cfg.h"
+#include    "os_ucos_ii.h"
+
+#if OS_FLAG_EN
+/*
+*********************************************************************************************************
+*                                            LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_FLAG_GRP   OSFlagTbl[OS_MAX_FLAGS];     /* Table of event flag groups                          */
+static  OS_FLAG_GRP  *OSFlagFreeList;              /* Pointer to free list of event flag groups           */
+
+/*
+*********************************************************************************************************
+*                                            LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void     OSFlagBlock(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode, OS_FLAGS flags, INT8U wait_type, INT16U timeout);
+static  BOOLEAN  OSFlagTaskRdy(OS_FLAG_NODE *pnode, OS_FLAGS flags_rdy);
+static  OS_FLAGS OSFlagTest(OS_FLAG_GRP *pgrp, OS_FLAGS flags, INT8U wait_type);
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    TEST EVENT FLAG GROUP CONDITION
+*
+* Description: This function checks if the flags of the group satisfy wait condition.
+*
+* Arguments  : pgrp          is a pointer to the event flag group
+*
+*              flags         is a bit pattern indicating which bit(s) (i.e. flags) to check
+*
+*              wait_type     OS_FLAG_WAIT_xxx without OS_FLAG_CONSUME
+*
+* Returns    : The flags which satisfy the condition or 0 if the condition is not satisfied.
+*
+* Note       : This function is INTERNAL to os_flag.c and must be called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+static OS_FLAGS OSFlagTest (OS_FLAG_GRP *pgrp, OS_FLAGS flags, INT8U wait_type)
+{
+    OS_FLAGS flags_rdy;
+
+
+    switch (wait_type) {
+        case OS_FLAG_WAIT_SET_ALL:                         /* All bits must be set                     */
+             flags_rdy = pgrp->OSFlagFlags & flags;
+             if (flags_rdy != flags) {
+                 flags_rdy = 0;
+             }
+             break;
+
+        case OS_FLAG_WAIT_SET_ANY:                         /* Any bit must be set                      */
+             flags_rdy = pgrp->OSFlagFlags & flags;
+             break;
+
+        case OS_FLAG_WAIT_CLR_ALL:                         /* All bits must be clear                   */
+             flags_rdy = ~pgrp->OSFlagFlags & flags;
+             if (flags_rdy != flags) {
+                 flags_rdy = 0;
+             }
+             break;
+
+        case OS_FLAG_WAIT_CLR_ANY:                         /* Any bit must be clear                    */
+        default:
+             flags_rdy = ~pgrp->OSFlagFlags & flags;
+             break;
+    }
+    return (flags_rdy);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                              CHECK THE STATUS OF FLAGS IN AN EVENT FLAG GROUP
+*
+* Description: This function is called to check the status of a combination of bits to be set or cleared
+*              in an event flag group.  Unlike OSFlagPend(), the calling task is never suspended.
+*
+* Arguments  : pgrp          is a pointer to the desired event flag group.
+*
+*              flags         is a bit pattern indicating which bit(s) (i.e. flags) you wish to check.
+*
+*              wait_type     specifies whether you want ALL bits to be set/cleared or ANY of the bits
+*                            to be set/cleared (OS_FLAG_WAIT_CLR_ALL, OS_FLAG_WAIT_CLR_ANY,
+*                            OS_FLAG_WAIT_SET_ALL or OS_FLAG_WAIT_SET_ANY).  Add OS_FLAG_CONSUME to
+*                            have the flags which satisfied the condition cleared (or set for CLR).
+*
+*              err           is a pointer to an error code and can be:
+*                            OS_NO_ERR               No error
+*                            OS_FLAG_INVALID_PGRP    'pgrp' is a NULL pointer
+*                            OS_ERR_EVENT_TYPE       You are not pointing to an event flag group
+*                            OS_FLAG_ERR_WAIT_TYPE   You didn't specify a proper 'wait_type' argument
+*                            OS_FLAG_ERR_NOT_RDY     The desired flags you are waiting for are not available
+*
+* Returns    : The flags in the event flag group that made the condition true or 0 if the condition
+*              is not satisfied.
+*
+* Note       : This function can be called from an ISR.
+*********************************************************************************************************
+*/
+
+OS_FLAGS OSFlagAccept (OS_FLAG_GRP *pgrp, OS_FLAGS flags, INT8U wait_type, INT8U *err)
+{
+#if (OS_CRITICAL_METHOD == 3)
+    OS_CPU_SR  cpu_sr;
+#endif
+    OS_FLAGS   flags_rdy;
+    BOOLEAN    consume;
+
+
+    if (pgrp == (OS_FLAG_GRP *)0) {                        /* Validate 'pgrp'                          */
+        *err = OS_FLAG_INVALID_PGRP;
+        return ((OS_FLAGS)0);
+    }
+    if (pgrp->OSFlagType != OS_EVENT_TYPE_FLAG) {          /* Validate event block type                */
+        *err = OS_ERR_EVENT_TYPE;
+        return ((OS_FLAGS)0);
+    }
+    consume    = (wait_type & OS_FLAG_CONSUME) ? TRUE : FALSE;
+    wait_type &= ~OS_FLAG_CONSUME;
+    if (wait_type > OS_FLAG_WAIT_SET_ANY) {
+        *err = OS_FLAG_ERR_WAIT_TYPE;
+        return ((OS_FLAGS)0);
+    }
+    OS_ENTER_CRITICAL();
+    flags_rdy = OSFlagTest(pgrp, flags, wait_type);
+    if (flags_rdy != (OS_FLAGS)0) {                        /* Condition satisfied                      */
+        if (consume == TRUE) {                             /* See if we need to consume the flags      */
+            if (wait_type >= OS_FLAG_WAIT_SET_ALL) {
+                pgrp->OSFlagFlags &= ~flags_rdy;           /* Clear ONLY the flags that we wanted      */
+            } else {
+                pgrp->OSFlagFlags |=  flags_rdy;           /* Set ONLY the flags that we wanted        */
+            }
+        }
+        *err = OS_NO_ERR;
+    } else {
+        *err = OS_FLAG_ERR_NOT_RDY;
+    }
+    OS_EXIT_CRITICAL();
+    return (flags_rdy);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           CREATE AN EVENT FLAG
+*
+* Description: This function is called to create an event flag group.
+*
+* Arguments  : flags         Contains the initial value to store in the event flag group.
+*
+*              err           is a pointer to an error code which will be returned to your application:
+*                               OS_NO_ERR                if the call was successful.
+*                               OS_ERR_CREATE_ISR        if you attempted to create an Event Flag from an
+*                                                        ISR.
+*                               OS_FLAG_GRP_DEPLETED     if there are no more event flag groups
+*
+* Returns    : A pointer to an event flag group or a NULL pointer if no more groups are available.
+*********************************************************************************************************
+*/
+
+OS_FLAG_GRP *OSFlagCreate (OS_FLAGS flags, INT8U *err)
+{
+#if (OS_CRITICAL_METHOD == 3)
+    OS_CPU_SR    cpu_sr;
+#endif
+    OS_FLAG_GRP *pgrp;
+
+
+    OS_ENTER_CRITICAL();
+    if (OSIntNesting > 0) {                                /* See if called from ISR ...               */
+        OS_EXIT_CRITICAL();
+        *err = OS_ERR_CREATE_ISR;                          /* ... can't CREATE from an ISR             */
+        return ((OS_FLAG_GRP *)0);
+    }
+    pgrp = OSFlagFreeList;                                 /* Get next free event flag                 */
+    if (pgrp != (OS_FLAG_GRP *)0) {                        /* See if we have event flag groups available */
+                                                           /* Adjust free list                         */
+        OSFlagFreeList       = (OS_FLAG_GRP *)OSFlagFreeList->OSFlagWaitList;
+        pgrp->OSFlagType     = OS_EVENT_TYPE_FLAG;         /* Set to event flag group type             */
+        pgrp->OSFlagFlags    = flags;                      /* Set to desired initial value             */
+        pgrp->OSFlagWaitList = (void *)0;                  /* Clear list of tasks waiting on flags     */
+        OS_EXIT_CRITICAL();
+        *err = OS_NO_ERR;
+    } else {
+        OS_EXIT_CRITICAL();
+        *err = OS_FLAG_GRP_DEPLETED;
+    }
+    return (pgrp);                                         /* Return pointer to event flag group       */
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        WAIT ON AN EVENT FLAG GROUP
+*
+* Description: This function is called to wait for a combination of bits to be set or cleared in an
+*              event flag group.
+*
+* Arguments  : pgrp          is a pointer to the desired event flag group.
+*
+*              flags         is a bit pattern indicating which bit(s) (i.e. flags) you wish to wait for.
+*
+*              wait_type     specifies whether you want ALL bits to be set/cleared or ANY of the bits
+*                            to be set/cleared (OS_FLAG_WAIT_xxx) optionally with OS_FLAG_CONSUME added
+*                            to consume the flags which made the task ready.
+*
+*              timeout       is an optional timeout (in clock ticks) that your task will wait for the
+*                            desired bit combination.  If you specify 0, however, your task will wait
+*                            forever.
+*
+*              err           is a pointer to an error code and can be:
+*                            OS_NO_ERR               The desired bits have been set within the timeout
+*                            OS_ERR_PEND_ISR         If you tried to PEND from an ISR
+*                            OS_FLAG_INVALID_PGRP    If 'pgrp' is a NULL pointer
+*                            OS_ERR_EVENT_TYPE       You are not pointing to an event flag group
+*                            OS_TIMEOUT              The bit(s) have not been set in the specified 'timeout'
+*                            OS_FLAG_ERR_WAIT_TYPE   You didn't specify a proper 'wait_type' argument
+*
+* Returns    : The flags in the event flag group that made the task ready or 0 if a timeout occurred.
+*********************************************************************************************************
+*/
+
+OS_FLAGS OSFlagPend (OS_FLAG_GRP *pgrp, OS_FLAGS flags, INT8U wait_type, INT16U timeout, INT8U *err)
+{
+#if (OS_CRITICAL_METHOD == 3)
+    OS_CPU_SR     cpu_sr;
+#endif
+    OS_FLAG_NODE  node;
+    OS_FLAGS      flags_rdy;
+    BOOLEAN       consume;
+
+
+    if (OSIntNesting > 0) {                                /* See if called from ISR ...               */
+        *err = OS_ERR_PEND_ISR;                            /* ... can't PEND from an ISR               */
+        return ((OS_FLAGS)0);
+    }
+    if (pgrp == (OS_FLAG_GRP *)0) {                        /* Validate 'pgrp'                          */
+        *err = OS_FLAG_INVALID_PGRP;
+        return ((OS_FLAGS)0);
+    }
+    if (pgrp->OSFlagType != OS_EVENT_TYPE_FLAG) {          /* Validate event block type                */
+        *err = OS_ERR_EVENT_TYPE;
+        return ((OS_FLAGS)0);
+    }
+    consume    = (wait_type & OS_FLAG_CONSUME) ? TRUE : FALSE;
+    wait_type &= ~OS_FLAG_CONSUME;
+    if (wait_type > OS_FLAG_WAIT_SET_ANY) {
+        *err = OS_FLAG_ERR_WAIT_TYPE;
+        return ((OS_FLAGS)0);
+    }
+    OS_ENTER_CRITICAL();
+    flags_rdy = OSFlagTest(pgrp, flags, wait_type);
+    if (flags_rdy != (OS_FLAGS)0) {                        /* Condition already satisfied              */
+        if (consume == TRUE) {                             /* See if we need to consume the flags      */
+            if (wait_type >= OS_FLAG_WAIT_SET_ALL) {
+                pgrp->OSFlagFlags &= ~flags_rdy;           /* Clear ONLY the flags that we wanted      */
+            } else {
+                pgrp->OSFlagFlags |=  flags_rdy;           /* Set ONLY the flags that we wanted        */
+            }
+        }
+        OS_EXIT_CRITICAL();
+        *err = OS_NO_ERR;
+        return (flags_rdy);
+    }
+    OSFlagBlock(pgrp, &node, flags, wait_type, timeout);   /* Suspend task until condition satisfied   */
+    OS_EXIT_CRITICAL();
+    OSSched();                                             /* Find next HPT ready to run               */
+    OS_ENTER_CRITICAL();
+    if (OSTCBCur->OSTCBStat & OS_STAT_FLAG) {              /* Have we timed-out?                       */
+        OSFlagUnlink(&node);
+        OSTCBCur->OSTCBStat = OS_STAT_RDY;                 /* Yes, make task ready-to-run              */
+        OS_EXIT_CRITICAL();
+        *err = OS_TIMEOUT;                                 /* Indicate that we timed-out waiting       */
+        return ((OS_FLAGS)0);
+    }
+    flags_rdy = OSTCBCur->OSTCBFlagsRdy;
+    if (consume == TRUE) {                                 /* See if we need to consume the flags      */
+        if (wait_type >= OS_FLAG_WAIT_SET_ALL) {
+            pgrp->OSFlagFlags &= ~flags_rdy;               /* Clear ONLY the flags that we got         */
+        } else {
+            pgrp->OSFlagFlags |=  flags_rdy;               /* Set ONLY the flags that we got           */
+        }
+    }
+    OS_EXIT_CRITICAL();
+    *err = OS_NO_ERR;                                      /* Event(s) must have occurred              */
+    return (flags_rdy);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         POST EVENT FLAG BIT(S)
+*
+* Description: This function is called to set or clear some bits in an event flag group.  The bits to
+*              set or clear are specified by a 'bit mask'.
+*
+* Arguments  : pgrp          is a pointer to the desired event flag group.
+*
+*              flags         If 'opt' (see below) is OS_FLAG_SET, each bit that is set in 'flags' will
+*                            set the corresponding bit in the event flag group.
+*                            If 'opt' (see below) is OS_FLAG_CLR, each bit that is set in 'flags' will
+*                            CLEAR the corresponding bit in the event flag group.
+*
+*              opt           indicates whether the flags will be:
+*                                set     (OS_FLAG_SET) or
+*                                cleared (OS_FLAG_CLR)
+*
+*              err           is a pointer to an error code and can be:
+*                            OS_NO_ERR              The call was successfull
+*                            OS_FLAG_INVALID_PGRP   You passed a NULL pointer
+*                            OS_ERR_EVENT_TYPE      You are not pointing to an event flag group
+*                            OS_FLAG_INVALID_OPT    You specified an invalid option
+*
+* Returns    : the new value of the event flags bits that are still set.
+*
+* Note       : 1) The execution time of this function depends on the number of tasks waiting on the
+*                 event flag group.
+*              2) This function can be called from an ISR. Rescheduling is then done on ISR exit.
+*********************************************************************************************************
+*/
+
+OS_FLAGS OSFlagPost (OS_FLAG_GRP *pgrp, OS_FLAGS flags, INT8U opt, INT8U *err)
+{
+#if (OS_CRITICAL_METHOD == 3)
+    OS_CPU_SR     cpu_sr;
+#endif
+    OS_FLAG_NODE *pnode;
+    OS_FLAG_NODE *pnext;
+    BOOLEAN       sched;
+    OS_FLAGS      flags_cur;
+    OS_FLAGS      flags_rdy;
+
+
+    if (pgrp == (OS_FLAG_GRP *)0) {                        /* Validate 'pgrp'                          */
+        *err = OS_FLAG_INVALID_PGRP;
+        return ((OS_FLAGS)0);
+    }
+    if (pgrp->OSFlagType != OS_EVENT_TYPE_FLAG) {          /* Make sure we are pointing to an event flag grp */
+        *err = OS_ERR_EVENT_TYPE;
+        return ((OS_FLAGS)0);
+    }
+    OS_ENTER_CRITICAL();
+    switch (opt) {
+        case OS_FLAG_CLR:
+             pgrp->OSFlagFlags &= ~flags;                  /* Clear the flags specified in the group   */
+             break;
+
+        case OS_FLAG_SET:
+             pgrp->OSFlagFlags |=  flags;                  /* Set   the flags specified in the group   */
+             break;
+
+        default:
+             OS_EXIT_CRITICAL();                           /* INVALID option                           */
+             *err = OS_FLAG_INVALID_OPT;
+             return ((OS_FLAGS)0);
+    }
+    sched = FALSE;                                         /* Indicate that we don't need rescheduling */
+    pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
+    while (pnode != (OS_FLAG_NODE *)0) {                   /* Go through all tasks waiting on event flag(s) */
+        pnext     = (OS_FLAG_NODE *)pnode->OSFlagNodeNext; /* Node is unlinked when task is made ready */
+        flags_rdy = OSFlagTest(pgrp, pnode->OSFlagNodeFlags, pnode->OSFlagNodeWaitType);
+        if (flags_rdy != (OS_FLAGS)0) {                    /* See if task condition is satisfied       */
+            if (OSFlagTaskRdy(pnode, flags_rdy) == TRUE) { /* Make task RTR, event(s) Rx'd             */
+                sched = TRUE;                              /* When done we will reschedule             */
+            }
+        }
+        pnode = pnext;                                     /* Point to next task waiting for event flag(s) */
+    }
+    flags_cur = pgrp->OSFlagFlags;
+    OS_EXIT_CRITICAL();
+    if (sched == TRUE) {
+        OSSched();                                         /* Does nothing when called from ISR        */
+    }
+    *err = OS_NO_ERR;
+    return (flags_cur);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           QUERY EVENT FLAG
+*
+* Description: This function is used to check the value of the event flag group.
+*
+* Arguments  : pgrp         is a pointer to the desired event flag group.
+*
+*              err           is a pointer to an error code returned to the called:
+*                            OS_NO_ERR              The call was successfull
+*                            OS_FLAG_INVALID_PGRP   You passed a NULL pointer
+*                            OS_ERR_EVENT_TYPE      You are not pointing to an event flag group
+*
+* Returns    : The current value of the event flag group.
+*********************************************************************************************************
+*/
+
+OS_FLAGS OSFlagQuery (OS_FLAG_GRP *pgrp, INT8U *err)
+{
+    if (pgrp == (OS_FLAG_GRP *)0) {                        /* Validate 'pgrp'                          */
+        *err = OS_FLAG_INVALID_PGRP;
+        return ((OS_FLAGS)0);
+    }
+    if (pgrp->OSFlagType != OS_EVENT_TYPE_FLAG) {          /* Validate event block type                */
+        *err = OS_ERR_EVENT_TYPE;
+        return ((OS_FLAGS)0);
+    }
+    *err = OS_NO_ERR;
+    return (pgrp->OSFlagFlags);                            /* Return the current value of the event flags */
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                         SUSPEND TASK UNTIL EVENT FLAG(s) RECEIVED OR TIMEOUT OCCURS
+*
+* Description: This function is internal to uC/OS-II and is used to put a task to sleep until the desired
+*              event flag bit(s) are set.
+*
+* Arguments  : pgrp          is a pointer to the desired event flag group.
+*
+*              pnode         is a pointer to a structure which contains data about the task waiting for
+*                            event flag bit(s) to be set.
+*
+*              flags         Is a bit pattern indicating which bit(s) (i.e. flags) you wish to check.
+*
+*              wait_type     specifies whether you want ALL bits to be set/cleared or ANY of the bits
+*                            to be set/cleared.
+*
+*              timeout       is the desired amount of time that the task will wait for the event flag
+*                            bit(s) to be set.
+*
+* Returns    : none
+*
+* Note       : This function is INTERNAL to os_flag.c and must be called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+static void OSFlagBlock (OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode, OS_FLAGS flags, INT8U wait_type, INT16U timeout)
+{
+    OS_FLAG_NODE *pnode_next;
+
+
+    OSTCBCur->OSTCBStat      |= OS_STAT_FLAG;
+    OSTickWheelInsert(OSTCBCur, timeout);                  /* Store timeout in task's TCB              */
+    OSTCBCur->OSTCBFlagNode   = pnode;                     /* TCB to link to node                      */
+    pnode->OSFlagNodeFlags    = flags;                     /* Save the flags that we need to wait for  */
+    pnode->OSFlagNodeWaitType = wait_type;                 /* Save the type of wait we are doing       */
+    pnode->OSFlagNodeTCB      = (void *)OSTCBCur;          /* Link to task's TCB                       */
+    pnode->OSFlagNodeNext     = pgrp->OSFlagWaitList;      /* Add node at beginning of event flag wait list */
+    pnode->OSFlagNodePrev     = (void *)0;
+    pnode->OSFlagNodeFlagGrp  = (void *)pgrp;              /* Link to Event Flag Group                 */
+    pnode_next                = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
+    if (pnode_next != (OS_FLAG_NODE *)0) {                 /* Is this the first NODE to insert?        */
+        pnode_next->OSFlagNodePrev = pnode;                /* No, link in doubly linked list           */
+    }
+    pgrp->OSFlagWaitList = (void *)pnode;
+                                                           /* Suspend current task until flag(s) received */
+    if ((OSRdyTbl[OSTCBCur->OSTCBY] &= ~OSTCBCur->OSTCBBitX) == 0) {
+        OSRdyGrp &= ~OSTCBCur->OSTCBBitY;
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    INITIALIZE THE EVENT FLAG MODULE
+*
+* Description: This function is called by uC/OS-II to initialize the event flag module.  Your application
+*              MUST NOT call this function.  In other words, this function is internal to uC/OS-II.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void OSFlagInit (void)
+{
+    INT8U i;
+
+
+    for (i = 0; i < (OS_MAX_FLAGS - 1); i++) {             /* Init. list of free EVENT FLAGS           */
+        OSFlagTbl[i].OSFlagType     = 0;
+        OSFlagTbl[i].OSFlagWaitList = (void *)&OSFlagTbl[i + 1];
+        OSFlagTbl[i].OSFlagFlags    = (OS_FLAGS)0;
+    }
+    OSFlagTbl[OS_MAX_FLAGS - 1].OSFlagType     = 0;
+    OSFlagTbl[OS_MAX_FLAGS - 1].OSFlagWaitList = (void *)0;
+    OSFlagTbl[OS_MAX_FLAGS - 1].OSFlagFlags    = (OS_FLAGS)0;
+    OSFlagFreeList                             = &OSFlagTbl[0];
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                              MAKE TASK READY-TO-RUN, EVENT(s) OCCURRED
+*
+* Description: This function is internal to uC/OS-II and is used to make a task ready-to-run because the
+*              desired event flag bit(s) have been set.
+*
+* Arguments  : pnode         is a pointer to a structure which contains data about the task waiting for
+*                            event flag bit(s) to be set.
+*
+*              flags_rdy     contains the bit pattern of the event flags that cause the task to become
+*                            ready-to-run.
+*
+* Returns    : TRUE          if the task has been placed in the ready list and thus needs scheduling
+*              FALSE         The task is still not ready to run and thus scheduling is not necessary
+*
+* Note       : This function is INTERNAL to os_flag.c and must be called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+static BOOLEAN OSFlagTaskRdy (OS_FLAG_NODE *pnode, OS_FLAGS flags_rdy)
+{
+    OS_TCB   *ptcb;
+    BOOLEAN   sched;
+
+
+    ptcb                = (OS_TCB *)pnode->OSFlagNodeTCB;  /* Point to TCB of waiting task             */
+    OSTickWheelRemove(ptcb);                               /* Task does not wait for timeout any longer */
+    ptcb->OSTCBFlagsRdy = flags_rdy;
+    ptcb->OSTCBStat    &= ~OS_STAT_FLAG;
+    if (ptcb->OSTCBStat == OS_STAT_RDY) {                  /* Put task into ready list                 */
+        OSRdyGrp               |= ptcb->OSTCBBitY;
+        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+        sched                   = TRUE;
+    } else {
+        sched                   = FALSE;
+    }
+    OSFlagUnlink(pnode);
+    return (sched);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  UNLINK EVENT FLAG NODE FROM WAITING LIST
+*
+* Description: This function is internal to uC/OS-II and is used to unlink an event flag node from a
+*              list of tasks waiting for the event flag.
+*
+* Arguments  : pnode         is a pointer to a structure which contains data about the task waiting for
+*                            event flag bit(s) to be set.
+*
+* Returns    : none
+*
+* Note       : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) This function is called by OSTaskDel() and must be called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+void OSFlagUnlink (OS_FLAG_NODE *pnode)
+{
+    OS_TCB       *ptcb;
+    OS_FLAG_GRP  *pgrp;
+    OS_FLAG_NODE *pnode_prev;
+    OS_FLAG_NODE *pnode_next;
+
+
+    pnode_prev = (OS_FLAG_NODE *)pnode->OSFlagNodePrev;
+    pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeNext;
+    if (pnode_prev == (OS_FLAG_NODE *)0) {                      /* Is it first node in wait list?      */
+        pgrp                 = (OS_FLAG_GRP *)pnode->OSFlagNodeFlagGrp;
+        pgrp->OSFlagWaitList = (void *)pnode_next;              /*      Update list for new 1st node   */
+        if (pnode_next != (OS_FLAG_NODE *)0) {
+            pnode_next->OSFlagNodePrev = (OS_FLAG_NODE *)0;     /*      Link new 1st node PREV to NULL */
+        }
+    } else {                                                    /* No,  A node somewhere in the list   */
+        pnode_prev->OSFlagNodeNext = pnode_next;                /*      Link around the node to unlink */
+        if (pnode_next != (OS_FLAG_NODE *)0) {                  /*      Was this the LAST node?        */
+            pnode_next->OSFlagNodePrev = pnode_prev;            /*      No, Link around current node   */
+        }
+    }
+    ptcb                = (OS_TCB *)pnode->OSFlagNodeTCB;
+    ptcb->OSTCBFlagNode = (OS_FLAG_NODE *)0;
+}
+#endif
@@ -0,0 +1,479 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                  MUTUAL EXCLUSION SEMAPHORE MANAGEMENT
+*
+*                        (c) Copyright 1992-1998, Jean J. Labrosse, Plantation, FL
+*                                           All Rights Reserved
+*
+*                                                  V2.00
+*
+* File : OS_MUTEX.C
+* By   : Jean J. Labrosse
+*
+* B.K. Mutexes are not part of uC/OS-II V2.00. This file adds them with API of later uC/OS-II versions
+*      (OSMutexCreate(), OSMutexPend(), OSMutexPost(), OSMutexAccept(), OSMutexQuery()) built on V2.00
+*      event control blocks. Owner of a mutex is raised to the mutex Priority Inheritance Priority (PIP)
+*      when a higher priority task has to wait for the mutex. PIP is a not used task priority which must
+*      be higher than priority of any task using the mutex (see a_res_list.h).
+*      OSEventCnt keeps PIP in upper 8 bits and owner priority (or OS_MUTEX_AVAILABLE) in lower 8 bits,
+*      OSEventPtr points to owner OS_TCB.
+*      Owner priority is its OSTCBBasePrio so mutexes can be nested - owner runs at the highest PIP of the
+*      mutexes it owns which higher priority tasks wait for and gets back to OSTCBBasePrio when there are
+*      none. OSTCBPrioTbl[] entry of PIP points to the owner while it runs at PIP otherwise it is reserved.
+*********************************************************************************************************
+*/
+
+#include    "os_cpu.h"
+#include    "os_cfg.h"
+#include    "os_ucos_ii.h"
+
+#if OS_MUTEX_EN
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  OS_MUTEX_KEEP_LOWER_8   0x00FF
+#define  OS_MUTEX_KEEP_UPPER_8   0xFF00
+
+#define  OS_MUTEX_AVAILABLE      0x00FF
+
+#define  OS_TCB_RESERVED         ((OS_TCB *)1)   /* Priority reserved in OSTCBPrioTbl[] (see OSTaskCreate())  */
+
+/*
+*********************************************************************************************************
+*                                      CHANGE PRIORITY OF MUTEX OWNER
+*
+* Description: This function moves a task to a new priority.  The task stays in the ready list or in the
+*              wait list of the event it is pending on.
+*
+* Arguments  : ptcb     is a pointer to the task's OS_TCB
+*
+*              prio     is the new priority of the task
+*
+* Returns    : none
+*
+* Note       : This function is INTERNAL to os_mutex.c and must be called with interrupts disabled.
+*              OSTCBPrioTbl[] is not changed here (see OSMutex_SetOwnerPrio()).
+*********************************************************************************************************
+*/
+static void OSMutex_ChangePrio (OS_TCB *ptcb, INT8U prio)
+{
+    OS_EVENT *pevent;
+    BOOLEAN   rdy;
+
+
+    pevent = ptcb->OSTCBEventPtr;
+    if (OSRdyTbl[ptcb->OSTCBY] & ptcb->OSTCBBitX) {            /* See if task is ready to run             */
+        if ((OSRdyTbl[ptcb->OSTCBY] &= ~ptcb->OSTCBBitX) == 0) {
+            OSRdyGrp &= ~ptcb->OSTCBBitY;
+        }
+        rdy = TRUE;
+    } else {
+        rdy = FALSE;
+        if (pevent != (OS_EVENT *)0) {                         /* Remove from event wait list             */
+            if ((pevent->OSEventTbl[ptcb->OSTCBY] &= ~ptcb->OSTCBBitX) == 0) {
+                pevent->OSEventGrp &= ~ptcb->OSTCBBitY;
+            }
+        }
+    }
+    ptcb->OSTCBPrio = prio;
+    ptcb->OSTCBY    = prio >> 3;
+    ptcb->OSTCBBitY = OSMapTbl[ptcb->OSTCBY];
+    ptcb->OSTCBX    = prio & 0x07;
+    ptcb->OSTCBBitX = OSMapTbl[ptcb->OSTCBX];
+    if (rdy == TRUE) {                                         /* Put task back with its new priority     */
+        OSRdyGrp               |= ptcb->OSTCBBitY;
+        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+    } else if (pevent != (OS_EVENT *)0) {
+        pevent->OSEventGrp               |= ptcb->OSTCBBitY;
+        pevent->OSEventTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                       SET PRIORITY OF MUTEX OWNER
+*
+* Description: This function sets the priority a mutex owner must run at - the highest PIP of the mutexes
+*              the task owns which a task with higher priority than the owner's OSTCBBasePrio waits for,
+*              or OSTCBBasePrio when there is no such mutex. When the owner itself waits for a mutex
+*              the owner of that mutex is updated as well (owner moves in the wait list).
+*
+* Arguments  : ptcb     is a pointer to the mutex owner's OS_TCB
+*
+* Returns    : none
+*
+* Note       : This function is INTERNAL to os_mutex.c and must be called with interrupts disabled.
+*              It scans all OS_EVENT blocks so it is called only when a mutex is contended.
+*********************************************************************************************************
+*/
+static void OSMutex_SetOwnerPrio (OS_TCB *ptcb)
+{
+    OS_EVENT *pevent;
+    INT8U     prio;                                            /* Priority the owner must run at          */
+    INT8U     pip;
+    INT8U     y;
+    INT8U     i;
+
+
+    while (ptcb != (OS_TCB *)0) {
+        prio   = ptcb->OSTCBBasePrio;
+        pevent = &OSEventTbl[0];
+        for (i = 0; i < OS_MAX_EVENTS; i++, pevent++) {        /* Find mutexes owned by the task          */
+            if ((pevent->OSEventType == OS_EVENT_TYPE_MUTEX) && (pevent->OSEventPtr == (void *)ptcb) &&
+                (pevent->OSEventGrp != 0)) {
+                pip = (INT8U)(pevent->OSEventCnt >> 8);
+                y   = OSUnMapTbl[pevent->OSEventGrp];          /* Highest priority task waiting           */
+                if ((pip < prio) &&
+                    ((INT8U)((y << 3) + OSUnMapTbl[pevent->OSEventTbl[y]]) < ptcb->OSTCBBasePrio)) {
+                    prio = pip;                                /* OS_PRIO_MUTEX_CEIL_DIS is never < prio  */
+                }
+            }
+        }
+        if (prio == ptcb->OSTCBPrio) {                         /* Already runs at the right priority?     */
+            return;
+        }
+        if (ptcb->OSTCBPrio != ptcb->OSTCBBasePrio) {          /* Leave PIP the owner runs at             */
+            OSTCBPrioTbl[ptcb->OSTCBPrio] = OS_TCB_RESERVED;
+        }
+        OSMutex_ChangePrio(ptcb, prio);
+        if (prio != ptcb->OSTCBBasePrio) {                     /* Owner runs at PIP                       */
+            OSTCBPrioTbl[prio] = ptcb;
+        }
+        pevent = ptcb->OSTCBEventPtr;                          /* Owner waits for other mutex?            */
+        if ((pevent != (OS_EVENT *)0) && (ptcb->OSTCBStat & OS_STAT_MUTEX)) {
+            ptcb = (OS_TCB *)pevent->OSEventPtr;               /* Yes, update owner of that mutex         */
+        } else {
+            ptcb = (OS_TCB *)0;
+        }
+    }
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   ACCEPT MUTUAL EXCLUSION SEMAPHORE
+*
+* Description: This function checks the mutual exclusion semaphore to see if a resource is available.
+*              Unlike OSMutexPend(), OSMutexAccept() does not suspend the calling task if the resource is
+*              not available.
+*
+* Arguments  : pevent     is a pointer to the event control block
+*
+*              err        is a pointer to an error code which will be returned to your application:
+*                            OS_NO_ERR          if the call was successful.
+*                            OS_ERR_EVENT_TYPE  if 'pevent' is not a pointer to a mutex
+*                            OS_ERR_PEND_ISR    if you called this function from an ISR
+*
+* Returns    : == 1       if the resource is available, the mutual exclusion semaphore is acquired
+*              == 0       a) if the resource is not available
+*                         b) you didn't pass a pointer to a mutual exclusion semaphore
+*                         c) you called this function from an ISR
+*********************************************************************************************************
+*/
+INT8U OSMutexAccept (OS_EVENT *pevent, INT8U *err)
+{
+#if (OS_CRITICAL_METHOD == 3)
+    OS_CPU_SR  cpu_sr;
+#endif
+
+
+    if (OSIntNesting > 0) {                            /* Make sure it's not called from an ISR        */
+        *err = OS_ERR_PEND_ISR;
+        return (0);
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventType != OS_EVENT_TYPE_MUTEX) {  /* Validate event block type                    */
+        OS_EXIT_CRITICAL();
+        *err = OS_ERR_EVENT_TYPE;
+        return (0);
+    }
+    *err = OS_NO_ERR;
+    if (OSRunning == FALSE) {                          /* B.K. constructors run before OSStart() when  */
+        OS_EXIT_CRITICAL();                            /* ... there is only one thread and no OSTCBCur */
+        return (1);
+    }
+    if ((pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8) == OS_MUTEX_AVAILABLE) {
+        pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER_8;   /* Mask off LSByte (Acquire Mutex)              */
+        pevent->OSEventCnt |= OSTCBCur->OSTCBBasePrio; /* Save task base priority in LSByte            */
+        pevent->OSEventPtr  = (void *)OSTCBCur;        /* Link TCB of task owning Mutex                */
+        OS_EXIT_CRITICAL();
+        return (1);
+    }
+    OS_EXIT_CRITICAL();
+    return (0);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  CREATE A MUTUAL EXCLUSION SEMAPHORE
+*
+* Description: This function creates a mutual exclusion semaphore.
+*
+* Arguments  : prio          is the priority to use when accessing the mutual exclusion semaphore.  In
+*                            other words, when the semaphore is acquired and a higher priority task
+*                            attempts to obtain the semaphore then the priority of the task owning the
+*                            semaphore is raised to this priority.  It is assumed that you will specify
+*                            a priority that is LOWER in value than ANY of the tasks competing for the
+*                            mutex.  OS_PRIO_MUTEX_CEIL_DIS creates mutex without priority inheritance.
+*
+*              err           is a pointer to an error code which will be returned to your application:
+*                               OS_NO_ERR          if the call was successful.
+*                               OS_PRIO_EXIST      if a task at the priority inheritance priority
+*                                                  already exist.
+*                               OS_PRIO_INVALID    if the priority you specify is higher that the
+*                                                  maximum allowed (i.e. > OS_LOWEST_PRIO)
+*                               OS_ERR_PEND_ISR    if you called this function from an ISR
+*
+* Returns    : != (void *)0  is a pointer to the event control clock (OS_EVENT) associated with the
+*                            created mutex.
+*              == (void *)0  if an error is detected (including no free event control block).
+*********************************************************************************************************
+*/
+OS_EVENT *OSMutexCreate (INT8U prio, INT8U *err)
+{
+    OS_EVENT *pevent;
+#if (OS_CRITICAL_METHOD == 3)
+    OS_CPU_SR  cpu_sr;
+#endif
+
+
+    if (OSIntNesting > 0) {                            /* See if called from ISR ...                   */
+        *err = OS_ERR_PEND_ISR;                        /* ... can't CREATE mutex from an ISR           */
+        return ((OS_EVENT *)0);
+    }
+    if ((prio != OS_PRIO_MUTEX_CEIL_DIS) && (prio >= OS_LOWEST_PRIO)) {
+        *err = OS_PRIO_INVALID;                        /* Validate PIP                                 */
+        return ((OS_EVENT *)0);
+    }
+    OS_ENTER_CRITICAL();
+    if (prio != OS_PRIO_MUTEX_CEIL_DIS) {
+        if (OSTCBPrioTbl[prio] != (OS_TCB *)0) {       /* Mutex priority must not already exist        */
+            OS_EXIT_CRITICAL();
+            *err = OS_PRIO_EXIST;
+            return ((OS_EVENT *)0);
+        }
+        OSTCBPrioTbl[prio] = OS_TCB_RESERVED;          /* Reserve the table entry                      */
+    }
+    pevent = OSEventFreeList;                          /* Get next free event control block            */
+    if (pevent == (OS_EVENT *)0) {                     /* See if an ECB was available                  */
+        if (prio != OS_PRIO_MUTEX_CEIL_DIS) {
+            OSTCBPrioTbl[prio] = (OS_TCB *)0;          /* No, Release the table entry                  */
+        }
+        OS_EXIT_CRITICAL();
+        *err = OS_NO_ERR;                              /* Caller checks NULL as for OSSemCreate()      */
+        return ((OS_EVENT *)0);
+    }
+    OSEventFreeList     = (OS_EVENT *)OSEventFreeList->OSEventPtr; /* Adjust the free list            */
+    OS_EXIT_CRITICAL();
+    pevent->OSEventType = OS_EVENT_TYPE_MUTEX;
+    pevent->OSEventCnt  = (INT16U)((INT16U)prio << 8) | OS_MUTEX_AVAILABLE; /* Resource is available   */
+    pevent->OSEventPtr  = (void *)0;                   /* No task owning the mutex                     */
+    OSEventWaitListInit(pevent);
+    *err                = OS_NO_ERR;
+    return (pevent);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  PEND ON MUTUAL EXCLUSION SEMAPHORE
+*
+* Description: This function waits for a mutual exclusion semaphore.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired
+*                            mutex.
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for the resource up to the amount of time specified by this argument.
+*                            If you specify 0, however, your task will wait forever at the specified
+*                            mutex or, until the resource becomes available.
+*
+*              err           is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*                               OS_NO_ERR          The call was successful and your task owns the mutex
+*                               OS_TIMEOUT         The mutex was not available within the specified time.
+*                               OS_ERR_EVENT_TYPE  If you didn't pass a pointer to a mutex
+*                               OS_ERR_PEND_ISR    If you called this function from an ISR and the result
+*                                                  would lead to a suspension.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The owner is raised to PIP only when the waiting task has higher priority than the owner
+*                 and the owner does not run at higher PIP already (nested mutexes).
+*              2) Owner pending on another mutex is moved in that mutex wait list and the owner of that
+*                 mutex is raised as well.
+*              3) Owner priority is set again when the waiting task times out (see OSMutex_SetOwnerPrio()).
+*********************************************************************************************************
+*/
+void OSMutexPend (OS_EVENT *pevent, INT16U timeout, INT8U *err)
+{
+#if (OS_CRITICAL_METHOD == 3)
+    OS_CPU_SR  cpu_sr;
+#endif
+
+
+    if (OSIntNesting > 0) {                            /* See if called from ISR ...                   */
+        *err = OS_ERR_PEND_ISR;                        /* ... can't PEND from an ISR                   */
+        return;
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventType != OS_EVENT_TYPE_MUTEX) {  /* Validate event block type                    */
+        OS_EXIT_CRITICAL();
+        *err = OS_ERR_EVENT_TYPE;
+        return;
+    }
+    if (OSRunning == FALSE) {                          /* B.K. constructors run before OSStart() when  */
+        OS_EXIT_CRITICAL();                            /* ... there is only one thread and no OSTCBCur */
+        *err = OS_NO_ERR;
+        return;
+    }
+    if ((pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8) == OS_MUTEX_AVAILABLE) { /* Is Mutex available?    */
+        pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER_8;   /* Yes, Acquire the resource                    */
+        pevent->OSEventCnt |= OSTCBCur->OSTCBBasePrio; /*      Save base priority of owning task       */
+        pevent->OSEventPtr  = (void *)OSTCBCur;        /*      Point to owning task's OS_TCB           */
+        OS_EXIT_CRITICAL();
+        *err = OS_NO_ERR;
+        return;
+    }
+    OSTCBCur->OSTCBStat |= OS_STAT_MUTEX;              /* Mutex not available, pend current task       */
+    OSTickWheelInsert(OSTCBCur, timeout);              /* Store timeout in current task's TCB          */
+    OSEventTaskWait(pevent);                           /* Suspend task until event or timeout occurs   */
+    if ((pevent->OSEventCnt >> 8) != OS_PRIO_MUTEX_CEIL_DIS) {   /* Promote owner to PIP if needed    */
+        OSMutex_SetOwnerPrio((OS_TCB *)pevent->OSEventPtr);
+    }
+    OS_EXIT_CRITICAL();
+    OSSched();                                         /* Find next highest priority task ready        */
+    OS_ENTER_CRITICAL();
+    if (OSTCBCur->OSTCBStat & OS_STAT_MUTEX) {         /* Must have timed out if still waiting for event*/
+        OSEventTO(pevent);
+        if ((pevent->OSEventCnt >> 8) != OS_PRIO_MUTEX_CEIL_DIS) { /* Owner may not need PIP any more  */
+            OSMutex_SetOwnerPrio((OS_TCB *)pevent->OSEventPtr);
+        }
+        OS_EXIT_CRITICAL();
+        *err = OS_TIMEOUT;                             /* Indicate that we didn't get mutex within TO  */
+        return;
+    }
+    OSTCBCur->OSTCBEventPtr = (OS_EVENT *)0;
+    OS_EXIT_CRITICAL();
+    *err = OS_NO_ERR;
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  POST TO A MUTUAL EXCLUSION SEMAPHORE
+*
+* Description: This function signals a mutual exclusion semaphore
+*
+* Arguments  : pevent              is a pointer to the event control block associated with the desired
+*                                  mutex.
+*
+* Returns    : OS_NO_ERR               The call was successful and the mutex was signaled.
+*              OS_ERR_EVENT_TYPE       If you didn't pass a pointer to a mutex
+*              OS_ERR_POST_ISR         Attempted to post from an ISR (not valid for MUTEXes)
+*              OS_ERR_NOT_MUTEX_OWNER  The task that did the post is NOT the owner of the MUTEX.
+*********************************************************************************************************
+*/
+INT8U OSMutexPost (OS_EVENT *pevent)
+{
+    INT8U      prio;
+    INT8U      x;
+    INT8U      y;
+    OS_TCB    *ptcb;
+#if (OS_CRITICAL_METHOD == 3)
+    OS_CPU_SR  cpu_sr;
+#endif
+
+
+    if (OSIntNesting > 0) {                            /* See if called from ISR ...                   */
+        return (OS_ERR_POST_ISR);                      /* ... can't POST mutex from an ISR             */
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventType != OS_EVENT_TYPE_MUTEX) {  /* Validate event block type                    */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_EVENT_TYPE);
+    }
+    if (OSRunning == FALSE) {                          /* B.K. mutex was not taken by OSMutexPend()    */
+        OS_EXIT_CRITICAL();                            /* ... before OSStart() (see above)             */
+        return (OS_NO_ERR);
+    }
+    if (OSTCBCur != (OS_TCB *)pevent->OSEventPtr) {    /* See if posting task owns the MUTEX           */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_NOT_MUTEX_OWNER);
+    }
+    if (pevent->OSEventGrp) {                          /* Any task waiting for the mutex?              */
+        y    = OSUnMapTbl[pevent->OSEventGrp];         /* Yes, Find highest priority task waiting      */
+        x    = OSUnMapTbl[pevent->OSEventTbl[y]];
+        prio = (INT8U)((y << 3) + x);
+        ptcb = OSTCBPrioTbl[prio];                     /*      Waiting task at PIP is in the table too */
+        OSEventTaskRdy(pevent, (void *)0, OS_STAT_MUTEX);        /* Make it ready to run               */
+        pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER_8;   /*      Save base priority of mutex's new owner */
+        pevent->OSEventCnt |= ptcb->OSTCBBasePrio;
+        pevent->OSEventPtr  = (void *)ptcb;            /*      Link to new mutex owner's OS_TCB        */
+        if ((pevent->OSEventCnt >> 8) != OS_PRIO_MUTEX_CEIL_DIS) {
+            OSMutex_SetOwnerPrio(ptcb);                /*      New owner may need PIP for other waiters*/
+        }
+    } else {
+        pevent->OSEventCnt |= OS_MUTEX_AVAILABLE;      /* No,  Mutex is now available                  */
+        pevent->OSEventPtr  = (void *)0;
+        if (OSTCBCur->OSTCBPrio == OSTCBCur->OSTCBBasePrio) {    /* Nobody to run instead of us        */
+            OS_EXIT_CRITICAL();
+            return (OS_NO_ERR);
+        }
+    }
+    if (OSTCBCur->OSTCBPrio != OSTCBCur->OSTCBBasePrio) {        /* Did we run at PIP?                 */
+        OSMutex_SetOwnerPrio(OSTCBCur);                /* Yes, PIP may not be needed any more          */
+    }
+    OS_EXIT_CRITICAL();
+    OSSched();                                         /* Find highest priority task ready to run      */
+    return (OS_NO_ERR);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                     QUERY A MUTUAL EXCLUSION SEMAPHORE
+*
+* Description: This function obtains information about a mutex
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired mutex
+*
+*              pdata         is a pointer to a structure that will contain information about the mutex
+*
+* Returns    : OS_NO_ERR            The call was successful and the message was sent
+*              OS_ERR_EVENT_TYPE    If you are attempting to obtain data from a non mutex.
+*********************************************************************************************************
+*/
+INT8U OSMutexQuery (OS_EVENT *pevent, OS_MUTEX_DATA *pdata)
+{
+    INT8U   i;
+    INT8U  *psrc;
+    INT8U  *pdest;
+#if (OS_CRITICAL_METHOD == 3)
+    OS_CPU_SR  cpu_sr;
+#endif
+
+
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventType != OS_EVENT_TYPE_MUTEX) {  /* Validate event block type                    */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_EVENT_TYPE);
+    }
+    pdata->OSMutexPIP  = (INT8U)(pevent->OSEventCnt >> 8);
+    pdata->OSOwnerPrio = (INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8);
+    if (pdata->OSOwnerPrio == 0xFF) {
+        pdata->OSValue = 1;
+    } else {
+        pdata->OSValue = 0;
+    }
+    pdata->OSEventGrp  = pevent->OSEventGrp;           /* Copy wait list                               */
+    psrc               = &pevent->OSEventTbl[0];
+    pdest              = &pdata->OSEventTbl[0];
+    for (i = 0; i < OS_EVENT_TBL_SIZE; i++) {
+        *pdest++ = *psrc++;
+    }
+    OS_EXIT_CRITICAL();
+    return (OS_NO_ERR);
+}
+#endif
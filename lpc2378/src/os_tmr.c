@@ -0,0 +1,523 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                            TIMER MANAGEMENT
+*
+*                        (c) Copyright 1992-1998, Jean J. Labrosse, Plantation, FL
+*                                           All Rights Reserved
+*
+*                                                  V2.00
+*
+* File : OS_TMR.C
+* By   : Jean J. Labrosse
+*
+* B.K. Software timers are not part of uC/OS-II V2.00. This file adds them with API close to later
+*      uC/OS-II versions (OSTmrCreate(), OSTmrStart(), OSTmrStop(), OSTmrDel(), OSTmrRemainGet(),
+*      OSTmrStateGet()) but without timer names. Running timers are kept in hashed timer wheel, timer
+*      is linked into spoke (OSTmrMatch % OS_TMR_CFG_WHEEL_SIZE) so every tick only one spoke is visited.
+*      Timers are processed by the timer task (OS_TASK_TMR_PRIO) signaled by OSTimeTick() so callbacks
+*      run in the task context and can post messages, allocate memory or acquire mutexes.
+*      Timer data are protected by scheduler lock so timers cannot be used from ISRs.
+*********************************************************************************************************
+*/
+
+#include    "os_cpu.h"
+#include    "os_cfg.h"
+#include    "os_ucos_ii.h"
+
+#if OS_TMR_EN
+/*
+*********************************************************************************************************
+*                                            LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TMR       OSTmrTbl[OS_TMR_CFG_MAX];                 /* Table of timers                       */
+static  OS_TMR      *OSTmrFreeList;                            /* Pointer to list of free timers        */
+static  OS_TMR      *OSTmrWheelTbl[OS_TMR_CFG_WHEEL_SIZE];     /* Timer wheel spokes                    */
+static  INT32U       OSTmrTime;                                /* Ticks processed by the timer task     */
+static  OS_EVENT    *OSTmrSemSignal;                           /* Signaled by OSTimeTick() every tick   */
+static  OS_STK       OSTmrTaskStk[OS_TASK_TMR_STK_SIZE];       /* Timer task stack                      */
+
+/*
+*********************************************************************************************************
+*                                        LINK TIMER INTO TIMER WHEEL
+*
+* Description: This function links the timer into the spoke visited when the timer expires.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+*              dly           is the number of ticks to the timer expiration (must be > 0)
+*
+* Returns    : none
+*
+* Note       : This function is INTERNAL to os_tmr.c and must be called with the scheduler locked.
+*********************************************************************************************************
+*/
+static void OSTmr_Link (OS_TMR *ptmr, INT32U dly)
+{
+    OS_TMR **pspoke;
+
+
+    ptmr->OSTmrState = OS_TMR_STATE_RUNNING;
+    ptmr->OSTmrMatch = OSTmrTime + dly;
+    pspoke           = &OSTmrWheelTbl[ptmr->OSTmrMatch & (OS_TMR_CFG_WHEEL_SIZE - 1)];
+    ptmr->OSTmrPrev  = (OS_TMR *)0;                    /* Link timer at the beginning of the spoke     */
+    ptmr->OSTmrNext  = *pspoke;
+    if (*pspoke != (OS_TMR *)0) {
+        (*pspoke)->OSTmrPrev = ptmr;
+    }
+    *pspoke          = ptmr;
+}
+
+/*
+*********************************************************************************************************
+*                                      UNLINK TIMER FROM TIMER WHEEL
+*
+* Description: This function removes running timer from its spoke of the timer wheel.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+* Returns    : none
+*
+* Note       : This function is INTERNAL to os_tmr.c and must be called with the scheduler locked.
+*              Nothing is done when the timer is not running.
+*********************************************************************************************************
+*/
+static void OSTmr_Unlink (OS_TMR *ptmr)
+{
+    if (ptmr->OSTmrState == OS_TMR_STATE_RUNNING) {
+        if (ptmr->OSTmrPrev != (OS_TMR *)0) {
+            ptmr->OSTmrPrev->OSTmrNext = ptmr->OSTmrNext;
+        } else {
+            OSTmrWheelTbl[ptmr->OSTmrMatch & (OS_TMR_CFG_WHEEL_SIZE - 1)] = ptmr->OSTmrNext;
+        }
+        if (ptmr->OSTmrNext != (OS_TMR *)0) {
+            ptmr->OSTmrNext->OSTmrPrev = ptmr->OSTmrPrev;
+        }
+        ptmr->OSTmrState = OS_TMR_STATE_STOPPED;
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                              TIMER TASK
+*
+* Description: This task is signaled by OSTimeTick() every tick.  It advances the timer wheel time and
+*              calls callbacks of timers which expired in the current spoke.  Periodic timers are linked
+*              again for the next period before their callback is called.
+*
+* Arguments  : pdata         is not used
+*
+* Returns    : none
+*
+* Note       : Callback is called with the scheduler unlocked so it can pend.  The spoke is scanned from
+*              its beginning after every callback because the callback can start, stop or delete timers.
+*              Ticks signaled when the task was late are not lost (they are counted by the semaphore).
+*********************************************************************************************************
+*/
+static void OSTmr_Task (void *pdata)
+{
+    INT8U            err;
+    OS_TMR          *ptmr;
+    OS_TMR_CALLBACK  pfnct;
+    void            *parg;
+
+
+    pdata = pdata;                                     /* Prevent compiler warning                     */
+    for (;;) {
+        OSSemPend(OSTmrSemSignal, 0, &err);            /* Wait for the next tick                       */
+        OSSchedLock();
+        OSTmrTime++;
+        ptmr = OSTmrWheelTbl[OSTmrTime & (OS_TMR_CFG_WHEEL_SIZE - 1)];
+        while (ptmr != (OS_TMR *)0) {
+            if (ptmr->OSTmrMatch == OSTmrTime) {       /* Timer expired (not the next wheel turn)      */
+                OSTmr_Unlink(ptmr);
+                if (ptmr->OSTmrOpt == OS_TMR_OPT_PERIODIC) {
+                    OSTmr_Link(ptmr, ptmr->OSTmrPeriod);   /* Restart periodic timer                   */
+                } else {
+                    ptmr->OSTmrState = OS_TMR_STATE_COMPLETED;
+                }
+                pfnct = ptmr->OSTmrCallback;
+                parg  = ptmr->OSTmrCallbackArg;
+                OSSchedUnlock();
+                if (pfnct != (OS_TMR_CALLBACK)0) {
+                    (*pfnct)((void *)ptmr, parg);      /* Call the timer callback                      */
+                }
+                OSSchedLock();
+                ptmr = OSTmrWheelTbl[OSTmrTime & (OS_TMR_CFG_WHEEL_SIZE - 1)];
+            } else {
+                ptmr = ptmr->OSTmrNext;
+            }
+        }
+        OSSchedUnlock();
+    }
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         INITIALIZE TIMER MANAGER
+*
+* Description: This function is called by OSInit() to initialize the software timers and to create
+*              the timer task.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note       : This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+void OSTmrInit (void)
+{
+    INT16U i;
+
+
+    for (i = 0; i < (OS_TMR_CFG_MAX - 1); i++) {       /* Init. list of free timers                    */
+        OSTmrTbl[i].OSTmrState = OS_TMR_STATE_UNUSED;
+        OSTmrTbl[i].OSTmrNext  = &OSTmrTbl[i + 1];
+    }
+    OSTmrTbl[OS_TMR_CFG_MAX - 1].OSTmrState = OS_TMR_STATE_UNUSED;
+    OSTmrTbl[OS_TMR_CFG_MAX - 1].OSTmrNext  = (OS_TMR *)0;
+    OSTmrFreeList = &OSTmrTbl[0];
+    for (i = 0; i < OS_TMR_CFG_WHEEL_SIZE; i++) {      /* No running timers                            */
+        OSTmrWheelTbl[i] = (OS_TMR *)0;
+    }
+    OSTmrTime      = 0L;
+    OSTmrSemSignal = OSSemCreate(0);                   /* No ticks to process                          */
+#if OS_STK_GROWTH == 1
+    OSTaskCreateExt(OSTmr_Task,
+                    (void *)0,                                 /* No arguments passed to OSTmr_Task()  */
+                    &OSTmrTaskStk[OS_TASK_TMR_STK_SIZE - 1],   /* Set Top-Of-Stack                     */
+                    OS_TASK_TMR_PRIO,
+                    OS_TASK_TMR_ID,
+                    &OSTmrTaskStk[0],                          /* Set Bottom-Of-Stack                  */
+                    OS_TASK_TMR_STK_SIZE,
+                    (void *)0,                                 /* No TCB extension                     */
+                    OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);/* Enable stack checking + clear stack  */
+#else
+    OSTaskCreateExt(OSTmr_Task,
+                    (void *)0,                                 /* No arguments passed to OSTmr_Task()  */
+                    &OSTmrTaskStk[0],                          /* Set Top-Of-Stack                     */
+                    OS_TASK_TMR_PRIO,
+                    OS_TASK_TMR_ID,
+                    &OSTmrTaskStk[OS_TASK_TMR_STK_SIZE - 1],   /* Set Bottom-Of-Stack                  */
+                    OS_TASK_TMR_STK_SIZE,
+                    (void *)0,                                 /* No TCB extension                     */
+                    OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);/* Enable stack checking + clear stack  */
+#endif
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             SIGNAL TIMER TASK
+*
+* Description: This function is called by OSTimeTick() every tick to let the timer task process timers.
+*
+* Arguments  : none
+*
+* Returns    : OS_NO_ERR          The call was successful
+*              OS_SEM_OVF         If the timer task is late by 65535 ticks
+*********************************************************************************************************
+*/
+INT8U OSTmrSignal (void)
+{
+    return (OSSemPost(OSTmrSemSignal));
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              CREATE A TIMER
+*
+* Description: This function is called by your application code to create a timer.  The timer is created
+*              in the stopped state (see OSTmrStart()).
+*
+* Arguments  : dly           is the number of ticks to the first timer expiration.  For periodic timer
+*                            0 means the first expiration after 'period'.
+*
+*              period        is the number of ticks between expirations of periodic timer.
+*
+*              opt           OS_TMR_OPT_ONE_SHOT   the timer expires only once
+*                            OS_TMR_OPT_PERIODIC   the timer is restarted after every expiration
+*
+*              callback      is a pointer to the function called (by the timer task) when the timer
+*                            expires or NULL if no function is called
+*
+*              callback_arg  is the argument passed to the callback
+*
+*              err           is a pointer to an error code which will be returned to your application:
+*                               OS_NO_ERR                 the timer was created
+*                               OS_ERR_TMR_ISR            if you called this function from an ISR
+*                               OS_ERR_TMR_INVALID_OPT    if 'opt' is not valid
+*                               OS_ERR_TMR_INVALID_DLY    if one-shot 'dly' or periodic 'period' is 0
+*                               OS_ERR_TMR_NON_AVAIL      if there are no free timers
+*
+* Returns    : A pointer to the timer or NULL if the timer was not created
+*********************************************************************************************************
+*/
+OS_TMR *OSTmrCreate (INT32U dly, INT32U period, INT8U opt, OS_TMR_CALLBACK callback, void *callback_arg, INT8U *err)
+{
+    OS_TMR *ptmr;
+
+
+    if (OSIntNesting > 0) {                            /* See if called from ISR ...                   */
+        *err = OS_ERR_TMR_ISR;                         /* ... can't create timer from an ISR           */
+        return ((OS_TMR *)0);
+    }
+    switch (opt) {
+        case OS_TMR_OPT_PERIODIC:
+             if (period == 0) {
+                 *err = OS_ERR_TMR_INVALID_DLY;
+                 return ((OS_TMR *)0);
+             }
+             break;
+
+        case OS_TMR_OPT_ONE_SHOT:
+             if (dly == 0) {
+                 *err = OS_ERR_TMR_INVALID_DLY;
+                 return ((OS_TMR *)0);
+             }
+             break;
+
+        default:
+             *err = OS_ERR_TMR_INVALID_OPT;
+             return ((OS_TMR *)0);
+    }
+    OSSchedLock();
+    ptmr = OSTmrFreeList;                              /* Get a free timer                             */
+    if (ptmr == (OS_TMR *)0) {
+        OSSchedUnlock();
+        *err = OS_ERR_TMR_NON_AVAIL;
+        return ((OS_TMR *)0);
+    }
+    OSTmrFreeList          = ptmr->OSTmrNext;
+    ptmr->OSTmrState       = OS_TMR_STATE_STOPPED;     /* Timer is created stopped                     */
+    ptmr->OSTmrDly         = dly;
+    ptmr->OSTmrPeriod      = period;
+    ptmr->OSTmrOpt         = opt;
+    ptmr->OSTmrCallback    = callback;
+    ptmr->OSTmrCallbackArg = callback_arg;
+    OSSchedUnlock();
+    *err = OS_NO_ERR;
+    return (ptmr);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              DELETE A TIMER
+*
+* Description: This function is called by your application code to delete a timer.  Running timer is
+*              stopped first.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+*              err           is a pointer to an error code which will be returned to your application:
+*                               OS_NO_ERR                 the timer was deleted
+*                               OS_ERR_TMR_ISR            if you called this function from an ISR
+*                               OS_ERR_TMR_INVALID        if 'ptmr' is NULL
+*                               OS_ERR_TMR_INACTIVE       if the timer was not created
+*
+* Returns    : TRUE when the timer was deleted, FALSE otherwise
+*********************************************************************************************************
+*/
+BOOLEAN OSTmrDel (OS_TMR *ptmr, INT8U *err)
+{
+    if (OSIntNesting > 0) {
+        *err = OS_ERR_TMR_ISR;
+        return (FALSE);
+    }
+    if (ptmr == (OS_TMR *)0) {
+        *err = OS_ERR_TMR_INVALID;
+        return (FALSE);
+    }
+    OSSchedLock();
+    if (ptmr->OSTmrState == OS_TMR_STATE_UNUSED) {
+        OSSchedUnlock();
+        *err = OS_ERR_TMR_INACTIVE;
+        return (FALSE);
+    }
+    OSTmr_Unlink(ptmr);
+    ptmr->OSTmrState = OS_TMR_STATE_UNUSED;            /* Return the timer to the free list            */
+    ptmr->OSTmrNext  = OSTmrFreeList;
+    OSTmrFreeList    = ptmr;
+    OSSchedUnlock();
+    *err = OS_NO_ERR;
+    return (TRUE);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              START A TIMER
+*
+* Description: This function is called by your application code to start a timer.  Running timer is
+*              restarted from the beginning.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+*              err           is a pointer to an error code which will be returned to your application:
+*                               OS_NO_ERR                 the timer was started
+*                               OS_ERR_TMR_ISR            if you called this function from an ISR
+*                               OS_ERR_TMR_INVALID        if 'ptmr' is NULL
+*                               OS_ERR_TMR_INACTIVE       if the timer was not created
+*
+* Returns    : TRUE when the timer was started, FALSE otherwise
+*********************************************************************************************************
+*/
+BOOLEAN OSTmrStart (OS_TMR *ptmr, INT8U *err)
+{
+    if (OSIntNesting > 0) {
+        *err = OS_ERR_TMR_ISR;
+        return (FALSE);
+    }
+    if (ptmr == (OS_TMR *)0) {
+        *err = OS_ERR_TMR_INVALID;
+        return (FALSE);
+    }
+    OSSchedLock();
+    if (ptmr->OSTmrState == OS_TMR_STATE_UNUSED) {
+        OSSchedUnlock();
+        *err = OS_ERR_TMR_INACTIVE;
+        return (FALSE);
+    }
+    OSTmr_Unlink(ptmr);                                /* Restart timer when it is running             */
+    if (ptmr->OSTmrDly == 0) {                         /* Periodic timer without initial delay         */
+        OSTmr_Link(ptmr, ptmr->OSTmrPeriod);
+    } else {
+        OSTmr_Link(ptmr, ptmr->OSTmrDly);
+    }
+    OSSchedUnlock();
+    *err = OS_NO_ERR;
+    return (TRUE);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              STOP A TIMER
+*
+* Description: This function is called by your application code to stop a timer.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+*              opt           OS_TMR_OPT_NONE       just stop the timer
+*                            OS_TMR_OPT_CALLBACK   call the timer callback when running timer is stopped
+*
+*              err           is a pointer to an error code which will be returned to your application:
+*                               OS_NO_ERR                 the timer was stopped (or it was not running)
+*                               OS_ERR_TMR_ISR            if you called this function from an ISR
+*                               OS_ERR_TMR_INVALID        if 'ptmr' is NULL
+*                               OS_ERR_TMR_INACTIVE       if the timer was not created
+*
+* Returns    : TRUE when the timer is stopped, FALSE otherwise
+*********************************************************************************************************
+*/
+BOOLEAN OSTmrStop (OS_TMR *ptmr, INT8U opt, INT8U *err)
+{
+    BOOLEAN running;
+
+
+    if (OSIntNesting > 0) {
+        *err = OS_ERR_TMR_ISR;
+        return (FALSE);
+    }
+    if (ptmr == (OS_TMR *)0) {
+        *err = OS_ERR_TMR_INVALID;
+        return (FALSE);
+    }
+    OSSchedLock();
+    if (ptmr->OSTmrState == OS_TMR_STATE_UNUSED) {
+        OSSchedUnlock();
+        *err = OS_ERR_TMR_INACTIVE;
+        return (FALSE);
+    }
+    running = (BOOLEAN)(ptmr->OSTmrState == OS_TMR_STATE_RUNNING);
+    OSTmr_Unlink(ptmr);
+    ptmr->OSTmrState = OS_TMR_STATE_STOPPED;
+    OSSchedUnlock();
+    if ((running == TRUE) && (opt == OS_TMR_OPT_CALLBACK) && (ptmr->OSTmrCallback != (OS_TMR_CALLBACK)0)) {
+        (*ptmr->OSTmrCallback)((void *)ptmr, ptmr->OSTmrCallbackArg);
+    }
+    *err = OS_NO_ERR;
+    return (TRUE);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 GET NUMBER OF TICKS TO TIMER EXPIRATION
+*
+* Description: This function is called to get the number of ticks before the timer expires.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+*              err           is a pointer to an error code which will be returned to your application:
+*                               OS_NO_ERR                 the call was successful
+*                               OS_ERR_TMR_ISR            if you called this function from an ISR
+*                               OS_ERR_TMR_INVALID        if 'ptmr' is NULL
+*                               OS_ERR_TMR_INACTIVE       if the timer was not created
+*
+* Returns    : The number of ticks to expiration of running timer, the initial delay (or the period) of
+*              stopped timer and 0 for completed one-shot timer.
+*********************************************************************************************************
+*/
+INT32U OSTmrRemainGet (OS_TMR *ptmr, INT8U *err)
+{
+    INT32U remain;
+
+
+    if (OSIntNesting > 0) {
+        *err = OS_ERR_TMR_ISR;
+        return (0);
+    }
+    if (ptmr == (OS_TMR *)0) {
+        *err = OS_ERR_TMR_INVALID;
+        return (0);
+    }
+    OSSchedLock();
+    switch (ptmr->OSTmrState) {
+        case OS_TMR_STATE_RUNNING:
+             remain = ptmr->OSTmrMatch - OSTmrTime;
+             break;
+
+        case OS_TMR_STATE_STOPPED:
+             remain = (ptmr->OSTmrDly == 0) ? ptmr->OSTmrPeriod : ptmr->OSTmrDly;
+             break;
+
+        case OS_TMR_STATE_COMPLETED:
+             remain = 0;
+             break;
+
+        default:
+             OSSchedUnlock();
+             *err = OS_ERR_TMR_INACTIVE;
+             return (0);
+    }
+    OSSchedUnlock();
+    *err = OS_NO_ERR;
+    return (remain);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          GET STATE OF A TIMER
+*
+* Description: This function is called to get the current state of the timer.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+*              err           is a pointer to an error code which will be returned to your application:
+*                               OS_NO_ERR                 the call was successful
+*                               OS_ERR_TMR_INVALID        if 'ptmr' is NULL
+*
+* Returns    : OS_TMR_STATE_UNUSED, OS_TMR_STATE_STOPPED, OS_TMR_STATE_COMPLETED or OS_TMR_STATE_RUNNING
+*********************************************************************************************************
+*/
+INT8U OSTmrStateGet (OS_TMR *ptmr, INT8U *err)
+{
+    if (ptmr == (OS_TMR *)0) {
+        *err = OS_ERR_TMR_INVALID;
+        return (OS_TMR_STATE_UNUSED);
+    }
+    *err = OS_NO_ERR;
+    return (ptmr->OSTmrState);
+}
+#endif
@@ -0,0 +1,379 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        tsk_obstacle.c
+* Description: Obstacle watch task which samples US, IRED and tilt sensors during track movement
+*              and stops tracks as soon as an obstacle is detected
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+#include "lib_error.h"
+#include "tsk_obstacle.h"
+#include "tsk_tracks.h"
+#include "hw_gpio.h"
+#include "hw_timer.h"
+#include "hw_adc.h"
+#include "hw_hcsr04.h"
+#include "ctr_gp2d12.h"
+
+//moving average of the latest sensor samples
+typedef struct
+{
+	WORD mSample[OBSTACLE_WATCH_MAX_SAMPLES];//latest samples
+	BYTE mLength;//number of samples averaged
+	BYTE mIndex;//place for the next sample
+	BYTE mCount;//number of valid samples in mSample
+	DWORD mSum;//sum of valid samples
+} sMovingAverage;
+
+static OS_EVENT *ObstacleWatchStartSem;//posted by StartObstacleWatch to wake up the task
+static OS_EVENT *ObstacleWatchDoneSem;//posted by the task when watch is finished
+
+static volatile BYTE ObstacleWatchDirection;//direction of the watched movement
+static volatile BYTE ObstacleWatchResult;//result of the last watch
+static volatile WORD ObstacleWatchCoveredPulses;//track pulses counted when tracks were stopped by the watch
+static volatile WORD ObstacleWatchMaxLatency;//worst case detection latency in Timer3 ticks
+static volatile WORD ObstacleWatchMaxPeriod;//the longest sampling period in Timer3 ticks
+
+OS_STK ObstacleWatchTaskStack[OBSTACLE_WATCH_STACK_SIZE];//stack for obstacle watch task
+
+/*
+*********************************************************************************************************
+* Name:                                   InitObstacleWatch
+*
+* Description: Creates semaphores used to start obstacle watch and signal its end
+*
+*
+* Arguments:   none
+*
+* Returns:     none
+*
+* Note(s):
+* 		Must be called before ObstacleWatchTask is created
+* 		Rise UCOSII_RES_EXCEPTION when semaphores cannot be created
+* *********************************************************************************************************
+*/
+void InitObstacleWatch(void)
+{
+	ObstacleWatchResult=OBSTACLE_WATCH_NONE;
+	ObstacleWatchCoveredPulses=0;
+	ObstacleWatchMaxLatency=0;
+	ObstacleWatchMaxPeriod=0;
+
+	ObstacleWatchStartSem=OSSemCreate(0);
+	if(!ObstacleWatchStartSem)UCOSII_RES_EXCEPTION;//when no OS resources to create semaphore rise an exception
+	ObstacleWatchDoneSem=OSSemCreate(0);
+	if(!ObstacleWatchDoneSem)UCOSII_RES_EXCEPTION;//when no OS resources to create semaphore rise an exception
+}//InitObstacleWatch
+
+/*
+*********************************************************************************************************
+* Name:                                   StartObstacleWatch
+*
+* Description: Wakes up obstacle watch task to sample sensors as long as tracks are moving
+*
+*
+* Arguments:   InDirection - direction of the movement (MOTOR_FORWARD, MOTOR_REVERSE)
+*
+* Returns:     none
+*
+* Note(s):
+* 		Call it just after RunTracksPulses. For MOTOR_REVERSE only tilt is watched.
+* 		Every StartObstacleWatch must be followed by WaitObstacleWatch which returns TRUE
+* *********************************************************************************************************
+*/
+void StartObstacleWatch(BYTE InDirection)
+{
+	ObstacleWatchDirection=InDirection;
+	ObstacleWatchResult=OBSTACLE_WATCH_NONE;
+	OSSemPost(ObstacleWatchStartSem);//task has higher priority so it takes the first sample immediately
+}//StartObstacleWatch
+
+/*
+*********************************************************************************************************
+* Name:                                   WaitObstacleWatch
+*
+* Description: Waits until obstacle watch is finished (tracks stopped)
+*
+*
+* Arguments:   InTimeout - timeout in OS Ticks (0 - wait forever)
+*
+* Returns:     TRUE - watch is finished GetObstacleWatchResult can be read, FALSE - timeout
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+BOOL WaitObstacleWatch(WORD InTimeout)
+{
+	INT8U Err;
+
+	OSSemPend(ObstacleWatchDoneSem,InTimeout,&Err);
+	return Err==OS_NO_ERR;
+}//WaitObstacleWatch
+
+/*
+*********************************************************************************************************
+* Name:                                   GetObstacleWatchResult
+*
+* Description: Returns result of the last finished obstacle watch
+*
+*
+* Arguments:   none
+*
+* Returns:     OBSTACLE_WATCH_NONE, OBSTACLE_WATCH_DISTANCE, OBSTACLE_WATCH_TILT
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+BYTE GetObstacleWatchResult(void)
+{
+	return ObstacleWatchResult;
+}//GetObstacleWatchResult
+
+/*
+*********************************************************************************************************
+* Name:                                   GetObstacleWatchCoveredPulses
+*
+* Description: Returns number of track pulses covered when obstacle watch stopped tracks
+*
+*
+* Arguments:   none
+*
+* Returns:     Total track pulses counted just before tracks were stopped
+*
+* Note(s):
+* 		Valid only when GetObstacleWatchResult is not OBSTACLE_WATCH_NONE
+* *********************************************************************************************************
+*/
+WORD GetObstacleWatchCoveredPulses(void)
+{
+	return ObstacleWatchCoveredPulses;
+}//GetObstacleWatchCoveredPulses
+
+/*
+*********************************************************************************************************
+* Name:                                   GetObstacleWatchMaxLatency
+*
+* Description: Returns worst case obstacle detection latency measured so far
+*
+*
+* Arguments:   none
+*
+* Returns:     Max time in Timer3 ticks (120us) from start of the sample which detected an obstacle
+* 				until tracks were stopped
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+WORD GetObstacleWatchMaxLatency(void)
+{
+	return ObstacleWatchMaxLatency;
+}//GetObstacleWatchMaxLatency
+
+/*
+*********************************************************************************************************
+* Name:                                   GetObstacleWatchMaxPeriod
+*
+* Description: Returns the longest sensor sampling period measured so far
+*
+*
+* Arguments:   none
+*
+* Returns:     Max time in Timer3 ticks (120us) between start of subsequent samples
+*
+* Note(s):
+* 		Obstacle which shows up just after a sample is stopped not later than period + latency
+* *********************************************************************************************************
+*/
+WORD GetObstacleWatchMaxPeriod(void)
+{
+	return ObstacleWatchMaxPeriod;
+}//GetObstacleWatchMaxPeriod
+
+/*
+*********************************************************************************************************
+* Name:                                   ResetAverage
+*
+* Description: Removes all samples from the moving average
+*
+*
+* Arguments:   pAverage - moving average to be reset
+* 				Length - number of samples to be averaged (<= OBSTACLE_WATCH_MAX_SAMPLES)
+*
+* Returns:     none
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+static void ResetAverage(sMovingAverage *pAverage,BYTE Length)
+{
+	pAverage->mLength=Length;
+	pAverage->mIndex=0;
+	pAverage->mCount=0;
+	pAverage->mSum=0;
+}//ResetAverage
+
+/*
+*********************************************************************************************************
+* Name:                                   AddSample
+*
+* Description: Adds the sample to the moving average replacing the oldest one when average is full
+*
+*
+* Arguments:   pAverage - moving average
+* 				Sample - new sample
+*
+* Returns:     TRUE when average is full and GetAverage can be used, FALSE otherwise
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+static BOOL AddSample(sMovingAverage *pAverage,WORD Sample)
+{
+	if(pAverage->mCount<pAverage->mLength)pAverage->mCount++;
+	else pAverage->mSum-=pAverage->mSample[pAverage->mIndex];//remove the oldest sample
+
+	pAverage->mSample[pAverage->mIndex]=Sample;
+	pAverage->mSum+=Sample;
+	if(++pAverage->mIndex>=pAverage->mLength)pAverage->mIndex=0;
+
+	return pAverage->mCount==pAverage->mLength;
+}//AddSample
+
+/*
+*********************************************************************************************************
+* Name:                                   GetAverage
+*
+* Description: Returns average of the samples
+*
+*
+* Arguments:   pAverage - moving average
+*
+* Returns:     Average of valid samples
+*
+* Note(s):
+* *********************************************************************************************************
+*/
+static WORD GetAverage(sMovingAverage *pAverage)
+{
+	if(!pAverage->mCount)return 0;
+	return (WORD)(pAverage->mSum/pAverage->mCount);
+}//GetAverage
+
+/*
+*********************************************************************************************************
+* Name:                                   WatchForObstacles
+*
+* Description: Samples sensors every OBSTACLE_WATCH_PERIOD_TICKS as long as tracks are moving
+* 				and stops tracks immediately when an obstacle is detected
+*
+* Arguments:   Direction - direction of the movement (MOTOR_FORWARD, MOTOR_REVERSE)
+*
+* Returns:     OBSTACLE_WATCH_NONE, OBSTACLE_WATCH_DISTANCE, OBSTACLE_WATCH_TILT
+*
+* Note(s):
+* 		For forward movement US, IRED and tilt are checked the same way as Move() did before
+* 		but on every sample (not after 0.5s of IRED averaging)
+* 		For reverse movement only tilt is checked
+* *********************************************************************************************************
+*/
+static BYTE WatchForObstacles(BYTE Direction)
+{
+	static sMovingAverage IredAverage;//kept static to not occupy task stack
+	static sMovingAverage XAverage;
+	static sMovingAverage ZAverage;
+	BYTE Result=OBSTACLE_WATCH_NONE;
+	BYTE Obstacle;
+	BYTE IredSettleSamples=0;//samples to skip until IRED output is stable after power up
+	DWORD SampleStart;//Timer3 time stamp of the current sample start
+	DWORD PrevSampleStart=0;//Timer3 time stamp of the previous sample start
+	DWORD Latency;
+
+	ResetAverage(&IredAverage,OBSTACLE_WATCH_IRED_SAMPLES);
+	ResetAverage(&XAverage,OBSTACLE_WATCH_TILT_SAMPLES);
+	ResetAverage(&ZAverage,OBSTACLE_WATCH_TILT_SAMPLES);
+
+	if(Direction==MOTOR_FORWARD)
+	{
+		DistanceDetectorOn();//detector is on for whole movement
+		IredSettleSamples=(DISTANCE_READING_POWER_UP_DELAY+OBSTACLE_WATCH_PERIOD_TICKS-1)/OBSTACLE_WATCH_PERIOD_TICKS;
+	}
+
+	while(IsTrackMoving())
+	{
+		SampleStart=GetTimer3Ticks();
+		if(PrevSampleStart && (SampleStart-PrevSampleStart)>ObstacleWatchMaxPeriod)
+			ObstacleWatchMaxPeriod=(WORD)(SampleStart-PrevSampleStart);
+		PrevSampleStart=SampleStart;
+
+		if(Direction==MOTOR_FORWARD)//check obstacle but only for forward movement
+		{
+			Obstacle=ClassifyUS(ReadRawUS());//first check US for very close object
+			if(IredSettleSamples)IredSettleSamples--;
+			else if(AddSample(&IredAverage,ReadSingleIRED()) && Obstacle!=OBSTACLE_VERY_SHORT_DISTANCE)
+				Obstacle=DistanceSensorsFusion(Obstacle,ClassifyIRED(GetAverage(&IredAverage)));
+			if(Obstacle==OBSTACLE_CHASM || Obstacle==OBSTACLE_VERY_SHORT_DISTANCE)
+				Result=OBSTACLE_WATCH_DISTANCE;
+		}
+
+		//check if during movement Wall-e is not moving over an obstacle
+		GetuPAdcAccess();
+		AddSample(&XAverage,GetAccelerationX());
+		Obstacle=AddSample(&ZAverage,GetAccelerationZ());
+		ReleaseuPAdcAccess();
+		if(Obstacle && ClassifyTilt(GetAverage(&XAverage),GetAverage(&ZAverage))!=NO_TILT)
+			Result=OBSTACLE_WATCH_TILT;
+
+		if(Result!=OBSTACLE_WATCH_NONE)
+		{
+			ObstacleWatchCoveredPulses=GetCurrentTrackPulses();//get final number of pulses managed to be run
+			StopTracks(); //stop movement immediately
+			Latency=GetTimer3Ticks()-SampleStart;
+			if(Latency>ObstacleWatchMaxLatency)ObstacleWatchMaxLatency=(WORD)Latency;
+			break;
+		}
+		OSTimeDly(OBSTACLE_WATCH_PERIOD_TICKS);
+	}//while in movement
+
+	if(Direction==MOTOR_FORWARD)DistanceDetectorOff();
+	return Result;
+}//WatchForObstacles
+
+/*
+******************************************************************************************************
+* Name:                                   ObstacleWatchTask
+*
+* Description: Task which samples obstacle sensors during the movement and stops tracks on an obstacle
+*
+*
+* Arguments:   pdata - uCOS-II task argument
+*
+* Returns:     none
+*
+* Note(s):
+*
+* *********************************************************************************************************
+*/
+void ObstacleWatchTask(void *pdata)
+{
+	INT8U Err;
+
+	pdata=pdata;//to remove warning
+	for(;;)
+	{
+		OSSemPend(ObstacleWatchStartSem,0,&Err);//wait forever for the movement start
+		ObstacleWatchResult=WatchForObstacles(ObstacleWatchDirection);
+		OSSemPost(ObstacleWatchDoneSem);//signal end of the watch to Move()
+	}//for(;;)
+}//ObstacleWatchTask
@@ -0,0 +1,91 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        wrp_flag.cpp
+* Description: objective wrapper to uCOS-II event flags
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+* History:
+*              17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+
+#include "wrp_flag.hpp"
+#include "lib_error.h"
+
+//------------------------------------------------------------------------------
+//                     EventFlags Class - wraps uCOS event flag group
+//------------------------------------------------------------------------------
+#if OS_FLAG_EN
+cEventFlags::cEventFlags(WORD InitFlags)
+{
+	BYTE Result;
+	
+	m_OsFlagGrp=::OSFlagCreate(InitFlags,&Result);
+	if(!m_OsFlagGrp)UCOSII_RES_EXCEPTION;//Exception - when there is not uCOS-II event flag group availiable
+}//cEventFlags::cEventFlags
+
+cEventFlags::cEventFlags(OS_FLAG_GRP* pOsFlagGrp)
+{
+	m_OsFlagGrp=pOsFlagGrp;
+	if(!m_OsFlagGrp)UCOSII_RES_EXCEPTION;//Exception - when group was not created by C code
+}//cEventFlags::cEventFlags
+
+WORD cEventFlags::Pend(WORD Flags, BYTE WaitType, WORD TimeOut, BYTE* pResult)
+{
+	BYTE Result;
+	WORD ReadyFlags;
+	
+	if(TimeOut==OS_INFINITE)
+	{
+		ReadyFlags=::OSFlagPend(m_OsFlagGrp,Flags,WaitType,0x0000,&Result);//for uCOS-II the value 0x0000 means infinite
+	}
+	else if(TimeOut==OS_NO_WAIT)
+	{
+		ReadyFlags=::OSFlagAccept(m_OsFlagGrp,Flags,WaitType,&Result);
+		if(Result==OS_FLAG_ERR_NOT_RDY)Result=OS_TIMEOUT;//same result as for timeout of OSFlagPend
+	}
+	else
+	{
+		ReadyFlags=::OSFlagPend(m_OsFlagGrp,Flags,WaitType,TimeOut,&Result);
+	}
+	if(pResult)*pResult=Result;
+	return ReadyFlags;
+}//cEventFlags::Pend
+
+WORD cEventFlags::Accept(WORD Flags, BYTE WaitType)
+{
+	BYTE Result;
+	
+	return ::OSFlagAccept(m_OsFlagGrp,Flags,WaitType,&Result);
+}//cEventFlags::Accept
+
+BYTE cEventFlags::Set(WORD Flags)
+{
+	BYTE Result;
+	
+	::OSFlagPost(m_OsFlagGrp,Flags,OS_FLAG_SET,&Result);
+	return Result;
+}//cEventFlags::Set
+
+BYTE cEventFlags::Clear(WORD Flags)
+{
+	BYTE Result;
+	
+	::OSFlagPost(m_OsFlagGrp,Flags,OS_FLAG_CLR,&Result);
+	return Result;
+}//cEventFlags::Clear
+
+WORD cEventFlags::Query()
+{
+	BYTE Result;
+	
+	return ::OSFlagQuery(m_OsFlagGrp,&Result);
+}//cEventFlags::Query
+#endif //OS_FLAG_EN
@@ -1,56 +1,120 @@
-
-/*
-*********************************************************************************************************
-*                                            LPC 2378
-*
-*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
-*                                           All Rights Reserved
-*
-*
-* File:        wrp_sem.cpp
-* Description: objective wrapper to uCOS-II semaphores
-* Author:      Bogdan Kowalczyk
-* Date:        17-December-2008
-* Note:
-* History:
-*              17-December-2008 - Initial version created
-*********************************************************************************************************
-*/
-
-#include "wrp_sem.hpp"
-#include "lib_error.h"
-
-//------------------------------------------------------------------------------
-//                     CountedSemaphore Class - wraps uCOS Semaphore
-//------------------------------------------------------------------------------
-#if OS_SEM_EN
-cCountedSemaphore::cCountedSemaphore(WORD Value)
-{
-	m_OsEvent=::OSSemCreate(Value);
-	if(!m_OsEvent)UCOSII_RES_EXCEPTION;//Exception - when there is not uCOS-II event blocks availiable (uCOS-II resources are not availaible) 
-}//cCountedSemaphore::cCountedSemaphore
-
-
-BYTE cCountedSemaphore::Acquire(WORD TimeOut)
-{
-   BYTE Result;
-
-   if(TimeOut==OS_INFINITE)
-      {
-      ::OSSemPend(m_OsEvent,0x0000,&Result);//for uCOS-II the value 0x0000 means infinite
-      return Result;
-      }
-   else if(TimeOut==OS_NO_WAIT)
-      {
-      if(Accept()) //if semaphore can be accepted
-         return OS_NO_ERR;
-      else //semaphore is not availiable
-         return OS_TIMEOUT;
-      }
-   else
-      {
-      ::OSSemPend(m_OsEvent,TimeOut,&Result);
-      return Result;
-      }
-}//take semaphore with error
-#endif //OS_SEM_EN
+
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        wrp_sem.cpp
+* Description: objective wrapper to uCOS-II semaphores
+* Author:      Bogdan Kowalczyk
+* Date:        17-December-2008
+* Note:
+* History:
+*              17-December-2008 - Initial version created
+*              17-Oct-2026 - cMutex wraps uCOS-II mutex with priority inheritance and collects contention statistic
+*********************************************************************************************************
+*/
+
+#include "wrp_sem.hpp"
+#include "lib_error.h"
+#include "hw_timer.h"
+
+//------------------------------------------------------------------------------
+//                     CountedSemaphore Class - wraps uCOS Semaphore
+//------------------------------------------------------------------------------
+#if OS_SEM_EN
+cCountedSemaphore::cCountedSemaphore(WORD Value)
+{
+	m_OsEvent=::OSSemCreate(Value);
+	if(!m_OsEvent)UCOSII_RES_EXCEPTION;//Exception - when there is not uCOS-II event blocks availiable (uCOS-II resources are not availaible) 
+}//cCountedSemaphore::cCountedSemaphore
+
+
+BYTE cCountedSemaphore::Acquire(WORD TimeOut)
+{
+   BYTE Result;
+
+   if(TimeOut==OS_INFINITE)
+      {
+      ::OSSemPend(m_OsEvent,0x0000,&Result);//for uCOS-II the value 0x0000 means infinite
+      return Result;
+      }
+   else if(TimeOut==OS_NO_WAIT)
+      {
+      if(Accept()) //if semaphore can be accepted
+         return OS_NO_ERR;
+      else //semaphore is not availiable
+         return OS_TIMEOUT;
+      }
+   else
+      {
+      ::OSSemPend(m_OsEvent,TimeOut,&Result);
+      return Result;
+      }
+}//take semaphore with error
+#endif //OS_SEM_EN
+
+//------------------------------------------------------------------------------
+//                     Mutex Class - wraps uCOS Mutex
+//------------------------------------------------------------------------------
+#if OS_MUTEX_EN
+cMutex::cMutex(BYTE Pip)
+{
+	BYTE Result;
+	
+	m_OsEvent=::OSMutexCreate(Pip,&Result);
+	//Exception - when there is not uCOS-II event blocks availiable or Pip is already used
+	if(!m_OsEvent)UCOSII_RES_EXCEPTION;
+	m_Status.mAcquired=0;
+	m_Status.mContended=0;
+	m_Status.mMaxHoldTime=0;
+	m_AcquireTime=0;
+}//cMutex::cMutex
+
+BYTE cMutex::Acquire(WORD TimeOut)
+{
+	BYTE Result;
+	BOOL Contended=FALSE;//set when mutex is owned by other task
+	OS_CPU_SR  cpu_sr;//required by OS_ENTER_CRITICAL/OS_EXIT_CRITICAL
+
+	if(!::OSMutexAccept(m_OsEvent,&Result))
+	{
+		if(Result!=OS_NO_ERR) return Result;
+		if(TimeOut==OS_NO_WAIT) return OS_TIMEOUT;//mutex is not availiable
+		Contended=TRUE;
+		::OSMutexPend(m_OsEvent,(TimeOut==OS_INFINITE)?0x0000:TimeOut,&Result);//for uCOS-II the value 0x0000 means infinite
+		if(Result!=OS_NO_ERR) return Result;
+	}
+	//statistic is updated by the owner only so it does not need any other protection
+	m_Status.mAcquired++;
+	if(Contended) m_Status.mContended++;
+	OS_ENTER_CRITICAL();//time stamp must be taken with interrupts disabled
+	m_AcquireTime=GetTimer3TimeStamp();
+	OS_EXIT_CRITICAL();
+	return OS_NO_ERR;
+}//cMutex::Acquire
+
+BYTE cMutex::Release()
+{
+	DWORD HoldTime;
+	OS_CPU_SR  cpu_sr;//required by OS_ENTER_CRITICAL/OS_EXIT_CRITICAL
+
+	OS_ENTER_CRITICAL();//time stamp must be taken with interrupts disabled
+	HoldTime=GetTimer3TimeStamp()-m_AcquireTime;
+	OS_EXIT_CRITICAL();
+	if(HoldTime>m_Status.mMaxHoldTime) m_Status.mMaxHoldTime=HoldTime;
+	return ::OSMutexPost(m_OsEvent);
+}//cMutex::Release
+
+void cMutex::GetStatus(sMutexStatus& rStatus)
+{
+	OS_CPU_SR  cpu_sr;//required by OS_ENTER_CRITICAL/OS_EXIT_CRITICAL
+	
+	OS_ENTER_CRITICAL();//statistic is not changed by the owner in the meantime
+	rStatus=m_Status;
+	OS_EXIT_CRITICAL();
+}//cMutex::GetStatus
+#endif //OS_MUTEX_EN
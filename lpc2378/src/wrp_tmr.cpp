@@ -0,0 +1,60 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        wrp_tmr.cpp
+* Description: objective wrapper to uCOS-II - software timers
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* Note:
+* History:
+*              17-Oct-2026 - Initial version created
+*********************************************************************************************************
+*/
+#include "wrp_tmr.hpp"
+#include "lib_error.h"
+
+//------------------------------------------------------------------------------
+//                     Timer Class - wraps uCOS software timer
+//------------------------------------------------------------------------------
+#if OS_TMR_EN
+cTimer::cTimer(WORD Period, BYTE Opt, WORD Delay)
+{
+	BYTE Result;
+	
+	m_pOsTmr=::OSTmrCreate(Delay,Period,Opt,Callback,static_cast<void*>(this),&Result);
+	if(!m_pOsTmr)UCOSII_RES_EXCEPTION;//Exception - when there is not uCOS-II timer availiable or wrong timer setup
+}//cTimer::cTimer
+
+BYTE cTimer::Start()
+{
+	BYTE Result;
+	
+	::OSTmrStart(m_pOsTmr,&Result);
+	return Result;
+}//cTimer::Start
+
+BYTE cTimer::Stop()
+{
+	BYTE Result;
+	
+	::OSTmrStop(m_pOsTmr,OS_TMR_OPT_NONE,&Result);
+	return Result;
+}//cTimer::Stop
+
+DWORD cTimer::Remain()
+{
+	BYTE Result;
+	
+	return ::OSTmrRemainGet(m_pOsTmr,&Result);
+}//cTimer::Remain
+
+void cTimer::Callback(void* pOsTmr, void* pArg)
+{
+	static_cast<cTimer*>(pArg)->Expired();
+}//cTimer::Callback
+#endif //OS_TMR_EN
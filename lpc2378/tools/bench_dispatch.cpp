@@ -0,0 +1,277 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        bench_dispatch.cpp
+* Description: Host benchmark of the notifier dispatching (make host_bench)
+*              Links the same uCOS-II, middleware and drivers as Wall-e host simulation with own publishers
+*              and subscribers instead of Wall-e managers.
+*              Every measurement is made for the event driven dispatcher (publisher wakes the dispatcher up,
+*              all send queues drained) and for the former dispatcher emulated by a highest priority task
+*              which every OS tick takes at most one notifier from every send queue (publishers are not
+*              connected to Kernel dispatcher then).
+*              Latency - Post() to Receive() latency percentiles of notifiers posted at random moments
+*              between ticks.
+*              Throughput - notifiers/s received from every of publishers which post bursts of notifiers
+*              every tick and from single publisher which posts notifiers all the time.
+*              Usage: bench_dispatch
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+* 17-Oct-2026 Former dispatcher emulated by cBenchFormerDispatcher, throughput measurement
+*********************************************************************************************************
+*/
+
+#include "wrp_kernel.hpp"
+#include "mng.hpp"
+#include "host_bench.h"
+
+//Kernel must be constructed before any other OS object (see main.cpp)
+cKernel cKernel::m_Kernel;
+
+#define BENCH_NOTIFIER			NT_ID31 //notifier measured by the benchmark
+
+#define BENCH_LATENCY_SAMPLES	200 //number of notifiers measured in every mode
+#define BENCH_MAX_POST_DELAY_NS	((1000000000ULL/OS_TICKS_PER_SEC)*3/4) //notifier is posted random time after the tick
+
+#define BENCH_BURST_PUBLISHERS	3 //number of publishers posting bursts of notifiers
+#define BENCH_BURST_SIZE		8 //number of notifiers posted every tick by burst publisher (its send queue size)
+#define BENCH_BURST_TICKS		OS_TICKS_PER_SEC //burst throughput measurement time
+#define BENCH_FLOOD_TICKS		(OS_TICKS_PER_SEC/2) //flood throughput measurement time
+
+#define BENCH_FORMER_DISP_PRIO	6 //former dispatcher polling was done at the highest application priority
+#define BENCH_SUBSCRIBER_PRIO	10
+#define BENCH_PUBLISHER_PRIO	20 //latency publisher and benchmark control
+#define BENCH_BURST_PRIO		21 //first burst publisher priority, next ones get next priorities
+#define BENCH_FLOOD_PRIO		25
+
+#define BENCH_PUBLISHERS		(BENCH_BURST_PUBLISHERS+2) //latency, burst and flood publishers
+#define BENCH_SOURCE_LATENCY	0 //notifier source (upper byte of notifier data) - latency publisher
+#define BENCH_SOURCE_BURST		1 //first burst publisher
+#define BENCH_SOURCE_FLOOD		(BENCH_SOURCE_BURST+BENCH_BURST_PUBLISHERS)
+#define BENCH_DATA(Source,Seq)	((WORD)(((Source)<<8)|((Seq)&0xFF)))
+
+static volatile BOOL PollingMode;//TRUE - former dispatcher emulated
+static volatile BOOL Bursting;//TRUE - burst publishers post
+static volatile BOOL Flooding;//TRUE - flood publisher posts
+static cBasePublisher* BenchPublisher[BENCH_PUBLISHERS];//publishers polled by former dispatcher
+static unsigned long long PostNs[BENCH_LATENCY_SAMPLES];//time when notifier of given sequence number was posted
+static unsigned long long ReceiveNs[BENCH_LATENCY_SAMPLES];//time when notifier of given sequence number was received
+static volatile DWORD Received[BENCH_PUBLISHERS];//number of received notifiers of every source
+
+//connect all benchmark publishers to Kernel dispatcher or disconnect them for former dispatcher
+static void SetPollingMode(BOOL InPollingMode)
+{
+	BYTE i;
+
+	for(i=0;i<BENCH_PUBLISHERS;i++)
+		BenchPublisher[i]->SetDispatcher(InPollingMode ? static_cast<cBaseDispatcher*>(NULL) : static_cast<cBaseDispatcher*>(&Kernel.Dispatcher));
+	PollingMode=InPollingMode;
+}//SetPollingMode
+
+//former dispatcher - every OS tick takes at most one notifier from every publisher send queue
+class cBenchFormerDispatcher: public cThread
+{
+	OS_STK m_ThreadStack[OS_TASK_STACK_SIZE];
+	virtual void Run();
+public:
+	cBenchFormerDispatcher(){Create((OS_STK *)&m_ThreadStack[0],(OS_STK *)&m_ThreadStack[OS_TASK_STACK_SIZE-1],BENCH_FORMER_DISP_PRIO);};
+};
+
+void cBenchFormerDispatcher::Run()
+{
+	BYTE i;
+	cNotifier* pNotifier;
+
+	for(;;)
+	{
+		Delay(1);
+		for(i=0;PollingMode && (i<BENCH_PUBLISHERS);i++)
+		{
+			pNotifier=static_cast<cNotifier*>(BenchPublisher[i]->GetSendQueue()->Accept());
+			if(pNotifier)
+			{
+				Kernel.Dispatcher.DirectDispatch(pNotifier);
+				pNotifier->Dec();//not kept in send queue any longer
+			}
+		}
+	}
+}//cBenchFormerDispatcher::Run
+
+//counts received notifiers and stores receive time of latency ones
+class cBenchSubscriber: public cMngBaseSubscriber<BENCH_LATENCY_SAMPLES,OS_TASK_STACK_SIZE,BENCH_SUBSCRIBER_PRIO>
+{
+	virtual void Run();
+};
+
+void cBenchSubscriber::Run()
+{
+	cSmartPtr<cTypeNotifier<WORD> > pNotifier;
+	WORD Data;
+
+	for(;;)
+	{
+		pNotifier = Receive();
+		if(!pNotifier.isValid())
+			continue;
+		Data=pNotifier->GetData();
+		if((Data>>8) < BENCH_PUBLISHERS)
+			Received[Data>>8]++;
+		if(((Data>>8)==BENCH_SOURCE_LATENCY) && ((Data&0xFF) < BENCH_LATENCY_SAMPLES))
+			ReceiveNs[Data&0xFF]=BenchNs();
+	}
+}//cBenchSubscriber::Run
+
+//posts BENCH_BURST_SIZE notifiers every tick
+template <BYTE Prio>
+class cBenchBurstPublisher: public cMngBasePublisher<BENCH_BURST_SIZE,OS_TASK_STACK_SIZE,Prio>
+{
+	virtual void Run();
+};
+
+template <BYTE Prio>
+void cBenchBurstPublisher<Prio>::Run()
+{
+	BYTE i;
+
+	for(;;)
+	{
+		this->Delay(1);
+		for(i=0;Bursting && (i<BENCH_BURST_SIZE);i++)
+		{
+			cSmartPtr<cTypeNotifier<WORD> > pNotifier = new cTypeNotifier<WORD>(BENCH_NOTIFIER,this->GetThreadId(),NT_HND_NORMAL_PRT);
+			pNotifier->GetData()=BENCH_DATA(BENCH_SOURCE_BURST+Prio-BENCH_BURST_PRIO,i);
+			this->Post(pNotifier);
+		}
+	}
+}//cBenchBurstPublisher::Run
+
+//posts notifiers as fast as possible and waits a tick only when its send queue is full
+class cBenchFloodPublisher: public cMngBasePublisher<BENCH_BURST_SIZE,OS_TASK_STACK_SIZE,BENCH_FLOOD_PRIO>
+{
+	virtual void Run();
+};
+
+void cBenchFloodPublisher::Run()
+{
+	for(;;)
+	{
+		Delay(1);
+		while(Flooding)
+		{
+			cSmartPtr<cTypeNotifier<WORD> > pNotifier = new cTypeNotifier<WORD>(BENCH_NOTIFIER,GetThreadId(),NT_HND_NORMAL_PRT);
+			pNotifier->GetData()=BENCH_DATA(BENCH_SOURCE_FLOOD,0);
+			if(Post(pNotifier)!=OS_NO_ERR)
+				Delay(1);
+		}
+	}
+}//cBenchFloodPublisher::Run
+
+//posts latency notifiers, controls other publishers and reports the results
+class cBenchPublisher: public cMngBasePublisher<8,OS_TASK_STACK_SIZE,BENCH_PUBLISHER_PRIO>
+{
+	void MeasureLatency(void);
+	void MeasureThroughput(void);
+	virtual void Run();
+};
+
+void cBenchPublisher::MeasureLatency(void)
+{
+	WORD Seq;
+	unsigned long long Latency[BENCH_LATENCY_SAMPLES];
+
+	for(Seq=0;Seq<BENCH_LATENCY_SAMPLES;Seq++)
+	{
+		ReceiveNs[Seq]=0;
+		Delay(1);//synchronize to the tick and post random time after it
+		BenchSpinNs((BENCH_MAX_POST_DELAY_NS*(rand()%1000))/1000);
+		cSmartPtr<cTypeNotifier<WORD> > pNotifier = new cTypeNotifier<WORD>(BENCH_NOTIFIER,GetThreadId(),NT_HND_NORMAL_PRT);
+		pNotifier->GetData()=BENCH_DATA(BENCH_SOURCE_LATENCY,Seq);
+		PostNs[Seq]=BenchNs();
+		Post(pNotifier);
+	}
+	Delay(2);//let the last notifier be received
+
+	for(Seq=0;Seq<BENCH_LATENCY_SAMPLES;Seq++)
+		Latency[Seq]=ReceiveNs[Seq] ? (ReceiveNs[Seq]-PostNs[Seq]) : 0;
+	BenchSort(Latency,BENCH_LATENCY_SAMPLES);
+	printf("%-28s p50 %8llu us   p99 %8llu us   max %8llu us\n",
+			PollingMode ? "latency former dispatcher:" : "latency event driven:",
+			BenchPercentile(Latency,BENCH_LATENCY_SAMPLES,50)/BENCH_NS_PER_US,
+			BenchPercentile(Latency,BENCH_LATENCY_SAMPLES,99)/BENCH_NS_PER_US,
+			Latency[BENCH_LATENCY_SAMPLES-1]/BENCH_NS_PER_US);
+}//cBenchPublisher::MeasureLatency
+
+void cBenchPublisher::MeasureThroughput(void)
+{
+	BYTE i;
+	unsigned long long Start,Time;
+
+	for(i=0;i<BENCH_PUBLISHERS;i++)
+		Received[i]=0;
+	Start=BenchNs();
+	Bursting=TRUE;
+	Delay(BENCH_BURST_TICKS);
+	Bursting=FALSE;
+	Time=BenchNs()-Start;
+	Delay(2);//let the last burst be received
+	printf("%-28s",PollingMode ? "burst former dispatcher:" : "burst event driven:");
+	for(i=0;i<BENCH_BURST_PUBLISHERS;i++)
+		printf(" P%d %6llu/s ",i+1,(Received[BENCH_SOURCE_BURST+i]*1000000000ULL)/Time);
+	printf("\n");
+
+	Start=BenchNs();
+	Flooding=TRUE;
+	Delay(BENCH_FLOOD_TICKS);
+	Flooding=FALSE;
+	Time=BenchNs()-Start;
+	Delay(2);
+	printf("%-28s P1 %8llu/s\n",PollingMode ? "flood former dispatcher:" : "flood event driven:",
+			(Received[BENCH_SOURCE_FLOOD]*1000000000ULL)/Time);
+}//cBenchPublisher::MeasureThroughput
+
+void cBenchPublisher::Run()
+{
+	Delay(OS_TICKS_PER_SEC);//dispatcher thread starts dispatching after head and arms are positioned
+	printf("Post to Receive latency of %d notifiers (OS tick %d ms)\n",BENCH_LATENCY_SAMPLES,1000/OS_TICKS_PER_SEC);
+	SetPollingMode(TRUE);
+	MeasureLatency();
+	SetPollingMode(FALSE);
+	MeasureLatency();
+	printf("Throughput of %d publishers posting %d notifiers every tick and of publisher posting all the time\n",
+			BENCH_BURST_PUBLISHERS,BENCH_BURST_SIZE);
+	SetPollingMode(TRUE);
+	MeasureThroughput();
+	SetPollingMode(FALSE);
+	MeasureThroughput();
+	exit(EXIT_SUCCESS);
+}//cBenchPublisher::Run
+
+cBenchFormerDispatcher					BenchFormerDispatcher;
+cBenchSubscriber 						BenchSubscriber;
+cBenchPublisher 						BenchLatencyPublisher;
+cBenchBurstPublisher<BENCH_BURST_PRIO> 		BenchBurstPublisher1;
+cBenchBurstPublisher<BENCH_BURST_PRIO+1> 	BenchBurstPublisher2;
+cBenchBurstPublisher<BENCH_BURST_PRIO+2> 	BenchBurstPublisher3;
+cBenchFloodPublisher					BenchFloodPublisher;
+
+int	main (void)
+{
+	BYTE i;
+
+	BenchPublisher[BENCH_SOURCE_LATENCY]=&BenchLatencyPublisher;
+	BenchPublisher[BENCH_SOURCE_BURST]=&BenchBurstPublisher1;
+	BenchPublisher[BENCH_SOURCE_BURST+1]=&BenchBurstPublisher2;
+	BenchPublisher[BENCH_SOURCE_BURST+2]=&BenchBurstPublisher3;
+	BenchPublisher[BENCH_SOURCE_FLOOD]=&BenchFloodPublisher;
+	for(i=0;i<BENCH_PUBLISHERS;i++)
+		Kernel.Dispatcher.RegisterPublisher(*BenchPublisher[i]);
+	Kernel.Dispatcher.RegisterSubscriber(BenchSubscriber,BENCH_NOTIFIER);
+	Kernel.Start();
+	return 0;
+}
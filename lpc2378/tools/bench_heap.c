@@ -0,0 +1,308 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        bench_heap.c
+* Description: Host benchmark of the heap allocator (make host_bench)
+*              Replays allocation traces on TLSF allocator of lib_memalloc.c and on the former first fit
+*              allocator (bench_heap_ff.c) with the same heap size. Reports host CPU cycles of malloc and
+*              free calls (p50, p99, max), worst fragmentation seen during the replay
+*              (1 - largest free block / free bytes) and failed allocations.
+*              Every trace is replayed BENCH_REPLAYS times and cycles of the call are the minimum of its
+*              replays so host preemption and interrupts (which hit a single replay) are not in the results
+*              and max is the worst case call of the trace.
+*              Synthetic traces are generated by deterministic pseudo random generator so every run and
+*              every allocator gets the same sequence:
+*              notifiers - short living 16..64 byte blocks
+*              graphics - mix of short living small blocks, text and window buffers and long living bitmaps
+*              fragmenting - long living small blocks interleaved with short living medium ones
+*              Trace recorded by Wall-e host build is replayed when its file is given (WALLE_HEAP_TRACE
+*              environment variable of .host/walle names the file, see HostHeapTrace).
+*              Largest free block is the size reported by largestfree() of the allocator.
+*              After every trace malloc(largestfree()) must succeed on TLSF heap.
+*              Usage: bench_heap [recorded trace file]
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+* 17-Oct-2026 Worst case measured as the maximum of per call minimums of replays, added recorded trace replay
+*********************************************************************************************************
+*/
+
+#include "type.h"
+#include "lib_memalloc.h"
+#include "host_bench.h"
+#include "bench_heap_ff.h"
+
+#define BENCH_HEAP_SIZE		0x10000 //the same as .heap of Lpc2378-host.cmd
+#define BENCH_TRACE_OPS		20000 //number of malloc and free calls of the trace
+#define BENCH_MAX_LIVE		512 //max number of allocated blocks
+#define BENCH_FRAG_PERIOD	64 //fragmentation checked every BENCH_FRAG_PERIOD operations
+#define BENCH_PAGE_SIZE		4096 //host memory page size
+#define BENCH_REPLAYS		7 //replays of the trace, every call cycles are the minimum of its replays
+
+//class of the allocated block in the trace
+typedef struct
+{
+	unsigned int mMinSize;
+	unsigned int mMaxSize;
+	unsigned int mWeight;//probability weight of the class
+	unsigned int mKeep;//1 of mKeep free attempts releases block of that class (1 - short living)
+} sBenchClass;
+
+typedef struct
+{
+	const char *mName;
+	unsigned int mLiveBytes;//allocations stop when more than that is allocated
+	const sBenchClass *pClass;
+	int mClassNo;
+} sBenchTrace;
+
+//trace operation - allocation of mSize bytes into mSlot or release of mSlot when mSize is 0
+typedef struct
+{
+	unsigned short mSlot;
+	unsigned short mSize;
+} sBenchOp;
+
+static const sBenchClass NotifierClass[]={{16,64,1,1}};
+static const sBenchClass GraphicsClass[]={{16,64,70,1},{100,400,25,2},{1000,4000,5,16}};
+static const sBenchClass FragmentingClass[]={{16,32,50,64},{200,600,50,1}};
+
+static const sBenchTrace Trace[]=
+{
+	{"notifiers",8000,NotifierClass,1},
+	{"graphics",40000,GraphicsClass,3},
+	{"fragmenting",40000,FragmentingClass,2},
+};
+
+typedef struct
+{
+	const char *mName;
+	void (*pInit)(void);
+	void* (*pMalloc)(size_t nbytes);
+	void (*pFree)(void *ap);
+	unsigned int (*pFreeLeft)(void);
+	unsigned int (*pLargestFree)(void);
+} sBenchAllocator;
+
+static unsigned long long FfHeapArea[BENCH_HEAP_SIZE/sizeof(unsigned long long)];
+
+static void FfInit(void)
+{
+	ff_i_alloc(FfHeapArea,sizeof(FfHeapArea));
+}
+
+static const sBenchAllocator Allocator[]=
+{
+	{"TLSF",i_alloc,malloc,free,freeleft,largestfree},
+	{"first fit",FfInit,ff_malloc,ff_free,ff_freeleft,ff_largestfree},
+};
+
+static sBenchOp Op[BENCH_TRACE_OPS];
+static int OpNo;
+static unsigned long long OpCycles[BENCH_TRACE_OPS];//minimum cycles of the operation in all replays
+static unsigned long long MallocCycles[BENCH_TRACE_OPS];
+static unsigned long long FreeCycles[BENCH_TRACE_OPS];
+static unsigned int Seed;
+
+//deterministic pseudo random generator so traces do not depend on C library
+static unsigned int BenchRand(void)
+{
+	Seed=Seed*1103515245+12345;
+	return (Seed>>8)&0xFFFFFF;
+}//BenchRand
+
+//generate operations of the trace
+static void GenerateTrace(const sBenchTrace *pTrace)
+{
+	unsigned short Size[BENCH_MAX_LIVE];//size of the block allocated in the slot (0 - slot free)
+	unsigned char Class[BENCH_MAX_LIVE];
+	unsigned int Live=0,LiveBytes=0,Weights=0,Pick;
+	int i,Slot,Try;
+
+	for(i=0;i<pTrace->mClassNo;i++)
+		Weights+=pTrace->pClass[i].mWeight;
+	for(i=0;i<BENCH_MAX_LIVE;i++)
+		Size[i]=0;
+	Seed=1;
+	for(OpNo=0;OpNo<BENCH_TRACE_OPS;OpNo++)
+	{
+		if(Live && ((LiveBytes>pTrace->mLiveBytes) || (Live>=BENCH_MAX_LIVE) || (BenchRand()&1)))
+		{//release - long living blocks survive most of release attempts
+			for(Try=0;;Try++)
+			{
+				Slot=BenchRand()%BENCH_MAX_LIVE;
+				if(Size[Slot] && ((Try>4*BENCH_MAX_LIVE) || !(BenchRand()%pTrace->pClass[Class[Slot]].mKeep)))
+					break;
+			}
+			Op[OpNo].mSlot=Slot;
+			Op[OpNo].mSize=0;
+			LiveBytes-=Size[Slot];
+			Size[Slot]=0;
+			Live--;
+		}
+		else
+		{
+			for(Slot=0;Size[Slot];Slot++);
+			Pick=BenchRand()%Weights;
+			for(i=0;Pick>=pTrace->pClass[i].mWeight;i++)
+				Pick-=pTrace->pClass[i].mWeight;
+			Class[Slot]=i;
+			Size[Slot]=pTrace->pClass[i].mMinSize+BenchRand()%(pTrace->pClass[i].mMaxSize-pTrace->pClass[i].mMinSize+1);
+			Op[OpNo].mSlot=Slot;
+			Op[OpNo].mSize=Size[Slot];
+			LiveBytes+=Size[Slot];
+			Live++;
+		}
+	}
+}//GenerateTrace
+
+//read trace recorded by HostHeapTrace - recorded addresses are mapped to slots
+static BOOL ReadTrace(const char *pFileName)
+{
+	FILE *pFile=fopen(pFileName,"r");
+	void *pAddress[BENCH_MAX_LIVE];//recorded address of the block allocated in the slot (NULL - slot free)
+	void *pBlock;
+	unsigned int Size;
+	char Call;
+	int Slot;
+
+	if(!pFile)
+		return FALSE;
+	for(Slot=0;Slot<BENCH_MAX_LIVE;Slot++)
+		pAddress[Slot]=NULL;
+	OpNo=0;
+	while((OpNo<BENCH_TRACE_OPS) && (fscanf(pFile," %c %p",&Call,&pBlock)==2))
+	{
+		if(Call=='m')
+		{
+			if((fscanf(pFile,"%u",&Size)!=1) || !Size || (Size>0xFFFF))
+				break;
+			for(Slot=0;(Slot<BENCH_MAX_LIVE) && pAddress[Slot];Slot++);
+			if(Slot==BENCH_MAX_LIVE)
+				break;//trace has more live blocks than the benchmark
+			pAddress[Slot]=pBlock;
+			Op[OpNo].mSize=Size;
+		}
+		else
+		{
+			for(Slot=0;(Slot<BENCH_MAX_LIVE) && (pAddress[Slot]!=pBlock);Slot++);
+			if(Slot==BENCH_MAX_LIVE)
+				continue;//block allocated before recording was started
+			pAddress[Slot]=NULL;
+			Op[OpNo].mSize=0;
+		}
+		Op[OpNo++].mSlot=Slot;
+	}
+	fclose(pFile);
+	return OpNo>0;
+}//ReadTrace
+
+//replay trace once - cycles of every call are reduced to OpCycles
+static void ReplayOnce(const sBenchAllocator *pAllocator,unsigned int *pMaxFrag,int *pFailed)
+{
+	void *pSlot[BENCH_MAX_LIVE];
+	int i;
+	unsigned long long Start,Cycles;
+	unsigned int Frag,FreeLeft;
+	void *pLargest;
+
+	for(i=0;i<BENCH_MAX_LIVE;i++)
+		pSlot[i]=NULL;
+	pAllocator->pInit();
+	//touch whole heap so host page faults are not measured
+	FreeLeft=pAllocator->pLargestFree();
+	pLargest=pAllocator->pMalloc(FreeLeft);
+	for(i=0;i<FreeLeft;i+=BENCH_PAGE_SIZE)
+		((char*)pLargest)[i]=0;
+	pAllocator->pFree(pLargest);
+	for(i=0;i<OpNo;i++)
+	{
+		Cycles=~0ULL;//no call when released slot was not allocated
+		if(Op[i].mSize)
+		{
+			Start=BenchCycles();
+			pSlot[Op[i].mSlot]=pAllocator->pMalloc(Op[i].mSize);
+			Cycles=BenchCycles()-Start;
+			if(!pSlot[Op[i].mSlot])(*pFailed)++;
+		}
+		else if(pSlot[Op[i].mSlot])
+		{
+			Start=BenchCycles();
+			pAllocator->pFree(pSlot[Op[i].mSlot]);
+			Cycles=BenchCycles()-Start;
+			pSlot[Op[i].mSlot]=NULL;
+		}
+		if(Cycles<OpCycles[i])OpCycles[i]=Cycles;
+		if(!(i%BENCH_FRAG_PERIOD) && (FreeLeft=pAllocator->pFreeLeft()))
+		{//fragmentation in 0.1% units
+			Frag=1000-(unsigned int)((1000ULL*pAllocator->pLargestFree())/FreeLeft);
+			if(Frag>*pMaxFrag)*pMaxFrag=Frag;
+		}
+	}
+}//ReplayOnce
+
+//replay trace on the allocator BENCH_REPLAYS times and print the results
+static void ReplayTrace(const sBenchAllocator *pAllocator)
+{
+	int i,MallocNo=0,FreeNo=0,Failed=0;
+	unsigned int MaxFrag=0;
+	void *pLargest;
+
+	for(i=0;i<OpNo;i++)
+		OpCycles[i]=~0ULL;
+	for(i=0;i<BENCH_REPLAYS;i++)
+		ReplayOnce(pAllocator,&MaxFrag,&Failed);
+	for(i=0;i<OpNo;i++)
+	{
+		if(Op[i].mSize)
+			MallocCycles[MallocNo++]=OpCycles[i];
+		else if(OpCycles[i]!=~0ULL)//release of the slot which was not allocated is not a call
+			FreeCycles[FreeNo++]=OpCycles[i];
+	}
+	Failed/=BENCH_REPLAYS;
+	BenchSort(MallocCycles,MallocNo);
+	BenchSort(FreeCycles,FreeNo);
+	printf("  %-10s malloc %5llu %6llu %7llu   free %5llu %6llu %7llu   frag %2u.%u%%   failed %d\n",pAllocator->mName,
+			BenchPercentile(MallocCycles,MallocNo,50),BenchPercentile(MallocCycles,MallocNo,99),MallocCycles[MallocNo-1],
+			BenchPercentile(FreeCycles,FreeNo,50),BenchPercentile(FreeCycles,FreeNo,99),FreeCycles[FreeNo-1],
+			MaxFrag/10,MaxFrag%10,Failed);
+
+	if(pAllocator->pMalloc==malloc)
+	{//the largest free block reported by largestfree() must be allocated (exception otherwise)
+		pLargest=malloc(largestfree());
+		free(pLargest);
+	}
+}//ReplayTrace
+
+int main(int argc, char *argv[])
+{
+	unsigned int i,j;
+
+	printf("Heap %d bytes, up to %d operations per trace, host cycles p50 p99 max (minimum of %d replays), worst fragmentation\n",
+			BENCH_HEAP_SIZE,BENCH_TRACE_OPS,BENCH_REPLAYS);
+	for(i=0;i<sizeof(Trace)/sizeof(Trace[0]);i++)
+	{
+		GenerateTrace(&Trace[i]);
+		printf("%s:\n",Trace[i].mName);
+		for(j=0;j<sizeof(Allocator)/sizeof(Allocator[0]);j++)
+			ReplayTrace(&Allocator[j]);
+	}
+	if(argc>1)
+	{
+		if(!ReadTrace(argv[1]))
+		{
+			printf("FAILED - no heap calls recorded in %s\n",argv[1]);
+			return EXIT_FAILURE;
+		}
+		printf("recorded %s (%d operations):\n",argv[1],OpNo);
+		for(j=0;j<sizeof(Allocator)/sizeof(Allocator[0]);j++)
+			ReplayTrace(&Allocator[j]);
+	}
+	return EXIT_SUCCESS;
+}
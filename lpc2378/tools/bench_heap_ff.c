@@ -0,0 +1,149 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2008, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        bench_heap_ff.c
+* Description: Former first fit heap allocator of lib_memalloc.c kept as reference for bench_heap
+*              Functions are renamed (ff_ prefix), heap is given to ff_i_alloc and allocation failure
+*              returns NULL instead of MEM_ALLOC_EXCEPTION so the benchmark can count it.
+* Author:      Bogdan Kowalczyk
+* Date:        30-Sep-2008
+* Note:
+* 	Based on the source code from article "memory allocation in C"
+*   by Leslie Aldridge avaliable on embedded.com
+* History:
+*              30-Sep-2008 - Initial version created
+* 				2-Nov-2008 - Added critical mem exception generation when allocations fail
+* 			   17-Oct-2026 - Copied from lib_memalloc.c for host benchmark, added ff_largestfree()
+*********************************************************************************************************
+*/
+
+#include <stddef.h>
+#include "bench_heap_ff.h"
+
+//HEADER occupy 8 bytes on ARM (16 bytes on 64 bit host)
+typedef struct hdr {
+	struct hdr	*ptr; //pointer to other free blocks (NULL if there are not any free blocks - end of free block list)
+	unsigned int size; //size of allocated space in HEADER size units
+} HEADER;
+
+static HEADER 	*frhd=NULL; //head of the list of free blocks
+static volatile unsigned int	memleft;	/* memory left on the heap in HEADER size units*/
+
+unsigned int ff_freeleft(void)
+{
+	return  memleft*sizeof(HEADER);//calculate number of free bytes on the heap
+}//ff_freeleft
+
+//size of the largest free block user area in bytes
+unsigned int ff_largestfree(void)
+{
+	HEADER *nxt;
+	unsigned int Largest=0;
+
+	for(nxt=frhd;nxt;nxt=nxt->ptr)
+		if(nxt->size>Largest)Largest=nxt->size;
+	return Largest ? (Largest-1)*sizeof(HEADER) : 0;
+}//ff_largestfree
+
+void ff_free(void *ap)
+{
+	HEADER *nxt, *prev=NULL, *f;
+
+	f = (HEADER *)ap - 1;	/* Point to header of block being returned. */
+	memleft += f->size;
+
+	if(frhd==NULL)//NULL here means all heap is allocated
+	{//returned block will be the only on free list
+		frhd=f;
+		f->ptr=NULL;
+		return;
+	}
+
+	if (frhd > f)
+	{
+		/* Free-space head is higher up in memory than returnee. */
+		nxt = frhd; 	/* old head */
+		frhd = f; 	/* new head */
+		prev = f + f->size; 	/* right after new head */
+		if (prev==nxt)  /* Old and new are contiguous. */
+		{
+			f->size += nxt->size;
+			f->ptr = nxt->ptr; 	/* Form one block. */
+		}
+		else
+		{
+			f->ptr = nxt;
+		}
+		return;
+	}
+
+	/*	Otherwise, current free-space head is lower in memory. Walk down free-space list looking for the block being returned. */
+	for (nxt=frhd; nxt && nxt < f; prev=nxt,nxt=nxt->ptr)
+	{
+		if (nxt+nxt->size == f)
+		{
+			nxt->size += f->size; 	/* They're contiguous. */
+			f = nxt + nxt->size; 	/* Form one block. */
+			if (f==nxt->ptr)
+			{
+				nxt->size += f->size;
+				nxt->ptr = f->ptr;
+			}
+			return;
+		}
+	}
+
+	prev->ptr = f; 	/* link to queue */
+	prev = f + f->size; 	/* right after space to free */
+	if (prev == nxt) 	/* 'f' and 'nxt' are contiguous. */
+	{
+		f->size += nxt->size;
+		f->ptr = nxt->ptr; 	/* Form a larger, contiguous block. */
+	}
+	else
+		f->ptr = nxt;
+}//ff_free
+
+void *ff_malloc(size_t nbytes)
+{
+	HEADER *nxt, *prev;
+	unsigned int nunits;
+
+	if (!nbytes) return NULL;
+
+	nunits = (nbytes+sizeof(HEADER)-1) / sizeof(HEADER) + 1;
+
+	for (prev=NULL,nxt=frhd; nxt; prev=nxt,nxt = nxt->ptr)
+	{
+		if (nxt->size >= nunits) 	/* big enough */
+		{
+			if (nxt->size > nunits) //if free block avaliable is larger than requested block
+			{
+				nxt->size -= nunits; 	/* Allocate requested block from the avalilable free block end. */
+				nxt += nxt->size;
+				nxt->size = nunits;
+			}
+			else //requested size in HEADER units exactly correspond to the released block
+			{
+				if (prev==NULL) frhd = nxt->ptr;
+				else prev->ptr = nxt->ptr;
+			}
+			memleft -= nunits;
+			return((void *)(nxt+1));
+		}
+	}
+	return(NULL);//memory cannot be allocated
+}//ff_malloc
+
+void ff_i_alloc(void *pHeap,size_t Size)
+{
+	frhd = (HEADER*)pHeap; 	/* Initialize the allocator. */
+	frhd->ptr = NULL;
+	frhd->size = Size / sizeof(HEADER);
+	memleft = frhd->size; 	/* initial size in HEADER size units */
+}//ff_i_alloc
@@ -0,0 +1,34 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        bench_heap_ff.h
+* Description: Former first fit heap allocator used as reference by bench_heap (see bench_heap_ff.c)
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#ifndef BENCH_HEAP_FF_H_
+#define BENCH_HEAP_FF_H_
+
+#include <stddef.h>
+
+//initialize heap of Size bytes at pHeap (must be aligned to pointer size)
+extern void ff_i_alloc(void *pHeap,size_t Size);
+//allocate nbytes, NULL when there is no large enough free block
+extern void *ff_malloc(size_t nbytes);
+//release memory allocated by ff_malloc
+extern void ff_free(void *ap);
+//number of free bytes
+extern unsigned int ff_freeleft(void);
+//the largest number of bytes which can be allocated by one ff_malloc call
+extern unsigned int ff_largestfree(void);
+
+#endif /*BENCH_HEAP_FF_H_*/
@@ -0,0 +1,110 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        bench_lcd.c
+* Description: Host benchmark of LCD frame buffer (make host_bench)
+*              Draws the same frames with ctr_lcd.h primitives sent directly to the LCD and drawn into
+*              the frame buffer of ctr_lcd_fb.c flushed after every frame. LCD SPI words are executed by
+*              the LCD controller emulator of hw_host.c. Reports SPI words of every frame for both ways.
+*              The first frame draws the whole screen, next frames change time text, icon and status
+*              line as display manager does every second.
+*              Fails when emulated LCD content drawn through the frame buffer differs from the direct one
+*              after any frame or when the frame buffer needs more SPI words in total, so it is also
+*              a regression test of the frame buffer.
+*              Usage: bench_lcd
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include "type.h"
+#include "hw_spi.h"
+#include "hw_host.h"
+#include "ctr_lcd.h"
+#include "ctr_lcd_fb.h"
+#include "host_bench.h"
+
+#define BENCH_FRAMES		8
+#define BENCH_BMP_WIDTH		16
+#define BENCH_BMP_HIGHT		16
+#define BENCH_POISON		0xA5A //color of pixels never drawn by frame buffer flush
+
+//bitmap in LCDWriteBmp format - width, hight and 12 bit packed pixels
+static unsigned char BenchBmp[2+(BENCH_BMP_WIDTH*BENCH_BMP_HIGHT*3)/2]={BENCH_BMP_WIDTH,BENCH_BMP_HIGHT};
+static WORD BenchLcd[BENCH_FRAMES][LCD_FB_SIZE][LCD_FB_SIZE];//emulated LCD after every direct frame
+static DWORD BenchWords[2][BENCH_FRAMES];//SPI words of every frame [0 direct, 1 frame buffer]
+
+static void BenchFrame(int InFrame)
+{
+	char Time[]="12:00:00";
+
+	if(InFrame==0)
+	{
+		LCDClearScreen();
+		LCDSetRect(0,0,LCD_FB_SIZE-3,LCD_FB_SIZE-1,FILL,BLUE);//window background
+		LCDSetRect(0,0,LCD_FB_SIZE-3,LCD_FB_SIZE-1,NOFILL,WHITE);//window border
+		LCDSetRect(0,0,14,LCD_FB_SIZE-1,NOFILL,WHITE);//title border
+		LCDPutStr("WALL-e",3,40,SMALL,YELLOW,BLUE);
+		LCDSetCircle(70,100,15,RED);
+		LCDSetLine(30,5,110,60,GREEN);
+	}
+	//every frame - time, blinking icon and status line
+	Time[7]='0'+InFrame%10;
+	LCDPutStr(Time,20,30,LARGE,WHITE,BLUE);
+	if(InFrame&1)
+		LCDFillRect(45,10,45+BENCH_BMP_HIGHT-1,10+BENCH_BMP_WIDTH-1,BLUE);
+	else
+		LCDWriteBmp(45,10,BenchBmp);
+	LCDPutStr((InFrame&1)?"ARS: OFF":"ARS: ON ",110,5,SMALL,WHITE,BLUE);
+}//BenchFrame
+
+int main(void)
+{
+	int Frame,Pass,x,y;
+	DWORD Words,Total[2]={0,0};
+	long Diffs=0;
+
+	for(x=2;x<(int)sizeof(BenchBmp);x++)
+		BenchBmp[x]=(unsigned char)(x*37);
+
+	//Pass 0 - direct LCD drawing, Pass 1 - frame buffer
+	for(Pass=0;Pass<2;Pass++)
+	{
+		HostFillLcd(Pass?BENCH_POISON:BLACK);
+		if(Pass)
+			LCDFbEnable();
+		for(Frame=0;Frame<BENCH_FRAMES;Frame++)
+		{
+			Words=GetLcdSpiWords();
+			BenchFrame(Frame);
+			LCDFbFlush();
+			BenchWords[Pass][Frame]=GetLcdSpiWords()-Words;
+			Total[Pass]+=BenchWords[Pass][Frame];
+			for(x=0;x<LCD_FB_SIZE;x++)
+				for(y=0;y<LCD_FB_SIZE;y++)
+				{
+					if(!Pass)
+						BenchLcd[Frame][x][y]=HostGetLcdPixel(x,y);
+					else if(BenchLcd[Frame][x][y]!=HostGetLcdPixel(x,y))
+						Diffs++;
+				}
+		}
+		LCDFbDisable();
+	}
+
+	printf("LCD SPI words of the frame (first frame draws the whole screen)\n");
+	printf("frame      direct  frame buffer\n");
+	for(Frame=0;Frame<BENCH_FRAMES;Frame++)
+		printf("%5d  %10lu    %10lu\n",Frame,(unsigned long)BenchWords[0][Frame],(unsigned long)BenchWords[1][Frame]);
+	printf("total  %10lu    %10lu\n",(unsigned long)Total[0],(unsigned long)Total[1]);
+	printf("pixels different from direct drawing %ld\n",Diffs);
+	printf("%s\n",(!Diffs && Total[1]<=Total[0])?"PASSED":"FAILED");
+	return (!Diffs && Total[1]<=Total[0])?EXIT_SUCCESS:EXIT_FAILURE;
+}//main
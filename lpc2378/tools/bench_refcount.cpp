@@ -0,0 +1,152 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        bench_refcount.cpp
+* Description: Host benchmark of notifier reference counting (make host_bench)
+*              Life cycle - notifier created by publisher, posted, dispatched to 1 and 3 subscriber threads,
+*              received and released. Reports reference counter updates per life cycle
+*              (cMemMgrBase::GetRefOpsCounter) and time of the life cycle.
+*              Inc()/Dec() pair - cost of the current critical section protected counter and of the former
+*              one protected by OS mutex (reproduced by cFormerRefCount), used to estimate former life cycle.
+*              Usage: bench_refcount
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include "wrp_kernel.hpp"
+#include "mng.hpp"
+#include "host_bench.h"
+
+//Kernel must be constructed before any other OS object (see main.cpp)
+cKernel cKernel::m_Kernel;
+
+#define BENCH_NOTIFIER			NT_ID31 //notifier measured by the benchmark
+#define BENCH_SUBSCRIBERS		3 //number of subscriber threads
+#define BENCH_CYCLES			20000 //number of measured notifier life cycles
+#define BENCH_PAIRS				200000 //number of measured Inc()/Dec() pairs
+
+#define BENCH_SUBSCRIBER_PRIO	13 //first subscriber priority, next ones get next priorities (12 is OS timer task)
+#define BENCH_PUBLISHER_PRIO	20
+
+static const BYTE BenchFanOut[]={1,BENCH_SUBSCRIBERS};//numbers of subscribers of the measured notifier
+
+//former cMemMgrBase reference counter protected by OS mutex (Kernel.MemMgrMutex)
+class cFormerRefCount
+{
+	int m_ClassRefs;
+	cMutex m_MemMgrMutex;
+public:
+	cFormerRefCount(){m_ClassRefs=0;};
+	void Inc(void){m_MemMgrMutex.Acquire();++m_ClassRefs;m_MemMgrMutex.Release();};
+	void Dec(void){m_MemMgrMutex.Acquire();--m_ClassRefs;m_MemMgrMutex.Release();};
+};
+
+static cFormerRefCount FormerRefCount;
+
+//receives notifiers the same way managers do
+template <BYTE Prio>
+class cBenchSubscriber: public cMngBaseSubscriber<4,OS_TASK_STACK_SIZE,Prio>
+{
+	virtual void Run();
+};
+
+template <BYTE Prio>
+void cBenchSubscriber<Prio>::Run()
+{
+	cSmartPtr<cTypeNotifier<WORD> > pNotifier;
+
+	for(;;)
+	{
+		pNotifier = this->Receive();
+	}
+}//cBenchSubscriber::Run
+
+cBenchSubscriber<BENCH_SUBSCRIBER_PRIO> 	BenchSubscriber1;
+cBenchSubscriber<BENCH_SUBSCRIBER_PRIO+1> 	BenchSubscriber2;
+cBenchSubscriber<BENCH_SUBSCRIBER_PRIO+2> 	BenchSubscriber3;
+static cBaseSubscriber* BenchSubscriber[BENCH_SUBSCRIBERS]={&BenchSubscriber1,&BenchSubscriber2,&BenchSubscriber3};
+
+//posts measured notifiers and reports the results
+class cBenchPublisher: public cMngBasePublisher<4,OS_TASK_STACK_SIZE,BENCH_PUBLISHER_PRIO>
+{
+	unsigned long long MeasurePair(void);
+	virtual void Run();
+};
+
+//measure Inc()/Dec() pair of current and former counter, return the difference in ps
+unsigned long long cBenchPublisher::MeasurePair(void)
+{
+	DWORD i;
+	unsigned long long Start,Current,Former;
+	cSmartPtr<cTypeNotifier<WORD> > pNotifier = new cTypeNotifier<WORD>(BENCH_NOTIFIER,GetThreadId(),NT_HND_NORMAL_PRT);
+
+	Start=BenchNs();
+	for(i=0;i<BENCH_PAIRS;i++)
+	{
+		pNotifier->Inc();
+		pNotifier->Dec();
+	}
+	Current=((BenchNs()-Start)*1000)/BENCH_PAIRS;
+	Start=BenchNs();
+	for(i=0;i<BENCH_PAIRS;i++)
+	{
+		FormerRefCount.Inc();
+		FormerRefCount.Dec();
+	}
+	Former=((BenchNs()-Start)*1000)/BENCH_PAIRS;
+	printf("Inc()/Dec() pair:  critical section %5llu ns   former OS mutex %5llu ns\n",Current/1000,Former/1000);
+	return (Former>Current) ? (Former-Current) : 0;
+}//cBenchPublisher::MeasurePair
+
+void cBenchPublisher::Run()
+{
+	BYTE i,j;
+	DWORD Cycle,RefOps;
+	unsigned long long Start,PairDelta;
+	unsigned long long Time[sizeof(BenchFanOut)/sizeof(BenchFanOut[0])];
+	DWORD Ops[sizeof(BenchFanOut)/sizeof(BenchFanOut[0])];
+
+	Delay(OS_TICKS_PER_SEC);//dispatcher thread starts dispatching after head and arms are positioned
+	for(i=0;i<sizeof(BenchFanOut)/sizeof(BenchFanOut[0]);i++)
+	{
+		for(j=0;j<BENCH_SUBSCRIBERS;j++)
+		{
+			Kernel.Dispatcher.UnregisterSubscriber(*BenchSubscriber[j]);
+			if(j<BenchFanOut[i])
+				Kernel.Dispatcher.RegisterSubscriber(*BenchSubscriber[j],BENCH_NOTIFIER);
+		}
+		Delay(1);
+		RefOps=cMemMgrBase::GetRefOpsCounter();
+		Start=BenchNs();
+		for(Cycle=0;Cycle<BENCH_CYCLES;Cycle++)
+		{//dispatcher and subscribers have higher priority so the notifier is received when Post() returns
+			cSmartPtr<cTypeNotifier<WORD> > pNotifier = new cTypeNotifier<WORD>(BENCH_NOTIFIER,GetThreadId(),NT_HND_NORMAL_PRT);
+			pNotifier->GetData()=Cycle;
+			Post(pNotifier);
+		}
+		Time[i]=((BenchNs()-Start)*1000)/BENCH_CYCLES;
+		Ops[i]=(cMemMgrBase::GetRefOpsCounter()-RefOps)/BENCH_CYCLES;
+	}
+	PairDelta=MeasurePair();
+	for(i=0;i<sizeof(BenchFanOut)/sizeof(BenchFanOut[0]);i++)
+		printf("%d subscribers:  %2u reference updates   life cycle %6llu ns   former OS mutex counter about %6llu ns\n",
+				BenchFanOut[i],(unsigned)Ops[i],Time[i]/1000,(Time[i]+(Ops[i]*PairDelta)/2)/1000);
+	exit(EXIT_SUCCESS);
+}//cBenchPublisher::Run
+
+cBenchPublisher BenchPublisher;
+
+int	main (void)
+{
+	Kernel.Dispatcher.RegisterPublisher(BenchPublisher);
+	Kernel.Start();
+	return 0;
+}
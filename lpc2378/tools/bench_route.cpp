@@ -0,0 +1,170 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        bench_route.cpp
+* Description: Host benchmark of the notifier fan-out to subscribers (make host_bench)
+*              Reports host CPU cycles per dispatched notifier when 1, 4 and 12 of NO_OF_SUBSCRIBERS
+*              registered subscribers subscribe for it (the rest subscribe for other notifier).
+*              Measured for Kernel dispatcher routing table (DirectDispatch) and for the former
+*              DispatchNotifier which scanned whole subscriber table and took the subscriber table mutex
+*              once per entry (reproduced by cFormerRouter with the same subscribers).
+*              Usage: bench_route
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include "wrp_kernel.hpp"
+#include "host_bench.h"
+
+//Kernel must be constructed before any other OS object (see main.cpp)
+cKernel cKernel::m_Kernel;
+
+#define BENCH_NOTIFIER			NT_ID31 //notifier measured by the benchmark
+#define BENCH_OTHER_NOTIFIER	NT_ID32 //notifier of subscribers not interested in the measured one
+
+#define BENCH_BATCH				16 //notifiers dispatched between draining of receive queues (receive queue size)
+#define BENCH_BATCHES			2000 //number of measured batches
+#define BENCH_ROUTER_PRIO		20
+
+static const BYTE BenchFanOut[]={1,4,NO_OF_SUBSCRIBERS};//numbers of subscribers of the measured notifier
+
+static cSubscriber<BENCH_BATCH> BenchSubscriber[NO_OF_SUBSCRIBERS];
+
+//former cDispatcher::DispatchNotifier - visits every subscriber table entry under the mutex
+class cFormerRouter
+{
+	struct sSubscriberEntry
+	{
+		cBaseSubscriber* m_pSubscriber;
+		DWORD m_NotifierIdFlags;
+		WORD m_Error_Counter;
+	};
+	sSubscriberEntry m_SubscriberTable[NO_OF_SUBSCRIBERS];
+	cMutex m_SubscriberMutex;
+public:
+	void SetSubscriber(BYTE InNo,cBaseSubscriber* pSubscriber,DWORD InNotifierIdFlags)
+	{
+		m_SubscriberTable[InNo].m_pSubscriber=pSubscriber;
+		m_SubscriberTable[InNo].m_NotifierIdFlags=InNotifierIdFlags;
+		m_SubscriberTable[InNo].m_Error_Counter=0;
+	};
+	void DispatchNotifier(cNotifier* pNotifier);
+};
+
+void cFormerRouter::DispatchNotifier(cNotifier* pNotifier)
+{
+	BYTE i;
+	BYTE Result;
+
+	for(i=0;i<NO_OF_SUBSCRIBERS;i++)
+	{
+		m_SubscriberMutex.Acquire();
+		if((m_SubscriberTable[i].m_NotifierIdFlags & (pNotifier->GetNotifierId()))&& (m_SubscriberTable[i].m_pSubscriber))
+		{
+			pNotifier->Inc();
+			if(pNotifier->GetHandling() & NT_HND_HIGH_PRT)
+				Result=((m_SubscriberTable[i].m_pSubscriber)->GetReceiveQueue())->SendFront(pNotifier);
+			else
+				Result=((m_SubscriberTable[i].m_pSubscriber)->GetReceiveQueue())->Send(pNotifier);
+			if (Result!=OS_NO_ERR)
+			{
+				m_SubscriberTable[i].m_Error_Counter += 1;
+				pNotifier->Dec();
+			}
+		}
+		m_SubscriberMutex.Release();
+	}
+}//cFormerRouter::DispatchNotifier
+
+static cFormerRouter FormerRouter;
+
+//take all notifiers out of subscribers receive queues
+static void DrainSubscribers(void)
+{
+	BYTE i;
+	cNotifier* pNotifier;
+
+	for(i=0;i<NO_OF_SUBSCRIBERS;i++)
+		while((pNotifier=static_cast<cNotifier*>(BenchSubscriber[i].GetReceiveQueue()->Accept()))!=NULL)
+			pNotifier->Dec();
+}//DrainSubscribers
+
+//subscribe InFanOut subscribers for the measured notifier in Kernel dispatcher and in former router
+static void SetFanOut(BYTE InFanOut)
+{
+	BYTE i;
+	DWORD Mask;
+
+	for(i=0;i<NO_OF_SUBSCRIBERS;i++)
+	{
+		Mask=(i<InFanOut) ? BENCH_NOTIFIER : BENCH_OTHER_NOTIFIER;
+		Kernel.Dispatcher.UnregisterSubscriber(BenchSubscriber[i]);
+		Kernel.Dispatcher.RegisterSubscriber(BenchSubscriber[i],Mask);
+		FormerRouter.SetSubscriber(i,&BenchSubscriber[i],Mask);
+	}
+}//SetFanOut
+
+class cBenchRouter: public cThread
+{
+	OS_STK m_ThreadStack[OS_TASK_STACK_SIZE];
+	unsigned long long Measure(BOOL InFormer,cNotifier* pNotifier);
+	virtual void Run();
+public:
+	cBenchRouter(){Create((OS_STK *)&m_ThreadStack[0],(OS_STK *)&m_ThreadStack[OS_TASK_STACK_SIZE-1],BENCH_ROUTER_PRIO);};
+};
+
+//return median of host cycles per notifier dispatched by former router or Kernel dispatcher
+unsigned long long cBenchRouter::Measure(BOOL InFormer,cNotifier* pNotifier)
+{
+	static unsigned long long Cycles[BENCH_BATCHES];
+	WORD Batch;
+	BYTE i;
+	unsigned long long Start;
+
+	for(Batch=0;Batch<BENCH_BATCHES;Batch++)
+	{
+		Start=BenchCycles();
+		for(i=0;i<BENCH_BATCH;i++)
+		{
+			if(InFormer)
+				FormerRouter.DispatchNotifier(pNotifier);
+			else
+				Kernel.Dispatcher.DirectDispatch(pNotifier);
+		}
+		Cycles[Batch]=(BenchCycles()-Start)/BENCH_BATCH;
+		DrainSubscribers();
+	}
+	BenchSort(Cycles,BENCH_BATCHES);
+	return BenchPercentile(Cycles,BENCH_BATCHES,50);
+}//cBenchRouter::Measure
+
+void cBenchRouter::Run()
+{
+	BYTE i;
+	cSmartPtr<cTypeNotifier<WORD> > pNotifier = new cTypeNotifier<WORD>(BENCH_NOTIFIER,GetThreadId(),NT_HND_NORMAL_PRT);
+
+	printf("Host cycles per dispatched notifier, %d subscribers registered\n",NO_OF_SUBSCRIBERS);
+	for(i=0;i<sizeof(BenchFanOut)/sizeof(BenchFanOut[0]);i++)
+	{
+		SetFanOut(BenchFanOut[i]);
+		printf("%2d subscribers:   former scan %6llu   routing table %6llu\n",BenchFanOut[i],
+				Measure(TRUE,pNotifier.operator->()),Measure(FALSE,pNotifier.operator->()));
+	}
+	exit(EXIT_SUCCESS);
+}//cBenchRouter::Run
+
+cBenchRouter BenchRouter;
+
+int	main (void)
+{
+	Kernel.Start();
+	return 0;
+}
@@ -0,0 +1,461 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        bench_seq.c
+* Description: Host benchmark of Walle Simply Sequencer interpreter (make host_bench)
+*              Runs every program of the sequence source by the former text interpreter (copy of former
+*              cExeMngr::ExeCmdSeq with ParseSeq, ExtractTokenToBuffer and FindLineNoForLabel) on its text
+*              lines and by the bytecode interpreter (the same dispatch as cExeMngr::ExeCmdSeq) on the table
+*              compiled by seqc into mng_exe_seq.h. Actions are stubs which record action ID, exe code
+*              and arguments. Reports executed actions (steps) per second of both interpreters.
+*              Fails when actions executed by both interpreters differ, so it also checks seqc output.
+*              Usage: bench_seq [source.seq] (default src/mng_exe.seq)
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include <string.h>
+#include "mng_exe_seq.h"
+#include "host_bench.h"
+
+#define BENCH_SEQ_SOURCE		"src/mng_exe.seq"
+#define BENCH_MAX_LINE			256 //max length of the source line
+#define BENCH_MAX_LINES			512 //max number of lines in one program
+#define BENCH_MAX_STEPS			4096 //max number of recorded actions of one program run
+#define BENCH_RUNS				100000 //number of measured runs of every program
+#define NO_LINE_NUMBER_FOR_LABEL	0xFFFF
+#define SEQ_ACT_NO_EXE_CODE		0xFF //line without action (former ParseSeq result)
+
+//compiled programs of mng_exe_seq.h found by the name of the source program
+typedef struct
+{
+	const char *mName;
+	const BYTE *mpProg;
+} sBenchProg;
+
+static const sBenchProg BenchProg[]=
+{
+	{"WalleTestSeqProg",WalleTestSeqProg},
+	{"WalleEnjoySeqProg",WalleEnjoySeqProg},
+};
+
+//action executed by the interpreter
+typedef struct
+{
+	BYTE mAct;
+	BYTE mExe;
+	DWORD mArg0;
+	DWORD mArg1;
+} sBenchStep;
+
+static sBenchStep Step[BENCH_MAX_STEPS];
+static int StepNo;
+
+static void Record(BYTE InAct, BYTE InExe, DWORD InArg0, DWORD InArg1)
+{
+	if(StepNo<BENCH_MAX_STEPS)
+	{
+		Step[StepNo].mAct=InAct;
+		Step[StepNo].mExe=InExe;
+		Step[StepNo].mArg0=InArg0;
+		Step[StepNo].mArg1=InArg1;
+	}
+	StepNo++;
+}//Record
+
+/*
+*********************************************************************************************************
+*                                    FORMER TEXT INTERPRETER
+*********************************************************************************************************
+*/
+static char TextLine[BENCH_MAX_LINES][BENCH_MAX_LINE];//text lines of the program as the former tables had
+static const char *TextTbl[BENCH_MAX_LINES];
+static char TokenBuffer[MAX_SEQ_TOKEN_LENGTH];
+static char LabelBuffer[MAX_SEQ_TOKEN_LENGTH];
+static const char *pCurPosInSeq;
+static WORD SeqLnCntr;
+static WORD RptNo;
+static WORD CurrentRprNo;
+static BYTE ExeCode;
+
+static const char *FindTokenStart(const char *pIn)
+{
+	while (*pIn)
+	{
+		if (*pIn!=' ')return pIn;
+		pIn++;
+	}
+	return NULL;
+}//FindTokenStart
+
+static const char *ExtractTokenToBuffer(const char *pTokenStart, char *pTokenBuffer, int TokenBufferSize)
+{
+	*pTokenBuffer=0;
+	pTokenStart=FindTokenStart(pTokenStart);
+	if(pTokenStart)
+	{
+		while ((*pTokenStart!=' ') && (*pTokenStart!=0) && (TokenBufferSize > 1))
+		{
+			*pTokenBuffer=*pTokenStart;
+			pTokenStart++;
+			pTokenBuffer++;
+			TokenBufferSize--;
+		}
+	}
+	*pTokenBuffer=0;
+	return pTokenStart;
+}//ExtractTokenToBuffer
+
+static WORD FindLineNoForLabel(const char *InSeqCmdTbl[], char *InLabel)
+{
+	const char *pSeqPos;
+	WORD SeqLn=0;
+
+	for(;;)
+	{
+		pSeqPos=ExtractTokenToBuffer(InSeqCmdTbl[SeqLn],TokenBuffer,sizeof(TokenBuffer));
+		if(pSeqPos)
+		{
+			if (!strcmp(TokenBuffer,SEQ_EXE_CODE_LABEL_STR))
+			{
+				pSeqPos=ExtractTokenToBuffer(pSeqPos,TokenBuffer,sizeof(TokenBuffer));
+				if(pSeqPos && !strcmp(TokenBuffer,InLabel))
+					return SeqLn;
+			}
+			else
+			{
+				pSeqPos=ExtractTokenToBuffer(pSeqPos,TokenBuffer,sizeof(TokenBuffer));
+				if(pSeqPos && !strcmp(TokenBuffer,SEQ_ACT_END_STR))
+					return NO_LINE_NUMBER_FOR_LABEL;
+			}
+		}
+		SeqLn++;
+		if(SeqLn==NO_LINE_NUMBER_FOR_LABEL)
+			return NO_LINE_NUMBER_FOR_LABEL;
+	}
+}//FindLineNoForLabel
+
+static BYTE ParseSeq(void)
+{
+	ExeCode=SEQ_EXE_CODE_NO;
+	pCurPosInSeq=ExtractTokenToBuffer(pCurPosInSeq,TokenBuffer,sizeof(TokenBuffer));
+	if(!pCurPosInSeq)
+		return SEQ_ACT_NO_EXE_CODE;
+	if (!strcmp(TokenBuffer,SEQ_EXE_CODE_LABEL_STR))
+	{
+		ExeCode=SEQ_EXE_CODE_LABEL;
+		return SEQ_ACT_NO_EXE_CODE;
+	}
+	if (!strcmp(TokenBuffer,SEQ_EXE_CODE_ASYNC_STR)) ExeCode=SEQ_EXE_CODE_ASYNC;
+	if (!strcmp(TokenBuffer,SEQ_EXE_CODE_SYNC_STR)) ExeCode=SEQ_EXE_CODE_SYNC;
+	pCurPosInSeq=ExtractTokenToBuffer(pCurPosInSeq,TokenBuffer,sizeof(TokenBuffer));
+	if(!pCurPosInSeq)
+		return SEQ_ACT_NO_EXE_CODE;
+
+	if (!strcmp(TokenBuffer,SEQ_ACT_DELAY_STR)) return SEQ_ACT_DELAY;
+	if (!strcmp(TokenBuffer,SEQ_ACT_HALT_STR)) return SEQ_ACT_HALT;
+	if (!strcmp(TokenBuffer,SEQ_ACT_RPT_STR)) return SEQ_ACT_RPT;
+	if (!strcmp(TokenBuffer,SEQ_ACT_END_STR)) return SEQ_ACT_END;
+	if (!strcmp(TokenBuffer,SEQ_ACT_MOVE_FRD_STR)) return SEQ_ACT_MOVE_FRD;
+	if (!strcmp(TokenBuffer,SEQ_ACT_MOVE_BWR_STR)) return SEQ_ACT_MOVE_BWR;
+	if (!strcmp(TokenBuffer,SEQ_ACT_TURN_LEFT_STR )) return SEQ_ACT_TURN_LEFT;
+	if (!strcmp(TokenBuffer,SEQ_ACT_TURN_RIGHT_STR )) return SEQ_ACT_TURN_RIGHT;
+	if (!strcmp(TokenBuffer,SEQ_ACT_TURN_AROUND_STR )) return SEQ_ACT_TURN_AROUND;
+	if (!strcmp(TokenBuffer,SEQ_ACT_TURN_HEAD_STR )) return SEQ_ACT_TURN_HEAD;
+	if (!strcmp(TokenBuffer,SEQ_ACT_LEFT_ARM_STR )) return SEQ_ACT_LEFT_ARM;
+	if (!strcmp(TokenBuffer,SEQ_ACT_RIGHT_ARM_STR )) return SEQ_ACT_RIGHT_ARM;
+	if (!strcmp(TokenBuffer,SEQ_ACT_ARMS_SYNC_MOVE_STR )) return SEQ_ACT_ARMS_SYNC_MOVE;
+	if (!strcmp(TokenBuffer,SEQ_ACT_ARMS_OPOSIT_MOVE_STR )) return SEQ_ACT_ARMS_OPOSIT_MOVE;
+	if (!strcmp(TokenBuffer,SEQ_ACT_ARMS_ON_STR )) return SEQ_ACT_ARMS_ON;
+	if (!strcmp(TokenBuffer,SEQ_ACT_ARMS_OFF_STR )) return SEQ_ACT_ARMS_OFF;
+	return SEQ_ACT_NO_EXE_CODE;
+}//ParseSeq
+
+//extracts next token as number, returns 0 when there is no token
+static int TextArg(DWORD *pOutValue)
+{
+	pCurPosInSeq=ExtractTokenToBuffer(pCurPosInSeq,TokenBuffer,sizeof(TokenBuffer));
+	if(!pCurPosInSeq)
+		return 0;
+	*pOutValue=(DWORD)atol(TokenBuffer);
+	return 1;
+}//TextArg
+
+static void TextActRpt(const char *InSeqCmdTbl[])
+{
+	WORD SeqLnNo;
+	WORD RptNoInCmd;
+
+	pCurPosInSeq=ExtractTokenToBuffer(pCurPosInSeq,TokenBuffer,sizeof(TokenBuffer));
+	if(!pCurPosInSeq)
+		return;
+	strcpy(LabelBuffer, TokenBuffer);
+	pCurPosInSeq=ExtractTokenToBuffer(pCurPosInSeq,TokenBuffer,sizeof(TokenBuffer));
+	RptNoInCmd=pCurPosInSeq?atoi(TokenBuffer):0;
+	if(RptNoInCmd==0)
+	{
+		SeqLnNo=FindLineNoForLabel(InSeqCmdTbl,LabelBuffer);
+		if(SeqLnNo!=NO_LINE_NUMBER_FOR_LABEL)
+			SeqLnCntr=SeqLnNo;
+		return;
+	}
+	if(RptNo==0 && CurrentRprNo==0)
+	{
+		RptNo=RptNoInCmd;
+		CurrentRprNo=RptNo;
+	}
+	CurrentRprNo-=1;
+	if(CurrentRprNo)
+	{
+		SeqLnNo=FindLineNoForLabel(InSeqCmdTbl,LabelBuffer);
+		if(SeqLnNo!=NO_LINE_NUMBER_FOR_LABEL)
+			SeqLnCntr=SeqLnNo;
+		return;
+	}
+	RptNo=0;
+	CurrentRprNo=0;
+}//TextActRpt
+
+static void TextExeCmdSeq(const char *InSeqCmdTbl[])
+{
+	BYTE Act;
+	DWORD Arg0,Arg1;
+
+	ExeCode=SEQ_EXE_CODE_NO;
+	SeqLnCntr=0;
+	RptNo=0;
+	CurrentRprNo=0;
+	for(;;)
+	{
+		pCurPosInSeq=InSeqCmdTbl[SeqLnCntr];
+		Act=ParseSeq();
+		switch (Act)
+		{
+		case SEQ_ACT_END:
+			return;
+		case SEQ_ACT_RPT:
+			TextActRpt(InSeqCmdTbl);
+			break;
+		case SEQ_ACT_DELAY:
+			if(TextArg(&Arg0))
+				Record(Act,ExeCode,Arg0,0);
+			break;
+		case SEQ_ACT_MOVE_FRD:
+		case SEQ_ACT_MOVE_BWR:
+			if(TextArg(&Arg0) && TextArg(&Arg1))
+				Record(Act,ExeCode,(WORD)Arg0,(BYTE)Arg1);
+			break;
+		case SEQ_ACT_TURN_HEAD:
+		case SEQ_ACT_LEFT_ARM:
+		case SEQ_ACT_RIGHT_ARM:
+		case SEQ_ACT_ARMS_SYNC_MOVE:
+		case SEQ_ACT_ARMS_OPOSIT_MOVE:
+			if(TextArg(&Arg0))
+				Record(Act,ExeCode,(WORD)Arg0,0);
+			break;
+		case SEQ_ACT_NO_EXE_CODE:
+			break;
+		default://actions without arguments
+			Record(Act,ExeCode,0,0);
+			break;
+		}
+		SeqLnCntr++;
+	}
+}//TextExeCmdSeq
+
+/*
+*********************************************************************************************************
+*                                      BYTECODE INTERPRETER
+*********************************************************************************************************
+*/
+typedef void (*tSeqActHandler)(void);
+
+static const BYTE *pSeqProg;
+static const BYTE *pSeqPc;
+static const BYTE *pSeqArg;
+static const BYTE SeqActArgSize[SEQ_ACT_NO]=SEQ_ACT_ARG_SIZES;
+
+static WORD SeqArgWord(BYTE InOffset)
+{
+	return pSeqArg[InOffset]|((WORD)pSeqArg[InOffset+1]<<8);
+}//SeqArgWord
+
+static void SeqActRpt(void)
+{
+	WORD SeqTarget=SeqArgWord(0);
+	WORD RptNoInCmd=SeqArgWord(2);
+
+	if(RptNoInCmd==0)
+	{
+		if(SeqTarget!=SEQ_NO_JUMP_TARGET)
+			pSeqPc=pSeqProg+SeqTarget;
+		return;
+	}
+	if(RptNo==0 && CurrentRprNo==0)
+	{
+		RptNo=RptNoInCmd;
+		CurrentRprNo=RptNo;
+	}
+	CurrentRprNo-=1;
+	if(CurrentRprNo)
+	{
+		if(SeqTarget!=SEQ_NO_JUMP_TARGET)
+			pSeqPc=pSeqProg+SeqTarget;
+		return;
+	}
+	RptNo=0;
+	CurrentRprNo=0;
+}//SeqActRpt
+
+static void SeqActDword(void)
+{
+	Record(pSeqArg[-1]&SEQ_OP_ACT_MASK,ExeCode,SeqArgWord(0)|((DWORD)SeqArgWord(2)<<16),0);
+}//SeqActDword
+
+static void SeqActMove(void)
+{
+	Record(pSeqArg[-1]&SEQ_OP_ACT_MASK,ExeCode,SeqArgWord(0),pSeqArg[2]);
+}//SeqActMove
+
+static void SeqActPosition(void)
+{
+	Record(pSeqArg[-1]&SEQ_OP_ACT_MASK,ExeCode,SeqArgWord(0),0);
+}//SeqActPosition
+
+static void SeqActPlain(void)
+{
+	Record(pSeqArg[-1]&SEQ_OP_ACT_MASK,ExeCode,0,0);
+}//SeqActPlain
+
+static const tSeqActHandler SeqActTbl[SEQ_ACT_NO]=
+{
+	0,SeqActDword,SeqActPlain,SeqActRpt,SeqActMove,SeqActMove,SeqActPlain,SeqActPlain,
+	SeqActPlain,SeqActPosition,SeqActPosition,SeqActPosition,SeqActPosition,SeqActPosition,SeqActPlain,SeqActPlain
+};
+
+static void ExeCmdSeq(const BYTE *InSeqProg)
+{
+	BYTE Act;
+
+	ExeCode=SEQ_EXE_CODE_NO;
+	pSeqProg=InSeqProg;
+	pSeqPc=InSeqProg;
+	RptNo=0;
+	CurrentRprNo=0;
+	for(;;)
+	{
+		Act=*pSeqPc & SEQ_OP_ACT_MASK;
+		ExeCode=*pSeqPc>>SEQ_OP_EXE_SHIFT;
+		if(Act==SEQ_ACT_END || Act>=SEQ_ACT_NO)
+			return;
+		pSeqArg=pSeqPc+1;
+		pSeqPc=pSeqArg+SeqActArgSize[Act];
+		SeqActTbl[Act]();
+	}
+}//ExeCmdSeq
+
+/*
+*********************************************************************************************************
+*                                           BENCHMARK
+*********************************************************************************************************
+*/
+//compares both interpreters on the program and prints steps per second, returns 0 when they differ
+static int BenchProgram(const char *InName, int InLineNo)
+{
+	static sBenchStep TextStep[BENCH_MAX_STEPS];
+	const BYTE *pProg=NULL;
+	int TextStepNo,i,Same;
+	unsigned long long Start,TextNs,ByteNs;
+
+	for(i=0;i<(int)(sizeof(BenchProg)/sizeof(BenchProg[0]));i++)
+		if(!strcmp(BenchProg[i].mName,InName))
+			pProg=BenchProg[i].mpProg;
+	if(!pProg)
+	{
+		printf("%-20s not in mng_exe_seq.h\n",InName);
+		return 0;
+	}
+	strcpy(TextLine[InLineNo],SEQ_ACT_END_STR);//the former tables were protected by END at the end
+	for(i=0;i<=InLineNo;i++)
+		TextTbl[i]=TextLine[i];
+
+	StepNo=0;
+	TextExeCmdSeq(TextTbl);
+	TextStepNo=StepNo;
+	memcpy(TextStep,Step,sizeof(Step));
+	StepNo=0;
+	ExeCmdSeq(pProg);
+	Same=(StepNo==TextStepNo) && (StepNo<=BENCH_MAX_STEPS) && !memcmp(TextStep,Step,StepNo*sizeof(sBenchStep));
+
+	Start=BenchNs();
+	for(i=0;i<BENCH_RUNS;i++)
+	{
+		StepNo=0;
+		TextExeCmdSeq(TextTbl);
+	}
+	TextNs=BenchNs()-Start;
+	Start=BenchNs();
+	for(i=0;i<BENCH_RUNS;i++)
+	{
+		StepNo=0;
+		ExeCmdSeq(pProg);
+	}
+	ByteNs=BenchNs()-Start;
+	printf("%-20s %5d %10.1f %10.1f %6.1f   %s\n",InName,TextStepNo,
+			(1e3*TextStepNo*BENCH_RUNS)/TextNs,(1e3*TextStepNo*BENCH_RUNS)/ByteNs,(double)TextNs/ByteNs,
+			Same?"same":"DIFFERENT");
+	return Same;
+}//BenchProgram
+
+int main(int argc, char *argv[])
+{
+	const char *pSrcName=(argc>1)?argv[1]:BENCH_SEQ_SOURCE;
+	FILE *pIn=fopen(pSrcName,"r");
+	char Buf[BENCH_MAX_LINE];
+	char Name[BENCH_MAX_LINE]="";
+	char *p;
+	int LineNo=0,Passed=1;
+
+	if(!pIn)
+	{
+		fprintf(stderr,"bench_seq: cannot open %s\n",pSrcName);
+		return EXIT_FAILURE;
+	}
+	printf("Sequencer steps (executed actions) per run and millions of steps per second\n");
+	printf("%-20s %5s %10s %10s %6s\n","program","steps","text","bytecode","ratio");
+	//lines are prepared the way seqc does it
+	while(fgets(Buf,sizeof(Buf),pIn))
+	{
+		for(p=Buf;*p;p++)
+			if(*p=='\t' || *p=='\r' || *p=='\n')
+				*p=' ';
+		p=strstr(Buf,"//");
+		if(p)
+			*p=0;
+		p=Buf+strlen(Buf);
+		while(p>Buf && p[-1]==' ')
+			*--p=0;
+		if(!strncmp(Buf,"program ",8))
+		{
+			if(Name[0] && !BenchProgram(Name,LineNo))
+				Passed=0;
+			ExtractTokenToBuffer(Buf+8,Name,sizeof(Name));
+			LineNo=0;
+		}
+		else if(Name[0] && LineNo<BENCH_MAX_LINES-1)
+			strcpy(TextLine[LineNo++],Buf);
+	}
+	fclose(pIn);
+	if(Name[0] && !BenchProgram(Name,LineNo))
+		Passed=0;
+	printf("%s\n",Passed?"PASSED":"FAILED");
+	return Passed?EXIT_SUCCESS:EXIT_FAILURE;
+}//main
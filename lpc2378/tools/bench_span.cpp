@@ -0,0 +1,225 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        bench_span.cpp
+* Description: Host benchmark of LCD span primitives (make host_bench)
+*              Draws the same shapes with span primitives of ctr_lcd.c (one CASET/PASET/RAMWR window
+*              per span) and pixel by pixel with LCDSetPixel as lines and rectangle borders were drawn
+*              before span primitives. Window is drawn by cWindow::Draw and by its pixel addressed
+*              equivalent (border and whole title bar rectangle). LCD SPI words are counted and executed
+*              by the LCD controller emulator of hw_host.c, frame buffer is not used.
+*              Reports SPI words of both ways and their ratio.
+*              Fails when emulated LCD content differs or when window frame and title bar drawn by spans
+*              do not need at least BENCH_MIN_RATIO times fewer SPI words.
+*              Usage: bench_span
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include "wrp_kernel.hpp"
+#include "ctr_lcd.h"
+#include "hw_spi.h"
+#include "hw_host.h"
+#include "lib_g_window.hpp"
+#include "host_bench.h"
+
+//Kernel must be constructed before any other OS object (see main.cpp), it is not started by the benchmark
+cKernel cKernel::m_Kernel;
+
+#define BENCH_MIN_RATIO		5 //required reduction of SPI words of window frame and title bar
+#define BENCH_BMP_WIDTH		20
+#define BENCH_BMP_HIGHT		14
+#define BENCH_POISON		0xA5A //color of the emulated LCD before shape is drawn
+
+//bitmap in LCDWriteBmp format - width, hight and 12 bit packed pixels
+static unsigned char BenchBmp[2+(BENCH_BMP_WIDTH*BENCH_BMP_HIGHT*3)/2]={BENCH_BMP_WIDTH,BENCH_BMP_HIGHT};
+static WORD BenchLcd[HOST_LCD_COLUMNS][HOST_LCD_COLUMNS];//emulated LCD after pixel addressed drawing
+
+//benchmarked shape - drawn by span primitives (mpSpan) and pixel by pixel (mpPixel)
+typedef struct
+{
+	const char *mName;
+	void (*mpSpan)(void);
+	void (*mpPixel)(void);
+	BYTE mCheckRatio;//TRUE when BENCH_MIN_RATIO is required
+} sBenchShape;
+
+static BOOL Passed=TRUE;
+
+//pixel by pixel drawing of lines and rectangle borders
+static void PixelHLine(int x, int y0, int y1, int color)
+{
+	for(;y0<=y1;y0++)
+		LCDSetPixel(x,y0,color);
+}//PixelHLine
+
+static void PixelVLine(int x0, int x1, int y, int color)
+{
+	for(;x0<=x1;x0++)
+		LCDSetPixel(x0,y,color);
+}//PixelVLine
+
+static void PixelRect(int x0, int y0, int x1, int y1, int color)
+{
+	PixelHLine(x0,y0,y1,color);
+	PixelHLine(x1,y0,y1,color);
+	PixelVLine(x0,x1,y0,color);
+	PixelVLine(x0,x1,y1,color);
+}//PixelRect
+
+//window frame and title bar of WIN_* coordinates with SMALL font title
+#define BENCH_TITLE_BAR_X	(LCDFontHight(LCDSizeToFont(SMALL))+2) //title bar bottom line (see cWindow::Draw)
+
+static void SpanFrame(void)
+{
+	LCDSetRect(WIN_TOP_LEFT_X,WIN_TOP_LEFT_Y,WIN_BOT_RIGHT_X,WIN_BOT_RIGHT_Y,NOFILL,WHITE);
+	LCDHLine(BENCH_TITLE_BAR_X,WIN_TOP_LEFT_Y,WIN_BOT_RIGHT_Y,WHITE);
+}//SpanFrame
+
+static void PixelFrame(void)
+{
+	PixelRect(WIN_TOP_LEFT_X,WIN_TOP_LEFT_Y,WIN_BOT_RIGHT_X,WIN_BOT_RIGHT_Y,WHITE);
+	PixelRect(WIN_TOP_LEFT_X,WIN_TOP_LEFT_Y,BENCH_TITLE_BAR_X,WIN_BOT_RIGHT_Y,WHITE);
+}//PixelFrame
+
+static void SpanHorizontal(void)
+{
+	LCDSetLine(60,5,60,120,GREEN);
+}//SpanHorizontal
+
+static void PixelHorizontal(void)
+{
+	PixelHLine(60,5,120,GREEN);
+}//PixelHorizontal
+
+static void SpanVertical(void)
+{
+	LCDSetLine(5,70,120,70,RED);
+}//SpanVertical
+
+static void PixelVertical(void)
+{
+	PixelVLine(5,120,70,RED);
+}//PixelVertical
+
+static void SpanFillRect(void)
+{
+	LCDSetRect(20,30,60,90,FILL,BLUE);
+}//SpanFillRect
+
+static void PixelFillRect(void)
+{
+	int x;
+
+	for(x=20;x<=60;x++)
+		PixelHLine(x,30,90,BLUE);
+}//PixelFillRect
+
+//bitmap clipped to the rectangle which cuts its corner
+#define BENCH_BMP_X		40
+#define BENCH_BMP_Y		50
+
+static void SpanBlit(void)
+{
+	LCDBlitBmp(BENCH_BMP_X,BENCH_BMP_Y,BenchBmp,BENCH_BMP_X+3,BENCH_BMP_Y+5,WIN_BOT_RIGHT_X,WIN_BOT_RIGHT_Y);
+}//SpanBlit
+
+static void PixelBlit(void)
+{
+	int i,j;
+	long p;
+
+	for(i=3;i<BENCH_BMP_HIGHT;i++)
+		for(j=5;j<BENCH_BMP_WIDTH;j++)
+		{
+			p=(long)i*BENCH_BMP_WIDTH+j;
+			const unsigned char *pPair=&BenchBmp[2+(p>>1)*3];
+			LCDSetPixel(BENCH_BMP_X+i,BENCH_BMP_Y+j,(p&1)?((pPair[1]&0x0F)<<8)|pPair[2]:(pPair[0]<<4)|(pPair[1]>>4));
+		}
+}//PixelBlit
+
+//window of the display manager - border, title bar and centered title (see cWindow::Draw)
+static cWindow BenchWindow;
+static const char BenchTitle[]="BATTERY";
+
+static void SpanWindow(void)
+{
+	BenchWindow.SetReDraw();
+	BenchWindow.Draw();
+}//SpanWindow
+
+static void PixelWindow(void)
+{
+	LCDClearScreen();
+	PixelFrame();
+	LCDPutStr((char *)BenchTitle,WIN_TITLE_X,(WIN_BOT_RIGHT_X-(sizeof(BenchTitle)-1)*LCDFontWidth(LCDSizeToFont(SMALL)))/2,
+			SMALL,WHITE,BLACK);
+}//PixelWindow
+
+static const sBenchShape BenchShape[]=
+{
+	{"window frame and title bar",SpanFrame,PixelFrame,TRUE},
+	{"horizontal line",SpanHorizontal,PixelHorizontal,FALSE},
+	{"vertical line",SpanVertical,PixelVertical,FALSE},
+	{"filled rectangle",SpanFillRect,PixelFillRect,FALSE},
+	{"clipped bitmap",SpanBlit,PixelBlit,FALSE},
+	{"cWindow::Draw (with clear)",SpanWindow,PixelWindow,FALSE},
+};
+
+//draws the shape both ways and prints the result
+static void BenchRun(const sBenchShape *pShape)
+{
+	DWORD SpanWords,PixelWords;
+	long Diffs=0;
+	int x,y;
+
+	HostFillLcd(BENCH_POISON);
+	PixelWords=GetLcdSpiWords();
+	pShape->mpPixel();
+	PixelWords=GetLcdSpiWords()-PixelWords;
+	for(x=0;x<HOST_LCD_COLUMNS;x++)
+		for(y=0;y<HOST_LCD_COLUMNS;y++)
+			BenchLcd[x][y]=HostGetLcdPixel(x,y);
+
+	HostFillLcd(BENCH_POISON);
+	SpanWords=GetLcdSpiWords();
+	pShape->mpSpan();
+	SpanWords=GetLcdSpiWords()-SpanWords;
+	for(x=0;x<HOST_LCD_COLUMNS;x++)
+		for(y=0;y<HOST_LCD_COLUMNS;y++)
+			if(BenchLcd[x][y]!=HostGetLcdPixel(x,y))
+				Diffs++;
+
+	printf("%-28s %8lu %8lu %7.1f %7ld\n",pShape->mName,(unsigned long)PixelWords,(unsigned long)SpanWords,
+			SpanWords?(double)PixelWords/SpanWords:0.0,Diffs);
+	if(Diffs || (pShape->mCheckRatio && PixelWords<BENCH_MIN_RATIO*SpanWords))
+		Passed=FALSE;
+}//BenchRun
+
+int	main (void)
+{
+	unsigned int i;
+
+	for(i=2;i<sizeof(BenchBmp);i++)
+		BenchBmp[i]=(unsigned char)(i*37);
+	BenchWindow.SetWinTitle((char *)BenchTitle);
+	BenchWindow.SetWinTitleFontSize(SMALL);
+	BenchWindow.SetWinTitleFrgColor(WHITE);
+	BenchWindow.SetWinTitleBckColor(BLACK);
+	BenchWindow.SetBrdColor(WHITE);
+
+	printf("LCD SPI words, frame buffer not used\n");
+	printf("%-28s %8s %8s %7s %7s\n","shape","pixels","spans","ratio","diffs");
+	for(i=0;i<sizeof(BenchShape)/sizeof(BenchShape[0]);i++)
+		BenchRun(&BenchShape[i]);
+	printf("%s\n",Passed?"PASSED":"FAILED");
+	return Passed?EXIT_SUCCESS:EXIT_FAILURE;
+}
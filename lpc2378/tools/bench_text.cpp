@@ -0,0 +1,154 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        bench_text.cpp
+* Description: Host benchmark of text controls redraw (make host_bench)
+*              Time and date controls of the default window receive EVT_TIME notifiers of consecutive
+*              seconds (minute, hour and date changes included) and are drawn after each of them:
+*              glyph diff - cTxtCtrl::Draw redraws only glyphs which differ from the drawn ones
+*              full redraw - old text is cleared and the whole new text is drawn (as before glyph diff)
+*              LCD SPI words are counted and executed by the LCD controller emulator of hw_host.c.
+*              Reports SPI words per EVT_TIME update (average and max) of both ways.
+*              Fails when emulated LCD content of both ways differs after any update or when glyph diff
+*              does not reduce the average, so it is also a regression test of cTxtCtrl.
+*              Usage: bench_text
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include "wrp_kernel.hpp"
+#include "lib_g_text.hpp"
+#include "hw_spi.h"
+#include "hw_host.h"
+#include "host_bench.h"
+
+//Kernel must be constructed before any other OS object (see main.cpp)
+cKernel cKernel::m_Kernel;
+
+#define BENCH_UPDATES		150 //number of EVT_TIME updates (seconds)
+#define BENCH_PRIO			20
+
+//start time of the updates - date changes during the benchmark
+#define BENCH_YEAR			2026
+#define BENCH_MONTH			10
+#define BENCH_DAY			17
+#define BENCH_DAY_OF_WEEK	6
+#define BENCH_HOUR			23
+#define BENCH_MINUTE		58
+#define BENCH_SECOND		50
+
+//controls at the place of the default window ones (see mng_display.cpp)
+static cTimeTxtCtrl BenchTime("",4,44);
+static cDateTxtCtrl BenchDate("",22,19);
+
+static DWORD BenchHash[BENCH_UPDATES];//emulated LCD content after every update of the full redraw
+
+//hash of the emulated LCD content (FNV-1a of all pixels)
+static DWORD BenchLcdHash(void)
+{
+	DWORD Hash=2166136261UL;
+	int x,y;
+
+	for(x=0;x<HOST_LCD_COLUMNS;x++)
+		for(y=0;y<HOST_LCD_COLUMNS;y++)
+			Hash=(Hash^HostGetLcdPixel(x,y))*16777619UL;
+	return Hash;
+}//BenchLcdHash
+
+class cBenchText: public cThread
+{
+	OS_STK m_ThreadStack[OS_TASK_STACK_SIZE];
+	BOOL Measure(BOOL InFullRedraw,DWORD *pOutAverage,DWORD *pOutMax);
+	virtual void Run();
+public:
+	cBenchText(){Create((OS_STK *)&m_ThreadStack[0],(OS_STK *)&m_ThreadStack[OS_TASK_STACK_SIZE-1],BENCH_PRIO);};
+};
+
+//run all updates, returns FALSE when LCD content differs from the full redraw one
+BOOL cBenchText::Measure(BOOL InFullRedraw,DWORD *pOutAverage,DWORD *pOutMax)
+{
+	sRtcData Time={RTC_NONE_SCMD_ID,FALSE,FALSE,BENCH_YEAR,BENCH_MONTH,BENCH_DAY,BENCH_DAY_OF_WEEK,
+			BENCH_HOUR,BENCH_MINUTE,BENCH_SECOND};
+	DWORD Words,Total=0;
+	BOOL Same=TRUE;
+	int i;
+
+	*pOutMax=0;
+	HostFillLcd(BLACK);
+	BenchTime.SetReDraw();//LCD content is lost as after window redraw
+	BenchDate.SetReDraw();
+	for(i=0;i<BENCH_UPDATES;i++)
+	{
+		cSmartPtr< cTypeNotifier<sRtcData> > pNotifier = new cTypeNotifier<sRtcData>(EVT_TIME,GetThreadId(),NT_HND_NORMAL_PRT,Time);
+
+		Words=GetLcdSpiWords();
+		if(InFullRedraw)
+		{
+			BenchTime.Clear();
+			BenchDate.Clear();
+		}
+		BenchTime.ProcessNotifier(pNotifier);
+		BenchDate.ProcessNotifier(pNotifier);
+		if(InFullRedraw)
+		{
+			BenchTime.SetReDraw();
+			BenchDate.SetReDraw();
+		}
+		BenchTime.Draw();
+		BenchDate.Draw();
+		Words=GetLcdSpiWords()-Words;
+		if(i)//the first update draws controls on empty LCD
+		{
+			Total+=Words;
+			if(Words>*pOutMax)*pOutMax=Words;
+		}
+		if(InFullRedraw)
+			BenchHash[i]=BenchLcdHash();
+		else if(BenchHash[i]!=BenchLcdHash())
+			Same=FALSE;
+
+		//next second, the date changes at midnight (the benchmark does not reach the month end)
+		if(++Time.mSecond<60)continue;
+		Time.mSecond=0;
+		if(++Time.mMinute<60)continue;
+		Time.mMinute=0;
+		if(++Time.mHour<24)continue;
+		Time.mHour=0;
+		Time.mDay++;
+		Time.mDayOfWeek=(Time.mDayOfWeek+1)%7;
+	}
+	*pOutAverage=Total/(BENCH_UPDATES-1);
+	return Same;
+}//cBenchText::Measure
+
+void cBenchText::Run()
+{
+	DWORD FullAverage,FullMax,DiffAverage,DiffMax;
+	BOOL Passed;
+
+	Measure(TRUE,&FullAverage,&FullMax);
+	Passed=Measure(FALSE,&DiffAverage,&DiffMax);
+	printf("LCD SPI words per EVT_TIME update of time and date controls (%d updates)\n",BENCH_UPDATES-1);
+	printf("full redraw  average %5lu  max %5lu\n",(unsigned long)FullAverage,(unsigned long)FullMax);
+	printf("glyph diff   average %5lu  max %5lu\n",(unsigned long)DiffAverage,(unsigned long)DiffMax);
+	printf("LCD content %s\n",Passed?"the same":"DIFFERENT");
+	Passed=Passed && (DiffAverage<FullAverage);
+	printf("%s\n",Passed?"PASSED":"FAILED");
+	exit(Passed?EXIT_SUCCESS:EXIT_FAILURE);
+}//cBenchText::Run
+
+cBenchText BenchText;
+
+int	main (void)
+{
+	Kernel.Start();
+	return 0;
+}
@@ -0,0 +1,260 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        bench_tick.c
+* Description: Host benchmark of the OS tick processing (make host_bench)
+*              Calls OSTimeTick() (tick wheel of os_core.c) with increasing number of delayed tasks and
+*              reports host CPU cycles of the call (p50, p99, mean) when:
+*              delayed - all tasks are delayed for long time so no delay expires
+*              periodic - tasks are delayed for pseudo random 2..100 ticks periods and run when they expire
+*              For comparison the baseline OSTimeTick() (uCOS-II 2.00 which decrements delay of every task
+*              in OSTCBList) is replayed on the copy of the task list with the same delays (BaselineTimeTick).
+*              Tick wheel moves cost to the delay path - every OSTimeDly() and pend with timeout links the
+*              task into the wheel (OSTickWheelInsert) and every early end of the delay (post, resume)
+*              unlinks it (OSTickWheelRemove) where the baseline only stores OSTCBDly. Both are measured
+*              on a probe TCB which is not a task.
+*              OSTimeTick() is called with OSIntNesting set as from the tick ISR so it does not switch to
+*              the timer task. Readied tasks run when OSSched() is called after every tick by the benchmark
+*              task which has the lowest priority. OS tick interrupt (Timer2) is not started.
+*              Usage: bench_tick
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+* 17-Oct-2026 Compared with the replayed baseline OSTimeTick(), added tick wheel insert and remove costs
+*********************************************************************************************************
+*/
+
+#include "type.h"
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+#include "host_bench.h"
+
+#define BENCH_TICK_MAX_TASKS	(OS_MAX_TASKS-3) //all TCBs but idle, timer and benchmark tasks
+#define BENCH_TICK_TASK_PRIO	20 //priority of the first delayed task
+#define BENCH_TICK_PRIO			(OS_LOWEST_PRIO-1) //benchmark task runs when all other tasks wait
+#define BENCH_TICK_CALLS		10000 //OSTimeTick() calls measured for every number of tasks
+#define BENCH_TICK_LONG_DELAY	60000 //delay which does not expire during the measurement
+#define BENCH_TICK_MIN_PERIOD	2
+#define BENCH_TICK_MAX_PERIOD	100
+#define BENCH_TICK_DLY_CALLS	1000 //delay path measurements for every number of tasks
+
+static const int TaskNo[]={0,1,4,8,BENCH_TICK_MAX_TASKS};//numbers of delayed tasks measured
+
+static OS_STK TaskStack[BENCH_TICK_MAX_TASKS][OS_TASK_STACK_SIZE];
+static OS_STK BenchStack[OS_TASK_STACK_SIZE];
+static volatile INT16U Period[BENCH_TICK_MAX_TASKS];//delay of the task
+static int CreatedNo;//number of created delayed tasks
+static unsigned long long TickCycles[BENCH_TICK_CALLS];
+static unsigned long long BaseCycles[BENCH_TICK_CALLS];
+
+//baseline OSTimeTick() works on the copy of the task list so it does not change the kernel
+static OS_TCB BaseTcb[OS_MAX_TASKS+OS_N_SYS_TASKS];
+static OS_TCB *BaseTcbList;
+static INT8U BaseRdyGrp;
+static INT8U BaseRdyTbl[OS_RDY_TBL_SIZE];
+static volatile INT32U BaseTime;
+static unsigned int Seed=1;
+
+//deterministic pseudo random generator so the periods do not depend on C library
+static unsigned int BenchRand(void)
+{
+	Seed=Seed*1103515245+12345;
+	return (Seed>>8)&0xFFFFFF;
+}//BenchRand
+
+//delayed task - delays itself for its period forever
+static void DelayedTask(void *pdata)
+{
+	INT16U *pPeriod=(INT16U*)pdata;
+
+	for(;;)
+		OSTimeDly(*pPeriod);
+}//DelayedTask
+
+//baseline OSTimeTick() of uCOS-II 2.00 (os_core.c before the tick wheel) on the copy of the task list
+static void BaselineTimeTick(void)
+{
+	OS_TCB *ptcb;
+#if (OS_CRITICAL_METHOD == 3)
+	OS_CPU_SR  cpu_sr;
+#endif
+
+	ptcb = BaseTcbList;
+	while (ptcb->OSTCBPrio != OS_IDLE_PRIO) {
+		OS_ENTER_CRITICAL();
+		if (ptcb->OSTCBDly != 0) {
+			if (--ptcb->OSTCBDly == 0) {
+				if (!(ptcb->OSTCBStat & OS_STAT_SUSPEND)) {
+					BaseRdyGrp               |= ptcb->OSTCBBitY;
+					BaseRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+				} else {
+					ptcb->OSTCBDly = 1;
+				}
+			}
+		}
+		ptcb = ptcb->OSTCBNext;
+		OS_EXIT_CRITICAL();
+	}
+	OS_ENTER_CRITICAL();
+	BaseTime++;
+	OS_EXIT_CRITICAL();
+}//BaselineTimeTick
+
+//copy the task list for BaselineTimeTick() - delayed tasks get their periods, other tasks are not delayed
+static void CopyTaskList(void)
+{
+	OS_TCB *ptcb;
+	INT8U Task;
+	int i=0;
+
+	for(ptcb=OSTCBList;ptcb;ptcb=ptcb->OSTCBNext,i++)
+	{
+		BaseTcb[i]=*ptcb;
+		BaseTcb[i].OSTCBNext=ptcb->OSTCBNext?&BaseTcb[i+1]:(OS_TCB*)0;
+		Task=ptcb->OSTCBPrio-BENCH_TICK_TASK_PRIO;
+		BaseTcb[i].OSTCBDly=(Task<CreatedNo)?Period[Task]:0;
+	}
+	BaseTcbList=&BaseTcb[0];
+}//CopyTaskList
+
+//baseline tasks readied by BaselineTimeTick() run and delay again
+static void RunBaselineTasks(void)
+{
+	OS_TCB *ptcb;
+	INT8U Task;
+
+	for(ptcb=BaseTcbList;ptcb->OSTCBPrio!=OS_IDLE_PRIO;ptcb=ptcb->OSTCBNext)
+	{
+		Task=ptcb->OSTCBPrio-BENCH_TICK_TASK_PRIO;
+		if((Task<CreatedNo) && !ptcb->OSTCBDly)
+		{
+			BaseRdyTbl[ptcb->OSTCBY]&=~ptcb->OSTCBBitX;
+			if(!BaseRdyTbl[ptcb->OSTCBY])BaseRdyGrp&=~ptcb->OSTCBBitY;
+			ptcb->OSTCBDly=Period[Task];
+		}
+	}
+}//RunBaselineTasks
+
+//set delay of all tasks and let them delay again with it
+static void SetPeriods(BOOL InPeriodic)
+{
+	int i;
+
+	for(i=0;i<CreatedNo;i++)
+	{
+		Period[i]=InPeriodic?BENCH_TICK_MIN_PERIOD+BenchRand()%(BENCH_TICK_MAX_PERIOD-BENCH_TICK_MIN_PERIOD+1):BENCH_TICK_LONG_DELAY;
+		OSTimeDlyResume(BENCH_TICK_TASK_PRIO+i);//task runs at once as it has higher priority
+	}
+	CopyTaskList();
+}//SetPeriods
+
+//measure OSTimeTick() and the baseline OSTimeTick() and print results
+static void Measure(const char *pInName)
+{
+	unsigned long long Start,Sum=0,BaseSum=0;
+	int i;
+#if (OS_CRITICAL_METHOD == 3)
+	OS_CPU_SR  cpu_sr;
+#endif
+
+	for(i=0;i<BENCH_TICK_CALLS;i++)
+	{
+		OS_ENTER_CRITICAL();
+		OSIntNesting++;//as in the tick ISR - no context switch inside OSTimeTick()
+		OS_EXIT_CRITICAL();
+		Start=BenchCycles();
+		OSTimeTick();
+		TickCycles[i]=BenchCycles()-Start;
+		Sum+=TickCycles[i];
+		OS_ENTER_CRITICAL();
+		OSIntNesting--;
+		OS_EXIT_CRITICAL();
+		OSSched();//timer task and readied tasks run, tasks delay again
+		Start=BenchCycles();
+		BaselineTimeTick();
+		BaseCycles[i]=BenchCycles()-Start;
+		BaseSum+=BaseCycles[i];
+		RunBaselineTasks();
+	}
+	BenchSort(TickCycles,BENCH_TICK_CALLS);
+	BenchSort(BaseCycles,BENCH_TICK_CALLS);
+	printf("  %-8s %5d   wheel %5llu %6llu %6llu   baseline %5llu %6llu %6llu\n",pInName,CreatedNo,
+			BenchPercentile(TickCycles,BENCH_TICK_CALLS,50),BenchPercentile(TickCycles,BENCH_TICK_CALLS,99),
+			Sum/BENCH_TICK_CALLS,
+			BenchPercentile(BaseCycles,BENCH_TICK_CALLS,50),BenchPercentile(BaseCycles,BENCH_TICK_CALLS,99),
+			BaseSum/BENCH_TICK_CALLS);
+}//Measure
+
+//measure tick wheel insert and remove of the probe TCB and the baseline delay store
+static void MeasureDelayPath(void)
+{
+	static OS_TCB Probe;
+	unsigned long long Start,InsertSum=0,RemoveSum=0,StoreSum=0;
+	INT16U Ticks;
+	int i;
+#if (OS_CRITICAL_METHOD == 3)
+	OS_CPU_SR  cpu_sr;
+#endif
+
+	for(i=0;i<BENCH_TICK_DLY_CALLS;i++)
+	{
+		Ticks=BENCH_TICK_MIN_PERIOD+BenchRand()%(BENCH_TICK_MAX_PERIOD-BENCH_TICK_MIN_PERIOD+1);
+		OS_ENTER_CRITICAL();//probe is removed before the next tick
+		Start=BenchCycles();
+		OSTickWheelInsert(&Probe,Ticks);
+		InsertSum+=BenchCycles()-Start;
+		Start=BenchCycles();
+		OSTickWheelRemove(&Probe);
+		RemoveSum+=BenchCycles()-Start;
+		Start=BenchCycles();
+		((volatile OS_TCB*)&Probe)->OSTCBDly=Ticks;//baseline OSTimeDly() and pend with timeout
+		StoreSum+=BenchCycles()-Start;
+		Probe.OSTCBDly=0;
+		OS_EXIT_CRITICAL();
+	}
+	printf("  delay    %5d   wheel insert mean %4llu   wheel remove mean %4llu   baseline store mean %4llu\n",CreatedNo,
+			InsertSum/BENCH_TICK_DLY_CALLS,RemoveSum/BENCH_TICK_DLY_CALLS,StoreSum/BENCH_TICK_DLY_CALLS);
+}//MeasureDelayPath
+
+static void BenchTask(void *pdata)
+{
+	int i;
+
+	printf("OS tick, %d calls per line, host cycles p50 p99 mean of OSTimeTick with tick wheel and baseline\n",BENCH_TICK_CALLS);
+	printf("           tasks\n");
+	for(i=0;i<sizeof(TaskNo)/sizeof(TaskNo[0]);i++)
+	{
+		while(CreatedNo<TaskNo[i])
+		{
+			Period[CreatedNo]=BENCH_TICK_LONG_DELAY;
+			if(OSTaskCreate(DelayedTask,(void*)&Period[CreatedNo],&TaskStack[CreatedNo][OS_TASK_STACK_SIZE-1],
+					BENCH_TICK_TASK_PRIO+CreatedNo)!=OS_NO_ERR)
+			{
+				printf("FAILED - task %d not created\n",CreatedNo);
+				exit(EXIT_FAILURE);
+			}
+			CreatedNo++;
+		}
+		SetPeriods(FALSE);
+		Measure("delayed");
+		SetPeriods(TRUE);
+		Measure("periodic");
+		MeasureDelayPath();
+	}
+	exit(EXIT_SUCCESS);
+}//BenchTask
+
+int main(void)
+{
+	OSInit();
+	OSTaskCreate(BenchTask,NULL,&BenchStack[OS_TASK_STACK_SIZE-1],BENCH_TICK_PRIO);
+	OSStart();
+	return 0;
+}//main
@@ -0,0 +1,112 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        dbgdec.c
+* Description: Host decoder of Walle tokenized trace log
+*              Reads terminal output captured during remote LOG command and replaces every trace record
+*              line by the message text taken from trace string table (main.dbg created by make from .dbg_str)
+*              so decoded log looks like traces sent directly to the terminal. Other lines are copied unchanged.
+*              Usage: dbgdec [-t] <main.dbg> [<captured log>]
+*              -t - prefix every message by OS tick and level of the trace record
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../src/include/lib_dbg.h"
+
+#define DBGDEC_MAX_LINE		256 //max length of the captured log line
+#define DBGDEC_MAX_TABLE	0x10000 //message ID is 16 bit offset in string table
+
+static char Table[DBGDEC_MAX_TABLE+1];//trace string table (null terminated message texts)
+static long TableSize;
+
+//reads string table created by objcopy from .dbg_str section
+static int ReadTable(const char *pName)
+{
+	FILE *pFile=fopen(pName,"rb");
+
+	if(!pFile)
+	{
+		fprintf(stderr,"dbgdec: cannot open string table %s\n",pName);
+		return 0;
+	}
+	TableSize=(long)fread(Table,1,DBGDEC_MAX_TABLE,pFile);
+	Table[TableSize]=0;//last message is always terminated
+	fclose(pFile);
+	return 1;
+}//ReadTable
+
+//decodes one trace record line, returns 0 when line is not a correct record
+static int DecodeRecord(const char *pLine, int ShowTick, FILE *pOut)
+{
+	unsigned long MsgId,Level,Type,Tick,Value;
+
+	if(sscanf(pLine+strlen(DBG_LOG_REC_PREFIX),"%lx %lx %lx %lx %lx",&MsgId,&Level,&Type,&Tick,&Value)!=5)
+		return 0;
+	if((long)MsgId>=TableSize)
+	{
+		fprintf(pOut,"\n<dbgdec: unknown message id %04lX - string table does not match firmware>",MsgId);
+		return 1;
+	}
+	if(ShowTick)
+		fprintf(pOut,"\n[%08lu L%lu]",Tick,Level);
+	fputs(Table+MsgId,pOut);//message text exactly as it was traced
+	if(Type==DBG_LOG_STR_VAL)//DbgTraceStrVal prints value as Uart0Message does
+		fprintf(pOut,"%ld\n",(long)(int)Value);
+	return 1;
+}//DecodeRecord
+
+int main(int argc, char *argv[])
+{
+	char Line[DBGDEC_MAX_LINE];
+	FILE *pIn=stdin;
+	int ShowTick=0;
+	int ArgNo=1;
+	size_t Length;
+
+	if((argc>1) && !strcmp(argv[1],"-t"))
+	{
+		ShowTick=1;
+		ArgNo++;
+	}
+	if((argc-ArgNo<1) || (argc-ArgNo>2))
+	{
+		fprintf(stderr,"usage: dbgdec [-t] <main.dbg> [<captured log>]\n");
+		return 1;
+	}
+	if(!ReadTable(argv[ArgNo]))
+		return 1;
+	if((argc-ArgNo==2) && !(pIn=fopen(argv[ArgNo+1],"r")))
+	{
+		fprintf(stderr,"dbgdec: cannot open %s\n",argv[ArgNo+1]);
+		return 1;
+	}
+
+	while(fgets(Line,sizeof(Line),pIn))
+	{
+		Length=strlen(Line);
+		while(Length && ((Line[Length-1]=='\n') || (Line[Length-1]=='\r')))
+			Line[--Length]=0;//terminal sends CR LF
+		if(!strncmp(Line,DBG_LOG_LOST_PREFIX,strlen(DBG_LOG_LOST_PREFIX)))
+			fprintf(stdout,"\n<dbgdec: %ld trace records lost>",strtol(Line+strlen(DBG_LOG_LOST_PREFIX),NULL,16));
+		else if(!strncmp(Line,DBG_LOG_REC_PREFIX,strlen(DBG_LOG_REC_PREFIX)) && DecodeRecord(Line,ShowTick,stdout))
+			;
+		else if(Length)
+			fprintf(stdout,"\n%s",Line);//not a trace record line
+	}
+	fputc('\n',stdout);
+	if(pIn!=stdin)
+		fclose(pIn);
+	return 0;
+}//main
@@ -0,0 +1,89 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        host_bench.h
+* Description: Helpers shared by host benchmarks and tests (make host_bench, make host_test)
+*              which link Wall-e SW host objects (see HOSTLIB in Makefile).
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#ifndef HOST_BENCH_H_
+#define HOST_BENCH_H_
+
+#include <stdio.h>
+#include <time.h>
+
+//host C++ <cstdlib> can not be used together with Wall-e C library functions renamed by HOSTLIBC (see Makefile)
+//so C++ programs get only exit() from it
+#ifdef __cplusplus
+extern "C" void exit(int InStatus) __attribute__((noreturn));
+#define EXIT_SUCCESS	0
+#define EXIT_FAILURE	1
+#else
+#include <stdlib.h>
+#endif
+
+#define BENCH_NS_PER_US	1000ULL
+
+//host monotonic time in ns
+static inline unsigned long long BenchNs(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC,&Now);
+	return Now.tv_sec*1000000000ULL+Now.tv_nsec;
+}//BenchNs
+
+//host CPU cycle counter (time stamp counter) or ns when the host CPU has none
+static inline unsigned long long BenchCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __builtin_ia32_rdtsc();
+#else
+	return BenchNs();
+#endif
+}//BenchCycles
+
+//busy wait for InNs ns
+static inline void BenchSpinNs(unsigned long long InNs)
+{
+	unsigned long long Start=BenchNs();
+
+	while((BenchNs()-Start) < InNs);
+}//BenchSpinNs
+
+//sort InNumber values (insertion sort - benchmarks have at most few thousands of samples)
+static inline void BenchSort(unsigned long long *pValues,int InNumber)
+{
+	int i,j;
+	unsigned long long Value;
+
+	for(i=1;i<InNumber;i++)
+	{
+		Value=pValues[i];
+		for(j=i;(j>0)&&(pValues[j-1]>Value);j--)
+			pValues[j]=pValues[j-1];
+		pValues[j]=Value;
+	}
+}//BenchSort
+
+//return InPercent percentile of the sorted (see BenchSort) values
+static inline unsigned long long BenchPercentile(const unsigned long long *pValues,int InNumber,int InPercent)
+{
+	int Index=(InNumber*InPercent)/100;
+
+	if(Index >= InNumber)
+		Index=InNumber-1;
+	return pValues[Index];
+}//BenchPercentile
+
+#endif /*HOST_BENCH_H_*/
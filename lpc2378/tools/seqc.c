@@ -0,0 +1,342 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        seqc.c
+* Description: Host compiler of Walle Simply Sequencer programs
+*              Reads sequence source (mng_exe.seq) and generates header with const bytecode tables
+*              executed by cExeMngr::ExeCmdSeq. Lines are tokenized and parsed exactly as the former
+*              ExeMngr text interpreter did so compiled programs behave the same way.
+*              Usage: seqc <source.seq> <output.h>
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../src/include/mng_exe_seq_def.h"
+
+#define SEQC_MAX_LINE		256 //max length of the source line
+#define SEQC_MAX_LINES		512 //max number of lines in one program
+#define SEQC_MAX_PROG_SIZE	0xFFFE //program offsets must be below SEQ_NO_JUMP_TARGET
+
+//compiled sequence line
+typedef struct
+{
+	int mAct;//action ID or -1 when line does nothing
+	int mExe;//exe code ID
+	unsigned long mArg[2];//binary arguments
+	char mLabel[MAX_SEQ_TOKEN_LENGTH];//label defined by label line or referenced by RPT
+	int mIsLabel;//1 - line defines label mLabel
+	unsigned mOffset;//offset of the instruction from program start
+} sSeqLine;
+
+static const unsigned char ArgSize[SEQ_ACT_NO]=SEQ_ACT_ARG_SIZES;
+
+static const char *ActStr[SEQ_ACT_NO]={SEQ_ACT_END_STR,SEQ_ACT_DELAY_STR,SEQ_ACT_HALT_STR,SEQ_ACT_RPT_STR,
+		SEQ_ACT_MOVE_FRD_STR,SEQ_ACT_MOVE_BWR_STR,SEQ_ACT_TURN_LEFT_STR,SEQ_ACT_TURN_RIGHT_STR,
+		SEQ_ACT_TURN_AROUND_STR,SEQ_ACT_TURN_HEAD_STR,SEQ_ACT_LEFT_ARM_STR,SEQ_ACT_RIGHT_ARM_STR,
+		SEQ_ACT_ARMS_SYNC_MOVE_STR,SEQ_ACT_ARMS_OPOSIT_MOVE_STR,SEQ_ACT_ARMS_ON_STR,SEQ_ACT_ARMS_OFF_STR};
+
+static char Comment[SEQC_MAX_LINES][SEQC_MAX_LINE];//source lines of the program as written
+static sSeqLine Line[SEQC_MAX_LINES];
+static int LineNo;//number of lines in the program
+static char ProgName[SEQC_MAX_LINE];
+static char Pending[4*SEQC_MAX_LINE];//comment lines waiting for program line
+static int SrcLineNo;//line number in the source file for error messages
+static const char *SrcName;
+
+//starts from pIn to identify begining of the token string ignoring leading spaces if any
+//returns pointer to token or null if not found (because of end of the processed string)
+static const char *FindTokenStart(const char *pIn)
+{
+	while (*pIn)
+	{
+		if (*pIn!=' ')return pIn;
+		pIn++;
+	}
+	return NULL;
+}
+
+//find and copy token string to buffer which is next null terminated
+//returns pointer to the first character after the token or null if no token found
+//IMPORTANT! must stay the same as the former cExeMngr::ExtractTokenToBuffer (also for too long tokens)
+static const char *ExtractTokenToBuffer(const char *pTokenStart, char *pTokenBuffer, int TokenBufferSize)
+{
+	*pTokenBuffer=0;
+	pTokenStart=FindTokenStart(pTokenStart);
+	if(pTokenStart)
+	{
+		while ((*pTokenStart!=' ') && (*pTokenStart!=0) && (TokenBufferSize > 1))
+		{
+			*pTokenBuffer=*pTokenStart;
+			pTokenStart++;
+			pTokenBuffer++;
+			TokenBufferSize--;
+		}
+	}
+	*pTokenBuffer=0;
+	return pTokenStart;
+}
+
+//parse one sequence line the way the former cExeMngr::ParseSeq and SeqAct... functions did
+//returns action ID of the line to be compiled or -1 when the line does nothing when executed
+static int ParseLine(const char *pSeq, sSeqLine *pLine)
+{
+	char Token[MAX_SEQ_TOKEN_LENGTH];
+	int Act;
+
+	pLine->mAct=-1;
+	pLine->mIsLabel=0;
+	pLine->mExe=SEQ_EXE_CODE_NO;
+	pSeq=ExtractTokenToBuffer(pSeq,Token,sizeof(Token));
+	if(!pSeq)
+		return -1;//empty line
+	if(!strcmp(Token,SEQ_EXE_CODE_LABEL_STR))
+	{
+		pSeq=ExtractTokenToBuffer(pSeq,pLine->mLabel,sizeof(pLine->mLabel));
+		if(pSeq)
+			pLine->mIsLabel=1;
+		return -1;
+	}
+	if(!strcmp(Token,SEQ_EXE_CODE_ASYNC_STR)) pLine->mExe=SEQ_EXE_CODE_ASYNC;
+	if(!strcmp(Token,SEQ_EXE_CODE_SYNC_STR)) pLine->mExe=SEQ_EXE_CODE_SYNC;
+
+	pSeq=ExtractTokenToBuffer(pSeq,Token,sizeof(Token));
+	if(!pSeq)
+		return -1;//no action string
+	for(Act=0;Act<SEQ_ACT_NO;Act++)
+		if(!strcmp(Token,ActStr[Act]))
+			break;
+	if(Act==SEQ_ACT_NO)
+	{
+		fprintf(stderr,"%s:%d: warning: unknown action '%s' ignored\n",SrcName,SrcLineNo,Token);
+		return -1;
+	}
+	switch(Act)
+	{
+	case SEQ_ACT_DELAY:
+		pSeq=ExtractTokenToBuffer(pSeq,Token,sizeof(Token));
+		if(!pSeq) return -1;
+		pLine->mArg[0]=(unsigned long)atol(Token) & 0xFFFFFFFFUL;
+		break;
+	case SEQ_ACT_RPT:
+		pSeq=ExtractTokenToBuffer(pSeq,pLine->mLabel,sizeof(pLine->mLabel));
+		if(!pSeq) return -1;
+		pSeq=ExtractTokenToBuffer(pSeq,Token,sizeof(Token));
+		pLine->mArg[1]=pSeq?((unsigned long)atoi(Token) & 0xFFFF):0;//no repetitions means pure jump
+		break;
+	case SEQ_ACT_MOVE_FRD:
+	case SEQ_ACT_MOVE_BWR:
+		pSeq=ExtractTokenToBuffer(pSeq,Token,sizeof(Token));
+		if(!pSeq) return -1;
+		pLine->mArg[0]=(unsigned long)atoi(Token) & 0xFFFF;
+		pSeq=ExtractTokenToBuffer(pSeq,Token,sizeof(Token));
+		if(!pSeq) return -1;
+		pLine->mArg[1]=(unsigned long)atoi(Token) & 0xFF;
+		break;
+	case SEQ_ACT_TURN_HEAD:
+	case SEQ_ACT_LEFT_ARM:
+	case SEQ_ACT_RIGHT_ARM:
+	case SEQ_ACT_ARMS_SYNC_MOVE:
+	case SEQ_ACT_ARMS_OPOSIT_MOVE:
+		pSeq=ExtractTokenToBuffer(pSeq,Token,sizeof(Token));
+		if(!pSeq) return -1;
+		pLine->mArg[0]=(unsigned long)atoi(Token) & 0xFFFF;
+		break;
+	default://actions without arguments
+		break;
+	}
+	pLine->mAct=Act;
+	return Act;
+}
+
+//find offset of the instruction following the label
+//the same search as the former cExeMngr::FindLineNoForLabel: first label wins and search stops at END
+static unsigned FindLabelTarget(const char *pLabel)
+{
+	int i;
+
+	for(i=0;i<LineNo;i++)
+	{
+		if(Line[i].mIsLabel)
+		{
+			if(!strcmp(Line[i].mLabel,pLabel))
+				return Line[i].mOffset;
+		}
+		else if(Line[i].mAct==SEQ_ACT_END)
+			break;
+	}
+	return SEQ_NO_JUMP_TARGET;
+}
+
+//compile collected program lines and write its table to the output
+static void CompileProgram(FILE *pOut)
+{
+	int i,j;
+	unsigned Offset=0;
+	unsigned long Arg[2];
+	int ArgNo;
+	int EndFound=0;
+
+	if(!LineNo && !ProgName[0])
+		return;//nothing before the first program
+	//first pass - parse lines up to END and compute instruction offsets
+	for(i=0;i<LineNo;i++)
+	{
+		Line[i].mOffset=Offset;
+		if(EndFound)
+		{
+			Line[i].mAct=-1;//never executed
+			Line[i].mIsLabel=0;
+			continue;
+		}
+		if(Line[i].mAct>=0)
+			Offset+=1+ArgSize[Line[i].mAct];
+		if(Line[i].mAct==SEQ_ACT_END)
+			EndFound=1;
+	}
+	if(!EndFound)
+	{
+		fprintf(stderr,"%s: error: program %s is not terminated by %s\n",SrcName,ProgName,SEQ_ACT_END_STR);
+		exit(1);
+	}
+	if(Offset>SEQC_MAX_PROG_SIZE)
+	{
+		fprintf(stderr,"%s: error: program %s is too long\n",SrcName,ProgName);
+		exit(1);
+	}
+	//second pass - emit bytecode
+	fprintf(pOut,"const static BYTE %s[]={\n",ProgName);
+	for(i=0;i<LineNo;i++)
+	{
+		if(Line[i].mAct<0)
+		{
+			if(Line[i].mIsLabel)
+				fprintf(pOut,"\t%25s\t/* %4u: %s */\n","",Line[i].mOffset,Comment[i]);
+			continue;
+		}
+		ArgNo=0;
+		switch(Line[i].mAct)
+		{
+		case SEQ_ACT_RPT:
+			Arg[0]=FindLabelTarget(Line[i].mLabel);
+			Arg[1]=Line[i].mArg[1];
+			if(Arg[0]==SEQ_NO_JUMP_TARGET)
+				fprintf(stderr,"%s: warning: label '%s' not found in program %s\n",SrcName,Line[i].mLabel,ProgName);
+			break;
+		default:
+			Arg[0]=Line[i].mArg[0];
+			Arg[1]=Line[i].mArg[1];
+			break;
+		}
+		fprintf(pOut,"\t0x%02X,",SEQ_OP(Line[i].mAct,Line[i].mExe));
+		//arguments are WORDs except DLY DWORD and speed profile BYTE
+		for(j=0;j<ArgSize[Line[i].mAct];j++)
+		{
+			if(Line[i].mAct==SEQ_ACT_DELAY)
+				fprintf(pOut,"0x%02lX,",(Arg[0]>>(8*j))&0xFF);
+			else
+				fprintf(pOut,"0x%02lX,",(Arg[j/2]>>(8*(j%2)))&0xFF);
+			ArgNo++;
+		}
+		for(j=ArgNo;j<4;j++)
+			fprintf(pOut,"     ");
+		fprintf(pOut,"\t/* %4u: %s */\n",Line[i].mOffset,Comment[i]);
+	}
+	fprintf(pOut,"};\n\n");
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *pIn;
+	FILE *pOut;
+	char Buf[SEQC_MAX_LINE];
+	char *p;
+
+	if(argc!=3)
+	{
+		fprintf(stderr,"usage: seqc <source.seq> <output.h>\n");
+		return 1;
+	}
+	SrcName=argv[1];
+	pIn=fopen(argv[1],"r");
+	if(!pIn)
+	{
+		fprintf(stderr,"seqc: cannot open %s\n",argv[1]);
+		return 1;
+	}
+	pOut=fopen(argv[2],"w");
+	if(!pOut)
+	{
+		fprintf(stderr,"seqc: cannot create %s\n",argv[2]);
+		return 1;
+	}
+	p=strrchr(argv[1],'/');//source file name without path
+	fprintf(pOut,"/*\n* File: mng_exe_seq.h\n* Description: Walle Simply Sequencer programs compiled by tools/seqc from %s\n",p?p+1:argv[1]);
+	fprintf(pOut,"* IMPORTANT! Generated file - do not edit, change sequence source and rebuild\n*/\n");
+	fprintf(pOut,"#ifndef MNG_EXE_SEQ_H_\n#define MNG_EXE_SEQ_H_\n\n#include \"type.h\"\n#include \"mng_exe_seq_def.h\"\n\n");
+	LineNo=0;
+	ProgName[0]=0;
+	while(fgets(Buf,sizeof(Buf),pIn))
+	{
+		SrcLineNo++;
+		for(p=Buf;*p;p++)//line separators and tabs are treated as spaces
+			if(*p=='\t' || *p=='\r' || *p=='\n')
+				*p=' ';
+		while(p>Buf && p[-1]==' ')//remove trailing spaces
+			*--p=0;
+		if(!strncmp(Buf,"//",2))
+		{//comment lines just before program line are copied to the output before the program table
+			if(strlen(Pending)+strlen(Buf)+2<sizeof(Pending))
+			{
+				strcat(Pending,Buf);
+				strcat(Pending,"\n");
+			}
+			continue;
+		}
+		if(!Buf[0])
+		{
+			Pending[0]=0;//comments not followed by program line are not copied
+			continue;
+		}
+		if(!strncmp(Buf,"program ",8))
+		{
+			CompileProgram(pOut);
+			fprintf(pOut,"%s",Pending);
+			Pending[0]=0;
+			ExtractTokenToBuffer(Buf+8,ProgName,sizeof(ProgName));
+			LineNo=0;
+			continue;
+		}
+		if(!ProgName[0])
+		{
+			fprintf(stderr,"%s:%d: error: sequence line outside of program\n",SrcName,SrcLineNo);
+			return 1;
+		}
+		if(LineNo==SEQC_MAX_LINES)
+		{
+			fprintf(stderr,"%s:%d: error: too many lines in program %s\n",SrcName,SrcLineNo,ProgName);
+			return 1;
+		}
+		strcpy(Comment[LineNo],Buf);
+		p=strstr(Buf,"//");
+		if(p)
+			*p=0;//remove comment
+		ParseLine(Buf,&Line[LineNo]);
+		LineNo++;
+	}
+	CompileProgram(pOut);
+	fprintf(pOut,"#endif /*MNG_EXE_SEQ_H_*/\n");
+	fclose(pIn);
+	fclose(pOut);
+	return 0;
+}
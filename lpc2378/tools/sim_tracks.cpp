@@ -0,0 +1,159 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        sim_tracks.cpp
+* Description: Host simulation of track speed regulator (make host_bench)
+*              Runs left and right track control tasks of tsk_tracks.c on the track motors and encoders
+*              model of hw_host.c. Every move is done for motors with different efficiency and single
+*              speed profile. Reports:
+*              drift - difference of the left and right track distance when the move ends (pulses)
+*              speed error - average pulse length of both tracks against the speed goal (per mille)
+*              for regulated tracks (measured) and for fixed motor counts (open loop, from the model).
+*              Fails when regulated drift or speed error exceeds SIM_MAX_DRIFT or SIM_MAX_SPEED_ERROR
+*              or when any track pulse is dropped, so it is also a regression test of the regulator.
+*              Usage: sim_tracks
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include "wrp_kernel.hpp"
+#include "tsk_tracks.h"
+#include "hw_timer.h"
+#include "hw_gpio.h"
+#include "hw_host.h"
+#include "host_bench.h"
+
+//Kernel must be constructed before any other OS object (see main.cpp)
+cKernel cKernel::m_Kernel;
+
+#define SIM_PULSES				80 //number of track pulses of every move
+#define SIM_START_PULSES		(SIM_PULSES/4) //speed is measured from that pulse to the end of the move
+#define SIM_END_PULSES			(SIM_PULSES-2)
+#define SIM_MAX_DRIFT			1000 //max regulated drift in 1/1000 of the pulse
+#define SIM_MAX_SPEED_ERROR		20 //max regulated speed error in per mille
+#define SIM_PRIO				20
+
+//simulated move
+typedef struct
+{
+	const char *mName;
+	WORD mLeftEfficiency;//left motor efficiency in per mille
+	WORD mRightEfficiency;//right motor efficiency in per mille
+	BYTE mProfile;//LOW_PROFILE, MID_PROFILE or HIGH_PROFILE
+} sSimMove;
+
+static const sSimMove SimMove[]=
+{
+	{"calibrated motors",HOST_LEFT_MOTOR_EFFICIENCY,HOST_RIGHT_MOTOR_EFFICIENCY,MID_PROFILE},
+	{"left 4% weaker",HOST_LEFT_MOTOR_EFFICIENCY-40,HOST_RIGHT_MOTOR_EFFICIENCY,MID_PROFILE},
+	{"right 4% weaker",HOST_LEFT_MOTOR_EFFICIENCY,HOST_RIGHT_MOTOR_EFFICIENCY-40,LOW_PROFILE},
+	{"both 3% weaker",HOST_LEFT_MOTOR_EFFICIENCY-30,HOST_RIGHT_MOTOR_EFFICIENCY-30,HIGH_PROFILE},
+};
+
+//distance of the track in 1/1000 of the pulse
+static long SimDistance(BYTE InTrack)
+{
+	return (long)(HostGetTrackDistance(InTrack)/(HOST_TRACK_DISTANCE_UNIT/1000));
+}//SimDistance
+
+class cSimTracks: public cThread
+{
+	OS_STK m_ThreadStack[OS_TASK_STACK_SIZE];
+	BOOL Move(const sSimMove *pMove);
+	virtual void Run();
+public:
+	cSimTracks(){Create((OS_STK *)&m_ThreadStack[0],(OS_STK *)&m_ThreadStack[OS_TASK_STACK_SIZE-1],SIM_PRIO);};
+};
+
+//run the move and print the results, returns FALSE when regulated results exceed allowed limits
+BOOL cSimTracks::Move(const sSimMove *pMove)
+{
+	BYTE LeftCount,RightCount;
+	WORD Goal;
+	long LeftStart,RightStart,Drift,SpeedError,OpenDrift,OpenSpeedError;
+	DWORD StartTicks,EndTicks,LeftLength,RightLength;
+	long Distance=0;
+
+	switch(pMove->mProfile)
+	{
+	case LOW_PROFILE:
+		LeftCount=LOW_LEFT_MOTOR_COUNT;RightCount=LOW_RIGHT_MOTOR_COUNT;Goal=LOW_PULSE_LENGTH_GOAL;
+		break;
+	case HIGH_PROFILE:
+		LeftCount=HIGH_LEFT_MOTOR_COUNT;RightCount=HIGH_RIGHT_MOTOR_COUNT;Goal=HIGH_PULSE_LENGTH_GOAL;
+		break;
+	default:
+		LeftCount=MID_LEFT_MOTOR_COUNT;RightCount=MID_RIGHT_MOTOR_COUNT;Goal=MID_PULSE_LENGTH_GOAL;
+		break;
+	}
+	HostSetTrackMotors(pMove->mLeftEfficiency,pMove->mRightEfficiency);
+
+	//open loop - faster track covers SIM_PULSES, the slower one covers less
+	LeftLength=HostGetTrackPulseLength(LEFT_TRACK_TSK,LeftCount);
+	RightLength=HostGetTrackPulseLength(RIGHT_TRACK_TSK,RightCount);
+	OpenDrift=(LeftLength>RightLength)?(SIM_PULSES*1000L*(LeftLength-RightLength))/LeftLength:
+			(SIM_PULSES*1000L*(RightLength-LeftLength))/RightLength;
+	OpenSpeedError=(1000L*((long)(LeftLength+RightLength)/2-Goal))/Goal;
+
+	LeftStart=SimDistance(LEFT_TRACK_TSK);
+	RightStart=SimDistance(RIGHT_TRACK_TSK);
+	RunTracksPulses(SIM_PULSES,MOTOR_FORWARD,SIM_PULSES,MOTOR_FORWARD,pMove->mProfile);
+	while(GetCurrentTrackPulses()<SIM_START_PULSES)
+		Delay(1);
+	StartTicks=GetTimer3Ticks();
+	Distance=-(SimDistance(LEFT_TRACK_TSK)+SimDistance(RIGHT_TRACK_TSK));
+	while(IsTrackMoving() && GetCurrentTrackPulses()<SIM_END_PULSES)
+		Delay(1);
+	EndTicks=GetTimer3Ticks();
+	Distance+=SimDistance(LEFT_TRACK_TSK)+SimDistance(RIGHT_TRACK_TSK);
+	while(IsTrackMoving())
+		Delay(1);
+	Drift=(SimDistance(LEFT_TRACK_TSK)-LeftStart)-(SimDistance(RIGHT_TRACK_TSK)-RightStart);
+	if(Drift<0)Drift=-Drift;
+	//average pulse length of both tracks = time / (distance of both tracks / 2)
+	SpeedError=Distance?(1000L*((long)((2000LL*(EndTicks-StartTicks))/Distance)-Goal))/Goal:1000;
+
+	printf("%-18s %-5s  drift %2ld.%03ld (open loop %2ld.%03ld)   speed error %4ld (open loop %4ld)\n",pMove->mName,
+			(pMove->mProfile==LOW_PROFILE)?"LOW":(pMove->mProfile==HIGH_PROFILE)?"HIGH":"MID",
+			Drift/1000,Drift%1000,OpenDrift/1000,OpenDrift%1000,SpeedError,OpenSpeedError);
+	return (Drift<=SIM_MAX_DRIFT) && (SpeedError<=SIM_MAX_SPEED_ERROR) && (SpeedError>=-SIM_MAX_SPEED_ERROR);
+}//cSimTracks::Move
+
+void cSimTracks::Run()
+{
+	BYTE i;
+	BOOL Passed=TRUE;
+
+	Delay(OS_TICKS_PER_SEC);//track pulse buffers are created by dispatcher thread (InitPort2Int)
+	if((::OSTaskCreateExt(LeftTrackControlTask,NULL,&LeftTrackControlTaskStack[LEFT_TRACK_CTRL_STACK_SIZE-1],LEFT_TRACK_CTRL_TASK_PRIORITY,
+			LEFT_TRACK_CTRL_TASK_PRIORITY,&LeftTrackControlTaskStack[0],LEFT_TRACK_CTRL_STACK_SIZE,NULL,OS_TASK_OPT_STK_CHK|OS_TASK_OPT_STK_CLR)!= OS_NO_ERR)
+		|| (::OSTaskCreateExt(RightTrackControlTask,NULL,&RightTrackControlTaskStack[RIGHT_TRACK_CTRL_STACK_SIZE-1],RIGHT_TRACK_CTRL_TASK_PRIORITY,
+			RIGHT_TRACK_CTRL_TASK_PRIORITY,&RightTrackControlTaskStack[0],RIGHT_TRACK_CTRL_STACK_SIZE,NULL,OS_TASK_OPT_STK_CHK|OS_TASK_OPT_STK_CLR)!= OS_NO_ERR))
+		THREAD_CREATE_EXCEPTION;
+
+	printf("Track moves of %d pulses, drift in pulses, speed error in per mille of the pulse length goal\n",SIM_PULSES);
+	for(i=0;i<sizeof(SimMove)/sizeof(SimMove[0]);i++)
+		if(!Move(&SimMove[i]))
+			Passed=FALSE;
+	printf("dropped track pulses %u\n",(unsigned)GetTrackDroppedPulses());
+	if(GetTrackDroppedPulses())
+		Passed=FALSE;
+	printf("%s\n",Passed?"PASSED":"FAILED");
+	exit(Passed?EXIT_SUCCESS:EXIT_FAILURE);
+}//cSimTracks::Run
+
+cSimTracks SimTracks;
+
+int	main (void)
+{
+	Kernel.Start();
+	return 0;
+}
@@ -0,0 +1,244 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        test_mutex.cpp
+* Description: Host test of uCOS-II mutexes priority inheritance (os_mutex.c) (make host_test)
+*              Priority inversion scenarios driven step by step by the test thread. Low, waiter and high
+*              threads acquire and release mutexes on request, after every step owner priority and
+*              OSTCBPrioTbl[] entries of the PIPs are checked:
+*              - high priority task waits for the mutex owned by low priority one (owner runs at PIP)
+*              - lower priority task waits (owner keeps its priority)
+*              - MemMutex (PIP 0) taken while the owner runs at PIP of other mutex and the other way
+*                round (nested mutexes - owner runs at the highest PIP required and gets back to the
+*                lower PIP when it releases MemMutex)
+*              - waiting task times out (owner gets back to its priority)
+*              PIPs 1..4 are reserved by dispatcher and drivers mutexes so the test mutex A uses not used
+*              priority above the test threads.
+*              Fails when any check fails.
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include "wrp_kernel.hpp"
+#include "host_bench.h"
+
+//Kernel must be constructed before any other OS object (see main.cpp)
+cKernel cKernel::m_Kernel;
+
+#define TEST_MUTEX_PIP_A			18 //PIP of the test mutex A - not used priority above the test threads
+#define TEST_MUTEX_PRIO				13 //test thread drives the scenarios so it is above all others
+#define TEST_MUTEX_HIGH_PRIO		20
+#define TEST_MUTEX_WAITER_PRIO		22
+#define TEST_MUTEX_LOW_PRIO			30
+#define TEST_MUTEX_TIMEOUT			3 //ticks the high priority task waits in timeout scenario
+
+#define TEST_CMD_ACQUIRE			1
+#define TEST_CMD_RELEASE			2
+
+#define TEST_PRIO_RESERVED			((OS_TCB *)1) //PIP entry of OSTCBPrioTbl[] when nobody runs at PIP
+
+static cMutex MutexA(TEST_MUTEX_PIP_A);
+
+static BOOL Passed=TRUE;
+
+//prints result of the check
+static void Check(const char *pInName, BOOL InResult)
+{
+	printf("%-60s %s\n",pInName,InResult?"OK":"FAILED");
+	if(!InResult)
+		Passed=FALSE;
+}//Check
+
+//thread which acquires and releases mutexes on request of the test thread
+class cTestMutexTask: public cThread
+{
+	OS_STK m_ThreadStack[OS_TASK_STACK_SIZE];
+	cEvent m_Go;//signaled when there is a request
+	cMutex *m_pMutex;//mutex of the request
+	WORD m_TimeOut;
+	volatile BYTE m_Cmd;
+	volatile BYTE m_Result;//result of the last request or OS_TIMEOUT when it is not finished yet
+	virtual void Run()
+	{
+		for(;;)
+		{
+			m_Go.Wait();
+			if(m_Cmd==TEST_CMD_ACQUIRE)
+				m_Result=m_pMutex->Acquire(m_TimeOut);
+			else
+				m_Result=m_pMutex->Release();
+			m_Cmd=0;
+		}
+	};
+	void Request(BYTE InCmd, cMutex& rMutex, WORD InTimeOut)
+	{
+		m_Cmd=InCmd;
+		m_pMutex=&rMutex;
+		m_TimeOut=InTimeOut;
+		m_Result=OS_TIMEOUT;
+		m_Go.Signal();
+	};
+public:
+	cTestMutexTask(BYTE InPrio){Create((OS_STK *)&m_ThreadStack[0],(OS_STK *)&m_ThreadStack[OS_TASK_STACK_SIZE-1],InPrio);};
+	void Acquire(cMutex& rMutex, WORD InTimeOut=OS_INFINITE){Request(TEST_CMD_ACQUIRE,rMutex,InTimeOut);};
+	void Release(cMutex& rMutex){Request(TEST_CMD_RELEASE,rMutex,OS_INFINITE);};
+	//TRUE when the request is done with OS_NO_ERR
+	BOOL IsDone(){return !m_Cmd && m_Result==OS_NO_ERR;};
+	//TRUE when the task waits for the request to be done
+	BOOL IsWaiting(){return m_Cmd!=0;};
+	BYTE GetResult(){return m_Result;};
+	//priority the task runs at now
+	BYTE GetPrio(){return OSTCBPrioTbl[GetThreadPriority()]->OSTCBPrio;};
+	//TRUE when the task runs at InPip and OSTCBPrioTbl[InPip] points to it
+	BOOL RunsAt(BYTE InPip){return GetPrio()==InPip && OSTCBPrioTbl[InPip]==OSTCBPrioTbl[GetThreadPriority()];};
+};
+
+static cTestMutexTask High(TEST_MUTEX_HIGH_PRIO);
+static cTestMutexTask Waiter(TEST_MUTEX_WAITER_PRIO);
+static cTestMutexTask Low(TEST_MUTEX_LOW_PRIO);
+
+//TRUE when nobody runs at InPip
+static BOOL IsReserved(BYTE InPip)
+{
+	return OSTCBPrioTbl[InPip]==TEST_PRIO_RESERVED;
+}//IsReserved
+
+//TRUE when all tasks run at their priorities and PIPs are not used
+static BOOL IsIdle()
+{
+	return High.GetPrio()==TEST_MUTEX_HIGH_PRIO && Waiter.GetPrio()==TEST_MUTEX_WAITER_PRIO
+			&& Low.GetPrio()==TEST_MUTEX_LOW_PRIO && IsReserved(MEM_MUTEX_PIP) && IsReserved(TEST_MUTEX_PIP_A);
+}//IsIdle
+
+class cTestMutex: public cThread
+{
+	OS_STK m_ThreadStack[OS_TASK_STACK_SIZE];
+	void Step(){Delay(1);};//requested tasks run until they wait
+	void TestInversion();
+	void TestLowerWaiter();
+	void TestNested();
+	void TestNestedMemFirst();
+	void TestTimeout();
+	virtual void Run();
+public:
+	cTestMutex(){Create((OS_STK *)&m_ThreadStack[0],(OS_STK *)&m_ThreadStack[OS_TASK_STACK_SIZE-1],TEST_MUTEX_PRIO);};
+};
+
+//high priority task waits for the mutex owned by low priority one
+void cTestMutex::TestInversion()
+{
+	printf("\nInversion - high priority task waits for low priority owner\n");
+	Low.Acquire(MutexA);Step();
+	Check("low owns A at its priority",Low.IsDone() && Low.GetPrio()==TEST_MUTEX_LOW_PRIO);
+	High.Acquire(MutexA);Step();
+	Check("high waits for A",High.IsWaiting());
+	Check("low runs at PIP of A",Low.RunsAt(TEST_MUTEX_PIP_A));
+	Low.Release(MutexA);Step();
+	Check("low releases A and gets back to its priority",Low.IsDone() && Low.GetPrio()==TEST_MUTEX_LOW_PRIO);
+	Check("high owns A at its priority",High.IsDone() && High.GetPrio()==TEST_MUTEX_HIGH_PRIO);
+	Check("PIP of A reserved",IsReserved(TEST_MUTEX_PIP_A));
+	High.Release(MutexA);Step();
+	Check("all tasks at their priorities",High.IsDone() && IsIdle());
+}//cTestMutex::TestInversion
+
+//lower priority task waits for the mutex so the owner keeps its priority
+void cTestMutex::TestLowerWaiter()
+{
+	printf("\nLower priority task waits for the owner\n");
+	High.Acquire(MutexA);Step();
+	Low.Acquire(MutexA);Step();
+	Check("low waits for A",Low.IsWaiting());
+	Check("high keeps its priority",High.GetPrio()==TEST_MUTEX_HIGH_PRIO && IsReserved(TEST_MUTEX_PIP_A));
+	High.Release(MutexA);Step();
+	Check("low owns A at its priority",Low.IsDone() && Low.GetPrio()==TEST_MUTEX_LOW_PRIO);
+	Low.Release(MutexA);Step();
+	Check("all tasks at their priorities",Low.IsDone() && IsIdle());
+}//cTestMutex::TestLowerWaiter
+
+//MemMutex taken while the owner runs at PIP of A
+void cTestMutex::TestNested()
+{
+	printf("\nNested - MemMutex (PIP %d) taken while owner runs at PIP of A (%d)\n",MEM_MUTEX_PIP,TEST_MUTEX_PIP_A);
+	Low.Acquire(MutexA);Step();
+	High.Acquire(MutexA);Step();
+	Check("low runs at PIP of A",Low.RunsAt(TEST_MUTEX_PIP_A));
+	Low.Acquire(Kernel.MemMutex);Step();
+	Check("low owns MemMutex and keeps PIP of A",Low.IsDone() && Low.RunsAt(TEST_MUTEX_PIP_A));
+	Waiter.Acquire(Kernel.MemMutex);Step();
+	Check("waiter waits for MemMutex",Waiter.IsWaiting());
+	Check("low runs at PIP of MemMutex",Low.RunsAt(MEM_MUTEX_PIP));
+	Check("PIP of A reserved",IsReserved(TEST_MUTEX_PIP_A));
+	Low.Release(Kernel.MemMutex);Step();
+	Check("low releases MemMutex and gets back to PIP of A",Low.IsDone() && Low.RunsAt(TEST_MUTEX_PIP_A));
+	Check("PIP of MemMutex reserved",IsReserved(MEM_MUTEX_PIP));
+	Check("waiter owns MemMutex at its priority",Waiter.IsDone() && Waiter.GetPrio()==TEST_MUTEX_WAITER_PRIO);
+	Waiter.Release(Kernel.MemMutex);Step();
+	Low.Release(MutexA);Step();
+	Check("low releases A and gets back to its priority",Low.IsDone() && Low.GetPrio()==TEST_MUTEX_LOW_PRIO);
+	Check("high owns A",High.IsDone());
+	High.Release(MutexA);Step();
+	Check("all tasks at their priorities",High.IsDone() && IsIdle());
+}//cTestMutex::TestNested
+
+//owner runs at PIP of MemMutex when a task starts to wait for A owned as well
+void cTestMutex::TestNestedMemFirst()
+{
+	printf("\nNested - owner of A runs at PIP of MemMutex when high priority task waits for A\n");
+	Low.Acquire(MutexA);Step();
+	Low.Acquire(Kernel.MemMutex);Step();
+	Waiter.Acquire(Kernel.MemMutex);Step();
+	Check("low runs at PIP of MemMutex",Low.RunsAt(MEM_MUTEX_PIP));
+	High.Acquire(MutexA);Step();
+	Check("high waits for A",High.IsWaiting());
+	Check("low is not lowered to PIP of A",Low.RunsAt(MEM_MUTEX_PIP) && IsReserved(TEST_MUTEX_PIP_A));
+	Low.Release(Kernel.MemMutex);Step();
+	Check("low releases MemMutex and gets to PIP of A",Low.IsDone() && Low.RunsAt(TEST_MUTEX_PIP_A));
+	Check("PIP of MemMutex reserved",IsReserved(MEM_MUTEX_PIP));
+	Waiter.Release(Kernel.MemMutex);Step();
+	Low.Release(MutexA);Step();
+	Check("low releases A and gets back to its priority",Low.IsDone() && Low.GetPrio()==TEST_MUTEX_LOW_PRIO);
+	High.Release(MutexA);Step();
+	Check("all tasks at their priorities",Waiter.IsDone() && High.IsDone() && IsIdle());
+}//cTestMutex::TestNestedMemFirst
+
+//high priority task stops to wait for the mutex
+void cTestMutex::TestTimeout()
+{
+	printf("\nTimeout - high priority task stops to wait for the owner\n");
+	Low.Acquire(MutexA);Step();
+	High.Acquire(MutexA,TEST_MUTEX_TIMEOUT);Step();
+	Check("low runs at PIP of A",Low.RunsAt(TEST_MUTEX_PIP_A));
+	Delay(TEST_MUTEX_TIMEOUT+1);
+	Check("high times out",!High.IsWaiting() && High.GetResult()==OS_TIMEOUT);
+	Check("low gets back to its priority",Low.GetPrio()==TEST_MUTEX_LOW_PRIO && IsReserved(TEST_MUTEX_PIP_A));
+	Low.Release(MutexA);Step();
+	Check("all tasks at their priorities",Low.IsDone() && IsIdle());
+}//cTestMutex::TestTimeout
+
+void cTestMutex::Run()
+{
+	Check("all tasks at their priorities",IsIdle());
+	TestInversion();
+	TestLowerWaiter();
+	TestNested();
+	TestNestedMemFirst();
+	TestTimeout();
+	printf("%s\n",Passed?"PASSED":"FAILED");
+	exit(Passed?EXIT_SUCCESS:EXIT_FAILURE);
+}//cTestMutex::Run
+
+cTestMutex TestMutexThread;
+
+int	main (void)
+{
+	Kernel.Start();
+	return 0;
+}
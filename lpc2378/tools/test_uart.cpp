@@ -0,0 +1,206 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        test_uart.cpp
+* Description: Host test of UART0 TX and RX ring buffers of hw_uart.c (make host_test)
+*              hw_uart.c runs on UART0 registers model of test_uart_hw.c. Line thread sends and receives
+*              TEST_UART_CHARS_PER_TICK characters every OS Tick (115200 baud) raising UART0 interrupts.
+*              TX - string longer than TX buffer is put at once so TX buffer overflows, checked against
+*                   UART0_TX_OVERFLOW_POLICY the test is built with (test_uart_drop, test_uart_block,
+*                   test_uart_oldest): characters order, which characters are dropped, overflow counter,
+*                   TX buffer max level and line throughput
+*              RX - burst longer than RX buffer is received while nobody reads so RX buffer overflows,
+*                   next a line is read by a task waiting for characters
+*              Fails when any check fails.
+*              Usage: test_uart_drop | test_uart_block | test_uart_oldest
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include "wrp_kernel.hpp"
+#include "hw_uart.h"
+#include "test_uart_hw.h"
+#include "host_bench.h"
+
+//Kernel must be constructed before any other OS object (see main.cpp)
+cKernel cKernel::m_Kernel;
+
+#define TEST_UART_CHARS_PER_TICK	(115200/10/OS_TICKS_PER_SEC) //8N1 characters sent and received every OS Tick
+#define TEST_UART_TX_CHARS			3000 //characters put at once into TX buffer
+#define TEST_UART_RX_CHARS			100 //characters of RX burst
+#define TEST_UART_TIMEOUT			(5*OS_TICKS_PER_SEC) //max time of the line to send characters
+#define TEST_UART_LINE_PRIO			19
+#define TEST_UART_PRIO				20
+
+static char TxPattern[TEST_UART_TX_CHARS+1];
+static char RxPattern[TEST_UART_RX_CHARS+1];
+static const char RxLine[]="walle\r";
+
+static BOOL Passed=TRUE;
+
+//prints result of the check
+static void Check(const char *pInName, BOOL InResult)
+{
+	printf("%-52s %s\n",pInName,InResult?"OK":"FAILED");
+	if(!InResult)
+		Passed=FALSE;
+}//Check
+
+//fills buffer with pseudo random printable characters (there is not '\n' and '\r' sent as two characters)
+static void FillPattern(char *pOutBuf, int InNo, DWORD InSeed)
+{
+	int i;
+
+	for(i=0;i<InNo;i++)
+	{
+		InSeed=InSeed*1103515245UL+12345UL;
+		pOutBuf[i]='!'+(char)((InSeed>>16)%('~'-'!'+1));
+	}
+	pOutBuf[InNo]=0;
+}//FillPattern
+
+//TRUE when characters of pInSub are in pInStr in the same order
+static BOOL IsSubsequence(const char *pInSub, int InSubNo, const char *pInStr, int InStrNo)
+{
+	int i,j=0;
+
+	for(i=0;i<InStrNo && j<InSubNo;i++)
+		if(pInStr[i]==pInSub[j])
+			j++;
+	return j==InSubNo;
+}//IsSubsequence
+
+//TRUE when InNo characters of both buffers are the same
+static BOOL IsSame(const char *pIn1, const char *pIn2, int InNo)
+{
+	while(InNo--)
+		if(*pIn1++!=*pIn2++)
+			return FALSE;
+	return TRUE;
+}//IsSame
+
+//line model - UART0 sends and receives characters at 115200 baud
+class cTestUartLine: public cThread
+{
+	OS_STK m_ThreadStack[OS_TASK_STACK_SIZE];
+	virtual void Run()
+	{
+		for(;;)
+		{
+			Delay(1);
+			TestUartLine(TEST_UART_CHARS_PER_TICK,TEST_UART_CHARS_PER_TICK);
+		}
+	};
+public:
+	cTestUartLine(){Create((OS_STK *)&m_ThreadStack[0],(OS_STK *)&m_ThreadStack[OS_TASK_STACK_SIZE-1],TEST_UART_LINE_PRIO);};
+};
+
+class cTestUart: public cThread
+{
+	OS_STK m_ThreadStack[OS_TASK_STACK_SIZE];
+	void TestTx();
+	void TestRx();
+	virtual void Run();
+public:
+	cTestUart(){Create((OS_STK *)&m_ThreadStack[0],(OS_STK *)&m_ThreadStack[OS_TASK_STACK_SIZE-1],TEST_UART_PRIO);};
+};
+
+void cTestUart::TestTx()
+{
+	BYTE Policy=TestUart0TxPolicy();
+	DWORD Start,PutTicks,SentTicks,Overflows;
+	int Expected,SentNo;
+	const char *pSent=TestUartSent();
+
+	FillPattern(TxPattern,TEST_UART_TX_CHARS,Kernel.Ticks());
+	TestUartClearSent();
+	Start=Kernel.Ticks();
+	TestUart0PutStr(TxPattern);
+	PutTicks=Kernel.Ticks()-Start;
+	Overflows=TestGetUart0TxOverflows();
+	//each overflow is dropped character unless the task waits
+	Expected=(Policy==UART0_TX_BLOCK)?TEST_UART_TX_CHARS:TEST_UART_TX_CHARS-(int)Overflows;
+	while(TestUartSentNo()<Expected && Kernel.Ticks()-Start<TEST_UART_TIMEOUT)
+		Delay(1);
+	SentTicks=Kernel.Ticks()-Start;
+	Delay(2);//nothing more is sent
+	SentNo=TestUartSentNo();
+
+	printf("TX policy %s: %d characters put in %lu ticks, %d sent in %lu ticks (%lu characters/s)\n",
+			(Policy==UART0_TX_BLOCK)?"block":(Policy==UART0_TX_DROP_OLDEST)?"drop oldest":"drop",
+			TEST_UART_TX_CHARS,(unsigned long)PutTicks,SentNo,(unsigned long)SentTicks,
+			SentTicks?(unsigned long)(SentNo*OS_TICKS_PER_SEC/SentTicks):0UL);
+	printf("TX overflows %lu, TX buffer max level %u\n",(unsigned long)Overflows,(unsigned)TestGetUart0TxMaxLevel());
+	Check("TX buffer overflows",Overflows>0);
+	Check("TX buffer max level is its capacity",TestGetUart0TxMaxLevel()==UART0_TX_BUFFER_SIZE-1);
+	Check("sent characters are put ones in the same order",(SentNo==Expected) && IsSubsequence(pSent,SentNo,TxPattern,TEST_UART_TX_CHARS));
+	switch(Policy)
+	{
+	case UART0_TX_BLOCK:
+		Check("block - all characters sent",(SentNo==TEST_UART_TX_CHARS) && IsSame(pSent,TxPattern,TEST_UART_TX_CHARS));
+		Check("block - task waits for the line",PutTicks>0);
+		break;
+	case UART0_TX_DROP_OLDEST:
+		Check("drop oldest - the newest characters sent",(SentNo>=UART0_TX_BUFFER_SIZE-1)
+				&& IsSame(pSent+SentNo-(UART0_TX_BUFFER_SIZE-1),TxPattern+TEST_UART_TX_CHARS-(UART0_TX_BUFFER_SIZE-1),UART0_TX_BUFFER_SIZE-1));
+		break;
+	default:
+		Check("drop - the oldest characters sent",(SentNo>=UART0_TX_BUFFER_SIZE) && IsSame(pSent,TxPattern,UART0_TX_BUFFER_SIZE));
+		break;
+	}
+	Check("TX FIFO not overrun",TestUartFifoOverruns()==0);
+}//cTestUart::TestTx
+
+void cTestUart::TestRx()
+{
+	char Line[16];
+	char Received[TEST_UART_RX_CHARS];
+	int ch,No=0;
+	DWORD Start,Ticks;
+	char *pLine;
+
+	//burst while nobody reads - RX buffer keeps UART0_RX_BUFFER_SIZE-1 characters
+	FillPattern(RxPattern,TEST_UART_RX_CHARS,Kernel.Ticks()+1);
+	TestUartReceive(RxPattern,TEST_UART_RX_CHARS);
+	while(No<TEST_UART_RX_CHARS && (ch=TestUart0CheckForCharacterReceived()))
+		Received[No++]=(char)ch;
+	printf("RX burst of %d characters, %d read, RX overflows %lu\n",TEST_UART_RX_CHARS,No,(unsigned long)TestGetUart0RxOverflows());
+	Check("RX buffer keeps the oldest characters",(No==UART0_RX_BUFFER_SIZE-1) && IsSame(Received,RxPattern,No));
+	Check("RX overflows counted",TestGetUart0RxOverflows()==TEST_UART_RX_CHARS-(UART0_RX_BUFFER_SIZE-1));
+
+	//task waits for characters received by the line
+	TestUartLineRx(RxLine);
+	Start=Kernel.Ticks();
+	pLine=TestUart0GetTrmlStr(Line,sizeof(Line));
+	Ticks=Kernel.Ticks()-Start;
+	printf("RX line read in %lu ticks\n",(unsigned long)Ticks);
+	Check("RX line read by waiting task",pLine && Ticks>0 && IsSame(Line,RxLine,sizeof(RxLine)-2) && !Line[sizeof(RxLine)-2]);
+	Check("RX buffer empty",!TestUart0CheckForCharacterReceived());
+	Check("RX FIFO not overrun",TestUartFifoOverruns()==0);
+}//cTestUart::TestRx
+
+void cTestUart::Run()
+{
+	TestInitUart0();
+	TestTx();
+	TestRx();
+	printf("%s\n",Passed?"PASSED":"FAILED");
+	exit(Passed?EXIT_SUCCESS:EXIT_FAILURE);
+}//cTestUart::Run
+
+cTestUartLine TestUartLineThread;
+cTestUart TestUartThread;
+
+int	main (void)
+{
+	Kernel.Start();
+	return 0;
+}
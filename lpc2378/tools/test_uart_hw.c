@@ -0,0 +1,235 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        test_uart_hw.c
+* Description: UART0 driver of hw_uart.c built with UART0 registers model for test_uart (make host_test)
+*              hw_uart.c is compiled here with U0THR, U0RBR, U0LSR, U0IIR, U0IER and UART0 VIC registers
+*              replaced by the model of UART0 FIFOs and interrupt identification. VIC channel of hw_host.c
+*              UART0 stub is not touched - UART0 interrupt is emulated by TestUartLine and TestUartReceive.
+*              Built once for every UART0_TX_OVERFLOW_POLICY (see TESTUART in Makefile).
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#include "os_cpu.h"
+#include "os_cfg.h"
+#include "os_ucos_ii.h"
+#include "type.h"
+#include "hw_lpc23xx.h"
+#include "test_uart_hw.h"
+
+#define TEST_UART_FIFO_SIZE		16 //UART0 TX and RX FIFO size
+
+//UART0 registers model
+typedef struct
+{
+	BYTE mTxFifo[TEST_UART_FIFO_SIZE];
+	BYTE mTxNo;//characters in TX FIFO, mTxFifo[0] is sent first
+	BYTE mRxFifo[TEST_UART_FIFO_SIZE];
+	BYTE mRxNo;//characters in RX FIFO, mRxFifo[0] is read first
+	BOOL mThrePending;//THRE interrupt pending (cleared by IIR read which returns it or by THR write)
+	DWORD mIer;
+	DWORD mFifoOverruns;
+	BYTE mThrDummy;//THR place of the character written into full TX FIFO
+} sTestUart;
+
+static sTestUart TestUart;
+static char TestUartLineBuf[TEST_UART_LINE_SIZE];//characters sent out by the line
+static WORD TestUartLineNo;
+static const char *pTestUartLineRx;//characters which will be received by the line model
+
+//VIC UART0 channel registers used by hw_uart.c (VIC of hw_host.c UART0 stub is kept)
+static DWORD TestVicVectAddr6;
+static DWORD TestVicIntEnable;
+static DWORD TestVicIntEnClr;
+
+//removes the first character of FIFO
+static BYTE TestUartFifoGet(BYTE *pInFifo, BYTE *pInNo)
+{
+	BYTE ch=pInFifo[0];
+	BYTE i;
+
+	(*pInNo)--;
+	for(i=0;i<*pInNo;i++)
+		pInFifo[i]=pInFifo[i+1];
+	return ch;
+}//TestUartFifoGet
+
+//THR write - returns place in TX FIFO for the character
+static BYTE *TestUartThr(void)
+{
+	TestUart.mThrePending=FALSE;
+	if(TestUart.mTxNo==TEST_UART_FIFO_SIZE)
+	{
+		TestUart.mFifoOverruns++;//character is lost as on UART0
+		return &TestUart.mThrDummy;
+	}
+	return &TestUart.mTxFifo[TestUart.mTxNo++];
+}//TestUartThr
+
+//RBR read
+static DWORD TestUartRbr(void)
+{
+	if(!TestUart.mRxNo)
+		return 0;
+	return TestUartFifoGet(TestUart.mRxFifo,&TestUart.mRxNo);
+}//TestUartRbr
+
+//LSR read - RDR (BIT0), THRE (BIT5) and TEMT (BIT6)
+static DWORD TestUartLsr(void)
+{
+	return (TestUart.mRxNo?BIT0:0)|(TestUart.mTxNo?0:BIT5|BIT6);
+}//TestUartLsr
+
+//IIR read - RX data available has priority over THRE
+static DWORD TestUartIir(void)
+{
+	if(TestUart.mRxNo && (TestUart.mIer & BIT0))
+		return BIT2;
+	if(TestUart.mThrePending && (TestUart.mIer & BIT1))
+	{
+		TestUart.mThrePending=FALSE;
+		return BIT1;
+	}
+	return BIT0;//no interrupt pending
+}//TestUartIir
+
+#undef U0THR
+#undef U0RBR
+#undef U0LSR
+#undef U0IIR
+#undef U0IER
+#undef VICVectAddr6
+#undef VICIntEnable
+#undef VICIntEnClr
+#define U0THR			(*TestUartThr())
+#define U0RBR			TestUartRbr()
+#define U0LSR			TestUartLsr()
+#define U0IIR			TestUartIir()
+#define U0IER			TestUart.mIer
+#define VICVectAddr6	TestVicVectAddr6
+#define VICIntEnable	TestVicIntEnable
+#define VICIntEnClr		TestVicIntEnClr
+
+//hw_uart.c functions get Test prefix (the same functions of hw_host.c are used by the rest of Wall-e SW)
+#define InitUart0							TestInitUart0
+#define Uart0IsrHandler						TestUart0IsrHandler
+#define Uart0PutChar						TestUart0PutChar
+#define Uart0PutStr							TestUart0PutStr
+#define Uart0GetChar						TestUart0GetChar
+#define Uart0CheckForCharacterReceived		TestUart0CheckForCharacterReceived
+#define Uart0DebugMessage					TestUart0DebugMessage
+#define Uart0Message						TestUart0Message
+#define Uart0GetTrmlChar					TestUart0GetTrmlChar
+#define Uart0GetTrmlStr						TestUart0GetTrmlStr
+#define Uart0Flush							TestUart0Flush
+#define GetUart0TxOverflows					TestGetUart0TxOverflows
+#define GetUart0RxOverflows					TestGetUart0RxOverflows
+#define GetUart0TxMaxLevel					TestGetUart0TxMaxLevel
+
+#include "../src/hw_uart.c"
+
+BYTE TestUart0TxPolicy(void)
+{
+	return UART0_TX_OVERFLOW_POLICY;
+}//TestUart0TxPolicy
+
+//UART0 interrupt as it is served by OS_CPU_ExceptHndlr - interrupts disabled and ISR nesting counted
+static void TestUartIrq(void)
+{
+	OS_CPU_SR  cpu_sr;
+
+	if(!(TestVicIntEnable & BIT6))
+		return;
+	OS_ENTER_CRITICAL();
+	OSIntNesting++;
+	((void (*)(void))TestVicVectAddr6)();
+	OSIntNesting--;
+	OS_EXIT_CRITICAL();
+}//TestUartIrq
+
+//puts received character into RX FIFO and raises the interrupt (RX trigger level is 1 character)
+static void TestUartRxChar(char ch)
+{
+	OS_CPU_SR  cpu_sr;
+
+	OS_ENTER_CRITICAL();
+	if(TestUart.mRxNo==TEST_UART_FIFO_SIZE)
+		TestUart.mFifoOverruns++;
+	else
+		TestUart.mRxFifo[TestUart.mRxNo++]=ch;
+	OS_EXIT_CRITICAL();
+	TestUartIrq();
+}//TestUartRxChar
+
+void TestUartLine(WORD InTxChars, WORD InRxChars)
+{
+	OS_CPU_SR  cpu_sr;
+	BOOL Empty;
+	BYTE ch;
+
+	while(InTxChars--)
+	{
+		OS_ENTER_CRITICAL();
+		if(!TestUart.mTxNo)
+		{
+			OS_EXIT_CRITICAL();
+			break;
+		}
+		ch=TestUartFifoGet(TestUart.mTxFifo,&TestUart.mTxNo);
+		if(TestUartLineNo<TEST_UART_LINE_SIZE)
+			TestUartLineBuf[TestUartLineNo++]=ch;
+		Empty=!TestUart.mTxNo;
+		if(Empty)
+			TestUart.mThrePending=TRUE;
+		OS_EXIT_CRITICAL();
+		if(Empty)
+			TestUartIrq();//ISR fills TX FIFO from TX buffer
+	}
+	while(InRxChars-- && pTestUartLineRx && *pTestUartLineRx)
+		TestUartRxChar(*pTestUartLineRx++);
+}//TestUartLine
+
+void TestUartLineRx(const char *pInChars)
+{
+	pTestUartLineRx=pInChars;
+}//TestUartLineRx
+
+void TestUartReceive(const char *pInChars, WORD InNo)
+{
+	while(InNo--)
+		TestUartRxChar(*pInChars++);
+}//TestUartReceive
+
+const char *TestUartSent(void)
+{
+	return TestUartLineBuf;
+}//TestUartSent
+
+WORD TestUartSentNo(void)
+{
+	return TestUartLineNo;
+}//TestUartSentNo
+
+void TestUartClearSent(void)
+{
+	TestUartLineNo=0;
+}//TestUartClearSent
+
+BOOL TestUartTxIdle(void)
+{
+	return !TestUart.mTxNo;
+}//TestUartTxIdle
+
+DWORD TestUartFifoOverruns(void)
+{
+	return TestUart.mFifoOverruns;
+}//TestUartFifoOverruns
@@ -0,0 +1,84 @@
+/*
+*********************************************************************************************************
+*                                            LPC 2378
+*
+*                        (c) Copyright 2026, Bogdan Kowalczyk, POLAND
+*                                           All Rights Reserved
+*
+*
+* File:        test_uart_hw.h
+* Description: UART0 driver of hw_uart.c with UART0 registers model used by test_uart (see test_uart_hw.c)
+*              Driver functions have Test prefix so they do not collide with hw_host.c UART0 stubs.
+* Author:      Bogdan Kowalczyk
+* Date:        17-Oct-2026
+* History:
+* 17-Oct-2026 Initial version created
+*********************************************************************************************************
+*/
+
+#ifndef TEST_UART_HW_H_
+#define TEST_UART_HW_H_
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+#include "type.h"
+
+#define TEST_UART_LINE_SIZE		8192 //max number of characters sent out by the line model
+
+//hw_uart.c functions
+extern void TestInitUart0(void);
+extern int TestUart0PutChar(int ch);
+extern void TestUart0PutStr(char *pString);
+extern int TestUart0GetChar(void);
+extern int TestUart0CheckForCharacterReceived(void);
+extern char *TestUart0GetTrmlStr(char* pMsgBuffer, int inLength);
+extern DWORD TestGetUart0TxOverflows(void);
+extern DWORD TestGetUart0RxOverflows(void);
+extern WORD TestGetUart0TxMaxLevel(void);
+
+//UART0_TX_OVERFLOW_POLICY hw_uart.c is built with
+extern BYTE TestUart0TxPolicy(void);
+
+/*
+*********************************************************************************************************
+* Name:                                    TestUartLine
+*
+* Description: Line model - sends out up to InTxChars characters from TX FIFO and receives up to InRxChars
+*              characters given by TestUartLineRx. Raises UART0 interrupt as UART0 does when TX FIFO gets
+*              empty and when a character is received.
+*
+* Arguments:   InTxChars - number of characters which can be sent
+*              InRxChars - number of characters which can be received
+*
+* Returns:     none
+*
+* Note(s):     Called from a task, interrupt is emulated by calling UART0 ISR with interrupts disabled
+* *********************************************************************************************************
+*/
+extern void TestUartLine(WORD InTxChars, WORD InRxChars);
+
+//sets characters received by the next TestUartLine calls
+extern void TestUartLineRx(const char *pInChars);
+
+//receives all characters at once (burst faster than tasks can read)
+extern void TestUartReceive(const char *pInChars, WORD InNo);
+
+//characters sent out by the line model so far and their number
+extern const char *TestUartSent(void);
+extern WORD TestUartSentNo(void);
+
+//clears characters sent out by the line model
+extern void TestUartClearSent(void);
+
+//TRUE when TX FIFO is empty
+extern BOOL TestUartTxIdle(void);
+
+//number of characters written into full TX FIFO or received into full RX FIFO (lost by UART0)
+extern DWORD TestUartFifoOverruns(void);
+
+#ifdef __cplusplus
+}
+#endif //to close extern "C" if used
+
+#endif /*TEST_UART_HW_H_*/